@@ -13,7 +13,7 @@
 #endif
 
 
-#define NX_FFI_ABI_VERSION 10
+#define NX_FFI_ABI_VERSION 26
 
 enum NxEvalStatus
 #ifdef __cplusplus
@@ -41,12 +41,42 @@ enum NxOutputFormat
 typedef uint32_t NxOutputFormat;
 #endif // __cplusplus
 
+/**
+ * Cancellation flag a host trips from any thread to stop the evaluations it was passed to.
+ *
+ * Free the handle only after every call using it has returned.
+ */
+typedef struct NxCancellationHandle NxCancellationHandle;
+
+/**
+ * Entry component resolved once from a program artifact.
+ *
+ * The handle shares ownership of the artifact, so it stays usable after the artifact handle it
+ * was resolved from is freed.
+ */
+typedef struct NxComponentHandle NxComponentHandle;
+
 typedef struct NxLibraryRegistryHandle NxLibraryRegistryHandle;
 
+typedef struct NxOutputArenaHandle NxOutputArenaHandle;
+
+/**
+ * Immutable program artifact built from a workspace, source, or image.
+ *
+ * Evaluation functions may use one handle from multiple threads at the same time; each call
+ * reuses a pooled interpreter owned by the artifact. Free the handle only after every call using
+ * it has returned.
+ */
 typedef struct NxProgramArtifactHandle NxProgramArtifactHandle;
 
 typedef struct NxProgramBuildContextHandle NxProgramBuildContextHandle;
 
+/**
+ * Memory-bounded cache of rendered component output shared by `nx_component_evaluate_cached`
+ * calls. The cache is safe to use from multiple threads at the same time.
+ */
+typedef struct NxRenderCacheHandle NxRenderCacheHandle;
+
 typedef struct NxBuffer {
   uint8_t *ptr;
   size_t len;
@@ -60,6 +90,114 @@ typedef struct NxWorkspaceModule {
   size_t source_utf8_len;
 } NxWorkspaceModule;
 
+/**
+ * Borrowed UTF-8 root directory of one library submitted to `nx_load_libraries_into_registry`.
+ */
+typedef struct NxLibraryRoot {
+  const uint8_t *root_path_ptr;
+  size_t root_path_len;
+} NxLibraryRoot;
+
+/**
+ * Borrowed inputs for one component evaluation submitted to
+ * `nx_component_evaluate_batch_program_artifact`.
+ *
+ * Empty props or state bytes evaluate with an empty record, matching
+ * `nx_component_evaluate_program_artifact`.
+ */
+typedef struct NxComponentEvaluateRequest {
+  const uint8_t *component_name_ptr;
+  size_t component_name_len;
+  const uint8_t *props_ptr;
+  size_t props_len;
+  const uint8_t *state_ptr;
+  size_t state_len;
+} NxComponentEvaluateRequest;
+
+/**
+ * One offset-table entry at the start of a batch output buffer.
+ *
+ * `offset` and `len` locate the entry payload in bytes from the start of the same buffer.
+ * Entries are written in native byte order but the buffer is not guaranteed to be aligned, so
+ * consumers should copy entries out instead of dereferencing them in place.
+ */
+typedef struct NxBatchResultEntry {
+  uint32_t status;
+  uint32_t reserved;
+  uint64_t offset;
+  uint64_t len;
+} NxBatchResultEntry;
+
+/**
+ * Borrowed view of one payload owned by an `NxOutputArenaHandle`.
+ *
+ * The bytes stay valid until the arena is reset or freed. Views must not be passed to
+ * `nx_free_buffer`.
+ */
+typedef struct NxBufferView {
+  const uint8_t *ptr;
+  size_t len;
+} NxBufferView;
+
+/**
+ * Per-call evaluation limits accepted by the `*_with_limits` entry points.
+ *
+ * Zero `max_operations` or `max_recursion_depth` keeps the default limit, and zero
+ * `max_duration_micros` means no deadline. `cancellation` may be null. The deadline and the
+ * cancellation flag are polled every 1024 operations, so an interrupted call returns
+ * shortly after either trips.
+ */
+typedef struct NxEvalLimits {
+  uint64_t max_operations;
+  uint64_t max_recursion_depth;
+  uint64_t max_duration_micros;
+  const struct NxCancellationHandle *cancellation;
+} NxEvalLimits;
+
+/**
+ * Counters reported by `nx_get_render_cache_stats`.
+ */
+typedef struct NxRenderCacheStats {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t entries;
+  uint64_t bytes;
+  uint64_t capacity_bytes;
+} NxRenderCacheStats;
+
+/**
+ * Counters and timings reported by `nx_get_eval_stats` for the calling thread's most recent
+ * evaluation call.
+ */
+typedef struct NxEvalStats {
+  uint64_t evaluations;
+  uint64_t operations;
+  uint64_t peak_call_depth;
+  uint64_t eval_nanos;
+  uint64_t encode_nanos;
+} NxEvalStats;
+
+/**
+ * Host callback that receives one chunk of a payload streamed by the `*_into_callback` entry
+ * points.
+ *
+ * `ptr` and `len` describe bytes that are only valid for the duration of the call. Return `0`
+ * to receive the next chunk or any other value to stop the stream.
+ */
+typedef int32_t (*NxWriteCallback)(void *user_data, const uint8_t *ptr, size_t len);
+
+/**
+ * Module counts and per-phase timings reported by `nx_get_program_artifact_build_stats`.
+ */
+typedef struct NxProgramBuildStats {
+  uint64_t parsed_modules;
+  uint64_t analyzed_modules;
+  uint64_t parse_nanos;
+  uint64_t lower_nanos;
+  uint64_t analyze_nanos;
+  uint64_t link_nanos;
+} NxProgramBuildStats;
+
 #ifdef __cplusplus
 extern "C" {
 #endif // __cplusplus
@@ -100,29 +238,134 @@ NxEvalStatus nx_build_workspace_program_artifact(const struct NxProgramBuildCont
                                                  struct NxProgramArtifactHandle **out_handle,
                                                  struct NxBuffer *out_buffer);
 
+/**
+ * Rebuilds a workspace program artifact after the modules in `modules_ptr` changed.
+ *
+ * Modules not listed keep the source they had in `previous_ptr`, whose entry module is kept as
+ * well. Only modules affected by the change are analyzed again. `previous_ptr` stays valid and
+ * unchanged; the rebuilt artifact is returned as a new handle.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_rebuild_workspace_program_artifact(const struct NxProgramArtifactHandle *previous_ptr,
+                                                   const struct NxProgramBuildContextHandle *build_context_ptr,
+                                                   const struct NxWorkspaceModule *modules_ptr,
+                                                   size_t module_count,
+                                                   struct NxProgramArtifactHandle **out_handle,
+                                                   struct NxBuffer *out_buffer);
+
 NX_FFI_EXPORT NxEvalStatus nx_create_library_registry(struct NxLibraryRegistryHandle **out_handle);
 
 NX_FFI_EXPORT void nx_free_library_registry(struct NxLibraryRegistryHandle *handle);
 
+/**
+ * Sets the directory where `nx_load_library_into_registry` persists analyzed libraries.
+ *
+ * Later loads, including loads from other processes that share the directory, reuse a cached
+ * library while its sources and dependency libraries are unchanged. An empty path disables the
+ * cache.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_set_library_registry_cache_directory(const struct NxLibraryRegistryHandle *registry_ptr,
+                                                     const uint8_t *cache_directory_ptr,
+                                                     size_t cache_directory_len);
+
+/**
+ * Sets how many threads `nx_load_libraries_into_registry` discovers and analyzes libraries on.
+ *
+ * `0` selects the available hardware parallelism, which is the default; `1` loads every library
+ * on the calling thread.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_set_library_registry_load_workers(const struct NxLibraryRegistryHandle *registry_ptr,
+                                                  size_t worker_count);
+
 NX_FFI_EXPORT
 NxEvalStatus nx_load_library_into_registry(const struct NxLibraryRegistryHandle *registry_ptr,
                                            const uint8_t *root_path_ptr,
                                            size_t root_path_len,
                                            struct NxBuffer *out_buffer);
 
+/**
+ * Loads many libraries and their dependency closures into a registry at once.
+ *
+ * Independent libraries are analyzed concurrently. On failure, `out_buffer` receives the
+ * MessagePack diagnostics; libraries that finished loading stay in the registry.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_load_libraries_into_registry(const struct NxLibraryRegistryHandle *registry_ptr,
+                                             const struct NxLibraryRoot *roots_ptr,
+                                             size_t root_count,
+                                             struct NxBuffer *out_buffer);
+
 NX_FFI_EXPORT
 NxEvalStatus nx_create_program_build_context(const struct NxLibraryRegistryHandle *registry_ptr,
                                              struct NxProgramBuildContextHandle **out_handle);
 
+NX_FFI_EXPORT
+NxEvalStatus nx_set_program_build_context_analysis_workers(struct NxProgramBuildContextHandle *build_context_ptr,
+                                                           size_t worker_count);
+
+/**
+ * Limits workspace builds using this context to the entry module's import closure.
+ *
+ * A nonzero `enabled` makes `nx_build_workspace_program_artifact` analyze and keep only the
+ * modules reachable from the entry module through workspace imports; `0` restores the default of
+ * analyzing every submitted module. Do not call this while another thread is building with the
+ * same handle.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_set_program_build_context_entry_closure_pruning(struct NxProgramBuildContextHandle *build_context_ptr,
+                                                                uint32_t enabled);
+
 NX_FFI_EXPORT void nx_free_program_build_context(struct NxProgramBuildContextHandle *handle);
 
 NX_FFI_EXPORT void nx_free_program_artifact(struct NxProgramArtifactHandle *handle);
 
+/**
+ * Serializes a program artifact into a self-contained binary image.
+ *
+ * On success `out_buffer` receives the image bytes, owned by the caller and released with
+ * `nx_free_buffer`. Pass them to `nx_load_program_artifact`, in this or a later process, to
+ * restore the artifact without re-analysis. The artifact handle stays owned by the caller. On
+ * failure the buffer holds MessagePack diagnostics instead.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_serialize_program_artifact(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                           struct NxBuffer *out_buffer);
+
+/**
+ * Restores a program artifact from an image written by `nx_serialize_program_artifact`.
+ *
+ * The image bytes are only read during the call and may be freed afterwards. On success
+ * `*out_handle` receives a new artifact handle, owned by the caller and released with
+ * `nx_free_program_artifact`, and `out_buffer` is empty. Images from another NX version or image
+ * format, and truncated or corrupt images, return `NxEvalStatus_Error` with a null handle and a
+ * MessagePack diagnostic in `out_buffer` that names the mismatch; release it with
+ * `nx_free_buffer`.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_load_program_artifact(const uint8_t *image_ptr,
+                                      size_t image_len,
+                                      struct NxProgramArtifactHandle **out_handle,
+                                      struct NxBuffer *out_buffer);
+
 NX_FFI_EXPORT
 NxEvalStatus nx_eval_program_artifact(const struct NxProgramArtifactHandle *program_artifact_ptr,
                                       uint32_t output_format,
                                       struct NxBuffer *out_buffer);
 
+/**
+ * Evaluates the artifact's `root()` like `nx_eval_program_artifact` under `limits`.
+ *
+ * `limits` may be null for the defaults. A call stopped by its deadline or cancellation handle
+ * returns `NxEvalStatus_Error` with a `deadline-exceeded` or `evaluation-cancelled` diagnostic.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_eval_program_artifact_with_limits(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                  const struct NxEvalLimits *limits_ptr,
+                                                  uint32_t output_format,
+                                                  struct NxBuffer *out_buffer);
+
 NX_FFI_EXPORT
 NxEvalStatus nx_component_init_program_artifact(const struct NxProgramArtifactHandle *program_artifact_ptr,
                                                 const uint8_t *component_name_ptr,
@@ -132,6 +375,20 @@ NxEvalStatus nx_component_init_program_artifact(const struct NxProgramArtifactHa
                                                 uint32_t output_format,
                                                 struct NxBuffer *out_buffer);
 
+/**
+ * Initializes a component like `nx_component_init_program_artifact` under `limits`, which may be
+ * null for the defaults.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_init_program_artifact_with_limits(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                            const uint8_t *component_name_ptr,
+                                                            size_t component_name_len,
+                                                            const uint8_t *props_ptr,
+                                                            size_t props_len,
+                                                            const struct NxEvalLimits *limits_ptr,
+                                                            uint32_t output_format,
+                                                            struct NxBuffer *out_buffer);
+
 /**
  * Evaluates a component from a program artifact using MessagePack props/state inputs.
  *
@@ -149,6 +406,41 @@ NxEvalStatus nx_component_evaluate_program_artifact(const struct NxProgramArtifa
                                                     uint32_t output_format,
                                                     struct NxBuffer *out_buffer);
 
+/**
+ * Evaluates a component like `nx_component_evaluate_program_artifact` under `limits`, which may
+ * be null for the defaults.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_evaluate_program_artifact_with_limits(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                                const uint8_t *component_name_ptr,
+                                                                size_t component_name_len,
+                                                                const uint8_t *props_ptr,
+                                                                size_t props_len,
+                                                                const uint8_t *state_ptr,
+                                                                size_t state_len,
+                                                                const struct NxEvalLimits *limits_ptr,
+                                                                uint32_t output_format,
+                                                                struct NxBuffer *out_buffer);
+
+/**
+ * Evaluates many components from one program artifact in a single native call.
+ *
+ * Each request is evaluated exactly like `nx_component_evaluate_program_artifact`, but all
+ * requests share one interpreter and all outputs are written into one `out_buffer`. The buffer
+ * starts with `request_count` `NxBatchResultEntry` records in request order, followed by the
+ * per-entry payloads: the rendered value on success or diagnostics on failure, in the selected
+ * format. The call returns `NxEvalStatus_Ok` whenever the batch itself ran; inspect each entry
+ * status for per-request results. Every request gets its own budget under `limits`, which may be
+ * null for the defaults, so a request that exceeds it fails alone.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_evaluate_batch_program_artifact(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                          const struct NxComponentEvaluateRequest *requests_ptr,
+                                                          size_t request_count,
+                                                          const struct NxEvalLimits *limits_ptr,
+                                                          uint32_t output_format,
+                                                          struct NxBuffer *out_buffer);
+
 NX_FFI_EXPORT
 NxEvalStatus nx_component_dispatch_actions_program_artifact(const struct NxProgramArtifactHandle *program_artifact_ptr,
                                                             const uint8_t *state_snapshot_ptr,
@@ -158,6 +450,352 @@ NxEvalStatus nx_component_dispatch_actions_program_artifact(const struct NxProgr
                                                             uint32_t output_format,
                                                             struct NxBuffer *out_buffer);
 
+/**
+ * Dispatches actions like `nx_component_dispatch_actions_program_artifact` under `limits`, which
+ * may be null for the defaults. The deadline covers the whole batch of actions.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_dispatch_actions_program_artifact_with_limits(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                                        const uint8_t *state_snapshot_ptr,
+                                                                        size_t state_snapshot_len,
+                                                                        const uint8_t *actions_ptr,
+                                                                        size_t actions_len,
+                                                                        const struct NxEvalLimits *limits_ptr,
+                                                                        uint32_t output_format,
+                                                                        struct NxBuffer *out_buffer);
+
+/**
+ * Computes a compact delta that turns the `previous` component state snapshot into `next`.
+ *
+ * On success, `out_buffer` receives the raw delta bytes. On failure, it receives MessagePack
+ * diagnostics.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_snapshot_delta(const uint8_t *previous_ptr,
+                                         size_t previous_len,
+                                         const uint8_t *next_ptr,
+                                         size_t next_len,
+                                         struct NxBuffer *out_buffer);
+
+/**
+ * Rebuilds the full component state snapshot from the base snapshot a delta was computed
+ * against.
+ *
+ * On success, `out_buffer` receives the raw snapshot bytes. On failure, it receives MessagePack
+ * diagnostics.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_apply_component_snapshot_delta(const uint8_t *base_ptr,
+                                               size_t base_len,
+                                               const uint8_t *delta_ptr,
+                                               size_t delta_len,
+                                               struct NxBuffer *out_buffer);
+
+NX_FFI_EXPORT NxEvalStatus nx_create_cancellation_handle(struct NxCancellationHandle **out_handle);
+
+/**
+ * Cancels every running and future call that was passed `handle` in its `NxEvalLimits`.
+ *
+ * Safe to call from any thread while those calls run. A cancelled handle stays cancelled; create
+ * a new handle for the next request.
+ */
+NX_FFI_EXPORT void nx_cancel(const struct NxCancellationHandle *handle);
+
+NX_FFI_EXPORT void nx_free_cancellation_handle(struct NxCancellationHandle *handle);
+
+NX_FFI_EXPORT NxEvalStatus nx_create_output_arena(struct NxOutputArenaHandle **out_handle);
+
+/**
+ * Invalidates every view produced by the arena while keeping its largest chunk for reuse.
+ */
+NX_FFI_EXPORT void nx_reset_output_arena(struct NxOutputArenaHandle *handle);
+
+NX_FFI_EXPORT void nx_free_output_arena(struct NxOutputArenaHandle *handle);
+
+/**
+ * Arena variant of `nx_eval_program_artifact_with_limits`.
+ *
+ * The payload is appended to `arena` and described by `out_view`; it stays valid until the arena
+ * is reset or freed. One arena must not be used by multiple threads at the same time.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_eval_program_artifact_into_arena(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                 const struct NxEvalLimits *limits_ptr,
+                                                 uint32_t output_format,
+                                                 struct NxOutputArenaHandle *arena_ptr,
+                                                 struct NxBufferView *out_view);
+
+/**
+ * Arena variant of `nx_component_init_program_artifact_with_limits`.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_init_program_artifact_into_arena(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                           const uint8_t *component_name_ptr,
+                                                           size_t component_name_len,
+                                                           const uint8_t *props_ptr,
+                                                           size_t props_len,
+                                                           const struct NxEvalLimits *limits_ptr,
+                                                           uint32_t output_format,
+                                                           struct NxOutputArenaHandle *arena_ptr,
+                                                           struct NxBufferView *out_view);
+
+/**
+ * Arena variant of `nx_component_evaluate_program_artifact_with_limits`.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_evaluate_program_artifact_into_arena(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                               const uint8_t *component_name_ptr,
+                                                               size_t component_name_len,
+                                                               const uint8_t *props_ptr,
+                                                               size_t props_len,
+                                                               const uint8_t *state_ptr,
+                                                               size_t state_len,
+                                                               const struct NxEvalLimits *limits_ptr,
+                                                               uint32_t output_format,
+                                                               struct NxOutputArenaHandle *arena_ptr,
+                                                               struct NxBufferView *out_view);
+
+/**
+ * Arena variant of `nx_component_dispatch_actions_program_artifact_with_limits`.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_dispatch_actions_program_artifact_into_arena(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                                       const uint8_t *state_snapshot_ptr,
+                                                                       size_t state_snapshot_len,
+                                                                       const uint8_t *actions_ptr,
+                                                                       size_t actions_len,
+                                                                       const struct NxEvalLimits *limits_ptr,
+                                                                       uint32_t output_format,
+                                                                       struct NxOutputArenaHandle *arena_ptr,
+                                                                       struct NxBufferView *out_view);
+
+/**
+ * Streaming variant of `nx_eval_program_artifact_with_limits`.
+ *
+ * A successful payload is passed to `write` in chunks as it is encoded, together with
+ * `user_data`, instead of being collected into `out_buffer`; `out_buffer` stays empty. On
+ * `NxEvalStatus_Error`, diagnostics are returned in `out_buffer` and nothing is streamed unless
+ * encoding or `write` failed after earlier chunks were delivered, in which case the host must
+ * discard them.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_eval_program_artifact_into_callback(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                    const struct NxEvalLimits *limits_ptr,
+                                                    uint32_t output_format,
+                                                    NxWriteCallback write,
+                                                    void *user_data,
+                                                    struct NxBuffer *out_buffer);
+
+/**
+ * Streaming variant of `nx_component_init_program_artifact_with_limits`.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_init_program_artifact_into_callback(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                              const uint8_t *component_name_ptr,
+                                                              size_t component_name_len,
+                                                              const uint8_t *props_ptr,
+                                                              size_t props_len,
+                                                              const struct NxEvalLimits *limits_ptr,
+                                                              uint32_t output_format,
+                                                              NxWriteCallback write,
+                                                              void *user_data,
+                                                              struct NxBuffer *out_buffer);
+
+/**
+ * Streaming variant of `nx_component_evaluate_program_artifact_with_limits`.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_evaluate_program_artifact_into_callback(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                                  const uint8_t *component_name_ptr,
+                                                                  size_t component_name_len,
+                                                                  const uint8_t *props_ptr,
+                                                                  size_t props_len,
+                                                                  const uint8_t *state_ptr,
+                                                                  size_t state_len,
+                                                                  const struct NxEvalLimits *limits_ptr,
+                                                                  uint32_t output_format,
+                                                                  NxWriteCallback write,
+                                                                  void *user_data,
+                                                                  struct NxBuffer *out_buffer);
+
+/**
+ * Streaming variant of `nx_component_dispatch_actions_program_artifact_with_limits`.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_dispatch_actions_program_artifact_into_callback(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                                          const uint8_t *state_snapshot_ptr,
+                                                                          size_t state_snapshot_len,
+                                                                          const uint8_t *actions_ptr,
+                                                                          size_t actions_len,
+                                                                          const struct NxEvalLimits *limits_ptr,
+                                                                          uint32_t output_format,
+                                                                          NxWriteCallback write,
+                                                                          void *user_data,
+                                                                          struct NxBuffer *out_buffer);
+
+/**
+ * Resolves a named entry component once so repeated init/evaluate calls skip name resolution.
+ *
+ * On failure, diagnostics are serialized as MessagePack into `out_buffer` and
+ * `NxEvalStatus_Error` is returned.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_resolve_component_program_artifact(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                   const uint8_t *component_name_ptr,
+                                                   size_t component_name_len,
+                                                   struct NxComponentHandle **out_handle,
+                                                   struct NxBuffer *out_buffer);
+
+NX_FFI_EXPORT void nx_free_component(struct NxComponentHandle *handle);
+
+/**
+ * Resolved-handle variant of `nx_component_init_program_artifact_with_limits`; `limits` may be
+ * null for the defaults.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_init(const struct NxComponentHandle *component_ptr,
+                               const uint8_t *props_ptr,
+                               size_t props_len,
+                               const struct NxEvalLimits *limits_ptr,
+                               uint32_t output_format,
+                               struct NxBuffer *out_buffer);
+
+/**
+ * Resolved-handle variant of `nx_component_evaluate_program_artifact_with_limits`; `limits` may
+ * be null for the defaults.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_evaluate(const struct NxComponentHandle *component_ptr,
+                                   const uint8_t *props_ptr,
+                                   size_t props_len,
+                                   const uint8_t *state_ptr,
+                                   size_t state_len,
+                                   const struct NxEvalLimits *limits_ptr,
+                                   uint32_t output_format,
+                                   struct NxBuffer *out_buffer);
+
+/**
+ * Arena variant of `nx_component_evaluate`.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_evaluate_into_arena(const struct NxComponentHandle *component_ptr,
+                                              const uint8_t *props_ptr,
+                                              size_t props_len,
+                                              const uint8_t *state_ptr,
+                                              size_t state_len,
+                                              const struct NxEvalLimits *limits_ptr,
+                                              uint32_t output_format,
+                                              struct NxOutputArenaHandle *arena_ptr,
+                                              struct NxBufferView *out_view);
+
+/**
+ * Streaming variant of `nx_component_evaluate`.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_evaluate_into_callback(const struct NxComponentHandle *component_ptr,
+                                                 const uint8_t *props_ptr,
+                                                 size_t props_len,
+                                                 const uint8_t *state_ptr,
+                                                 size_t state_len,
+                                                 const struct NxEvalLimits *limits_ptr,
+                                                 uint32_t output_format,
+                                                 NxWriteCallback write,
+                                                 void *user_data,
+                                                 struct NxBuffer *out_buffer);
+
+/**
+ * Creates an empty render cache for `nx_component_evaluate_cached`.
+ *
+ * The cache retains at most roughly `capacity_bytes` of cache keys and rendered values and evicts
+ * the least recently used entries once an insertion exceeds that bound. One cache can be shared
+ * by any number of components, programs, and threads. On success `*out_handle` receives a handle
+ * the caller owns and must release with `nx_free_render_cache`; on failure it is set to null.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_create_render_cache(uint64_t capacity_bytes,
+                                    struct NxRenderCacheHandle **out_handle);
+
+/**
+ * Memoizes calls to functions declared as the UTF-8 name `name_ptr`/`name_len` in evaluations
+ * that use this cache.
+ *
+ * Meant for element functions that many components call with the same arguments. Calls are keyed
+ * by the defining module and the MessagePack encoding of the arguments, and every cache hit still
+ * counts the operations and call depth the call used against the evaluation's limits. Calls
+ * passing or returning action handlers are never memoized. The name stays registered when the
+ * cache is cleared.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_memoize_render_cache_function(const struct NxRenderCacheHandle *handle,
+                                              const uint8_t *name_ptr,
+                                              size_t name_len);
+
+/**
+ * Drops every cached rendered value and resets the hit/miss counters.
+ */
+NX_FFI_EXPORT void nx_clear_render_cache(const struct NxRenderCacheHandle *handle);
+
+/**
+ * Writes the cache's hit and miss counts, entry count, retained bytes, and capacity to
+ * `out_stats`.
+ *
+ * Counters accumulate until `nx_clear_render_cache` resets them.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_get_render_cache_stats(const struct NxRenderCacheHandle *handle,
+                                       struct NxRenderCacheStats *out_stats);
+
+/**
+ * Releases a render cache created by `nx_create_render_cache` together with every cached value.
+ *
+ * Passing null is a no-op. The handle must not be used by any thread after this call.
+ */
+NX_FFI_EXPORT void nx_free_render_cache(struct NxRenderCacheHandle *handle);
+
+/**
+ * Turns evaluation statistics collection on (nonzero) or off (`0`) for every thread.
+ *
+ * Collection is off by default and adds two clock reads per evaluation and per encoded payload
+ * while enabled.
+ */
+NX_FFI_EXPORT void nx_set_eval_stats_enabled(uint32_t enabled);
+
+/**
+ * Reports statistics for the most recent evaluation call made on the calling thread.
+ *
+ * Evaluation calls are `nx_eval_source` and the entry points that initialize, evaluate, or
+ * dispatch components. Every counter is zero while collection is disabled.
+ */
+NX_FFI_EXPORT NxEvalStatus nx_get_eval_stats(struct NxEvalStats *out_stats);
+
+/**
+ * Reports the module counts and per-phase timings recorded while building a program artifact.
+ *
+ * Per-module phases are summed across analysis workers. Artifacts loaded with
+ * `nx_load_program_artifact` only report `link_nanos`.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_get_program_artifact_build_stats(const struct NxProgramArtifactHandle *program_artifact_ptr,
+                                                 struct NxProgramBuildStats *out_stats);
+
+/**
+ * Variant of `nx_component_evaluate` that memoizes rendered output in `cache`.
+ *
+ * Evaluations of the same component with byte-identical props and state are answered from the
+ * cache without decoding the inputs or rendering. Only successful renders are cached. Cache misses
+ * render under `limits`, which may be null for the defaults.
+ */
+NX_FFI_EXPORT
+NxEvalStatus nx_component_evaluate_cached(const struct NxComponentHandle *component_ptr,
+                                          const uint8_t *props_ptr,
+                                          size_t props_len,
+                                          const uint8_t *state_ptr,
+                                          size_t state_len,
+                                          const struct NxRenderCacheHandle *cache_ptr,
+                                          const struct NxEvalLimits *limits_ptr,
+                                          uint32_t output_format,
+                                          struct NxBuffer *out_buffer);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -0,0 +1,33 @@
+// Copyright (c) Bret Johnson. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace NxLang.Nx.Interop;
+
+internal sealed class NxCancellationSafeHandle : SafeHandle
+{
+    internal NxCancellationSafeHandle()
+        : base(IntPtr.Zero, ownsHandle: true)
+    {
+    }
+
+    internal NxCancellationSafeHandle(IntPtr handle)
+        : this()
+    {
+        SetHandle(handle);
+    }
+
+    public override bool IsInvalid => handle == IntPtr.Zero;
+
+    protected override bool ReleaseHandle()
+    {
+        if (!IsInvalid)
+        {
+            NxNativeMethods.nx_free_cancellation_handle(handle);
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,16 @@
+// Copyright (c) Bret Johnson. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace NxLang.Nx.Interop;
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NxEvalLimits
+{
+    public ulong MaxOperations;
+    public ulong MaxRecursionDepth;
+    public ulong MaxDurationMicros;
+    public IntPtr Cancellation;
+}
@@ -0,0 +1,62 @@
+// Copyright (c) Bret Johnson. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Threading;
+
+namespace NxLang.Nx.Interop;
+
+/// <summary>
+/// Builds the native <see cref="NxEvalLimits"/> for one call from a managed timeout and cancellation token, and
+/// keeps the native cancellation handle alive and wired to the token until the call returns.
+/// </summary>
+internal sealed class NxEvalLimitsScope : IDisposable
+{
+    private readonly NxCancellationSafeHandle? _cancellation;
+    private readonly CancellationTokenRegistration _registration;
+
+    internal NxEvalLimitsScope(TimeSpan? timeout, CancellationToken cancellationToken)
+    {
+        if (timeout is { } duration && duration <= TimeSpan.Zero)
+        {
+            throw new ArgumentOutOfRangeException(nameof(timeout), duration, "Timeout must be positive.");
+        }
+
+        cancellationToken.ThrowIfCancellationRequested();
+        NxNativeLibrary.EnsureLoaded();
+
+        if (cancellationToken.CanBeCanceled)
+        {
+            _cancellation = CreateCancellationHandle();
+            _registration = cancellationToken.Register(
+                static state => NxNativeMethods.nx_cancel((NxCancellationSafeHandle)state!),
+                _cancellation);
+        }
+
+        Limits = new NxEvalLimits
+        {
+            MaxDurationMicros = timeout is { } limit ? Math.Max(1UL, (ulong)(limit.Ticks / 10)) : 0,
+            Cancellation = _cancellation?.DangerousGetHandle() ?? IntPtr.Zero,
+        };
+    }
+
+    internal NxEvalLimits Limits { get; }
+
+    public void Dispose()
+    {
+        // Unregister first so a late cancellation never touches a freed native handle.
+        _registration.Dispose();
+        _cancellation?.Dispose();
+    }
+
+    private static NxCancellationSafeHandle CreateCancellationHandle()
+    {
+        NxEvalStatus status = NxNativeMethods.nx_create_cancellation_handle(out IntPtr handle);
+        if (status != NxEvalStatus.Ok || handle == IntPtr.Zero)
+        {
+            throw NxRuntime.CreateInteropStatusException(status);
+        }
+
+        return new NxCancellationSafeHandle(handle);
+    }
+}
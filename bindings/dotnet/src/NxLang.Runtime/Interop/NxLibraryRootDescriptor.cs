@@ -0,0 +1,14 @@
+// Copyright (c) Bret Johnson. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace NxLang.Nx.Interop;
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct NxLibraryRootDescriptor
+{
+    internal IntPtr RootPathPtr;
+    internal nuint RootPathLen;
+}
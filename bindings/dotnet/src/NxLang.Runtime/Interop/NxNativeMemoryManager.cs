@@ -0,0 +1,47 @@
+// Copyright (c) Bret Johnson. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Buffers;
+
+namespace NxLang.Nx.Interop;
+
+/// <summary>
+/// Exposes a native NX output buffer as <see cref="Memory{T}"/> so it can be decoded without copying it to the
+/// managed heap.
+/// </summary>
+/// <remarks>
+/// The memory is owned by the native runtime and is only valid until its arena is reset or its buffer is freed;
+/// callers must finish reading before releasing it.
+/// </remarks>
+internal sealed unsafe class NxNativeMemoryManager : MemoryManager<byte>
+{
+    private readonly byte* _pointer;
+    private readonly int _length;
+
+    public NxNativeMemoryManager(IntPtr pointer, int length)
+    {
+        _pointer = (byte*)pointer;
+        _length = length;
+    }
+
+    public override Span<byte> GetSpan()
+    {
+        return new Span<byte>(_pointer, _length);
+    }
+
+    public override MemoryHandle Pin(int elementIndex = 0)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(elementIndex);
+        ArgumentOutOfRangeException.ThrowIfGreaterThan(elementIndex, _length);
+        return new MemoryHandle(_pointer + elementIndex);
+    }
+
+    public override void Unpin()
+    {
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+    }
+}
@@ -49,9 +49,30 @@ internal static class NxNativeMethods
         out IntPtr outHandle,
         out NxBuffer outBuffer);
 
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_rebuild_workspace_program_artifact(
+        NxProgramArtifactSafeHandle previousPtr,
+        NxProgramBuildContextSafeHandle buildContextPtr,
+        IntPtr modulesPtr,
+        nuint moduleCount,
+        out IntPtr outHandle,
+        out NxBuffer outBuffer);
+
     [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
     internal static extern void nx_free_program_artifact(IntPtr handle);
 
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_serialize_program_artifact(
+        NxProgramArtifactSafeHandle programArtifactPtr,
+        out NxBuffer outBuffer);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_load_program_artifact(
+        byte[] imagePtr,
+        nuint imageLen,
+        out IntPtr outHandle,
+        out NxBuffer outBuffer);
+
     [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
     internal static extern NxEvalStatus nx_create_library_registry(out IntPtr outHandle);
 
@@ -65,6 +86,24 @@ internal static class NxNativeMethods
         nuint rootPathLen,
         out NxBuffer outBuffer);
 
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_load_libraries_into_registry(
+        NxLibraryRegistrySafeHandle registryPtr,
+        IntPtr rootsPtr,
+        nuint rootCount,
+        out NxBuffer outBuffer);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_set_library_registry_cache_directory(
+        NxLibraryRegistrySafeHandle registryPtr,
+        byte[]? cacheDirectoryPtr,
+        nuint cacheDirectoryLen);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_set_library_registry_load_workers(
+        NxLibraryRegistrySafeHandle registryPtr,
+        nuint workerCount);
+
     [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
     internal static extern NxEvalStatus nx_create_program_build_context(
         NxLibraryRegistrySafeHandle registryPtr,
@@ -73,12 +112,29 @@ internal static class NxNativeMethods
     [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
     internal static extern void nx_free_program_build_context(IntPtr handle);
 
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_set_program_build_context_analysis_workers(
+        NxProgramBuildContextSafeHandle buildContextPtr,
+        nuint workerCount);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_set_program_build_context_entry_closure_pruning(
+        NxProgramBuildContextSafeHandle buildContextPtr,
+        uint enabled);
+
     [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
     internal static extern NxEvalStatus nx_eval_program_artifact(
         NxProgramArtifactSafeHandle programArtifactPtr,
         global::NxLang.Nx.NxOutputFormat outputFormat,
         out NxBuffer outBuffer);
 
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_eval_program_artifact_with_limits(
+        NxProgramArtifactSafeHandle programArtifactPtr,
+        in NxEvalLimits limits,
+        global::NxLang.Nx.NxOutputFormat outputFormat,
+        out NxBuffer outBuffer);
+
     [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
     internal static extern NxEvalStatus nx_component_init_program_artifact(
         NxProgramArtifactSafeHandle programArtifactPtr,
@@ -111,6 +167,110 @@ internal static class NxNativeMethods
         global::NxLang.Nx.NxOutputFormat outputFormat,
         out NxBuffer outBuffer);
 
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_component_snapshot_delta(
+        byte[] previousPtr,
+        nuint previousLen,
+        byte[] nextPtr,
+        nuint nextLen,
+        out NxBuffer outBuffer);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_apply_component_snapshot_delta(
+        byte[] basePtr,
+        nuint baseLen,
+        byte[] deltaPtr,
+        nuint deltaLen,
+        out NxBuffer outBuffer);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_create_cancellation_handle(out IntPtr outHandle);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern void nx_cancel(NxCancellationSafeHandle handle);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern void nx_free_cancellation_handle(IntPtr handle);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_create_output_arena(out IntPtr outHandle);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern void nx_reset_output_arena(NxOutputArenaSafeHandle handle);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern void nx_free_output_arena(IntPtr handle);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_eval_program_artifact_into_arena(
+        NxProgramArtifactSafeHandle programArtifactPtr,
+        in NxEvalLimits limits,
+        global::NxLang.Nx.NxOutputFormat outputFormat,
+        NxOutputArenaSafeHandle arenaPtr,
+        out NxBufferView outView);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_component_init_program_artifact_into_arena(
+        NxProgramArtifactSafeHandle programArtifactPtr,
+        byte[] componentNamePtr,
+        nuint componentNameLen,
+        byte[] propsPtr,
+        nuint propsLen,
+        in NxEvalLimits limits,
+        global::NxLang.Nx.NxOutputFormat outputFormat,
+        NxOutputArenaSafeHandle arenaPtr,
+        out NxBufferView outView);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_component_evaluate_program_artifact_into_arena(
+        NxProgramArtifactSafeHandle programArtifactPtr,
+        byte[] componentNamePtr,
+        nuint componentNameLen,
+        byte[] propsPtr,
+        nuint propsLen,
+        byte[] statePtr,
+        nuint stateLen,
+        in NxEvalLimits limits,
+        global::NxLang.Nx.NxOutputFormat outputFormat,
+        NxOutputArenaSafeHandle arenaPtr,
+        out NxBufferView outView);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_component_dispatch_actions_program_artifact_into_arena(
+        NxProgramArtifactSafeHandle programArtifactPtr,
+        byte[] stateSnapshotPtr,
+        nuint stateSnapshotLen,
+        byte[] actionsPtr,
+        nuint actionsLen,
+        in NxEvalLimits limits,
+        global::NxLang.Nx.NxOutputFormat outputFormat,
+        NxOutputArenaSafeHandle arenaPtr,
+        out NxBufferView outView);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_eval_program_artifact_into_callback(
+        NxProgramArtifactSafeHandle programArtifactPtr,
+        in NxEvalLimits limits,
+        global::NxLang.Nx.NxOutputFormat outputFormat,
+        NxWriteCallback write,
+        IntPtr userData,
+        out NxBuffer outBuffer);
+
+    [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+    internal static extern NxEvalStatus nx_component_evaluate_program_artifact_into_callback(
+        NxProgramArtifactSafeHandle programArtifactPtr,
+        byte[] componentNamePtr,
+        nuint componentNameLen,
+        byte[] propsPtr,
+        nuint propsLen,
+        byte[] statePtr,
+        nuint stateLen,
+        in NxEvalLimits limits,
+        global::NxLang.Nx.NxOutputFormat outputFormat,
+        NxWriteCallback write,
+        IntPtr userData,
+        out NxBuffer outBuffer);
+
     [DllImport(LibraryName, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
     internal static extern void nx_free_buffer(NxBuffer buffer);
 }
@@ -0,0 +1,63 @@
+// Copyright (c) Bret Johnson. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.IO;
+using System.Runtime.ExceptionServices;
+using System.Runtime.InteropServices;
+
+namespace NxLang.Nx.Interop;
+
+[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+internal delegate int NxWriteCallback(IntPtr userData, IntPtr ptr, nuint len);
+
+/// <summary>
+/// Copies chunks streamed by the native <c>*_into_callback</c> entry points into a <see cref="Stream"/>.
+/// </summary>
+/// <remarks>
+/// An exception thrown by the stream stops the native stream and is rethrown by <see cref="ThrowIfFailed"/>
+/// once the native call has returned.
+/// </remarks>
+internal sealed class NxStreamOutputSink
+{
+    private readonly Stream _destination;
+    private byte[] _chunk = Array.Empty<byte>();
+    private ExceptionDispatchInfo? _failure;
+
+    internal NxStreamOutputSink(Stream destination)
+    {
+        _destination = destination;
+        Callback = Write;
+    }
+
+    /// <summary>
+    /// Gets the delegate passed to native code; callers keep the sink alive for the duration of the call.
+    /// </summary>
+    internal NxWriteCallback Callback { get; }
+
+    internal void ThrowIfFailed()
+    {
+        _failure?.Throw();
+    }
+
+    private int Write(IntPtr userData, IntPtr ptr, nuint len)
+    {
+        try
+        {
+            int length = checked((int)len);
+            if (_chunk.Length < length)
+            {
+                _chunk = new byte[length];
+            }
+
+            Marshal.Copy(ptr, _chunk, 0, length);
+            _destination.Write(_chunk, 0, length);
+            return 0;
+        }
+        catch (Exception e)
+        {
+            _failure = ExceptionDispatchInfo.Capture(e);
+            return 1;
+        }
+    }
+}
@@ -2,7 +2,9 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 using System;
+using System.Collections.Generic;
 using System.IO;
+using System.Runtime.InteropServices;
 using System.Text;
 using NxLang.Nx.Interop;
 
@@ -32,6 +34,61 @@ public sealed class NxLibraryRegistry : IDisposable
         };
     }
 
+    /// <summary>
+    /// Sets the directory where loaded libraries are persisted across processes.
+    /// </summary>
+    /// <param name="cacheDirectory">
+    /// The cache directory, or <see langword="null"/> to disable the persistent cache.
+    /// </param>
+    /// <remarks>
+    /// Later loads reuse a cached library while its sources and dependency libraries are unchanged.
+    /// </remarks>
+    /// <exception cref="ArgumentException">Thrown when <paramref name="cacheDirectory"/> is empty or whitespace.</exception>
+    /// <exception cref="InvalidOperationException">Thrown when the native runtime rejects the directory.</exception>
+    public void SetCacheDirectory(string? cacheDirectory)
+    {
+        if (cacheDirectory is not null && string.IsNullOrWhiteSpace(cacheDirectory))
+        {
+            throw new ArgumentException("Library cache directory cannot be empty.", nameof(cacheDirectory));
+        }
+
+        NxNativeLibrary.EnsureLoaded();
+
+        byte[]? cacheDirectoryBytes = cacheDirectory is null
+            ? null
+            : Encoding.UTF8.GetBytes(Path.GetFullPath(cacheDirectory));
+        NxEvalStatus status = NxNativeMethods.nx_set_library_registry_cache_directory(
+            SafeHandle,
+            cacheDirectoryBytes,
+            (nuint)(cacheDirectoryBytes?.Length ?? 0));
+        if (status != NxEvalStatus.Ok)
+        {
+            throw NxRuntime.CreateInteropStatusException(status);
+        }
+    }
+
+    /// <summary>
+    /// Sets how many threads <see cref="LoadFromDirectories"/> discovers and analyzes libraries on.
+    /// </summary>
+    /// <param name="workerCount">
+    /// The worker count, or <c>0</c> to use the available hardware parallelism (the default).
+    /// </param>
+    /// <exception cref="ArgumentOutOfRangeException">Thrown when <paramref name="workerCount"/> is negative.</exception>
+    public void SetLoadWorkers(int workerCount)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(workerCount);
+
+        NxNativeLibrary.EnsureLoaded();
+
+        NxEvalStatus status = NxNativeMethods.nx_set_library_registry_load_workers(
+            SafeHandle,
+            (nuint)workerCount);
+        if (status != NxEvalStatus.Ok)
+        {
+            throw NxRuntime.CreateInteropStatusException(status);
+        }
+    }
+
     /// <summary>
     /// Loads and analyzes a local NX library root into this registry.
     /// </summary>
@@ -71,6 +128,89 @@ public sealed class NxLibraryRegistry : IDisposable
         }
     }
 
+    /// <summary>
+    /// Loads and analyzes several local NX library roots into this registry in one native call.
+    /// </summary>
+    /// <param name="rootPaths">The directories containing the NX library roots.</param>
+    /// <remarks>
+    /// Dependency libraries are loaded as well, and libraries whose dependencies are already loaded
+    /// are analyzed concurrently. Libraries that finished loading stay in the registry when another
+    /// root fails.
+    /// </remarks>
+    /// <exception cref="ArgumentNullException">Thrown when <paramref name="rootPaths"/> or one of its paths is null.</exception>
+    /// <exception cref="ArgumentException">Thrown when one of the paths is empty or whitespace.</exception>
+    /// <exception cref="NxEvaluationException">Thrown when loading the libraries reports NX diagnostics.</exception>
+    /// <exception cref="InvalidOperationException">Thrown when the native runtime cannot load the libraries.</exception>
+    public void LoadFromDirectories(IEnumerable<string> rootPaths)
+    {
+        ArgumentNullException.ThrowIfNull(rootPaths);
+
+        List<byte[]> rootPathBytes = new();
+        foreach (string rootPath in rootPaths)
+        {
+            ArgumentNullException.ThrowIfNull(rootPath, nameof(rootPaths));
+            if (string.IsNullOrWhiteSpace(rootPath))
+            {
+                throw new ArgumentException("Library root path cannot be empty.", nameof(rootPaths));
+            }
+
+            rootPathBytes.Add(Encoding.UTF8.GetBytes(Path.GetFullPath(rootPath)));
+        }
+
+        NxNativeLibrary.EnsureLoaded();
+
+        NxLibraryRootDescriptor[] descriptors = new NxLibraryRootDescriptor[rootPathBytes.Count];
+        GCHandle[] pathHandles = new GCHandle[rootPathBytes.Count];
+        GCHandle descriptorHandle = default;
+        NxEvalStatus status;
+        NxBuffer buffer;
+        try
+        {
+            for (int index = 0; index < rootPathBytes.Count; index++)
+            {
+                pathHandles[index] = GCHandle.Alloc(rootPathBytes[index], GCHandleType.Pinned);
+                descriptors[index] = new NxLibraryRootDescriptor
+                {
+                    RootPathPtr = pathHandles[index].AddrOfPinnedObject(),
+                    RootPathLen = (nuint)rootPathBytes[index].Length,
+                };
+            }
+
+            descriptorHandle = GCHandle.Alloc(descriptors, GCHandleType.Pinned);
+            status = NxNativeMethods.nx_load_libraries_into_registry(
+                SafeHandle,
+                descriptors.Length == 0 ? IntPtr.Zero : descriptorHandle.AddrOfPinnedObject(),
+                (nuint)descriptors.Length,
+                out buffer);
+        }
+        finally
+        {
+            if (descriptorHandle.IsAllocated)
+            {
+                descriptorHandle.Free();
+            }
+
+            foreach (GCHandle pathHandle in pathHandles)
+            {
+                if (pathHandle.IsAllocated)
+                {
+                    pathHandle.Free();
+                }
+            }
+        }
+
+        byte[] payload = NxRuntime.CopyAndFreeBuffer(buffer);
+        switch (status)
+        {
+            case NxEvalStatus.Ok:
+                return;
+            case NxEvalStatus.Error:
+                throw NxRuntime.CreateEvaluationExceptionFromMessagePack(payload);
+            default:
+                throw NxRuntime.CreateInteropStatusException(status);
+        }
+    }
+
     /// <summary>
     /// Creates a reusable program build context backed by this registry.
     /// </summary>
@@ -164,6 +164,125 @@ public sealed class NxProgramArtifact : IDisposable
         }
     }
 
+    /// <summary>
+    /// Rebuilds this workspace program artifact after some of its modules changed.
+    /// </summary>
+    /// <param name="changedModules">The new or edited modules; other modules keep their previous source.</param>
+    /// <param name="buildContext">The registry-backed build context used to resolve imported libraries.</param>
+    /// <returns>A new disposable program artifact handle; this artifact stays usable.</returns>
+    /// <remarks>
+    /// Modules whose source, workspace imports, and library imports are unchanged reuse their previous
+    /// analysis, so the rebuild cost follows the size of the edit.
+    /// </remarks>
+    /// <exception cref="ArgumentNullException">Thrown when an argument is null.</exception>
+    /// <exception cref="NxEvaluationException">Thrown when the rebuilt program reports NX diagnostics.</exception>
+    /// <exception cref="InvalidOperationException">Thrown when the native runtime cannot rebuild the program.</exception>
+    public NxProgramArtifact Rebuild(NxWorkspace changedModules, NxProgramBuildContext buildContext)
+    {
+        ArgumentNullException.ThrowIfNull(changedModules);
+        ArgumentNullException.ThrowIfNull(buildContext);
+
+        IntPtr handle = IntPtr.Zero;
+
+        try
+        {
+            using NxWorkspaceDescriptorScope descriptors = new(changedModules);
+            NxEvalStatus status = NxNativeMethods.nx_rebuild_workspace_program_artifact(
+                SafeHandle,
+                buildContext.SafeHandle,
+                descriptors.Pointer,
+                descriptors.Count,
+                out handle,
+                out NxBuffer buffer);
+
+            byte[] payload = NxRuntime.CopyAndFreeBuffer(buffer);
+
+            return status switch
+            {
+                NxEvalStatus.Ok when handle != IntPtr.Zero => new NxProgramArtifact(handle, FileName),
+                NxEvalStatus.Ok => throw new InvalidOperationException(
+                    "NX native runtime returned success without a program artifact handle."),
+                NxEvalStatus.Error => throw NxRuntime.CreateEvaluationExceptionFromMessagePack(payload),
+                _ => throw NxRuntime.CreateInteropStatusException(status),
+            };
+        }
+        catch
+        {
+            if (handle != IntPtr.Zero)
+            {
+                NxNativeMethods.nx_free_program_artifact(handle);
+            }
+
+            throw;
+        }
+    }
+
+    /// <summary>
+    /// Restores a program artifact from an image produced by <see cref="Serialize"/>.
+    /// </summary>
+    /// <param name="image">The program artifact image bytes.</param>
+    /// <param name="fileName">Optional file name identity reported by <see cref="FileName"/>.</param>
+    /// <returns>A disposable program artifact handle.</returns>
+    /// <exception cref="ArgumentNullException">Thrown when <paramref name="image"/> is null.</exception>
+    /// <exception cref="NxEvaluationException">Thrown when the image is invalid or was written by another NX version.</exception>
+    /// <exception cref="InvalidOperationException">Thrown when the native runtime cannot load the image.</exception>
+    public static NxProgramArtifact Load(byte[] image, string? fileName = null)
+    {
+        ArgumentNullException.ThrowIfNull(image);
+
+        NxNativeLibrary.EnsureLoaded();
+
+        IntPtr handle = IntPtr.Zero;
+
+        try
+        {
+            NxEvalStatus status = NxNativeMethods.nx_load_program_artifact(
+                image,
+                (nuint)image.Length,
+                out handle,
+                out NxBuffer buffer);
+
+            byte[] payload = NxRuntime.CopyAndFreeBuffer(buffer);
+            string normalizedFileName = string.IsNullOrEmpty(fileName) ? "input.nx" : fileName;
+
+            return status switch
+            {
+                NxEvalStatus.Ok when handle != IntPtr.Zero => new NxProgramArtifact(handle, normalizedFileName),
+                NxEvalStatus.Ok => throw new InvalidOperationException(
+                    "NX native runtime returned success without a program artifact handle."),
+                NxEvalStatus.Error => throw NxRuntime.CreateEvaluationExceptionFromMessagePack(payload),
+                _ => throw NxRuntime.CreateInteropStatusException(status),
+            };
+        }
+        catch
+        {
+            if (handle != IntPtr.Zero)
+            {
+                NxNativeMethods.nx_free_program_artifact(handle);
+            }
+
+            throw;
+        }
+    }
+
+    /// <summary>
+    /// Serializes this program artifact into a self-contained image for <see cref="Load"/>.
+    /// </summary>
+    /// <returns>The image bytes.</returns>
+    /// <exception cref="NxEvaluationException">Thrown when the native runtime reports a serialization failure.</exception>
+    public byte[] Serialize()
+    {
+        NxEvalStatus status = NxNativeMethods.nx_serialize_program_artifact(SafeHandle, out NxBuffer buffer);
+        byte[] payload = NxRuntime.CopyAndFreeBuffer(buffer);
+
+        return status switch
+        {
+            NxEvalStatus.Ok => payload,
+            NxEvalStatus.Error => throw NxRuntime.CreateEvaluationExceptionFromMessagePack(payload),
+            _ => throw NxRuntime.CreateInteropStatusException(status),
+        };
+    }
+
     /// <summary>
     /// Releases the native program-artifact handle.
     /// </summary>
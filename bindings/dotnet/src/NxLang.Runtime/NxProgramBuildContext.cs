@@ -39,6 +39,50 @@ public sealed class NxProgramBuildContext : IDisposable
         };
     }
 
+    /// <summary>
+    /// Sets how many threads workspace builds using this context parse and analyze modules on.
+    /// </summary>
+    /// <param name="workerCount">
+    /// The worker count, or <c>0</c> to use the available hardware parallelism (the default).
+    /// </param>
+    /// <remarks>
+    /// Do not call this while another thread is building with this context.
+    /// </remarks>
+    /// <exception cref="ArgumentOutOfRangeException">Thrown when <paramref name="workerCount"/> is negative.</exception>
+    public void SetAnalysisWorkers(int workerCount)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(workerCount);
+
+        NxEvalStatus status = NxNativeMethods.nx_set_program_build_context_analysis_workers(
+            SafeHandle,
+            (nuint)workerCount);
+        if (status != NxEvalStatus.Ok)
+        {
+            throw NxRuntime.CreateInteropStatusException(status);
+        }
+    }
+
+    /// <summary>
+    /// Limits workspace builds using this context to the entry module's import closure.
+    /// </summary>
+    /// <param name="enabled">
+    /// <see langword="true"/> to analyze and keep only modules reachable from the entry module;
+    /// <see langword="false"/> to analyze every submitted module (the default).
+    /// </param>
+    /// <remarks>
+    /// Do not call this while another thread is building with this context.
+    /// </remarks>
+    public void SetEntryClosurePruning(bool enabled)
+    {
+        NxEvalStatus status = NxNativeMethods.nx_set_program_build_context_entry_closure_pruning(
+            SafeHandle,
+            enabled ? 1u : 0u);
+        if (status != NxEvalStatus.Ok)
+        {
+            throw NxRuntime.CreateInteropStatusException(status);
+        }
+    }
+
     /// <summary>
     /// Releases the native program-build-context handle.
     /// </summary>
@@ -3,9 +3,11 @@
 
 using System;
 using System.Collections.Generic;
+using System.IO;
 using System.Runtime.InteropServices;
 using System.Text;
 using System.Text.Json;
+using System.Threading;
 using MessagePack;
 using NxLang.Nx.Interop;
 
@@ -20,6 +22,9 @@ public static class NxRuntime
     private static readonly MessagePackSerializerOptions MessagePackOptions =
         MessagePackSerializerOptions.Standard.WithSecurity(MessagePackSecurity.UntrustedData);
 
+    [ThreadStatic]
+    private static NxOutputArenaSafeHandle? _threadOutputArena;
+
     /// <summary>
     /// Evaluates NX source code and returns the raw result bytes in the canonical MessagePack wire format.
     /// </summary>
@@ -116,7 +121,8 @@ public static class NxRuntime
         byte[] payload = InvokeProgramArtifactNativeCall(
             programArtifact,
             outputFormat,
-            NxNativeMethods.nx_eval_program_artifact,
+            default,
+            NxNativeMethods.nx_eval_program_artifact_into_arena,
             out NxEvalStatus status);
         return status switch
         {
@@ -126,6 +132,72 @@ public static class NxRuntime
         };
     }
 
+    /// <summary>
+    /// Evaluates the <c>root()</c> entrypoint of a previously built program artifact in the requested output format,
+    /// stopping early when <paramref name="timeout"/> elapses or <paramref name="cancellationToken"/> is cancelled.
+    /// </summary>
+    /// <remarks>
+    /// The native runtime polls the deadline and the token every 1024 operations, so an interrupted evaluation
+    /// returns shortly after either trips. A cancelled token throws <see cref="OperationCanceledException"/>; an
+    /// elapsed timeout throws <see cref="NxEvaluationException"/> with a <c>deadline-exceeded</c> diagnostic.
+    /// </remarks>
+    public static byte[] EvaluateBytes(
+        NxProgramArtifact programArtifact,
+        NxOutputFormat outputFormat,
+        TimeSpan? timeout,
+        CancellationToken cancellationToken)
+    {
+        ArgumentNullException.ThrowIfNull(programArtifact);
+
+        using NxEvalLimitsScope limits = new(timeout, cancellationToken);
+        NxEvalStatus status = NxNativeMethods.nx_eval_program_artifact_with_limits(
+            programArtifact.SafeHandle,
+            limits.Limits,
+            outputFormat,
+            out NxBuffer buffer);
+        return LimitedPayloadOrThrow(status, CopyAndFreeBuffer(buffer), outputFormat, cancellationToken);
+    }
+
+    /// <summary>
+    /// Evaluates the <c>root()</c> entrypoint of a previously built program artifact and writes the canonical
+    /// MessagePack result to <paramref name="destination"/> as it is encoded.
+    /// </summary>
+    public static void EvaluateToStream(NxProgramArtifact programArtifact, Stream destination)
+    {
+        EvaluateToStream(programArtifact, destination, NxOutputFormat.MessagePack);
+    }
+
+    /// <summary>
+    /// Evaluates the <c>root()</c> entrypoint of a previously built program artifact and writes the result in the
+    /// requested output format to <paramref name="destination"/> as it is encoded.
+    /// </summary>
+    /// <remarks>
+    /// The payload is streamed in chunks instead of being collected in memory first, so very large renders can be
+    /// written straight to a file or HTTP response. Evaluation errors are thrown before anything is written; if
+    /// encoding or <paramref name="destination"/> fails midway, it may already hold a partial payload.
+    /// </remarks>
+    public static void EvaluateToStream(
+        NxProgramArtifact programArtifact,
+        Stream destination,
+        NxOutputFormat outputFormat)
+    {
+        ArgumentNullException.ThrowIfNull(programArtifact);
+        ArgumentNullException.ThrowIfNull(destination);
+
+        NxNativeLibrary.EnsureLoaded();
+
+        NxStreamOutputSink sink = new(destination);
+        NxEvalStatus status = NxNativeMethods.nx_eval_program_artifact_into_callback(
+            programArtifact.SafeHandle,
+            default,
+            outputFormat,
+            sink.Callback,
+            IntPtr.Zero,
+            out NxBuffer buffer);
+        GC.KeepAlive(sink);
+        StreamedStatusOrThrow(status, CopyAndFreeBuffer(buffer), outputFormat, sink);
+    }
+
     /// <summary>
     /// Evaluates NX source code and returns the JSON result as a <see cref="JsonElement"/>.
     /// </summary>
@@ -183,10 +255,24 @@ public static class NxRuntime
     /// <summary>
     /// Evaluates the <c>root()</c> entrypoint of a previously built program artifact and deserializes the result.
     /// </summary>
+    /// <remarks>
+    /// The result is decoded straight from the native output arena, without first copying it to a managed array.
+    /// </remarks>
     public static T Evaluate<T>(NxProgramArtifact programArtifact)
     {
-        byte[] bytes = EvaluateBytes(programArtifact);
-        return MessagePackSerializer.Deserialize<T>(bytes, MessagePackOptions);
+        ArgumentNullException.ThrowIfNull(programArtifact);
+
+        NxNativeLibrary.EnsureLoaded();
+
+        return DeserializeArenaMessagePackResult<T>(
+            (NxOutputArenaSafeHandle arena, out NxBufferView view) =>
+                NxNativeMethods.nx_eval_program_artifact_into_arena(
+                    programArtifact.SafeHandle,
+                    default,
+                    NxOutputFormat.MessagePack,
+                    arena,
+                    out view),
+            message: null);
     }
 
     /// <summary>
@@ -287,7 +373,8 @@ public static class NxRuntime
             componentName,
             outputFormat,
             propsBytes,
-            NxNativeMethods.nx_component_init_program_artifact,
+            default,
+            NxNativeMethods.nx_component_init_program_artifact_into_arena,
             out NxEvalStatus status);
         return status switch
         {
@@ -297,6 +384,37 @@ public static class NxRuntime
         };
     }
 
+    /// <summary>
+    /// Initializes a named component from a previously built program artifact in the requested output format,
+    /// stopping early when <paramref name="timeout"/> elapses or <paramref name="cancellationToken"/> is cancelled.
+    /// </summary>
+    /// <remarks>
+    /// Interruptions are reported as described for
+    /// <see cref="EvaluateBytes(NxProgramArtifact, NxOutputFormat, TimeSpan?, CancellationToken)"/>.
+    /// </remarks>
+    public static byte[] InitializeComponentBytes(
+        NxProgramArtifact programArtifact,
+        string componentName,
+        NxOutputFormat outputFormat,
+        byte[]? propsBytes,
+        TimeSpan? timeout,
+        CancellationToken cancellationToken)
+    {
+        ArgumentNullException.ThrowIfNull(programArtifact);
+        ArgumentNullException.ThrowIfNull(componentName);
+
+        using NxEvalLimitsScope limits = new(timeout, cancellationToken);
+        byte[] payload = InvokeComponentInitProgramArtifactNativeCall(
+            programArtifact,
+            componentName,
+            outputFormat,
+            propsBytes,
+            limits.Limits,
+            NxNativeMethods.nx_component_init_program_artifact_into_arena,
+            out NxEvalStatus status);
+        return LimitedPayloadOrThrow(status, payload, outputFormat, cancellationToken);
+    }
+
     /// <summary>
     /// Evaluates a named component from explicit props and state and returns the raw result bytes in the canonical
     /// MessagePack wire format.
@@ -407,7 +525,8 @@ public static class NxRuntime
             outputFormat,
             propsBytes,
             stateBytes,
-            NxNativeMethods.nx_component_evaluate_program_artifact,
+            default,
+            NxNativeMethods.nx_component_evaluate_program_artifact_into_arena,
             out NxEvalStatus status);
         return status switch
         {
@@ -417,6 +536,102 @@ public static class NxRuntime
         };
     }
 
+    /// <summary>
+    /// Evaluates a named component from a previously built program artifact in the requested output format,
+    /// stopping early when <paramref name="timeout"/> elapses or <paramref name="cancellationToken"/> is cancelled.
+    /// </summary>
+    /// <remarks>
+    /// Interruptions are reported as described for
+    /// <see cref="EvaluateBytes(NxProgramArtifact, NxOutputFormat, TimeSpan?, CancellationToken)"/>.
+    /// </remarks>
+    public static byte[] EvaluateComponentBytes(
+        NxProgramArtifact programArtifact,
+        string componentName,
+        NxOutputFormat outputFormat,
+        byte[]? propsBytes,
+        byte[]? stateBytes,
+        TimeSpan? timeout,
+        CancellationToken cancellationToken)
+    {
+        ArgumentNullException.ThrowIfNull(programArtifact);
+        ArgumentNullException.ThrowIfNull(componentName);
+
+        using NxEvalLimitsScope limits = new(timeout, cancellationToken);
+        byte[] payload = InvokeComponentEvaluateProgramArtifactNativeCall(
+            programArtifact,
+            componentName,
+            outputFormat,
+            propsBytes,
+            stateBytes,
+            limits.Limits,
+            NxNativeMethods.nx_component_evaluate_program_artifact_into_arena,
+            out NxEvalStatus status);
+        return LimitedPayloadOrThrow(status, payload, outputFormat, cancellationToken);
+    }
+
+    /// <summary>
+    /// Evaluates a named component from a previously built program artifact and writes the canonical MessagePack
+    /// result to <paramref name="destination"/> as it is encoded.
+    /// </summary>
+    public static void EvaluateComponentToStream(
+        NxProgramArtifact programArtifact,
+        string componentName,
+        Stream destination,
+        byte[]? propsBytes = null,
+        byte[]? stateBytes = null)
+    {
+        EvaluateComponentToStream(
+            programArtifact,
+            componentName,
+            destination,
+            NxOutputFormat.MessagePack,
+            propsBytes,
+            stateBytes);
+    }
+
+    /// <summary>
+    /// Evaluates a named component from a previously built program artifact and writes the result in the requested
+    /// output format to <paramref name="destination"/> as it is encoded.
+    /// </summary>
+    /// <remarks>
+    /// See <see cref="EvaluateToStream(NxProgramArtifact, Stream, NxOutputFormat)"/> for how failures are reported.
+    /// </remarks>
+    public static void EvaluateComponentToStream(
+        NxProgramArtifact programArtifact,
+        string componentName,
+        Stream destination,
+        NxOutputFormat outputFormat,
+        byte[]? propsBytes = null,
+        byte[]? stateBytes = null)
+    {
+        ArgumentNullException.ThrowIfNull(programArtifact);
+        ArgumentNullException.ThrowIfNull(componentName);
+        ArgumentNullException.ThrowIfNull(destination);
+
+        NxNativeLibrary.EnsureLoaded();
+
+        byte[] componentNameBytes = Encoding.UTF8.GetBytes(componentName);
+        byte[] propsPayloadBytes = propsBytes ?? Array.Empty<byte>();
+        byte[] statePayloadBytes = stateBytes ?? Array.Empty<byte>();
+
+        NxStreamOutputSink sink = new(destination);
+        NxEvalStatus status = NxNativeMethods.nx_component_evaluate_program_artifact_into_callback(
+            programArtifact.SafeHandle,
+            componentNameBytes,
+            (nuint)componentNameBytes.Length,
+            propsPayloadBytes,
+            (nuint)propsPayloadBytes.Length,
+            statePayloadBytes,
+            (nuint)statePayloadBytes.Length,
+            default,
+            outputFormat,
+            sink.Callback,
+            IntPtr.Zero,
+            out NxBuffer buffer);
+        GC.KeepAlive(sink);
+        StreamedStatusOrThrow(status, CopyAndFreeBuffer(buffer), outputFormat, sink);
+    }
+
     /// <summary>
     /// Evaluates a named component using no explicit props or state and returns the JSON result.
     /// </summary>
@@ -583,19 +798,37 @@ public static class NxRuntime
     /// Evaluates a named component from a program artifact with MessagePack-serializable props and state and
     /// deserializes the rendered result.
     /// </summary>
+    /// <remarks>
+    /// The result is decoded straight from the native output arena, without first copying it to a managed array.
+    /// </remarks>
     public static TElement EvaluateComponent<TProps, TState, TElement>(
         NxProgramArtifact programArtifact,
         string componentName,
         TProps props,
         TState state)
     {
-        byte[] payload = EvaluateComponentBytes(
-            programArtifact,
-            componentName,
-            SerializeMessagePackInput(props),
-            SerializeMessagePackInput(state));
-        return DeserializeMessagePackResult<TElement>(
-            payload,
+        ArgumentNullException.ThrowIfNull(programArtifact);
+        ArgumentNullException.ThrowIfNull(componentName);
+
+        NxNativeLibrary.EnsureLoaded();
+
+        byte[] componentNameBytes = Encoding.UTF8.GetBytes(componentName);
+        byte[] propsBytes = SerializeMessagePackInput(props);
+        byte[] stateBytes = SerializeMessagePackInput(state);
+        return DeserializeArenaMessagePackResult<TElement>(
+            (NxOutputArenaSafeHandle arena, out NxBufferView view) =>
+                NxNativeMethods.nx_component_evaluate_program_artifact_into_arena(
+                    programArtifact.SafeHandle,
+                    componentNameBytes,
+                    (nuint)componentNameBytes.Length,
+                    propsBytes,
+                    (nuint)propsBytes.Length,
+                    stateBytes,
+                    (nuint)stateBytes.Length,
+                    default,
+                    NxOutputFormat.MessagePack,
+                    arena,
+                    out view),
             "NX native runtime returned an invalid component evaluation MessagePack payload.");
     }
 
@@ -894,7 +1127,8 @@ public static class NxRuntime
             stateSnapshot,
             outputFormat,
             actionsBytes,
-            NxNativeMethods.nx_component_dispatch_actions_program_artifact,
+            default,
+            NxNativeMethods.nx_component_dispatch_actions_program_artifact_into_arena,
             out NxEvalStatus status);
         return status switch
         {
@@ -904,6 +1138,37 @@ public static class NxRuntime
         };
     }
 
+    /// <summary>
+    /// Dispatches actions against a prior component state snapshot in the requested output format, stopping early
+    /// when <paramref name="timeout"/> elapses or <paramref name="cancellationToken"/> is cancelled.
+    /// </summary>
+    /// <remarks>
+    /// The timeout covers the whole batch of actions, not each handler. Interruptions are reported as described for
+    /// <see cref="EvaluateBytes(NxProgramArtifact, NxOutputFormat, TimeSpan?, CancellationToken)"/>.
+    /// </remarks>
+    public static byte[] DispatchComponentActionsBytes(
+        NxProgramArtifact programArtifact,
+        byte[] stateSnapshot,
+        NxOutputFormat outputFormat,
+        byte[]? actionsBytes,
+        TimeSpan? timeout,
+        CancellationToken cancellationToken)
+    {
+        ArgumentNullException.ThrowIfNull(programArtifact);
+        ArgumentNullException.ThrowIfNull(stateSnapshot);
+
+        using NxEvalLimitsScope limits = new(timeout, cancellationToken);
+        byte[] payload = InvokeComponentDispatchProgramArtifactNativeCall(
+            programArtifact,
+            stateSnapshot,
+            outputFormat,
+            actionsBytes,
+            limits.Limits,
+            NxNativeMethods.nx_component_dispatch_actions_program_artifact_into_arena,
+            out NxEvalStatus status);
+        return LimitedPayloadOrThrow(status, payload, outputFormat, cancellationToken);
+    }
+
     /// <summary>
     /// Dispatches no actions against a prior component state snapshot and returns the JSON result.
     /// </summary>
@@ -1107,6 +1372,95 @@ public static class NxRuntime
             "NX native runtime returned an invalid component dispatch MessagePack payload.");
     }
 
+    /// <summary>
+    /// Computes a compact delta that turns a previous component state snapshot into the next one.
+    /// </summary>
+    /// <remarks>
+    /// Hosts that keep <paramref name="previousSnapshot"/> can store or send the delta instead of the full snapshot
+    /// and rebuild the next snapshot with <see cref="ApplyComponentSnapshotDelta"/>.
+    /// </remarks>
+    /// <exception cref="NxEvaluationException">Thrown when either input is not a component state snapshot.</exception>
+    public static byte[] ComponentSnapshotDelta(byte[] previousSnapshot, byte[] nextSnapshot)
+    {
+        ArgumentNullException.ThrowIfNull(previousSnapshot);
+        ArgumentNullException.ThrowIfNull(nextSnapshot);
+
+        NxEvalStatus status = NxNativeMethods.nx_component_snapshot_delta(
+            previousSnapshot,
+            (nuint)previousSnapshot.Length,
+            nextSnapshot,
+            (nuint)nextSnapshot.Length,
+            out NxBuffer buffer);
+        return SnapshotBytesOrThrow(status, CopyAndFreeBuffer(buffer));
+    }
+
+    /// <summary>
+    /// Rebuilds a full component state snapshot from the snapshot a delta was computed against.
+    /// </summary>
+    /// <exception cref="NxEvaluationException">
+    /// Thrown when the delta is malformed or was computed against a different base snapshot.
+    /// </exception>
+    public static byte[] ApplyComponentSnapshotDelta(byte[] baseSnapshot, byte[] delta)
+    {
+        ArgumentNullException.ThrowIfNull(baseSnapshot);
+        ArgumentNullException.ThrowIfNull(delta);
+
+        NxEvalStatus status = NxNativeMethods.nx_apply_component_snapshot_delta(
+            baseSnapshot,
+            (nuint)baseSnapshot.Length,
+            delta,
+            (nuint)delta.Length,
+            out NxBuffer buffer);
+        return SnapshotBytesOrThrow(status, CopyAndFreeBuffer(buffer));
+    }
+
+    private static void StreamedStatusOrThrow(
+        NxEvalStatus status,
+        byte[] payload,
+        NxOutputFormat outputFormat,
+        NxStreamOutputSink sink)
+    {
+        // A destination failure stops the native stream, so rethrow it ahead of the resulting diagnostics.
+        sink.ThrowIfFailed();
+        switch (status)
+        {
+            case NxEvalStatus.Ok:
+                return;
+            case NxEvalStatus.Error:
+                throw CreateEvaluationException(payload, outputFormat);
+            default:
+                throw CreateInteropStatusException(status);
+        }
+    }
+
+    private static byte[] LimitedPayloadOrThrow(
+        NxEvalStatus status,
+        byte[] payload,
+        NxOutputFormat outputFormat,
+        CancellationToken cancellationToken)
+    {
+        switch (status)
+        {
+            case NxEvalStatus.Ok:
+                return payload;
+            case NxEvalStatus.Error:
+                cancellationToken.ThrowIfCancellationRequested();
+                throw CreateEvaluationException(payload, outputFormat);
+            default:
+                throw CreateInteropStatusException(status);
+        }
+    }
+
+    private static byte[] SnapshotBytesOrThrow(NxEvalStatus status, byte[] payload)
+    {
+        return status switch
+        {
+            NxEvalStatus.Ok => payload,
+            NxEvalStatus.Error => throw CreateEvaluationExceptionFromMessagePack(payload),
+            _ => throw CreateInteropStatusException(status),
+        };
+    }
+
     private delegate NxEvalStatus EvalSourceCallback(
         byte[] sourceBytes,
         nuint sourceLength,
@@ -1117,8 +1471,10 @@ public static class NxRuntime
 
     private delegate NxEvalStatus EvalProgramArtifactCallback(
         NxProgramArtifactSafeHandle programArtifactHandle,
+        in NxEvalLimits limits,
         NxOutputFormat outputFormat,
-        out NxBuffer buffer);
+        NxOutputArenaSafeHandle arena,
+        out NxBufferView view);
 
     private delegate NxEvalStatus ComponentInitProgramArtifactCallback(
         NxProgramArtifactSafeHandle programArtifactHandle,
@@ -1126,8 +1482,10 @@ public static class NxRuntime
         nuint componentNameLength,
         byte[] propsBytes,
         nuint propsLength,
+        in NxEvalLimits limits,
         NxOutputFormat outputFormat,
-        out NxBuffer buffer);
+        NxOutputArenaSafeHandle arena,
+        out NxBufferView view);
 
     private delegate NxEvalStatus ComponentEvaluateProgramArtifactCallback(
         NxProgramArtifactSafeHandle programArtifactHandle,
@@ -1137,8 +1495,12 @@ public static class NxRuntime
         nuint propsLength,
         byte[] stateBytes,
         nuint stateLength,
+        in NxEvalLimits limits,
         NxOutputFormat outputFormat,
-        out NxBuffer buffer);
+        NxOutputArenaSafeHandle arena,
+        out NxBufferView view);
+
+    private delegate NxEvalStatus ArenaNativeCall(NxOutputArenaSafeHandle arena, out NxBufferView view);
 
     private delegate NxEvalStatus ComponentDispatchProgramArtifactCallback(
         NxProgramArtifactSafeHandle programArtifactHandle,
@@ -1146,8 +1508,10 @@ public static class NxRuntime
         nuint stateSnapshotLength,
         byte[] actionsBytes,
         nuint actionsLength,
+        in NxEvalLimits limits,
         NxOutputFormat outputFormat,
-        out NxBuffer buffer);
+        NxOutputArenaSafeHandle arena,
+        out NxBufferView view);
 
     private static byte[] InvokeSourceNativeCall(
         string source,
@@ -1175,6 +1539,7 @@ public static class NxRuntime
     private static byte[] InvokeProgramArtifactNativeCall(
         NxProgramArtifact programArtifact,
         NxOutputFormat outputFormat,
+        in NxEvalLimits limits,
         EvalProgramArtifactCallback callback,
         out NxEvalStatus status)
     {
@@ -1182,11 +1547,15 @@ public static class NxRuntime
 
         NxNativeLibrary.EnsureLoaded();
 
+        NxOutputArenaSafeHandle arena = GetThreadOutputArena();
+
         status = callback(
             programArtifact.SafeHandle,
+            in limits,
             outputFormat,
-            out NxBuffer buffer);
-        return CopyAndFreeBuffer(buffer);
+            arena,
+            out NxBufferView view);
+        return CopyAndResetArena(arena, view);
     }
 
     private static byte[] InvokeComponentInitProgramArtifactNativeCall(
@@ -1194,6 +1563,7 @@ public static class NxRuntime
         string componentName,
         NxOutputFormat outputFormat,
         byte[]? propsBytes,
+        in NxEvalLimits limits,
         ComponentInitProgramArtifactCallback callback,
         out NxEvalStatus status)
     {
@@ -1202,6 +1572,8 @@ public static class NxRuntime
 
         NxNativeLibrary.EnsureLoaded();
 
+        NxOutputArenaSafeHandle arena = GetThreadOutputArena();
+
         byte[] componentNameBytes = Encoding.UTF8.GetBytes(componentName);
         byte[] payloadBytes = propsBytes ?? Array.Empty<byte>();
 
@@ -1211,9 +1583,11 @@ public static class NxRuntime
             (nuint)componentNameBytes.Length,
             payloadBytes,
             (nuint)payloadBytes.Length,
+            in limits,
             outputFormat,
-            out NxBuffer buffer);
-        return CopyAndFreeBuffer(buffer);
+            arena,
+            out NxBufferView view);
+        return CopyAndResetArena(arena, view);
     }
 
     private static byte[] InvokeComponentEvaluateProgramArtifactNativeCall(
@@ -1222,6 +1596,7 @@ public static class NxRuntime
         NxOutputFormat outputFormat,
         byte[]? propsBytes,
         byte[]? stateBytes,
+        in NxEvalLimits limits,
         ComponentEvaluateProgramArtifactCallback callback,
         out NxEvalStatus status)
     {
@@ -1230,6 +1605,8 @@ public static class NxRuntime
 
         NxNativeLibrary.EnsureLoaded();
 
+        NxOutputArenaSafeHandle arena = GetThreadOutputArena();
+
         byte[] componentNameBytes = Encoding.UTF8.GetBytes(componentName);
         byte[] propsPayloadBytes = propsBytes ?? Array.Empty<byte>();
         byte[] statePayloadBytes = stateBytes ?? Array.Empty<byte>();
@@ -1242,9 +1619,11 @@ public static class NxRuntime
             (nuint)propsPayloadBytes.Length,
             statePayloadBytes,
             (nuint)statePayloadBytes.Length,
+            in limits,
             outputFormat,
-            out NxBuffer buffer);
-        return CopyAndFreeBuffer(buffer);
+            arena,
+            out NxBufferView view);
+        return CopyAndResetArena(arena, view);
     }
 
     private static byte[] InvokeComponentDispatchProgramArtifactNativeCall(
@@ -1252,6 +1631,7 @@ public static class NxRuntime
         byte[] stateSnapshot,
         NxOutputFormat outputFormat,
         byte[]? actionsBytes,
+        in NxEvalLimits limits,
         ComponentDispatchProgramArtifactCallback callback,
         out NxEvalStatus status)
     {
@@ -1260,6 +1640,8 @@ public static class NxRuntime
 
         NxNativeLibrary.EnsureLoaded();
 
+        NxOutputArenaSafeHandle arena = GetThreadOutputArena();
+
         byte[] payloadBytes = actionsBytes ?? Array.Empty<byte>();
 
         status = callback(
@@ -1268,9 +1650,11 @@ public static class NxRuntime
             (nuint)stateSnapshot.Length,
             payloadBytes,
             (nuint)payloadBytes.Length,
+            in limits,
             outputFormat,
-            out NxBuffer buffer);
-        return CopyAndFreeBuffer(buffer);
+            arena,
+            out NxBufferView view);
+        return CopyAndResetArena(arena, view);
     }
 
     internal static NxEvaluationException CreateEvaluationException(
@@ -1465,6 +1849,98 @@ public static class NxRuntime
         return new InvalidOperationException(message);
     }
 
+    private static NxOutputArenaSafeHandle GetThreadOutputArena()
+    {
+        NxOutputArenaSafeHandle? arena = _threadOutputArena;
+        if (arena is not null)
+        {
+            return arena;
+        }
+
+        NxEvalStatus status = NxNativeMethods.nx_create_output_arena(out IntPtr handle);
+        if (status != NxEvalStatus.Ok || handle == IntPtr.Zero)
+        {
+            throw CreateInteropStatusException(status);
+        }
+
+        arena = new NxOutputArenaSafeHandle(handle);
+        _threadOutputArena = arena;
+        return arena;
+    }
+
+    internal static byte[] CopyAndResetArena(NxOutputArenaSafeHandle arena, NxBufferView view)
+    {
+        try
+        {
+            return CopyView(view);
+        }
+        finally
+        {
+            NxNativeMethods.nx_reset_output_arena(arena);
+        }
+    }
+
+    private static byte[] CopyView(NxBufferView view)
+    {
+        if (view.Ptr == IntPtr.Zero)
+        {
+            return Array.Empty<byte>();
+        }
+
+        int length = checked((int)(nuint)view.Len);
+        byte[] result = new byte[length];
+        Marshal.Copy(view.Ptr, result, 0, length);
+        return result;
+    }
+
+    /// <summary>
+    /// Runs an arena-backed native call and deserializes a successful MessagePack result in place, reading the arena
+    /// memory directly instead of copying it out first.
+    /// </summary>
+    private static T DeserializeArenaMessagePackResult<T>(ArenaNativeCall call, string? message)
+    {
+        NxOutputArenaSafeHandle arena = GetThreadOutputArena();
+
+        // Deserialization runs caller formatters while the arena still holds the payload. Detach the arena so a
+        // nested runtime call on this thread uses a fresh one instead of resetting this payload mid-decode.
+        _threadOutputArena = null;
+        try
+        {
+            NxEvalStatus status = call(arena, out NxBufferView view);
+            switch (status)
+            {
+                case NxEvalStatus.Ok:
+                    break;
+                case NxEvalStatus.Error:
+                    throw CreateEvaluationExceptionFromMessagePack(CopyView(view));
+                default:
+                    throw CreateInteropStatusException(status);
+            }
+
+            using NxNativeMemoryManager memory = new(view.Ptr, checked((int)(nuint)view.Len));
+            try
+            {
+                return MessagePackSerializer.Deserialize<T>(memory.Memory, MessagePackOptions);
+            }
+            catch (MessagePackSerializationException e) when (message is not null)
+            {
+                throw new InvalidOperationException(message, e);
+            }
+        }
+        finally
+        {
+            NxNativeMethods.nx_reset_output_arena(arena);
+            if (_threadOutputArena is null)
+            {
+                _threadOutputArena = arena;
+            }
+            else
+            {
+                arena.Dispose();
+            }
+        }
+    }
+
     internal static byte[] CopyAndFreeBuffer(NxBuffer buffer)
     {
         try
@@ -0,0 +1,105 @@
+// Copyright (c) Bret Johnson. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Buffers;
+using System.Text;
+using MessagePack;
+
+namespace NxLang.Nx.Serialization;
+
+/// <summary>
+/// Helpers called by the MessagePack formatters that <c>nxlang generate --serializers</c> emits for NX records,
+/// unions, and component state.
+/// </summary>
+/// <remarks>
+/// Keys and discriminators are returned as UTF-8 spans over the payload, so generated formatters can match them
+/// against <c>u8</c> literals without decoding strings.
+/// </remarks>
+[CLSCompliant(false)]
+public static class NxMessagePackFormatterHelpers
+{
+    /// <summary>
+    /// Reads the next map key. A non-string key is skipped and reported as an empty span, which matches no NX field.
+    /// </summary>
+    public static ReadOnlySpan<byte> ReadKey(ref MessagePackReader reader)
+    {
+        if (reader.NextMessagePackType != MessagePackType.String)
+        {
+            reader.Skip();
+            return ReadOnlySpan<byte>.Empty;
+        }
+
+        return ReadStringSpan(ref reader);
+    }
+
+    /// <summary>
+    /// Scans the next <paramref name="entryCount"/> map entries of <paramref name="peek"/> for the <c>$type</c>
+    /// discriminator and returns its UTF-8 value.
+    /// </summary>
+    /// <param name="peek">A peek reader positioned after the map header; callers keep their own reader in place.</param>
+    /// <param name="entryCount">The number of entries in the map.</param>
+    /// <param name="baseType">The polymorphic root being decoded, used in error messages.</param>
+    public static ReadOnlySpan<byte> FindDiscriminator(ref MessagePackReader peek, int entryCount, Type baseType)
+    {
+        for (int i = 0; i < entryCount; i++)
+        {
+            ReadOnlySpan<byte> key = ReadKey(ref peek);
+            if (!key.SequenceEqual("$type"u8))
+            {
+                peek.Skip();
+                continue;
+            }
+
+            if (peek.NextMessagePackType != MessagePackType.String)
+            {
+                throw new MessagePackSerializationException(
+                    $"Expected '$type' discriminator for '{baseType.FullName}' to be a MessagePack string.");
+            }
+
+            ReadOnlySpan<byte> discriminator = ReadStringSpan(ref peek);
+            if (discriminator.IsEmpty)
+            {
+                throw new MessagePackSerializationException(
+                    $"Polymorphic '$type' discriminator for '{baseType.FullName}' must be a non-empty string.");
+            }
+
+            return discriminator;
+        }
+
+        throw new MessagePackSerializationException(
+            $"Expected polymorphic MessagePack payload for '{baseType.FullName}' to include a string '$type' key.");
+    }
+
+    /// <summary>
+    /// Creates the exception thrown when a payload names a discriminator the generated formatter does not know.
+    /// </summary>
+    public static MessagePackSerializationException UnknownDiscriminator(ReadOnlySpan<byte> discriminator, Type baseType)
+    {
+        return new MessagePackSerializationException(
+            $"Unknown polymorphic $type discriminator '{Encoding.UTF8.GetString(discriminator)}' for base type '{baseType.FullName}'.");
+    }
+
+    /// <summary>
+    /// Creates the exception thrown when a value's runtime type has no discriminator in the generated formatter.
+    /// </summary>
+    public static MessagePackSerializationException UnregisteredType(Type baseType, Type runtimeType)
+    {
+        return new MessagePackSerializationException(
+            $"No $type discriminator registration was found for polymorphic type '{runtimeType.FullName}' under '{baseType.FullName}'.");
+    }
+
+    /// <summary>
+    /// Reads a string as UTF-8 bytes, borrowing the payload memory unless the string spans several segments.
+    /// </summary>
+    private static ReadOnlySpan<byte> ReadStringSpan(ref MessagePackReader reader)
+    {
+        if (reader.TryReadStringSpan(out ReadOnlySpan<byte> span))
+        {
+            return span;
+        }
+
+        ReadOnlySequence<byte>? sequence = reader.ReadStringSequence();
+        return sequence.HasValue ? sequence.GetValueOrDefault().ToArray() : ReadOnlySpan<byte>.Empty;
+    }
+}
@@ -38,6 +38,35 @@ public sealed class NxPolymorphicConcreteMessagePackFormatter<TBase, TDerived> :
     }
 }
 
+/// <summary>
+/// MessagePack formatter for a concrete or intermediate derived type whose polymorphic root uses a generated
+/// formatter instead of <see cref="NxPolymorphicMessagePackFormatter{TBase}"/>.
+/// </summary>
+/// <typeparam name="TBase">The abstract polymorphic root type.</typeparam>
+/// <typeparam name="TDerived">A type in the hierarchy under <typeparamref name="TBase"/>.</typeparam>
+/// <typeparam name="TBaseFormatter">The formatter generated for <typeparamref name="TBase"/>.</typeparam>
+[CLSCompliant(false)]
+public sealed class NxPolymorphicConcreteMessagePackFormatter<TBase, TDerived, TBaseFormatter> : IMessagePackFormatter<TDerived>
+    where TBase : class
+    where TDerived : class, TBase
+    where TBaseFormatter : IMessagePackFormatter<TBase>, new()
+{
+    private static readonly TBaseFormatter Inner = new();
+
+    /// <inheritdoc />
+    public void Serialize(ref MessagePackWriter writer, TDerived value, MessagePackSerializerOptions options)
+    {
+        Inner.Serialize(ref writer, value, options);
+    }
+
+    /// <inheritdoc />
+    public TDerived Deserialize(ref MessagePackReader reader, MessagePackSerializerOptions options)
+    {
+        TBase? deserialized = Inner.Deserialize(ref reader, options);
+        return (TDerived)deserialized!;
+    }
+}
+
 /// <summary>
 /// Serializes abstract NX record/action roots using a canonical MessagePack map with a <c>$type</c> discriminator.
 /// </summary>
@@ -300,6 +300,29 @@ public class NxEndToEndTests
         Assert.Equal("b", result);
     }
 
+    [Fact]
+    public void Rebuild_WithChangedWorkspaceModule_EvaluatesUpdatedSource()
+    {
+        NxWorkspace workspace = new([
+            NxWorkspaceModule.FromSourceText(
+                "app/main.nx",
+                "import { answer } from \"../shared/value.nx\"\nlet root(): int = { answer }"),
+            NxWorkspaceModule.FromSourceText("shared/value.nx", "export let answer: int = 41"),
+        ]);
+        using NxLibraryRegistry registry = new();
+        using NxProgramBuildContext buildContext = registry.CreateBuildContext();
+        using NxProgramArtifact previous = NxProgramArtifact.BuildWorkspace(workspace, "app/main.nx", buildContext);
+
+        NxWorkspace changes = new([
+            NxWorkspaceModule.FromSourceText("shared/value.nx", "export let answer: int = 42"),
+        ]);
+        using NxProgramArtifact rebuilt = previous.Rebuild(changes, buildContext);
+
+        Assert.Equal(41, NxRuntime.Evaluate<int>(previous));
+        Assert.Equal(42, NxRuntime.Evaluate<int>(rebuilt));
+        Assert.Equal("app/main.nx", rebuilt.FileName);
+    }
+
     [Fact]
     public void Evaluate_WithWorkspaceProgramArtifact_RemainsExecutableAfterWorkspaceBuffersAreReleased()
     {
@@ -379,6 +402,60 @@ public class NxEndToEndTests
         }
     }
 
+    [Fact]
+    public void LibraryRegistry_LoadFromDirectories_LoadsEveryRoot()
+    {
+        string tempPath = Path.Combine(Path.GetTempPath(), $"nx-library-artifacts-{Guid.NewGuid():N}");
+        Directory.CreateDirectory(tempPath);
+
+        try
+        {
+            string appRoot = Path.Combine(tempPath, "app");
+            string coreRoot = Path.Combine(tempPath, "core");
+            string uiRoot = Path.Combine(tempPath, "ui");
+            string formsRoot = Path.Combine(tempPath, "forms");
+            Directory.CreateDirectory(appRoot);
+            Directory.CreateDirectory(coreRoot);
+            Directory.CreateDirectory(uiRoot);
+            Directory.CreateDirectory(formsRoot);
+            File.WriteAllText(
+                Path.Combine(coreRoot, "base.nx"),
+                """
+                export let base() = { 40 }
+                """);
+            File.WriteAllText(
+                Path.Combine(uiRoot, "one.nx"),
+                """
+                import "../core"
+                export let one() = { base() + 1 }
+                """);
+            File.WriteAllText(
+                Path.Combine(formsRoot, "two.nx"),
+                """
+                export let two() = { 1 }
+                """);
+            string source = """
+                import "../ui"
+                import "../forms"
+                let root() = { one() + two() }
+                """;
+            string mainPath = Path.Combine(appRoot, "main.nx");
+            File.WriteAllText(mainPath, source);
+
+            using NxLibraryRegistry registry = new();
+            registry.LoadFromDirectories(new[] { uiRoot, formsRoot });
+            using NxProgramBuildContext buildContext = registry.CreateBuildContext();
+
+            int result = NxRuntime.Evaluate<int>(source, buildContext, mainPath);
+
+            Assert.Equal(42, result);
+        }
+        finally
+        {
+            Directory.Delete(tempPath, recursive: true);
+        }
+    }
+
     [Fact]
     public void LibraryRegistry_LoadFromDirectory_WithInvalidSource_ThrowsEvaluationException()
     {
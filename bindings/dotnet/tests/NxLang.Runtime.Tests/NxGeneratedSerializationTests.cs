@@ -0,0 +1,124 @@
+// Copyright (c) Bret Johnson. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.IO;
+using MessagePack;
+using NxLang.Nx;
+using Xunit;
+
+namespace NxLang.Nx.Tests;
+
+// PlaybackState and TrackInfo come from `nxlang generate --language csharp --serializers` for
+// Fixtures/playback.nx, which the test project runs before compiling.
+
+public class NxGeneratedSerializationTests
+{
+    [Fact]
+    public void GeneratedUnionFormatter_WritesTypeMap()
+    {
+        PlaybackState state = new PlaybackStateFailed
+        {
+            Message = "Offline",
+            Retries = 2,
+        };
+
+        byte[] result = MessagePackSerializer.Serialize(
+            state,
+            cancellationToken: TestContext.Current.CancellationToken);
+        Dictionary<string, object?> payload =
+            MessagePackSerializer.Deserialize<Dictionary<string, object?>>(
+                result,
+                cancellationToken: TestContext.Current.CancellationToken);
+
+        Assert.Equal("PlaybackState.failed", Assert.IsType<string>(payload["$type"]));
+        Assert.Equal("Offline", Assert.IsType<string>(payload["message"]));
+        Assert.Equal(2, Convert.ToInt64(payload["retries"]));
+    }
+
+    [Fact]
+    public void GeneratedUnionFormatter_ReadsDiscriminatorAfterFields()
+    {
+        ArrayBufferWriter<byte> buffer = new();
+        MessagePackWriter writer = new(buffer);
+        writer.WriteMapHeader(3);
+        writer.Write("message");
+        writer.Write("Offline");
+        writer.Write("retries");
+        writer.WriteNil();
+        writer.Write("$type");
+        writer.Write("PlaybackState.failed");
+        writer.Flush();
+
+        PlaybackStateFailed failed = MessagePackSerializer.Deserialize<PlaybackStateFailed>(
+            buffer.WrittenMemory,
+            cancellationToken: TestContext.Current.CancellationToken);
+
+        Assert.Equal("Offline", failed.Message);
+        Assert.Null(failed.Retries);
+    }
+
+    [Fact]
+    public void GeneratedUnionFormatter_RejectsUnknownDiscriminator()
+    {
+        ArrayBufferWriter<byte> buffer = new();
+        MessagePackWriter writer = new(buffer);
+        writer.WriteMapHeader(1);
+        writer.Write("$type");
+        writer.Write("PlaybackState.paused");
+        writer.Flush();
+
+        MessagePackSerializationException exception = Assert.Throws<MessagePackSerializationException>(
+            () => MessagePackSerializer.Deserialize<PlaybackState>(
+                buffer.WrittenMemory,
+                cancellationToken: TestContext.Current.CancellationToken));
+
+        Assert.Contains("PlaybackState.paused", exception.ToString(), StringComparison.Ordinal);
+    }
+
+    [Fact]
+    public void GeneratedRecordFormatter_SkipsDiscriminatorAndUnknownKeys()
+    {
+        ArrayBufferWriter<byte> buffer = new();
+        MessagePackWriter writer = new(buffer);
+        writer.WriteMapHeader(4);
+        writer.Write("$type");
+        writer.Write("TrackInfo");
+        writer.Write("title");
+        writer.Write("Intro");
+        writer.Write("duration");
+        writer.Write(93);
+        writer.Write("rating");
+        writer.Write(4.5);
+        writer.Flush();
+
+        TrackInfo track = MessagePackSerializer.Deserialize<TrackInfo>(
+            buffer.WrittenMemory,
+            cancellationToken: TestContext.Current.CancellationToken);
+
+        Assert.Equal("Intro", track.Title);
+        Assert.Equal(4.5, track.Rating);
+    }
+
+    [Fact]
+    public void EvaluateProgramArtifact_DecodesGeneratedTypesFromNativeOutput()
+    {
+        using NxLibraryRegistry registry = new();
+        using NxProgramBuildContext buildContext = registry.CreateBuildContext();
+        using NxProgramArtifact artifact = NxProgramArtifact.Build(PlaybackSource, buildContext, "playback.nx");
+
+        PlaybackState state = NxRuntime.Evaluate<PlaybackState>(artifact);
+
+        PlaybackStateFailed failed = Assert.IsType<PlaybackStateFailed>(state);
+        Assert.Equal("Offline", failed.Message);
+        Assert.Equal(3, failed.Retries);
+    }
+
+    private static readonly string PlaybackSource =
+        File.ReadAllText(Path.Combine(AppContext.BaseDirectory, "Fixtures", "playback.nx")) + """
+
+        let root(): PlaybackState = { <PlaybackState.failed message={"Offline"} retries={3} /> }
+        """;
+}
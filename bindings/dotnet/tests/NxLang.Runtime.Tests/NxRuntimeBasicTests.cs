@@ -2,8 +2,10 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 using System;
+using System.IO;
 using System.Text;
 using System.Text.Json;
+using System.Threading;
 using MessagePack;
 using NxLang.Nx;
 using Xunit;
@@ -67,6 +69,24 @@ public class NxRuntimeBasicTests
         Assert.Equal(42, result.GetInt32());
     }
 
+    [Fact]
+    public void EvaluateJson_WithLoadedProgramArtifactImage_ReturnsCorrectJsonElement()
+    {
+        string source = "let root() = { 42 }";
+
+        byte[] image;
+        using (NxProgramArtifact built = NxProgramArtifact.Build(source))
+        {
+            image = built.Serialize();
+        }
+
+        using NxProgramArtifact programArtifact = NxProgramArtifact.Load(image);
+        JsonElement result = NxRuntime.EvaluateJson(programArtifact);
+
+        Assert.Equal(42, result.GetInt32());
+        Assert.Throws<NxEvaluationException>(() => NxProgramArtifact.Load(image[..(image.Length / 2)]));
+    }
+
     [Fact]
     public void EvaluateJson_EnumValue_ReturnsBareAuthoredMemberString()
     {
@@ -102,6 +122,58 @@ public class NxRuntimeBasicTests
         Assert.Equal("Hello, NX!", result);
     }
 
+    [Fact]
+    public void EvaluateToStream_WritesSamePayloadAsEvaluateBytes()
+    {
+        using NxProgramArtifact programArtifact = NxProgramArtifact.Build("""
+            let root() = { <list>{for i in [1, 2, 3] { <item value={i * 2} /> }}</list> }
+            """);
+        using MemoryStream destination = new();
+
+        NxRuntime.EvaluateToStream(programArtifact, destination, NxOutputFormat.Json);
+
+        Assert.Equal(NxRuntime.EvaluateBytes(programArtifact, NxOutputFormat.Json), destination.ToArray());
+    }
+
+    [Fact]
+    public void EvaluateToStream_EvaluationError_ThrowsWithoutWriting()
+    {
+        using NxProgramArtifact programArtifact = NxProgramArtifact.Build("let root() = { 1 / 0 }");
+        using MemoryStream destination = new();
+
+        Assert.Throws<NxEvaluationException>(() => NxRuntime.EvaluateToStream(programArtifact, destination));
+        Assert.Equal(0, destination.Length);
+    }
+
+    [Fact]
+    public void EvaluateBytes_WithTimeoutAndToken_ReturnsSamePayload()
+    {
+        using NxProgramArtifact programArtifact = NxProgramArtifact.Build("let root() = { 40 + 2 }");
+        using CancellationTokenSource cancellation = new();
+
+        byte[] result = NxRuntime.EvaluateBytes(
+            programArtifact,
+            NxOutputFormat.Json,
+            TimeSpan.FromSeconds(30),
+            cancellation.Token);
+
+        Assert.Equal("42", Encoding.UTF8.GetString(result));
+    }
+
+    [Fact]
+    public void EvaluateBytes_CancelledToken_ThrowsOperationCanceledException()
+    {
+        using NxProgramArtifact programArtifact = NxProgramArtifact.Build("let root() = { 40 + 2 }");
+        using CancellationTokenSource cancellation = new();
+        cancellation.Cancel();
+
+        Assert.Throws<OperationCanceledException>(() => NxRuntime.EvaluateBytes(
+            programArtifact,
+            NxOutputFormat.Json,
+            timeout: null,
+            cancellation.Token));
+    }
+
     [Fact]
     public void EvaluateBytes_NullSource_ThrowsArgumentNullException()
     {
@@ -5,6 +5,7 @@ using System;
 using System.Buffers;
 using System.Text.Json;
 using System.Text.Json.Serialization;
+using System.Threading;
 using MessagePack;
 using NxLang.Nx;
 using NxLang.Nx.Serialization;
@@ -312,6 +313,48 @@ public class NxRuntimeComponentTests
         Assert.False(document.RootElement.TryGetProperty("rendered", out _));
     }
 
+    [Fact]
+    public void EvaluateComponentBytes_WithLimits_RendersOrStopsOnDeadlineAndCancellation()
+    {
+        using NxProgramArtifact programArtifact = NxProgramArtifact.Build("""
+            let spin(n:int): int = { if n <= 0 { 0 } else { spin(n - 1) + spin(n - 1) } }
+            component <Busy depth:int /> = { <Count value={spin(depth)} /> }
+            """);
+        byte[] shallow = MessagePackSerializer.Serialize(new Dictionary<string, object?> { ["depth"] = 2 });
+        byte[] deep = MessagePackSerializer.Serialize(new Dictionary<string, object?> { ["depth"] = 40 });
+        using CancellationTokenSource cancellation = new();
+
+        byte[] json = NxRuntime.EvaluateComponentBytes(
+            programArtifact,
+            "Busy",
+            NxOutputFormat.Json,
+            shallow,
+            stateBytes: null,
+            TimeSpan.FromSeconds(30),
+            cancellation.Token);
+        using JsonDocument document = JsonDocument.Parse(json);
+        Assert.Equal("Count", document.RootElement.GetProperty("$type").GetString());
+
+        NxEvaluationException error = Assert.Throws<NxEvaluationException>(() => NxRuntime.EvaluateComponentBytes(
+            programArtifact,
+            "Busy",
+            NxOutputFormat.MessagePack,
+            deep,
+            stateBytes: null,
+            TimeSpan.FromMilliseconds(10),
+            CancellationToken.None));
+        Assert.Contains(error.Diagnostics, diagnostic => diagnostic.Code == "deadline-exceeded");
+
+        cancellation.Cancel();
+        Assert.Throws<OperationCanceledException>(() => NxRuntime.InitializeComponentBytes(
+            programArtifact,
+            "Busy",
+            NxOutputFormat.MessagePack,
+            shallow,
+            timeout: null,
+            cancellation.Token));
+    }
+
     [Fact]
     public void EvaluateComponent_WithInvalidState_ThrowsEvaluationException()
     {
@@ -393,6 +436,33 @@ public class NxRuntimeComponentTests
         Assert.NotEmpty(dispatchResult.StateSnapshot);
     }
 
+    [Fact]
+    public void ComponentSnapshotDelta_AppliedToPreviousSnapshot_RebuildsNextSnapshot()
+    {
+        string source = """
+            component <SearchBox placeholder:string /> = {
+              state { query:string = {placeholder} }
+              <TextInput value={query} placeholder={placeholder} />
+            }
+            """;
+
+        byte[] previous = NxRuntime.InitializeComponent<SearchBoxProps, TextInputElement>(
+                source,
+                "SearchBox",
+                new SearchBoxProps { Placeholder = "Find docs" })
+            .StateSnapshot.ToArray();
+        byte[] next = NxRuntime.InitializeComponent<SearchBoxProps, TextInputElement>(
+                source,
+                "SearchBox",
+                new SearchBoxProps { Placeholder = "Find packages" })
+            .StateSnapshot.ToArray();
+
+        byte[] delta = NxRuntime.ComponentSnapshotDelta(previous, next);
+
+        Assert.Equal(next, NxRuntime.ApplyComponentSnapshotDelta(previous, delta));
+        Assert.Throws<NxEvaluationException>(() => NxRuntime.ApplyComponentSnapshotDelta(next, delta));
+    }
+
     [Fact]
     public void ComponentJsonWorkflows_ReturnExpectedJson()
     {
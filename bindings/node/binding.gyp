@@ -0,0 +1,52 @@
+{
+  "variables": {
+    # Directory containing the nx_ffi library built by `cargo build --release -p nx-ffi`.
+    "nx_ffi_dir%": "<(module_root_dir)/../../target/release"
+  },
+  "targets": [
+    {
+      "target_name": "nx_node",
+      "sources": [
+        "src/binding.cc"
+      ],
+      "include_dirs": [
+        "../c"
+      ],
+      "defines": [
+        "NAPI_VERSION=8"
+      ],
+      "cflags_cc": [
+        "-std=c++17"
+      ],
+      "conditions": [
+        ["OS=='win'", {
+          "libraries": [
+            "<(nx_ffi_dir)/nx_ffi.dll.lib"
+          ],
+          "msvs_settings": {
+            "VCCLCompilerTool": {
+              "AdditionalOptions": ["/std:c++17"]
+            }
+          }
+        }],
+        ["OS=='mac'", {
+          "libraries": [
+            "-L<(nx_ffi_dir)",
+            "-lnx_ffi",
+            "-Wl,-rpath,<(nx_ffi_dir)"
+          ],
+          "xcode_settings": {
+            "CLANG_CXX_LANGUAGE_STANDARD": "c++17"
+          }
+        }],
+        ["OS=='linux'", {
+          "libraries": [
+            "-L<(nx_ffi_dir)",
+            "-lnx_ffi",
+            "-Wl,-rpath,<(nx_ffi_dir)"
+          ]
+        }]
+      ]
+    }
+  ]
+}
@@ -0,0 +1,118 @@
+/// <reference types="node" />
+
+/** Output encodings accepted by every evaluation call. Matches `NxOutputFormat` in `nx.h`. */
+export declare const OutputFormat: {
+  readonly MessagePack: 0;
+  readonly Json: 1;
+};
+export type OutputFormat = (typeof OutputFormat)[keyof typeof OutputFormat];
+
+/** ABI version reported by the loaded native runtime. */
+export declare const abiVersion: number;
+
+export interface NxTextSpan {
+  start_byte: number;
+  end_byte: number;
+  start_line: number;
+  start_column: number;
+  end_line: number;
+  end_column: number;
+}
+
+export interface NxDiagnosticLabel {
+  file: string;
+  span: NxTextSpan;
+  message?: string | null;
+  primary: boolean;
+}
+
+export interface NxDiagnostic {
+  severity: 'error' | 'warning' | 'info' | 'hint';
+  code?: string | null;
+  message: string;
+  labels: NxDiagnosticLabel[];
+  help?: string | null;
+  note?: string | null;
+}
+
+/** Error raised when NX reports diagnostics for a build, evaluation or component call. */
+export declare class NxEvaluationError extends Error {
+  readonly code: 'NX_EVAL_ERROR';
+  readonly diagnostics: NxDiagnostic[];
+}
+
+/** Bytes accepted for MessagePack inputs; strings are encoded as UTF-8. */
+export type NxInput = Buffer | Uint8Array | string;
+
+/** WorkspaceModule describes one logical module such as `app/main.nx`. */
+export interface NxWorkspaceModule {
+  identity: string;
+  source: string;
+}
+
+/**
+ * Limits for one evaluation call. Omitted or zero counts keep the runtime defaults. A call that runs
+ * past `timeoutMs` rejects with a `deadline-exceeded` diagnostic; aborting `signal` stops the
+ * evaluation and rejects with the signal's reason.
+ */
+export interface NxEvalLimits {
+  maxOperations?: number;
+  maxRecursionDepth?: number;
+  timeoutMs?: number;
+  signal?: AbortSignal;
+}
+
+/**
+ * Immutable program artifact. Every method runs on the libuv thread pool, so concurrent calls on
+ * one artifact evaluate in parallel without blocking the event loop. Results are Buffers over the
+ * native output memory.
+ */
+export declare class ProgramArtifact {
+  private constructor();
+
+  /** Evaluates the `root()` entrypoint. */
+  evaluate(outputFormat?: OutputFormat, limits?: NxEvalLimits): Promise<Buffer>;
+
+  /** Initializes a component, returning its rendered value and state snapshot. */
+  initComponent(
+    componentName: string,
+    props?: NxInput | null,
+    outputFormat?: OutputFormat,
+    limits?: NxEvalLimits,
+  ): Promise<Buffer>;
+
+  /** Renders a component from MessagePack props and state without lifecycle wrapper fields. */
+  evaluateComponent(
+    componentName: string,
+    props?: NxInput | null,
+    state?: NxInput | null,
+    outputFormat?: OutputFormat,
+    limits?: NxEvalLimits,
+  ): Promise<Buffer>;
+
+  /** Dispatches MessagePack-encoded actions against a state snapshot. */
+  dispatchActions(
+    stateSnapshot: NxInput,
+    actions: NxInput,
+    outputFormat?: OutputFormat,
+    limits?: NxEvalLimits,
+  ): Promise<Buffer>;
+
+  /** Serializes the artifact into a self-contained image for `loadProgramArtifact`. */
+  serialize(): Promise<Buffer>;
+
+  /** Releases this object's reference to the native artifact once in-flight calls finish. */
+  close(): void;
+}
+
+/** Parses, analyzes and links one source file off the main thread. */
+export declare function buildProgramArtifact(source: string, fileName?: string): Promise<ProgramArtifact>;
+
+/** Builds a program artifact from a set of workspace modules and an entry module identity. */
+export declare function buildWorkspaceProgramArtifact(
+  modules: readonly NxWorkspaceModule[],
+  entryIdentity: string,
+): Promise<ProgramArtifact>;
+
+/** Restores a program artifact from an image written by `ProgramArtifact.serialize`. */
+export declare function loadProgramArtifact(image: NxInput): Promise<ProgramArtifact>;
@@ -0,0 +1,141 @@
+'use strict';
+
+const { decode } = require('@msgpack/msgpack');
+
+function loadNative() {
+  try {
+    return require('./build/Release/nx_node.node');
+  } catch (error1) {
+    if (error1.code !== 'MODULE_NOT_FOUND') {
+      throw error1;
+    }
+    try {
+      return require('./build/Debug/nx_node.node');
+    } catch (error2) {
+      if (error2.code !== 'MODULE_NOT_FOUND') {
+        throw error2;
+      }
+      throw error1;
+    }
+  }
+}
+
+const native = loadNative();
+
+/** Output encodings accepted by every evaluation call. Matches `NxOutputFormat` in `nx.h`. */
+const OutputFormat = Object.freeze({
+  MessagePack: 0,
+  Json: 1,
+});
+
+/** Error raised when NX reports diagnostics for a build, evaluation or component call. */
+class NxEvaluationError extends Error {
+  constructor(message, diagnostics) {
+    super(message);
+    this.name = 'NxEvaluationError';
+    this.code = 'NX_EVAL_ERROR';
+    this.diagnostics = diagnostics;
+  }
+}
+
+function decodeDiagnostics(payload, outputFormat) {
+  if (payload.length === 0) {
+    return [];
+  }
+  return outputFormat === OutputFormat.Json ? JSON.parse(payload.toString('utf8')) : decode(payload);
+}
+
+function translateError(error) {
+  if (error === null || typeof error !== 'object' || error.code !== 'NX_EVAL_ERROR') {
+    return error;
+  }
+
+  const diagnostics = decodeDiagnostics(error.diagnostics, error.outputFormat);
+  const summary = diagnostics.length > 0 ? `: ${diagnostics[0].message}` : '';
+  return new NxEvaluationError(`NX evaluation failed${summary}`, diagnostics);
+}
+
+function settle(promise) {
+  return promise.catch((error) => {
+    throw translateError(error);
+  });
+}
+
+// Runs a native call whose `limits` argument sits at `index`, wiring `limits.signal` to a native
+// cancellation handle so aborting stops the evaluation on the thread pool.
+function callWithLimits(call, self, args, index) {
+  const limits = args[index];
+  if (limits === null || typeof limits !== 'object' || limits.signal === undefined) {
+    return settle(call.apply(self, args));
+  }
+
+  const { signal, ...rest } = limits;
+  if (signal.aborted) {
+    return Promise.reject(signal.reason);
+  }
+
+  const cancellation = native.createCancellation();
+  const onAbort = () => native.cancel(cancellation);
+  signal.addEventListener('abort', onAbort, { once: true });
+
+  const nativeArgs = args.slice();
+  nativeArgs[index] = { ...rest, cancellation };
+  let promise;
+  try {
+    promise = call.apply(self, nativeArgs);
+  } catch (error) {
+    signal.removeEventListener('abort', onAbort);
+    throw error;
+  }
+  return settle(promise)
+    .catch((error) => {
+      throw signal.aborted ? signal.reason : error;
+    })
+    .finally(() => signal.removeEventListener('abort', onAbort));
+}
+
+const { ProgramArtifact } = native;
+const limitsArgumentIndex = {
+  evaluate: 1,
+  initComponent: 3,
+  evaluateComponent: 4,
+  dispatchActions: 3,
+  serialize: undefined,
+};
+for (const [name, index] of Object.entries(limitsArgumentIndex)) {
+  const call = ProgramArtifact.prototype[name];
+  Object.defineProperty(ProgramArtifact.prototype, name, {
+    value:
+      index === undefined
+        ? function (...args) {
+            return settle(call.apply(this, args));
+          }
+        : function (...args) {
+            return callWithLimits(call, this, args, index);
+          },
+    writable: true,
+    configurable: true,
+  });
+}
+
+function buildProgramArtifact(source, fileName) {
+  return settle(native.buildProgramArtifact(source, fileName));
+}
+
+function buildWorkspaceProgramArtifact(modules, entryIdentity) {
+  return settle(native.buildWorkspaceProgramArtifact(modules, entryIdentity));
+}
+
+function loadProgramArtifact(image) {
+  return settle(native.loadProgramArtifact(image));
+}
+
+module.exports = {
+  abiVersion: native.abiVersion,
+  OutputFormat,
+  NxEvaluationError,
+  ProgramArtifact,
+  buildProgramArtifact,
+  buildWorkspaceProgramArtifact,
+  loadProgramArtifact,
+};
@@ -0,0 +1,1005 @@
+// Node-API addon over the NX C ABI declared in bindings/c/nx.h.
+//
+// Every build, evaluation and component call runs as async work on the libuv thread pool and
+// settles a promise back on the JavaScript thread, so parsing, analysis and rendering never block
+// the event loop. Successful payloads are returned as external Buffers over the NxBuffer memory the
+// native runtime allocated; the memory is released with nx_free_buffer when the Buffer is collected.
+
+#include <node_api.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nx.h"
+
+namespace {
+
+using Bytes = std::vector<uint8_t>;
+using ArtifactPtr = std::shared_ptr<NxProgramArtifactHandle>;
+using BuildContextPtr = std::shared_ptr<NxProgramBuildContextHandle>;
+using CancellationPtr = std::shared_ptr<NxCancellationHandle>;
+
+// Per-environment state shared by every call made from one JavaScript realm.
+struct AddonData {
+  napi_ref artifact_constructor = nullptr;
+  // Empty build context used by every build; builds only read it, so concurrent builds share it.
+  BuildContextPtr build_context;
+};
+
+// Native state wrapped by one JavaScript ProgramArtifact object.
+//
+// In-flight calls hold their own reference to the artifact, so closing or collecting the wrapper
+// while a call runs only frees the handle once that call has finished.
+struct ArtifactWrapper {
+  ArtifactPtr artifact;
+};
+
+constexpr NxBuffer kEmptyBuffer{nullptr, 0, 0};
+
+// Marks the objects returned by createCancellation so limits only accept genuine handles.
+constexpr napi_type_tag kCancellationTag{0x6e78636e63656c31ULL, 0x9d3f4a1be27c5068ULL};
+
+// Largest integer a JavaScript number holds exactly.
+constexpr double kMaxSafeInteger = 9007199254740991.0;
+
+bool Check(napi_env env, napi_status status) {
+  if (status == napi_ok) {
+    return true;
+  }
+
+  // Any later Node-API call, including napi_is_exception_pending, overwrites the last error info,
+  // so copy the message out first.
+  const napi_extended_error_info* info = nullptr;
+  std::string message = "Node-API call failed";
+  if (napi_get_last_error_info(env, &info) == napi_ok && info != nullptr && info->error_message != nullptr) {
+    message = info->error_message;
+  }
+
+  bool pending = false;
+  napi_is_exception_pending(env, &pending);
+  if (!pending) {
+    napi_throw_error(env, nullptr, message.c_str());
+  }
+  return false;
+}
+
+napi_value Undefined(napi_env env) {
+  napi_value result = nullptr;
+  napi_get_undefined(env, &result);
+  return result;
+}
+
+napi_value ThrowTypeError(napi_env env, const std::string& message) {
+  napi_throw_type_error(env, "ERR_INVALID_ARG_TYPE", message.c_str());
+  return nullptr;
+}
+
+AddonData* GetAddonData(napi_env env) {
+  void* data = nullptr;
+  if (!Check(env, napi_get_instance_data(env, &data))) {
+    return nullptr;
+  }
+  return static_cast<AddonData*>(data);
+}
+
+napi_valuetype TypeOf(napi_env env, napi_value value) {
+  napi_valuetype type = napi_undefined;
+  napi_typeof(env, value, &type);
+  return type;
+}
+
+bool ReadString(napi_env env, napi_value value, const char* name, std::string* out) {
+  if (TypeOf(env, value) != napi_string) {
+    ThrowTypeError(env, std::string(name) + " must be a string");
+    return false;
+  }
+
+  size_t length = 0;
+  if (!Check(env, napi_get_value_string_utf8(env, value, nullptr, 0, &length))) {
+    return false;
+  }
+  // Node-API always writes a terminating NUL, so reserve one byte past the text.
+  out->assign(length + 1, '\0');
+  if (!Check(env, napi_get_value_string_utf8(env, value, out->data(), out->size(), &length))) {
+    return false;
+  }
+  out->resize(length);
+  return true;
+}
+
+// Copies a string (as UTF-8), Buffer or Uint8Array argument. Absent optional arguments read as
+// empty, which the native entry points treat as an empty record.
+bool ReadBytes(napi_env env, napi_value value, const char* name, bool optional, Bytes* out) {
+  napi_valuetype type = TypeOf(env, value);
+  if (optional && (type == napi_undefined || type == napi_null)) {
+    out->clear();
+    return true;
+  }
+  if (type == napi_string) {
+    std::string text;
+    if (!ReadString(env, value, name, &text)) {
+      return false;
+    }
+    out->assign(text.begin(), text.end());
+    return true;
+  }
+
+  bool is_buffer = false;
+  if (!Check(env, napi_is_buffer(env, value, &is_buffer))) {
+    return false;
+  }
+  if (is_buffer) {
+    void* data = nullptr;
+    size_t length = 0;
+    if (!Check(env, napi_get_buffer_info(env, value, &data, &length))) {
+      return false;
+    }
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    out->assign(bytes, bytes + length);
+    return true;
+  }
+
+  bool is_typed_array = false;
+  if (!Check(env, napi_is_typedarray(env, value, &is_typed_array))) {
+    return false;
+  }
+  if (is_typed_array) {
+    napi_typedarray_type array_type = napi_int8_array;
+    size_t length = 0;
+    void* data = nullptr;
+    if (!Check(env, napi_get_typedarray_info(env, value, &array_type, &length, &data, nullptr, nullptr))) {
+      return false;
+    }
+    if (array_type == napi_uint8_array) {
+      const uint8_t* bytes = static_cast<const uint8_t*>(data);
+      out->assign(bytes, bytes + length);
+      return true;
+    }
+  }
+
+  ThrowTypeError(env, std::string(name) + " must be a string, Buffer or Uint8Array");
+  return false;
+}
+
+bool ReadOutputFormat(napi_env env, napi_value value, uint32_t* out) {
+  napi_valuetype type = TypeOf(env, value);
+  if (type == napi_undefined) {
+    *out = NxOutputFormat_MessagePack;
+    return true;
+  }
+
+  uint32_t format = 0;
+  if (type != napi_number || !Check(env, napi_get_value_uint32(env, value, &format)) ||
+      (format != NxOutputFormat_MessagePack && format != NxOutputFormat_Json)) {
+    napi_throw_range_error(env, "ERR_OUT_OF_RANGE", "outputFormat must be OutputFormat.MessagePack or OutputFormat.Json");
+    return false;
+  }
+  *out = format;
+  return true;
+}
+
+// Evaluation limits copied into one native call. The call shares ownership of its cancellation
+// handle, so the handle stays valid until the call finishes even if JavaScript collects it first.
+struct CallLimits {
+  NxEvalLimits limits{0, 0, 0, nullptr};
+  CancellationPtr cancellation;
+
+  const NxEvalLimits* get() {
+    limits.cancellation = cancellation.get();
+    return &limits;
+  }
+};
+
+void FinalizeCancellation(napi_env /*env*/, void* data, void* /*hint*/) {
+  delete static_cast<CancellationPtr*>(data);
+}
+
+bool UnwrapCancellation(napi_env env, napi_value value, CancellationPtr* out) {
+  bool tagged = false;
+  if (TypeOf(env, value) == napi_object &&
+      !Check(env, napi_check_object_type_tag(env, value, &kCancellationTag, &tagged))) {
+    return false;
+  }
+  if (!tagged) {
+    ThrowTypeError(env, "cancellation must be a handle returned by createCancellation");
+    return false;
+  }
+
+  void* data = nullptr;
+  if (!Check(env, napi_unwrap(env, value, &data))) {
+    return false;
+  }
+  *out = *static_cast<CancellationPtr*>(data);
+  return true;
+}
+
+// Reads an optional numeric property of a limits object. `*present` is false when it is absent.
+bool ReadLimitNumber(napi_env env, napi_value limits, const char* name, bool* present, double* out) {
+  napi_value value = nullptr;
+  if (!Check(env, napi_get_named_property(env, limits, name, &value))) {
+    return false;
+  }
+  napi_valuetype type = TypeOf(env, value);
+  *present = type != napi_undefined;
+  if (!*present) {
+    return true;
+  }
+  if (type != napi_number) {
+    ThrowTypeError(env, std::string("limits.") + name + " must be a number");
+    return false;
+  }
+  return Check(env, napi_get_value_double(env, value, out));
+}
+
+// Reads an optional non-negative integer count; zero keeps the runtime default.
+bool ReadLimitCount(napi_env env, napi_value limits, const char* name, uint64_t* out) {
+  bool present = false;
+  double count = 0;
+  if (!ReadLimitNumber(env, limits, name, &present, &count)) {
+    return false;
+  }
+  if (!present) {
+    return true;
+  }
+  if (!(count >= 0) || count > kMaxSafeInteger || count != std::floor(count)) {
+    std::string message = std::string("limits.") + name + " must be a non-negative integer";
+    napi_throw_range_error(env, "ERR_OUT_OF_RANGE", message.c_str());
+    return false;
+  }
+  *out = static_cast<uint64_t>(count);
+  return true;
+}
+
+// Reads `{ maxOperations, maxRecursionDepth, timeoutMs, cancellation }`. An absent limits argument
+// keeps every runtime default.
+bool ReadLimits(napi_env env, napi_value value, CallLimits* out) {
+  napi_valuetype type = TypeOf(env, value);
+  if (type == napi_undefined || type == napi_null) {
+    return true;
+  }
+  if (type != napi_object) {
+    ThrowTypeError(env, "limits must be an object");
+    return false;
+  }
+  if (!ReadLimitCount(env, value, "maxOperations", &out->limits.max_operations) ||
+      !ReadLimitCount(env, value, "maxRecursionDepth", &out->limits.max_recursion_depth)) {
+    return false;
+  }
+
+  bool has_timeout = false;
+  double timeout_ms = 0;
+  if (!ReadLimitNumber(env, value, "timeoutMs", &has_timeout, &timeout_ms)) {
+    return false;
+  }
+  if (has_timeout) {
+    if (!(timeout_ms > 0) || timeout_ms > kMaxSafeInteger) {
+      napi_throw_range_error(env, "ERR_OUT_OF_RANGE", "limits.timeoutMs must be a positive number");
+      return false;
+    }
+    out->limits.max_duration_micros = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(timeout_ms * 1000)));
+  }
+
+  napi_value cancellation = nullptr;
+  if (!Check(env, napi_get_named_property(env, value, "cancellation", &cancellation))) {
+    return false;
+  }
+  type = TypeOf(env, cancellation);
+  return type == napi_undefined || type == napi_null || UnwrapCancellation(env, cancellation, &out->cancellation);
+}
+
+bool GetArguments(napi_env env, napi_callback_info info, size_t expected, std::vector<napi_value>* args,
+                  napi_value* self) {
+  size_t count = expected;
+  args->assign(expected, nullptr);
+  if (!Check(env, napi_get_cb_info(env, info, &count, args->data(), self, nullptr))) {
+    return false;
+  }
+  // Missing trailing arguments read as undefined.
+  for (size_t index = count; index < expected; ++index) {
+    (*args)[index] = Undefined(env);
+  }
+  return true;
+}
+
+void FinalizeNativeBuffer(napi_env /*env*/, void* /*data*/, void* hint) {
+  std::unique_ptr<NxBuffer> buffer(static_cast<NxBuffer*>(hint));
+  nx_free_buffer(*buffer);
+}
+
+// Hands ownership of a native buffer to a JavaScript Buffer without copying it. Runtimes that forbid
+// external buffers get a copy instead.
+napi_value TakeBuffer(napi_env env, NxBuffer* buffer) {
+  NxBuffer owned = std::exchange(*buffer, kEmptyBuffer);
+  napi_value result = nullptr;
+  if (owned.ptr == nullptr || owned.len == 0) {
+    nx_free_buffer(owned);
+    void* data = nullptr;
+    return Check(env, napi_create_buffer(env, 0, &data, &result)) ? result : nullptr;
+  }
+
+  auto hint = std::make_unique<NxBuffer>(owned);
+  if (napi_create_external_buffer(env, owned.len, owned.ptr, FinalizeNativeBuffer, hint.get(), &result) ==
+      napi_ok) {
+    hint.release();
+    return result;
+  }
+
+  napi_status status = napi_create_buffer_copy(env, owned.len, owned.ptr, nullptr, &result);
+  nx_free_buffer(owned);
+  return Check(env, status) ? result : nullptr;
+}
+
+// One native call run on the libuv thread pool.
+//
+// Execute runs on a worker thread and must not touch JavaScript values; everything it needs is
+// copied into the call when it is queued.
+class NativeCall {
+ public:
+  explicit NativeCall(uint32_t output_format) : output_format_(output_format) {}
+  virtual ~NativeCall() { nx_free_buffer(buffer_); }
+
+  NativeCall(const NativeCall&) = delete;
+  NativeCall& operator=(const NativeCall&) = delete;
+
+  static napi_value Queue(napi_env env, std::unique_ptr<NativeCall> call, const char* resource_name);
+
+ protected:
+  virtual NxEvalStatus Execute(NxBuffer* out_buffer) = 0;
+
+  // Builds the resolved value on the JavaScript thread; returns nullptr with an exception pending
+  // on failure.
+  virtual napi_value Resolve(napi_env env) { return TakeBuffer(env, &buffer_); }
+
+  uint32_t output_format() const { return output_format_; }
+
+  NxBuffer buffer_ = kEmptyBuffer;
+
+ private:
+  static void ExecuteWork(napi_env env, void* data);
+  static void CompleteWork(napi_env env, napi_status status, void* data);
+
+  napi_value CreateError(napi_env env);
+
+  uint32_t output_format_;
+  NxEvalStatus status_ = NxEvalStatus_Panic;
+  napi_async_work work_ = nullptr;
+  napi_deferred deferred_ = nullptr;
+};
+
+napi_value NativeCall::Queue(napi_env env, std::unique_ptr<NativeCall> call, const char* resource_name) {
+  napi_value promise = nullptr;
+  napi_value name = nullptr;
+  if (!Check(env, napi_create_promise(env, &call->deferred_, &promise)) ||
+      !Check(env, napi_create_string_utf8(env, resource_name, NAPI_AUTO_LENGTH, &name)) ||
+      !Check(env, napi_create_async_work(env, nullptr, name, ExecuteWork, CompleteWork, call.get(), &call->work_))) {
+    return nullptr;
+  }
+  if (!Check(env, napi_queue_async_work(env, call->work_))) {
+    napi_delete_async_work(env, call->work_);
+    return nullptr;
+  }
+  call.release();
+  return promise;
+}
+
+void NativeCall::ExecuteWork(napi_env /*env*/, void* data) {
+  auto* call = static_cast<NativeCall*>(data);
+  call->status_ = call->Execute(&call->buffer_);
+}
+
+void NativeCall::CompleteWork(napi_env env, napi_status status, void* data) {
+  std::unique_ptr<NativeCall> call(static_cast<NativeCall*>(data));
+  napi_delete_async_work(env, call->work_);
+
+  napi_value settlement = nullptr;
+  bool resolved = false;
+  if (status == napi_cancelled) {
+    napi_value message = nullptr;
+    napi_create_string_utf8(env, "NX native call was cancelled", NAPI_AUTO_LENGTH, &message);
+    napi_create_error(env, nullptr, message, &settlement);
+  } else if (call->status_ == NxEvalStatus_Ok) {
+    settlement = call->Resolve(env);
+    resolved = settlement != nullptr;
+  } else {
+    settlement = call->CreateError(env);
+  }
+
+  if (settlement == nullptr) {
+    napi_get_and_clear_last_exception(env, &settlement);
+  }
+  if (resolved) {
+    napi_resolve_deferred(env, call->deferred_, settlement);
+  } else {
+    napi_reject_deferred(env, call->deferred_, settlement);
+  }
+}
+
+// Creates the rejection for a non-Ok status. The JavaScript wrapper decodes `diagnostics` using
+// `outputFormat` and rethrows an NxEvaluationError.
+napi_value NativeCall::CreateError(napi_env env) {
+  const char* code = "NX_PANIC";
+  const char* text = "NX native runtime panicked";
+  switch (status_) {
+    case NxEvalStatus_Error:
+      code = "NX_EVAL_ERROR";
+      text = "NX evaluation failed";
+      break;
+    case NxEvalStatus_InvalidArgument:
+      code = "NX_INVALID_ARGUMENT";
+      text = "NX native runtime rejected an invalid argument";
+      break;
+    default:
+      break;
+  }
+
+  napi_value error = nullptr;
+  napi_value code_value = nullptr;
+  napi_value message = nullptr;
+  napi_value status = nullptr;
+  napi_value format = nullptr;
+  napi_value diagnostics = TakeBuffer(env, &buffer_);
+  if (diagnostics == nullptr || !Check(env, napi_create_string_utf8(env, code, NAPI_AUTO_LENGTH, &code_value)) ||
+      !Check(env, napi_create_string_utf8(env, text, NAPI_AUTO_LENGTH, &message)) ||
+      !Check(env, napi_create_error(env, code_value, message, &error)) ||
+      !Check(env, napi_create_uint32(env, static_cast<uint32_t>(status_), &status)) ||
+      !Check(env, napi_create_uint32(env, output_format_, &format)) ||
+      !Check(env, napi_set_named_property(env, error, "status", status)) ||
+      !Check(env, napi_set_named_property(env, error, "outputFormat", format)) ||
+      !Check(env, napi_set_named_property(env, error, "diagnostics", diagnostics))) {
+    return nullptr;
+  }
+  return error;
+}
+
+class EvalCall final : public NativeCall {
+ public:
+  EvalCall(ArtifactPtr artifact, uint32_t output_format, CallLimits limits)
+      : NativeCall(output_format), artifact_(std::move(artifact)), limits_(std::move(limits)) {}
+
+ protected:
+  NxEvalStatus Execute(NxBuffer* out_buffer) override {
+    return nx_eval_program_artifact_with_limits(artifact_.get(), limits_.get(), output_format(), out_buffer);
+  }
+
+ private:
+  ArtifactPtr artifact_;
+  CallLimits limits_;
+};
+
+class ComponentInitCall final : public NativeCall {
+ public:
+  ComponentInitCall(ArtifactPtr artifact, std::string component_name, Bytes props, uint32_t output_format,
+                    CallLimits limits)
+      : NativeCall(output_format),
+        artifact_(std::move(artifact)),
+        component_name_(std::move(component_name)),
+        props_(std::move(props)),
+        limits_(std::move(limits)) {}
+
+ protected:
+  NxEvalStatus Execute(NxBuffer* out_buffer) override {
+    return nx_component_init_program_artifact_with_limits(
+        artifact_.get(), reinterpret_cast<const uint8_t*>(component_name_.data()), component_name_.size(),
+        props_.data(), props_.size(), limits_.get(), output_format(), out_buffer);
+  }
+
+ private:
+  ArtifactPtr artifact_;
+  std::string component_name_;
+  Bytes props_;
+  CallLimits limits_;
+};
+
+class ComponentEvaluateCall final : public NativeCall {
+ public:
+  ComponentEvaluateCall(ArtifactPtr artifact, std::string component_name, Bytes props, Bytes state,
+                        uint32_t output_format, CallLimits limits)
+      : NativeCall(output_format),
+        artifact_(std::move(artifact)),
+        component_name_(std::move(component_name)),
+        props_(std::move(props)),
+        state_(std::move(state)),
+        limits_(std::move(limits)) {}
+
+ protected:
+  NxEvalStatus Execute(NxBuffer* out_buffer) override {
+    return nx_component_evaluate_program_artifact_with_limits(
+        artifact_.get(), reinterpret_cast<const uint8_t*>(component_name_.data()), component_name_.size(),
+        props_.data(), props_.size(), state_.data(), state_.size(), limits_.get(), output_format(), out_buffer);
+  }
+
+ private:
+  ArtifactPtr artifact_;
+  std::string component_name_;
+  Bytes props_;
+  Bytes state_;
+  CallLimits limits_;
+};
+
+class ComponentDispatchCall final : public NativeCall {
+ public:
+  ComponentDispatchCall(ArtifactPtr artifact, Bytes state_snapshot, Bytes actions, uint32_t output_format,
+                        CallLimits limits)
+      : NativeCall(output_format),
+        artifact_(std::move(artifact)),
+        state_snapshot_(std::move(state_snapshot)),
+        actions_(std::move(actions)),
+        limits_(std::move(limits)) {}
+
+ protected:
+  NxEvalStatus Execute(NxBuffer* out_buffer) override {
+    return nx_component_dispatch_actions_program_artifact_with_limits(
+        artifact_.get(), state_snapshot_.data(), state_snapshot_.size(), actions_.data(), actions_.size(),
+        limits_.get(), output_format(), out_buffer);
+  }
+
+ private:
+  ArtifactPtr artifact_;
+  Bytes state_snapshot_;
+  Bytes actions_;
+  CallLimits limits_;
+};
+
+class SerializeCall final : public NativeCall {
+ public:
+  explicit SerializeCall(ArtifactPtr artifact)
+      : NativeCall(NxOutputFormat_MessagePack), artifact_(std::move(artifact)) {}
+
+ protected:
+  NxEvalStatus Execute(NxBuffer* out_buffer) override {
+    return nx_serialize_program_artifact(artifact_.get(), out_buffer);
+  }
+
+ private:
+  ArtifactPtr artifact_;
+};
+
+napi_value NewArtifactObject(napi_env env, ArtifactPtr artifact);
+
+// Base for calls that produce a program artifact. Build diagnostics are always MessagePack.
+class BuildCall : public NativeCall {
+ public:
+  BuildCall() : NativeCall(NxOutputFormat_MessagePack) {}
+  ~BuildCall() override {
+    if (handle_ != nullptr) {
+      nx_free_program_artifact(handle_);
+    }
+  }
+
+ protected:
+  napi_value Resolve(napi_env env) override {
+    ArtifactPtr artifact(std::exchange(handle_, nullptr), nx_free_program_artifact);
+    return NewArtifactObject(env, std::move(artifact));
+  }
+
+  NxProgramArtifactHandle* handle_ = nullptr;
+};
+
+class SourceBuildCall final : public BuildCall {
+ public:
+  SourceBuildCall(BuildContextPtr build_context, std::string source, std::string file_name)
+      : build_context_(std::move(build_context)), source_(std::move(source)), file_name_(std::move(file_name)) {}
+
+ protected:
+  NxEvalStatus Execute(NxBuffer* out_buffer) override {
+    return nx_build_program_artifact(build_context_.get(), reinterpret_cast<const uint8_t*>(source_.data()),
+                                     source_.size(), reinterpret_cast<const uint8_t*>(file_name_.data()),
+                                     file_name_.size(), &handle_, out_buffer);
+  }
+
+ private:
+  BuildContextPtr build_context_;
+  std::string source_;
+  std::string file_name_;
+};
+
+class WorkspaceBuildCall final : public BuildCall {
+ public:
+  WorkspaceBuildCall(BuildContextPtr build_context, std::vector<std::pair<std::string, std::string>> modules,
+                     std::string entry_identity)
+      : build_context_(std::move(build_context)),
+        modules_(std::move(modules)),
+        entry_identity_(std::move(entry_identity)) {}
+
+ protected:
+  NxEvalStatus Execute(NxBuffer* out_buffer) override {
+    std::vector<NxWorkspaceModule> descriptors;
+    descriptors.reserve(modules_.size());
+    for (const auto& [identity, source] : modules_) {
+      descriptors.push_back(NxWorkspaceModule{reinterpret_cast<const uint8_t*>(identity.data()), identity.size(),
+                                              reinterpret_cast<const uint8_t*>(source.data()), source.size()});
+    }
+    return nx_build_workspace_program_artifact(build_context_.get(), descriptors.data(), descriptors.size(),
+                                               reinterpret_cast<const uint8_t*>(entry_identity_.data()),
+                                               entry_identity_.size(), &handle_, out_buffer);
+  }
+
+ private:
+  BuildContextPtr build_context_;
+  std::vector<std::pair<std::string, std::string>> modules_;
+  std::string entry_identity_;
+};
+
+class ImageLoadCall final : public BuildCall {
+ public:
+  explicit ImageLoadCall(Bytes image) : image_(std::move(image)) {}
+
+ protected:
+  NxEvalStatus Execute(NxBuffer* out_buffer) override {
+    return nx_load_program_artifact(image_.data(), image_.size(), &handle_, out_buffer);
+  }
+
+ private:
+  Bytes image_;
+};
+
+void FinalizeArtifactWrapper(napi_env /*env*/, void* data, void* /*hint*/) {
+  delete static_cast<ArtifactWrapper*>(data);
+}
+
+napi_value NewArtifactObject(napi_env env, ArtifactPtr artifact) {
+  AddonData* addon = GetAddonData(env);
+  napi_value constructor = nullptr;
+  napi_value external = nullptr;
+  napi_value instance = nullptr;
+  if (addon == nullptr || !Check(env, napi_get_reference_value(env, addon->artifact_constructor, &constructor)) ||
+      !Check(env, napi_create_external(env, &artifact, nullptr, nullptr, &external)) ||
+      !Check(env, napi_new_instance(env, constructor, 1, &external, &instance))) {
+    return nullptr;
+  }
+  return instance;
+}
+
+// ProgramArtifact objects are only created by the build functions, which pass the native handle
+// through an external value.
+napi_value ArtifactConstructor(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  napi_value self = nullptr;
+  if (!GetArguments(env, info, 1, &args, &self)) {
+    return nullptr;
+  }
+  if (TypeOf(env, args[0]) != napi_external) {
+    return ThrowTypeError(env, "ProgramArtifact cannot be constructed directly; use buildProgramArtifact");
+  }
+
+  void* data = nullptr;
+  if (!Check(env, napi_get_value_external(env, args[0], &data))) {
+    return nullptr;
+  }
+  auto wrapper = std::make_unique<ArtifactWrapper>();
+  wrapper->artifact = *static_cast<ArtifactPtr*>(data);
+  if (!Check(env, napi_wrap(env, self, wrapper.get(), FinalizeArtifactWrapper, nullptr, nullptr))) {
+    return nullptr;
+  }
+  wrapper.release();
+  return self;
+}
+
+// Reads the receiver's artifact for a method call, throwing once the artifact was closed.
+bool GetArtifact(napi_env env, napi_value self, ArtifactPtr* out) {
+  void* data = nullptr;
+  if (!Check(env, napi_unwrap(env, self, &data))) {
+    return false;
+  }
+  ArtifactPtr artifact = static_cast<ArtifactWrapper*>(data)->artifact;
+  if (!artifact) {
+    napi_throw_error(env, "ERR_NX_ARTIFACT_CLOSED", "program artifact is closed");
+    return false;
+  }
+  *out = std::move(artifact);
+  return true;
+}
+
+napi_value ArtifactEvaluate(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  napi_value self = nullptr;
+  ArtifactPtr artifact;
+  uint32_t format = 0;
+  CallLimits limits;
+  if (!GetArguments(env, info, 2, &args, &self) || !GetArtifact(env, self, &artifact) ||
+      !ReadOutputFormat(env, args[0], &format) || !ReadLimits(env, args[1], &limits)) {
+    return nullptr;
+  }
+  return NativeCall::Queue(env, std::make_unique<EvalCall>(std::move(artifact), format, std::move(limits)),
+                           "nx:evaluate");
+}
+
+napi_value ArtifactInitComponent(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  napi_value self = nullptr;
+  ArtifactPtr artifact;
+  std::string component_name;
+  Bytes props;
+  uint32_t format = 0;
+  CallLimits limits;
+  if (!GetArguments(env, info, 4, &args, &self) || !GetArtifact(env, self, &artifact) ||
+      !ReadString(env, args[0], "componentName", &component_name) ||
+      !ReadBytes(env, args[1], "props", true, &props) || !ReadOutputFormat(env, args[2], &format) ||
+      !ReadLimits(env, args[3], &limits)) {
+    return nullptr;
+  }
+  return NativeCall::Queue(env,
+                           std::make_unique<ComponentInitCall>(std::move(artifact), std::move(component_name),
+                                                               std::move(props), format, std::move(limits)),
+                           "nx:initComponent");
+}
+
+napi_value ArtifactEvaluateComponent(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  napi_value self = nullptr;
+  ArtifactPtr artifact;
+  std::string component_name;
+  Bytes props;
+  Bytes state;
+  uint32_t format = 0;
+  CallLimits limits;
+  if (!GetArguments(env, info, 5, &args, &self) || !GetArtifact(env, self, &artifact) ||
+      !ReadString(env, args[0], "componentName", &component_name) ||
+      !ReadBytes(env, args[1], "props", true, &props) || !ReadBytes(env, args[2], "state", true, &state) ||
+      !ReadOutputFormat(env, args[3], &format) || !ReadLimits(env, args[4], &limits)) {
+    return nullptr;
+  }
+  return NativeCall::Queue(
+      env,
+      std::make_unique<ComponentEvaluateCall>(std::move(artifact), std::move(component_name), std::move(props),
+                                              std::move(state), format, std::move(limits)),
+      "nx:evaluateComponent");
+}
+
+napi_value ArtifactDispatchActions(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  napi_value self = nullptr;
+  ArtifactPtr artifact;
+  Bytes state_snapshot;
+  Bytes actions;
+  uint32_t format = 0;
+  CallLimits limits;
+  if (!GetArguments(env, info, 4, &args, &self) || !GetArtifact(env, self, &artifact) ||
+      !ReadBytes(env, args[0], "stateSnapshot", false, &state_snapshot) ||
+      !ReadBytes(env, args[1], "actions", false, &actions) || !ReadOutputFormat(env, args[2], &format) ||
+      !ReadLimits(env, args[3], &limits)) {
+    return nullptr;
+  }
+  return NativeCall::Queue(
+      env,
+      std::make_unique<ComponentDispatchCall>(std::move(artifact), std::move(state_snapshot), std::move(actions),
+                                              format, std::move(limits)),
+      "nx:dispatchActions");
+}
+
+napi_value ArtifactSerialize(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  napi_value self = nullptr;
+  ArtifactPtr artifact;
+  if (!GetArguments(env, info, 0, &args, &self) || !GetArtifact(env, self, &artifact)) {
+    return nullptr;
+  }
+  return NativeCall::Queue(env, std::make_unique<SerializeCall>(std::move(artifact)), "nx:serialize");
+}
+
+// Drops this object's reference to the native artifact. Calls already queued keep it alive until
+// they finish.
+napi_value ArtifactClose(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  napi_value self = nullptr;
+  void* data = nullptr;
+  if (!GetArguments(env, info, 0, &args, &self) || !Check(env, napi_unwrap(env, self, &data))) {
+    return nullptr;
+  }
+  static_cast<ArtifactWrapper*>(data)->artifact.reset();
+  return Undefined(env);
+}
+
+// Creates a cancellation handle for the `cancellation` field of a limits object.
+napi_value CreateCancellation(napi_env env, napi_callback_info /*info*/) {
+  NxCancellationHandle* handle = nullptr;
+  if (nx_create_cancellation_handle(&handle) != NxEvalStatus_Ok || handle == nullptr) {
+    napi_throw_error(env, "ERR_NX_CANCELLATION", "could not create an NX cancellation handle");
+    return nullptr;
+  }
+
+  auto owned = std::make_unique<CancellationPtr>(handle, nx_free_cancellation_handle);
+  napi_value object = nullptr;
+  if (!Check(env, napi_create_object(env, &object)) ||
+      !Check(env, napi_type_tag_object(env, object, &kCancellationTag)) ||
+      !Check(env, napi_wrap(env, object, owned.get(), FinalizeCancellation, nullptr, nullptr))) {
+    return nullptr;
+  }
+  owned.release();
+  return object;
+}
+
+// Stops every running and future call that was given the handle. Safe at any time, including while
+// those calls run on the thread pool.
+napi_value Cancel(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  CancellationPtr cancellation;
+  if (!GetArguments(env, info, 1, &args, nullptr) || !UnwrapCancellation(env, args[0], &cancellation)) {
+    return nullptr;
+  }
+  nx_cancel(cancellation.get());
+  return Undefined(env);
+}
+
+napi_value BuildProgramArtifact(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  AddonData* addon = GetAddonData(env);
+  std::string source;
+  std::string file_name = "main.nx";
+  if (addon == nullptr || !GetArguments(env, info, 2, &args, nullptr) ||
+      !ReadString(env, args[0], "source", &source) ||
+      (TypeOf(env, args[1]) != napi_undefined && !ReadString(env, args[1], "fileName", &file_name))) {
+    return nullptr;
+  }
+  return NativeCall::Queue(
+      env, std::make_unique<SourceBuildCall>(addon->build_context, std::move(source), std::move(file_name)),
+      "nx:buildProgramArtifact");
+}
+
+napi_value BuildWorkspaceProgramArtifact(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  AddonData* addon = GetAddonData(env);
+  std::string entry_identity;
+  bool is_array = false;
+  if (addon == nullptr || !GetArguments(env, info, 2, &args, nullptr) ||
+      !Check(env, napi_is_array(env, args[0], &is_array))) {
+    return nullptr;
+  }
+  if (!is_array) {
+    return ThrowTypeError(env, "modules must be an array of { identity, source } objects");
+  }
+
+  uint32_t length = 0;
+  if (!Check(env, napi_get_array_length(env, args[0], &length))) {
+    return nullptr;
+  }
+  std::vector<std::pair<std::string, std::string>> modules(length);
+  for (uint32_t index = 0; index < length; ++index) {
+    napi_value module = nullptr;
+    napi_value identity = nullptr;
+    napi_value source = nullptr;
+    if (!Check(env, napi_get_element(env, args[0], index, &module))) {
+      return nullptr;
+    }
+    if (TypeOf(env, module) != napi_object) {
+      return ThrowTypeError(env, "modules must be an array of { identity, source } objects");
+    }
+    if (!Check(env, napi_get_named_property(env, module, "identity", &identity)) ||
+        !Check(env, napi_get_named_property(env, module, "source", &source)) ||
+        !ReadString(env, identity, "module identity", &modules[index].first) ||
+        !ReadString(env, source, "module source", &modules[index].second)) {
+      return nullptr;
+    }
+  }
+  if (!ReadString(env, args[1], "entryIdentity", &entry_identity)) {
+    return nullptr;
+  }
+
+  return NativeCall::Queue(env,
+                           std::make_unique<WorkspaceBuildCall>(addon->build_context, std::move(modules),
+                                                                std::move(entry_identity)),
+                           "nx:buildWorkspaceProgramArtifact");
+}
+
+napi_value LoadProgramArtifact(napi_env env, napi_callback_info info) {
+  std::vector<napi_value> args;
+  Bytes image;
+  if (!GetArguments(env, info, 1, &args, nullptr) || !ReadBytes(env, args[0], "image", false, &image)) {
+    return nullptr;
+  }
+  return NativeCall::Queue(env, std::make_unique<ImageLoadCall>(std::move(image)), "nx:loadProgramArtifact");
+}
+
+void FinalizeAddonData(napi_env env, void* data, void* /*hint*/) {
+  std::unique_ptr<AddonData> addon(static_cast<AddonData*>(data));
+  if (addon->artifact_constructor != nullptr) {
+    napi_delete_reference(env, addon->artifact_constructor);
+  }
+}
+
+BuildContextPtr CreateEmptyBuildContext(napi_env env) {
+  NxLibraryRegistryHandle* registry = nullptr;
+  NxProgramBuildContextHandle* build_context = nullptr;
+  NxEvalStatus status = nx_create_library_registry(&registry);
+  if (status == NxEvalStatus_Ok) {
+    status = nx_create_program_build_context(registry, &build_context);
+    nx_free_library_registry(registry);
+  }
+  if (status == NxEvalStatus_Ok) {
+    // Builds already run on libuv pool threads, so keep each build's analysis on that thread.
+    status = nx_set_program_build_context_analysis_workers(build_context, 1);
+  }
+  if (status != NxEvalStatus_Ok) {
+    napi_throw_error(env, "ERR_NX_INIT", "failed to create the NX program build context");
+    return nullptr;
+  }
+  return BuildContextPtr(build_context, nx_free_program_build_context);
+}
+
+// Returns a promise rejected with the exception an entry point left pending.
+napi_value RejectPendingException(napi_env env) {
+  napi_value error = nullptr;
+  napi_value promise = nullptr;
+  napi_deferred deferred = nullptr;
+  if (napi_get_and_clear_last_exception(env, &error) != napi_ok ||
+      napi_create_promise(env, &deferred, &promise) != napi_ok) {
+    return nullptr;
+  }
+  napi_reject_deferred(env, deferred, error);
+  return promise;
+}
+
+// Adapts an async entry point so that argument validation failures, which the entry point reports
+// by returning nullptr with an exception pending, reject the returned promise instead of throwing
+// synchronously.
+template <napi_callback Entry>
+napi_value Async(napi_env env, napi_callback_info info) {
+  napi_value promise = Entry(env, info);
+  return promise != nullptr ? promise : RejectPendingException(env);
+}
+
+bool SetFunction(napi_env env, napi_value exports, const char* name, napi_callback callback) {
+  napi_value function = nullptr;
+  return Check(env, napi_create_function(env, name, NAPI_AUTO_LENGTH, callback, nullptr, &function)) &&
+         Check(env, napi_set_named_property(env, exports, name, function));
+}
+
+napi_value Init(napi_env env, napi_value exports) {
+  uint32_t abi_version = nx_ffi_abi_version();
+  if (abi_version != NX_FFI_ABI_VERSION) {
+    std::string message = "NX native runtime ABI version " + std::to_string(abi_version) +
+                          " does not match the version this addon was built against (" +
+                          std::to_string(NX_FFI_ABI_VERSION) + ")";
+    napi_throw_error(env, "ERR_NX_ABI_MISMATCH", message.c_str());
+    return nullptr;
+  }
+
+  auto addon = std::make_unique<AddonData>();
+  addon->build_context = CreateEmptyBuildContext(env);
+  if (!addon->build_context) {
+    return nullptr;
+  }
+
+  const napi_property_descriptor methods[] = {
+      {"evaluate", nullptr, Async<ArtifactEvaluate>, nullptr, nullptr, nullptr, napi_default_method, nullptr},
+      {"initComponent", nullptr, Async<ArtifactInitComponent>, nullptr, nullptr, nullptr, napi_default_method, nullptr},
+      {"evaluateComponent", nullptr, Async<ArtifactEvaluateComponent>, nullptr, nullptr, nullptr, napi_default_method, nullptr},
+      {"dispatchActions", nullptr, Async<ArtifactDispatchActions>, nullptr, nullptr, nullptr, napi_default_method, nullptr},
+      {"serialize", nullptr, Async<ArtifactSerialize>, nullptr, nullptr, nullptr, napi_default_method, nullptr},
+      {"close", nullptr, ArtifactClose, nullptr, nullptr, nullptr, napi_default_method, nullptr},
+  };
+  napi_value constructor = nullptr;
+  napi_value abi = nullptr;
+  if (!Check(env, napi_define_class(env, "ProgramArtifact", NAPI_AUTO_LENGTH, ArtifactConstructor, nullptr,
+                                    sizeof(methods) / sizeof(methods[0]), methods, &constructor)) ||
+      !Check(env, napi_create_reference(env, constructor, 1, &addon->artifact_constructor))) {
+    return nullptr;
+  }
+  // The environment owns the addon data from here on and finalizes it on teardown.
+  AddonData* data = addon.release();
+  if (!Check(env, napi_set_instance_data(env, data, FinalizeAddonData, nullptr))) {
+    FinalizeAddonData(env, data, nullptr);
+    return nullptr;
+  }
+
+  if (!Check(env, napi_set_named_property(env, exports, "ProgramArtifact", constructor)) ||
+      !Check(env, napi_create_uint32(env, abi_version, &abi)) ||
+      !Check(env, napi_set_named_property(env, exports, "abiVersion", abi)) ||
+      !SetFunction(env, exports, "buildProgramArtifact", Async<BuildProgramArtifact>) ||
+      !SetFunction(env, exports, "buildWorkspaceProgramArtifact", Async<BuildWorkspaceProgramArtifact>) ||
+      !SetFunction(env, exports, "loadProgramArtifact", Async<LoadProgramArtifact>) ||
+      !SetFunction(env, exports, "createCancellation", CreateCancellation) ||
+      !SetFunction(env, exports, "cancel", Cancel)) {
+    return nullptr;
+  }
+  return exports;
+}
+
+}  // namespace
+
+NAPI_MODULE_INIT() { return Init(env, exports); }
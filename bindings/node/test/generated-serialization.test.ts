@@ -0,0 +1,211 @@
+import assert from 'node:assert/strict';
+import { execFileSync } from 'node:child_process';
+import { mkdirSync, readFileSync } from 'node:fs';
+import { createRequire } from 'node:module';
+import { test } from 'node:test';
+import { fileURLToPath, pathToFileURL } from 'node:url';
+import type * as Generated from './generated/track-types.ts';
+
+const require = createRequire(import.meta.url);
+const { buildProgramArtifact } = require('..');
+
+type Track = Generated.Track;
+
+const repoRoot = fileURLToPath(new URL('../../../', import.meta.url));
+const trackTypesPath = fileURLToPath(new URL('./fixtures/track-types.nx', import.meta.url));
+const trackTypes = readFileSync(trackTypesPath, 'utf8');
+
+// Generates the codecs under test with `nxlang generate --serializers`, so the assertions below
+// always run against what the generator currently emits. Set NXLANG to use a prebuilt CLI.
+function generateCodecs(): string {
+  const outputDir = fileURLToPath(new URL('./generated/', import.meta.url));
+  const output = `${outputDir}track-types.ts`;
+  mkdirSync(outputDir, { recursive: true });
+  const args = ['generate', trackTypesPath, '--language', 'typescript', '--serializers', '--output', output];
+  if (process.env.NXLANG) {
+    execFileSync(process.env.NXLANG, args, { stdio: 'inherit' });
+  } else {
+    execFileSync('cargo', ['run', '--quiet', '-p', 'nx-cli', '--', ...args], {
+      cwd: repoRoot,
+      stdio: 'inherit',
+    });
+  }
+  return output;
+}
+
+const { NxMessagePackReader, NxMessagePackWriter, decodeTrack, encodeTrack }: typeof Generated =
+  await import(pathToFileURL(generateCodecs()).href);
+
+function roundTrip(track: Track): Track {
+  const writer = new NxMessagePackWriter();
+  encodeTrack(writer, track);
+  return decodeTrack(new NxMessagePackReader(writer.finish()));
+}
+
+const sampleTrack: Track = {
+  $type: 'Track',
+  title: 'Intro',
+  note: null,
+  plays: 1,
+  delta: 2,
+  low: 3,
+  high: 4,
+  rating: 1.5,
+  retryable: true,
+  meta: null,
+};
+
+function str(value: string): Uint8Array {
+  const writer = new NxMessagePackWriter();
+  writer.writeString(value);
+  return writer.finish();
+}
+
+function concat(...parts: (Uint8Array | number[])[]): Uint8Array {
+  return Uint8Array.from(parts.flatMap((part) => Array.from(part)));
+}
+
+test('decodes and re-encodes a runtime payload with long strings and safe integer boundaries', async () => {
+  const title = 'T'.repeat(40);
+  const note = 'N'.repeat(300);
+  const artifact = await buildProgramArtifact(`${trackTypes}
+    let root(): Track = {
+      <Track title={"${title}"} note={"${note}"} plays={9007199254740991} delta={-5}
+        low={-9007199254740991} high={4294967296} rating={4.25} retryable={false}
+        meta={<Meta label={"nested"} depth={2} />} />
+    }
+  `);
+  const payload = await artifact.evaluate();
+
+  const track = decodeTrack(new NxMessagePackReader(payload));
+
+  assert.equal(track.title, title);
+  assert.equal(track.note, note);
+  assert.equal(track.plays, 9007199254740991);
+  assert.equal(track.delta, -5);
+  assert.equal(track.low, -9007199254740991);
+  assert.equal(track.high, 4294967296);
+  assert.equal(track.rating, 4.25);
+  assert.equal(track.retryable, false);
+  assert.deepEqual(track.meta, { $type: 'Meta', label: 'nested', depth: 2 });
+  assert.deepEqual(roundTrip(track), track);
+});
+
+test('rejects int64 fields beyond the safe integer range instead of rounding them', async () => {
+  const artifact = await buildProgramArtifact(`${trackTypes}
+    let root(): Track = {
+      <Track title={"Max"} note={null} plays={9223372036854775807} delta={0}
+        low={-9223372036854775807 - 1} high={0} rating={0.5} meta={null} />
+    }
+  `);
+  const payload = await artifact.evaluate();
+
+  assert.throws(() => decodeTrack(new NxMessagePackReader(payload)), {
+    name: 'RangeError',
+    message: /outside the safe JavaScript integer range/,
+  });
+
+  const value = new NxMessagePackReader(payload).readValue() as Record<string, unknown>;
+  assert.equal(value.plays, 9223372036854775807n);
+  assert.equal(value.low, -9223372036854775808n);
+});
+
+test('writes integers exactly and never as floats', () => {
+  const writer = new NxMessagePackWriter();
+  writer.writeInteger(9223372036854775807n);
+  writer.writeInteger(-9223372036854775808n);
+  writer.writeInteger(42n);
+  writer.writeInteger(-9007199254740991);
+  const reader = new NxMessagePackReader(writer.finish());
+
+  assert.equal(reader.readValue(), 9223372036854775807n);
+  assert.equal(reader.readValue(), -9223372036854775808n);
+  assert.equal(reader.readInteger(), 42);
+  assert.equal(reader.readInteger(), -9007199254740991);
+
+  assert.throws(() => new NxMessagePackWriter().writeInteger(2 ** 63), RangeError);
+  assert.throws(() => new NxMessagePackWriter().writeInteger(1.5), RangeError);
+  assert.throws(() => new NxMessagePackWriter().writeInteger(9223372036854775808n), RangeError);
+  assert.throws(() => encodeTrack(new NxMessagePackWriter(), { ...sampleTrack, plays: 2 ** 53 }), RangeError);
+});
+
+test('decodes nil fields from a runtime payload', async () => {
+  const artifact = await buildProgramArtifact(`${trackTypes}
+    let root(): Track = {
+      <Track title={"Intro"} note={null} plays={0} delta={-32} low={-33} high={127} rating={0.5}
+        meta={null} />
+    }
+  `);
+  const payload = await artifact.evaluate();
+
+  const track = decodeTrack(new NxMessagePackReader(payload));
+
+  assert.equal(track.note, null);
+  assert.equal(track.meta, null);
+  assert.equal(track.delta, -32);
+  assert.equal(track.low, -33);
+  assert.equal(track.high, 127);
+  assert.equal(track.retryable, true);
+  assert.deepEqual(roundTrip(track), track);
+});
+
+test('reads runtime payloads as prototype-free values', async () => {
+  const artifact = await buildProgramArtifact(`${trackTypes}
+    let root(): Track = {
+      <Track title={"Intro"} note={null} plays={1} delta={2} low={3} high={4} rating={1.5}
+        meta={<Meta label={"nested"} depth={1} />} />
+    }
+  `);
+
+  const value = new NxMessagePackReader(await artifact.evaluate()).readValue() as Record<string, any>;
+
+  assert.equal(Object.getPrototypeOf(value), null);
+  assert.equal(Object.getPrototypeOf(value.meta), null);
+  assert.equal(value.meta.label, 'nested');
+  assert.equal(value.note, null);
+});
+
+test('skips bin and ext values and applies field defaults for missing keys', () => {
+  const payload = concat(
+    [0x87],
+    str('title'),
+    str('Intro'),
+    str('cover'),
+    [0xc5, 0x01, 0x2c],
+    new Uint8Array(300).fill(7),
+    str('checksum'),
+    [0xc4, 0x03, 0x01, 0x02, 0x03],
+    str('stamp'),
+    [0xc7, 0x04, 0x01, 0xde, 0xad, 0xbe, 0xef],
+    str('flag'),
+    [0xd4, 0x02, 0xff],
+    str('digest'),
+    [0xd8, 0x03],
+    new Uint8Array(16).fill(9),
+    str('plays'),
+    [0x03],
+  );
+
+  const track = decodeTrack(new NxMessagePackReader(payload));
+
+  assert.equal(track.title, 'Intro');
+  assert.equal(track.plays, 3);
+  assert.equal(track.retryable, true);
+  assert.equal(track.note, undefined);
+});
+
+test('keeps a __proto__ payload key as a plain entry', () => {
+  const writer = new NxMessagePackWriter();
+  writer.writeMapHeader(1);
+  writer.writeString('__proto__');
+  writer.writeMapHeader(1);
+  writer.writeString('polluted');
+  writer.writeBoolean(true);
+
+  const value = new NxMessagePackReader(writer.finish()).readValue() as Record<string, any>;
+
+  assert.equal(Object.getPrototypeOf(value), null);
+  assert.deepEqual(Object.keys(value), ['__proto__']);
+  assert.equal(value.polluted, undefined);
+  assert.equal(({} as Record<string, unknown>).polluted, undefined);
+});
@@ -0,0 +1,135 @@
+'use strict';
+
+const assert = require('node:assert/strict');
+const { test } = require('node:test');
+const { decode, encode } = require('@msgpack/msgpack');
+const {
+  abiVersion,
+  buildProgramArtifact,
+  buildWorkspaceProgramArtifact,
+  loadProgramArtifact,
+  NxEvaluationError,
+  OutputFormat,
+} = require('..');
+
+function json(buffer) {
+  return JSON.parse(buffer.toString('utf8'));
+}
+
+test('reports the native ABI version', () => {
+  assert.equal(typeof abiVersion, 'number');
+  assert.ok(abiVersion > 0);
+});
+
+test('evaluates a program artifact as JSON and MessagePack', async () => {
+  const artifact = await buildProgramArtifact('let root() = { 40 + 2 }', 'main.nx');
+
+  assert.equal(json(await artifact.evaluate(OutputFormat.Json)), 42);
+  assert.equal(decode(await artifact.evaluate()), 42);
+});
+
+test('evaluates concurrently on one artifact', async () => {
+  const artifact = await buildProgramArtifact('let root() = { 1 + 2 }');
+  const results = await Promise.all(Array.from({ length: 8 }, () => artifact.evaluate(OutputFormat.Json)));
+
+  assert.deepEqual(results.map(json), Array(8).fill(3));
+});
+
+test('builds workspace artifacts from module descriptors', async () => {
+  const artifact = await buildWorkspaceProgramArtifact(
+    [
+      { identity: 'app/main.nx', source: 'import { answer } from "../shared/value.nx"\nlet root(): int = { answer }' },
+      { identity: 'shared/value.nx', source: 'export let answer: int = 42' },
+    ],
+    'app/main.nx',
+  );
+
+  assert.equal(json(await artifact.evaluate(OutputFormat.Json)), 42);
+});
+
+test('rejects static errors with decoded diagnostics', async () => {
+  await assert.rejects(buildProgramArtifact('let root() = { missing }', 'broken.nx'), (error) => {
+    assert.ok(error instanceof NxEvaluationError);
+    assert.equal(error.code, 'NX_EVAL_ERROR');
+    assert.ok(error.diagnostics.length > 0);
+    assert.equal(error.diagnostics[0].severity, 'error');
+    return true;
+  });
+});
+
+test('initializes, renders and dispatches components', async () => {
+  const artifact = await buildProgramArtifact(`
+    component <Counter start:int = 0 /> = {
+      state { count:int = {start} }
+      <p:>{count}</p>
+    }
+  `);
+  const props = encode({ start: 5 });
+
+  const init = decode(await artifact.initComponent('Counter', props));
+  assert.ok(init.state_snapshot instanceof Uint8Array);
+
+  const rendered = await artifact.evaluateComponent('Counter', props, null, OutputFormat.Json);
+  assert.ok(json(rendered) !== null);
+
+  const dispatched = decode(await artifact.dispatchActions(init.state_snapshot, encode([])));
+  assert.deepEqual(dispatched.effects, []);
+});
+
+test('round-trips serialized artifact images', async () => {
+  const artifact = await buildProgramArtifact('let root() = { 7 }');
+  const restored = await loadProgramArtifact(await artifact.serialize());
+
+  assert.equal(json(await restored.evaluate(OutputFormat.Json)), 7);
+});
+
+test('rejects calls after close', async () => {
+  const artifact = await buildProgramArtifact('let root() = { 1 }');
+  const pending = artifact.evaluate(OutputFormat.Json);
+  artifact.close();
+
+  assert.equal(json(await pending), 1);
+  await assert.rejects(artifact.evaluate(), { code: 'ERR_NX_ARTIFACT_CLOSED' });
+});
+
+test('rejects invalid arguments before queueing native work', async () => {
+  const artifact = await buildProgramArtifact('let root() = { 1 }');
+
+  await assert.rejects(artifact.evaluate(9), RangeError);
+  await assert.rejects(artifact.dispatchActions('not bytes', 42), TypeError);
+  await assert.rejects(buildProgramArtifact(42), TypeError);
+});
+
+test('applies evaluation limits and abort signals', async () => {
+  const artifact = await buildProgramArtifact(`
+    let spin(n:int): int = { if n <= 0 { 0 } else { spin(n - 1) + spin(n - 1) } }
+    let root(): int = { spin(40) }
+    component <Busy /> = { <p:>{spin(12)}</p> }
+  `);
+
+  const limits = { maxOperations: 100 };
+  await assert.rejects(artifact.evaluateComponent('Busy', null, null, OutputFormat.Json, limits), (error) => {
+    assert.ok(error instanceof NxEvaluationError);
+    assert.match(error.diagnostics[0].message, /Operation limit exceeded/);
+    return true;
+  });
+  await assert.rejects(artifact.evaluate(OutputFormat.Json, { maxOperations: Number.MAX_SAFE_INTEGER, timeoutMs: 10 }), (error) => {
+    assert.ok(error instanceof NxEvaluationError);
+    assert.equal(error.diagnostics[0].code, 'deadline-exceeded');
+    return true;
+  });
+
+  const controller = new AbortController();
+  const pending = artifact.evaluate(OutputFormat.Json, {
+    maxOperations: Number.MAX_SAFE_INTEGER,
+    signal: controller.signal,
+  });
+  controller.abort(new Error('stop'));
+  await assert.rejects(pending, { message: 'stop' });
+  await assert.rejects(artifact.initComponent('Busy', null, OutputFormat.Json, { signal: controller.signal }), {
+    message: 'stop',
+  });
+
+  await assert.rejects(artifact.evaluate(OutputFormat.Json, { maxOperations: -1 }), RangeError);
+  await assert.rejects(artifact.evaluate(OutputFormat.Json, 'fast'), TypeError);
+});
@@ -0,0 +1,229 @@
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use nx_api::{
+    build_workspace_program_artifact, dispatch_component_actions_program_artifact,
+    eval_program_artifact, eval_program_artifact_runtime,
+    evaluate_resolved_component_program_artifact, initialize_resolved_component_program_artifact,
+    load_program_artifact_from_source, resolve_component_program_artifact,
+    ComponentResolveEvalResult, NxWorkspace, NxWorkspaceModule, ProgramArtifact,
+    ProgramBuildContext, ResolvedComponent,
+};
+use nx_interpreter::Interpreter;
+use nx_value::NxValue;
+use std::collections::BTreeMap;
+use std::fs;
+use std::path::{Path, PathBuf};
+
+fn examples_dir() -> PathBuf {
+    Path::new(env!("CARGO_MANIFEST_DIR")).join("../../examples/nx")
+}
+
+/// Loads every `.nx` file under `examples/nx` as a workspace module keyed by its relative path.
+fn example_workspace_modules() -> Vec<(String, String)> {
+    fn visit(root: &Path, dir: &Path, modules: &mut Vec<(String, String)>) {
+        let mut entries = fs::read_dir(dir)
+            .expect("examples directory should be readable")
+            .map(|entry| entry.expect("examples entry").path())
+            .collect::<Vec<_>>();
+        entries.sort();
+        for path in entries {
+            if path.is_dir() {
+                visit(root, &path, modules);
+            } else if path.extension().is_some_and(|extension| extension == "nx") {
+                let identity = path
+                    .strip_prefix(root)
+                    .expect("example path under root")
+                    .to_string_lossy()
+                    .replace('\\', "/");
+                let source = fs::read_to_string(&path).expect("example source should be UTF-8");
+                modules.push((identity, source));
+            }
+        }
+    }
+
+    let root = examples_dir();
+    let mut modules = Vec::new();
+    visit(&root, &root, &mut modules);
+    modules
+}
+
+/// Builds a workspace of `count` library modules that one entry module imports.
+fn synthetic_workspace_modules(count: usize) -> Vec<(String, String)> {
+    let mut modules = (0..count)
+        .map(|index| {
+            (
+                format!("lib/module{index}.nx"),
+                format!(
+                    "export let value{index}(x:int): int = {{ if x > {index} {{ x - {index} }} else {{ x + {index} }} }}\n\
+                     export component <Card{index} title:string /> = {{ <section title={{title}} /> }}\n"
+                ),
+            )
+        })
+        .collect::<Vec<_>>();
+
+    let mut entry = String::new();
+    for index in 0..count {
+        entry.push_str(&format!(
+            "import {{ value{index}, Card{index} }} from \"../lib/module{index}.nx\"\n"
+        ));
+    }
+    entry.push_str("let root(): int = { 0");
+    for index in 0..count {
+        entry.push_str(&format!(" + value{index}({index})"));
+    }
+    entry.push_str(" }\n");
+    modules.push(("app/main.nx".to_string(), entry));
+    modules
+}
+
+fn workspace(modules: &[(String, String)]) -> NxWorkspace {
+    NxWorkspace::new(
+        modules
+            .iter()
+            .map(|(identity, source)| {
+                NxWorkspaceModule::from_source(identity.as_str(), source.as_str())
+                    .expect("workspace module")
+            })
+            .collect(),
+    )
+    .expect("workspace")
+}
+
+fn component_program() -> ProgramArtifact {
+    let source = fs::read_to_string(examples_dir().join("component.nx"))
+        .expect("examples/nx/component.nx should be readable");
+    load_program_artifact_from_source(&source, "component.nx", &ProgramBuildContext::empty())
+        .unwrap_or_else(|diagnostics| {
+            panic!("examples/nx/component.nx should build, got {diagnostics:?}")
+        })
+}
+
+fn resolve_search_box(program: &ProgramArtifact) -> ResolvedComponent {
+    match resolve_component_program_artifact(program, "SearchBox") {
+        ComponentResolveEvalResult::Ok(component) => component,
+        ComponentResolveEvalResult::Err(diagnostics) => {
+            panic!("SearchBox should resolve, got {diagnostics:?}")
+        }
+    }
+}
+
+fn record(properties: &[(&str, &str)]) -> NxValue {
+    NxValue::Record {
+        type_name: None,
+        properties: properties
+            .iter()
+            .map(|(name, value)| (name.to_string(), NxValue::String(value.to_string())))
+            .collect::<BTreeMap<_, _>>(),
+    }
+}
+
+fn build_workspace_benchmark(c: &mut Criterion) {
+    let build_context = ProgramBuildContext::empty();
+    let mut group = c.benchmark_group("build_workspace");
+
+    let examples = example_workspace_modules();
+    let bytes = examples
+        .iter()
+        .map(|(_, source)| source.len())
+        .sum::<usize>();
+    let examples_workspace = workspace(&examples);
+    build_workspace_program_artifact(&examples_workspace, "component.nx", &build_context)
+        .expect("examples workspace should build");
+    group.throughput(Throughput::Bytes(bytes as u64));
+    group.bench_function("examples", |b| {
+        b.iter(|| {
+            let result = build_workspace_program_artifact(
+                black_box(&examples_workspace),
+                "component.nx",
+                &build_context,
+            );
+            black_box(result)
+        });
+    });
+
+    for count in [10, 50].iter() {
+        let modules = synthetic_workspace_modules(*count);
+        let bytes = modules
+            .iter()
+            .map(|(_, source)| source.len())
+            .sum::<usize>();
+        let synthetic_workspace = workspace(&modules);
+        build_workspace_program_artifact(&synthetic_workspace, "app/main.nx", &build_context)
+            .expect("synthetic workspace should build");
+        group.throughput(Throughput::Bytes(bytes as u64));
+        group.bench_with_input(
+            BenchmarkId::new("modules", count),
+            &synthetic_workspace,
+            |b, synthetic_workspace| {
+                b.iter(|| {
+                    let result = build_workspace_program_artifact(
+                        black_box(synthetic_workspace),
+                        "app/main.nx",
+                        &build_context,
+                    );
+                    black_box(result)
+                });
+            },
+        );
+    }
+
+    group.finish();
+}
+
+fn component_benchmark(c: &mut Criterion) {
+    let program = component_program();
+    let component = resolve_search_box(&program);
+    let props = record(&[("placeholder", "Find docs")]);
+    let state = record(&[("query", "docs")]);
+
+    // Handler props are runtime-only values, so the dispatch snapshot comes from the example's
+    // root element rendered and initialized directly by the interpreter.
+    let root_props = eval_program_artifact_runtime(&program).expect("component.nx root");
+    let snapshot = Interpreter::from_resolved_program(program.resolved_program.clone())
+        .initialize_resolved_component("SearchBox", root_props)
+        .expect("SearchBox should initialize from the root element")
+        .state_snapshot;
+    let actions = vec![NxValue::Record {
+        type_name: Some("SearchSubmitted".to_string()),
+        properties: BTreeMap::from([(
+            "searchString".to_string(),
+            NxValue::String("docs".to_string()),
+        )]),
+    }];
+
+    let mut group = c.benchmark_group("component");
+    group.bench_function("eval_root", |b| {
+        b.iter(|| black_box(eval_program_artifact(black_box(&program))));
+    });
+    group.bench_function("initialize_resolved", |b| {
+        b.iter(|| {
+            black_box(initialize_resolved_component_program_artifact(
+                &program,
+                &component,
+                black_box(&props),
+            ))
+        });
+    });
+    group.bench_function("evaluate_resolved", |b| {
+        b.iter(|| {
+            black_box(evaluate_resolved_component_program_artifact(
+                &program,
+                &component,
+                black_box(&props),
+                black_box(&state),
+            ))
+        });
+    });
+    group.bench_function("dispatch", |b| {
+        b.iter(|| {
+            black_box(dispatch_component_actions_program_artifact(
+                &program,
+                black_box(&snapshot),
+                black_box(&actions),
+            ))
+        });
+    });
+    group.finish();
+}
+
+criterion_group!(benches, build_workspace_benchmark, component_benchmark);
+criterion_main!(benches);
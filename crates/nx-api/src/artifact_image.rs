@@ -0,0 +1,98 @@
+//! Versioned binary images of analyzed artifacts.
+//!
+//! An image is a fixed header followed by one MessagePack body:
+//!
+//! - 4-byte magic identifying the image kind
+//! - little-endian `u32` format version of that kind
+//! - little-endian `u16` length plus the UTF-8 NX version that wrote the image
+//!
+//! Images decode from one contiguous byte slice, so hosts may read or map image files and pass
+//! the bytes through unchanged. The header is checked before the body is decoded, so images from
+//! another NX version or format are rejected without attempting to parse them.
+
+use serde::de::DeserializeOwned;
+use serde::Serialize;
+use std::io;
+
+const TOOL_VERSION: &str = env!("CARGO_PKG_VERSION");
+
+/// Encodes one image with the supplied header fields.
+pub(crate) fn encode_image<T: Serialize + ?Sized>(
+    magic: &[u8; 4],
+    format_version: u32,
+    body: &T,
+) -> io::Result<Vec<u8>> {
+    let mut bytes = Vec::new();
+    bytes.extend_from_slice(magic);
+    bytes.extend_from_slice(&format_version.to_le_bytes());
+    bytes.extend_from_slice(&(TOOL_VERSION.len() as u16).to_le_bytes());
+    bytes.extend_from_slice(TOOL_VERSION.as_bytes());
+    rmp_serde::encode::write(&mut bytes, body).map_err(io::Error::other)?;
+    Ok(bytes)
+}
+
+/// Decodes one image after validating its magic, format version, and writer version.
+pub(crate) fn decode_image<T: DeserializeOwned>(
+    bytes: &[u8],
+    magic: &[u8; 4],
+    format_version: u32,
+) -> io::Result<T> {
+    let invalid = |message: String| io::Error::new(io::ErrorKind::InvalidData, message);
+
+    let body = bytes
+        .strip_prefix(magic.as_slice())
+        .ok_or_else(|| invalid("unrecognized image header".to_string()))?;
+    let (version, body) = body
+        .split_first_chunk::<4>()
+        .ok_or_else(|| invalid("truncated image header".to_string()))?;
+    let version = u32::from_le_bytes(*version);
+    if version != format_version {
+        return Err(invalid(format!(
+            "unsupported image format version {version}; expected {format_version}"
+        )));
+    }
+
+    let (tool_version_len, body) = body
+        .split_first_chunk::<2>()
+        .ok_or_else(|| invalid("truncated image header".to_string()))?;
+    let tool_version_len = usize::from(u16::from_le_bytes(*tool_version_len));
+    if body.len() < tool_version_len {
+        return Err(invalid("truncated image header".to_string()));
+    }
+    let (tool_version, body) = body.split_at(tool_version_len);
+    if tool_version != TOOL_VERSION.as_bytes() {
+        return Err(invalid(format!(
+            "image was written by NX {}; this runtime is NX {TOOL_VERSION}",
+            String::from_utf8_lossy(tool_version)
+        )));
+    }
+
+    rmp_serde::from_slice(body).map_err(|error| invalid(format!("corrupt image body: {error}")))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    const MAGIC: &[u8; 4] = b"TEST";
+
+    #[test]
+    fn image_round_trips_body() {
+        let bytes = encode_image(MAGIC, 3, &("answer", 42u32)).expect("encode image");
+        let body: (String, u32) = decode_image(&bytes, MAGIC, 3).expect("decode image");
+        assert_eq!(body, ("answer".to_string(), 42));
+    }
+
+    #[test]
+    fn image_rejects_mismatched_header() {
+        let bytes = encode_image(MAGIC, 3, &42u32).expect("encode image");
+        assert!(decode_image::<u32>(&bytes, b"ELSE", 3).is_err());
+        assert!(decode_image::<u32>(&bytes, MAGIC, 4).is_err());
+        assert!(decode_image::<u32>(&bytes[..6], MAGIC, 3).is_err());
+
+        let mut other_tool = bytes.clone();
+        other_tool[10] ^= 0xff;
+        let error = decode_image::<u32>(&other_tool, MAGIC, 3).expect_err("tool version mismatch");
+        assert!(error.to_string().contains("written by NX"));
+    }
+}
@@ -1,4 +1,8 @@
+use crate::artifact_image::{decode_image, encode_image};
 use crate::diagnostics::{diagnostics_to_api, diagnostics_to_api_with_sources};
+use crate::interpreter_pool::{InterpreterPool, PooledInterpreter};
+use crate::library_cache::{read_library_cache, write_library_cache};
+use crate::parallel::{parallel_map, resolve_worker_count};
 use crate::source_graph::{
     LogicalModuleGraph, LogicalSourceModule, SourceProvider, SourceProviderError,
     WorkspaceSourceProvider,
@@ -18,17 +22,22 @@ use nx_interpreter::{
     ResolvedProgram, RuntimeModuleId,
 };
 use nx_syntax::parse_str as syntax_parse_str;
-use nx_types::{analyze_prepared_module, ModuleArtifact, Type, TypeEnvironment};
+use nx_types::{
+    analyze_prepared_module_with_imports, ImportedTypeEnvironment, ModuleArtifact, Type,
+    TypeEnvironment,
+};
 use rustc_hash::{FxHashMap, FxHashSet};
+use serde::{Deserialize, Serialize};
 use std::collections::hash_map::DefaultHasher;
 use std::fs;
 use std::hash::{Hash, Hasher};
 use std::io;
 use std::path::{Component, Path, PathBuf};
 use std::sync::{Arc, RwLock};
+use std::time::{Duration, Instant};
 
 /// Export metadata for one symbol provided by a library artifact.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct LibraryExport {
     pub module_file: String,
     pub item_name: String,
@@ -42,7 +51,7 @@ pub type LibraryInterfaceKind = InterfaceItemKind;
 pub type LibraryInterfaceItem = InterfaceItem;
 
 /// File-preserving artifact for one local NX library directory.
-#[derive(Debug, Clone)]
+#[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct LibraryArtifact {
     pub root_path: PathBuf,
     pub modules: Vec<ModuleArtifact>,
@@ -53,15 +62,32 @@ pub struct LibraryArtifact {
     pub dependency_roots: Vec<PathBuf>,
     pub diagnostics: Vec<Diagnostic>,
     pub fingerprint: u64,
+    /// Export types resolved once for this snapshot and reused by every module that imports the
+    /// library without an alias. Rebuilt when a cached artifact is loaded.
+    #[serde(skip)]
+    pub export_types: Arc<ImportedTypeEnvironment>,
+}
+
+impl LibraryArtifact {
+    fn with_export_types(mut self) -> Self {
+        self.export_types = Arc::new(freeze_library_export_types(&self));
+        self
+    }
 }
 
 /// File-preserving artifact for one resolved NX program.
+///
+/// An artifact is immutable once built and safe to share between threads, typically behind an
+/// `Arc`. Evaluations on different threads run concurrently; each one checks out an interpreter
+/// from a pool owned by the artifact, so warmed per-interpreter caches are reused instead of
+/// being rebuilt for every call.
 #[derive(Debug, Clone)]
 pub struct ProgramArtifact {
     /// Analyzed root modules submitted by the source provider.
     ///
-    /// Workspace builds currently preserve every submitted module analyzed for the build, not only
-    /// the transitive import closure of the selected entry module.
+    /// Workspace builds preserve every submitted module analyzed for the build unless
+    /// [`ProgramBuildContext::with_entry_closure_pruning`] limits them to the transitive import
+    /// closure of the selected entry module.
     pub root_modules: Vec<ModuleArtifact>,
     /// Normalized identity of the module whose `root()` entrypoint is selected for evaluation.
     pub entry_identity: String,
@@ -74,8 +100,119 @@ pub struct ProgramArtifact {
     /// Fingerprint derived from entry identity, source-provider modules, and selected libraries.
     pub fingerprint: u64,
     /// Runtime-ready resolved program for this artifact.
-    pub resolved_program: ResolvedProgram,
+    ///
+    /// The program is immutable and shared by every interpreter that evaluates this artifact.
+    pub resolved_program: Arc<ResolvedProgram>,
+    /// Time spent in each build phase while constructing this artifact.
+    pub build_stats: ProgramBuildStats,
     pub(crate) source_map: FxHashMap<String, Arc<str>>,
+    pub(crate) interpreters: InterpreterPool,
+}
+
+/// Module counts and per-phase timings recorded while building a [`ProgramArtifact`].
+///
+/// Per-module phases run on the build's analysis workers, so their durations are summed across
+/// workers and can exceed the wall-clock build time. Artifacts restored with
+/// [`ProgramArtifact::from_image`] only record `link`.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct ProgramBuildStats {
+    /// Source modules parsed and lowered for this build.
+    pub parsed_modules: u64,
+    /// Source modules type-checked for this build; modules reused by an incremental rebuild are
+    /// not counted.
+    pub analyzed_modules: u64,
+    /// Time spent parsing source text.
+    pub parse: Duration,
+    /// Time spent lowering syntax trees to HIR.
+    pub lower: Duration,
+    /// Time spent resolving imports and type-checking modules.
+    pub analyze: Duration,
+    /// Time spent building and prelinking the resolved program.
+    pub link: Duration,
+}
+
+const PROGRAM_IMAGE_MAGIC: &[u8; 4] = b"NXPA";
+const PROGRAM_IMAGE_FORMAT_VERSION: u32 = 2;
+
+/// Serialized form of a [`ProgramArtifact`].
+///
+/// The resolved program is not stored; it is rebuilt from the modules and libraries on load,
+/// which keeps module storage shared between the artifact and its resolved program.
+#[derive(Serialize)]
+struct ProgramImageRef<'a> {
+    root_modules: &'a [ModuleArtifact],
+    entry_identity: &'a str,
+    libraries: &'a [Arc<LibraryArtifact>],
+    diagnostics: &'a [Diagnostic],
+    fingerprint: u64,
+    source_map: &'a FxHashMap<String, Arc<str>>,
+}
+
+#[derive(Deserialize)]
+struct ProgramImage {
+    root_modules: Vec<ModuleArtifact>,
+    entry_identity: String,
+    libraries: Vec<Arc<LibraryArtifact>>,
+    diagnostics: Vec<Diagnostic>,
+    fingerprint: u64,
+    source_map: FxHashMap<String, Arc<str>>,
+}
+
+impl ProgramArtifact {
+    /// Checks out an interpreter bound to this artifact's resolved program.
+    ///
+    /// The interpreter returns to the artifact's pool when the guard is dropped.
+    pub(crate) fn interpreter(&self) -> PooledInterpreter<'_> {
+        self.interpreters.acquire(&self.resolved_program)
+    }
+
+    /// Serializes this artifact into a self-contained binary image.
+    ///
+    /// The image holds the analyzed modules, the selected library snapshots, and diagnostics, so
+    /// [`ProgramArtifact::from_image`] restores the artifact without parsing, analysis, or access
+    /// to the original source files and libraries.
+    pub fn to_image(&self) -> io::Result<Vec<u8>> {
+        encode_image(
+            PROGRAM_IMAGE_MAGIC,
+            PROGRAM_IMAGE_FORMAT_VERSION,
+            &ProgramImageRef {
+                root_modules: &self.root_modules,
+                entry_identity: &self.entry_identity,
+                libraries: &self.libraries,
+                diagnostics: &self.diagnostics,
+                fingerprint: self.fingerprint,
+                source_map: &self.source_map,
+            },
+        )
+    }
+
+    /// Restores an artifact from an image produced by [`ProgramArtifact::to_image`].
+    ///
+    /// Images written by a different NX version are rejected with [`io::ErrorKind::InvalidData`].
+    pub fn from_image(bytes: &[u8]) -> io::Result<Self> {
+        let image: ProgramImage =
+            decode_image(bytes, PROGRAM_IMAGE_MAGIC, PROGRAM_IMAGE_FORMAT_VERSION)?;
+        let (resolved_program, link) = timed(|| {
+            build_resolved_program(&image.root_modules, &image.libraries, image.fingerprint)
+        });
+        let entry_module_id = resolved_program.source_provider_module_id(&image.entry_identity);
+
+        Ok(Self {
+            root_modules: image.root_modules,
+            entry_identity: image.entry_identity,
+            entry_module_id,
+            libraries: image.libraries,
+            diagnostics: image.diagnostics,
+            fingerprint: image.fingerprint,
+            resolved_program: Arc::new(resolved_program),
+            build_stats: ProgramBuildStats {
+                link,
+                ..ProgramBuildStats::default()
+            },
+            source_map: image.source_map,
+            interpreters: InterpreterPool::new(),
+        })
+    }
 }
 
 #[derive(Debug, Default)]
@@ -83,6 +220,9 @@ struct LibraryRegistryState {
     libraries: FxHashMap<PathBuf, Arc<LibraryArtifact>>,
     dependency_graph: FxHashMap<PathBuf, Vec<PathBuf>>,
     loading: FxHashSet<PathBuf>,
+    cache_directory: Option<PathBuf>,
+    /// Configured worker count for batch library loads; `0` selects the available parallelism.
+    load_workers: usize,
 }
 
 /// Public owner of analyzed library snapshots.
@@ -96,6 +236,38 @@ impl LibraryRegistry {
         Self::default()
     }
 
+    /// Sets the directory used to persist analyzed library artifacts across processes.
+    ///
+    /// Later loads reuse a cached artifact only while the library's source fingerprint and the
+    /// fingerprints of its dependency libraries are unchanged, and re-analyze the library
+    /// otherwise. Passing `None` disables the cache.
+    pub fn set_cache_directory(&self, cache_directory: Option<PathBuf>) {
+        let mut state = self.inner.write().expect("library registry lock poisoned");
+        state.cache_directory = cache_directory;
+    }
+
+    /// Returns the persistent library cache directory, if one is configured.
+    pub fn cache_directory(&self) -> Option<PathBuf> {
+        let state = self.inner.read().expect("library registry lock poisoned");
+        state.cache_directory.clone()
+    }
+
+    /// Sets how many threads [`Self::load_libraries_from_directories`] discovers and analyzes
+    /// libraries on.
+    ///
+    /// `0` selects the available hardware parallelism, which is also the default; `1` loads every
+    /// library on the calling thread.
+    pub fn set_load_workers(&self, workers: usize) {
+        let mut state = self.inner.write().expect("library registry lock poisoned");
+        state.load_workers = workers;
+    }
+
+    /// Returns the number of worker threads batch library loads will use.
+    pub fn load_workers(&self) -> usize {
+        let state = self.inner.read().expect("library registry lock poisoned");
+        resolve_worker_count(state.load_workers)
+    }
+
     pub fn load_library_from_directory(
         &self,
         root_path: impl AsRef<Path>,
@@ -103,17 +275,11 @@ impl LibraryRegistry {
         let artifact = self
             .load_library_from_directory_internal(root_path.as_ref())
             .map_err(|error| {
-                let diagnostic = Diagnostic::error("library-load-error")
-                    .with_message(format!(
-                        "Failed to load library artifact from '{}': {}",
-                        root_path.as_ref().display(),
-                        error
-                    ))
-                    .build();
+                let diagnostic = library_load_error(root_path.as_ref(), &error);
                 crate::diagnostics::diagnostics_to_api(&[diagnostic], "")
             })?;
 
-        let diagnostics = self.closure_diagnostics(&artifact.root_path);
+        let diagnostics = self.closure_diagnostics(std::slice::from_ref(&artifact.root_path));
         if has_error_diagnostics(&diagnostics) {
             return Err(crate::diagnostics::diagnostics_to_api(&diagnostics, ""));
         }
@@ -121,10 +287,57 @@ impl LibraryRegistry {
         Ok(artifact)
     }
 
+    /// Loads several libraries together with their dependency closures.
+    ///
+    /// Libraries are analyzed in waves: every library whose dependencies are already loaded is
+    /// analyzed concurrently with the others in its wave, outside the registry lock, and the write
+    /// lock is taken only to publish each finished artifact. The returned artifacts follow the
+    /// order of `root_paths`.
+    pub fn load_libraries_from_directories<I, P>(
+        &self,
+        root_paths: I,
+    ) -> Result<Vec<Arc<LibraryArtifact>>, Vec<crate::NxDiagnostic>>
+    where
+        I: IntoIterator<Item = P>,
+        P: AsRef<Path>,
+    {
+        let mut roots = Vec::new();
+        let mut load_errors = Vec::new();
+        for root_path in root_paths {
+            match fs::canonicalize(root_path.as_ref()) {
+                Ok(root) => roots.push(root),
+                Err(error) => load_errors.push(library_load_error(root_path.as_ref(), &error)),
+            }
+        }
+        if load_errors.is_empty() {
+            if let Err((root, error)) = self.load_library_closure(&roots) {
+                load_errors.push(library_load_error(&root, &error));
+            }
+        }
+        if !load_errors.is_empty() {
+            return Err(crate::diagnostics::diagnostics_to_api(&load_errors, ""));
+        }
+
+        let diagnostics = self.closure_diagnostics(&roots);
+        if has_error_diagnostics(&diagnostics) {
+            return Err(crate::diagnostics::diagnostics_to_api(&diagnostics, ""));
+        }
+
+        Ok(roots
+            .iter()
+            .map(|root| {
+                self.get_loaded_library(root)
+                    .expect("library closure should be loaded")
+            })
+            .collect())
+    }
+
     pub fn build_context(&self) -> ProgramBuildContext {
         ProgramBuildContext {
             registry: self.clone(),
             visible_roots: self.loaded_roots().into_iter().collect(),
+            analysis_workers: 0,
+            prune_to_entry_closure: false,
         }
     }
 
@@ -144,6 +357,8 @@ impl LibraryRegistry {
         Ok(ProgramBuildContext {
             registry: self.clone(),
             visible_roots,
+            analysis_workers: 0,
+            prune_to_entry_closure: false,
         })
     }
 
@@ -201,25 +416,30 @@ impl LibraryRegistry {
 
         loading_stack.push(root_path.clone());
         let result = (|| {
-            let dependency_roots = discover_library_dependency_roots(&root_path)?;
-            for dependency_root in &dependency_roots {
-                let _ = self.load_library_from_directory_internal_with_stack(
-                    dependency_root,
-                    loading_stack,
-                )?;
-            }
+            let cache_directory = self.cache_directory();
+            let cached = match cache_directory.as_deref() {
+                Some(cache_directory) => {
+                    self.load_cached_library(cache_directory, &root_path, loading_stack)?
+                }
+                None => None,
+            };
 
-            let artifact = Arc::new(build_library_artifact_with_registry(&root_path, self)?);
-            let mut state = self.inner.write().expect("library registry lock poisoned");
-            let entry = state
-                .libraries
-                .entry(root_path.clone())
-                .or_insert_with(|| artifact.clone())
-                .clone();
-            state
-                .dependency_graph
-                .insert(root_path.clone(), artifact.dependency_roots.clone());
-            Ok(entry)
+            let artifact = match cached {
+                Some(artifact) => Arc::new(artifact),
+                None => {
+                    let dependency_roots = discover_library_dependency_roots(&root_path)?;
+                    for dependency_root in &dependency_roots {
+                        let _ = self.load_library_from_directory_internal_with_stack(
+                            dependency_root,
+                            loading_stack,
+                        )?;
+                    }
+
+                    self.build_and_cache_library(&root_path, cache_directory.as_deref())?
+                }
+            };
+
+            Ok(self.publish_library(&root_path, artifact))
         })();
 
         let popped = loading_stack.pop();
@@ -230,6 +450,197 @@ impl LibraryRegistry {
         result
     }
 
+    /// Loads the unloaded part of the dependency closure of `roots`.
+    ///
+    /// Errors carry the root of the library that failed to load.
+    fn load_library_closure(&self, roots: &[PathBuf]) -> Result<(), (PathBuf, io::Error)> {
+        let workers = self.load_workers();
+
+        // Discover the unloaded libraries one frontier at a time.
+        let mut pending = FxHashMap::<PathBuf, Vec<PathBuf>>::default();
+        let mut frontier = roots
+            .iter()
+            .filter(|root| self.get_loaded_library(root).is_none())
+            .cloned()
+            .collect::<Vec<_>>();
+        frontier.sort();
+        frontier.dedup();
+        while !frontier.is_empty() {
+            let discovered = parallel_map(frontier.len(), workers, |index| {
+                discover_library_dependency_roots(&frontier[index])
+            });
+
+            let mut next_frontier = Vec::new();
+            for (root, dependency_roots) in frontier.into_iter().zip(discovered) {
+                let dependency_roots = dependency_roots.map_err(|error| (root.clone(), error))?;
+                next_frontier.extend(
+                    dependency_roots
+                        .iter()
+                        .filter(|dependency_root| {
+                            self.get_loaded_library(dependency_root).is_none()
+                        })
+                        .cloned(),
+                );
+                pending.insert(root, dependency_roots);
+            }
+            next_frontier.sort();
+            next_frontier.dedup();
+            next_frontier.retain(|root| !pending.contains_key(root));
+            frontier = next_frontier;
+        }
+
+        let cache_directory = self.cache_directory();
+        while !pending.is_empty() {
+            let mut ready = pending
+                .iter()
+                .filter(|(_, dependency_roots)| {
+                    dependency_roots
+                        .iter()
+                        .all(|dependency_root| !pending.contains_key(dependency_root))
+                })
+                .map(|(root, _)| root.clone())
+                .collect::<Vec<_>>();
+            if ready.is_empty() {
+                let cycle = pending_library_cycle(&pending);
+                return Err((
+                    cycle[0].clone(),
+                    io::Error::new(
+                        io::ErrorKind::InvalidData,
+                        circular_library_dependency_message(&cycle),
+                    ),
+                ));
+            }
+            ready.sort();
+
+            let loaded = parallel_map(ready.len(), workers, |index| {
+                self.load_library_with_loaded_dependencies(
+                    &ready[index],
+                    cache_directory.as_deref(),
+                )
+            });
+
+            // Publish every library that finished so a failure does not discard its wave.
+            let mut first_error = None;
+            for (root, artifact) in ready.into_iter().zip(loaded) {
+                match artifact {
+                    Ok(artifact) => {
+                        self.publish_library(&root, artifact);
+                        pending.remove(&root);
+                    }
+                    Err(error) => {
+                        first_error.get_or_insert((root, error));
+                    }
+                }
+            }
+            if let Some(error) = first_error {
+                return Err(error);
+            }
+        }
+
+        Ok(())
+    }
+
+    /// Loads one library whose dependency libraries are all published already.
+    fn load_library_with_loaded_dependencies(
+        &self,
+        root_path: &Path,
+        cache_directory: Option<&Path>,
+    ) -> io::Result<Arc<LibraryArtifact>> {
+        if let Some(cache_directory) = cache_directory {
+            if let Some(artifact) =
+                self.load_cached_library(cache_directory, root_path, &mut Vec::new())?
+            {
+                return Ok(Arc::new(artifact));
+            }
+        }
+
+        self.build_and_cache_library(root_path, cache_directory)
+    }
+
+    fn build_and_cache_library(
+        &self,
+        root_path: &Path,
+        cache_directory: Option<&Path>,
+    ) -> io::Result<Arc<LibraryArtifact>> {
+        let artifact = Arc::new(build_library_artifact_with_registry(root_path, self)?);
+        if let Some(cache_directory) = cache_directory {
+            if let Some(dependency_fingerprints) =
+                self.dependency_fingerprints(&artifact.dependency_roots)
+            {
+                // The cache is an optimization; a failed write only costs the next process a
+                // re-analysis.
+                let _ = write_library_cache(cache_directory, &artifact, &dependency_fingerprints);
+            }
+        }
+        Ok(artifact)
+    }
+
+    /// Publishes a finished library, keeping the artifact of any load that published it first.
+    fn publish_library(
+        &self,
+        root_path: &Path,
+        artifact: Arc<LibraryArtifact>,
+    ) -> Arc<LibraryArtifact> {
+        let mut state = self.inner.write().expect("library registry lock poisoned");
+        state
+            .dependency_graph
+            .insert(root_path.to_path_buf(), artifact.dependency_roots.clone());
+        state
+            .libraries
+            .entry(root_path.to_path_buf())
+            .or_insert(artifact)
+            .clone()
+    }
+
+    /// Loads one library from the persistent cache when its entry is still valid.
+    ///
+    /// Dependencies recorded in the entry are loaded first, so each dependency is validated
+    /// against its own sources before its fingerprint is compared with the one the cached
+    /// artifact was analyzed against.
+    fn load_cached_library(
+        &self,
+        cache_directory: &Path,
+        root_path: &Path,
+        loading_stack: &mut Vec<PathBuf>,
+    ) -> io::Result<Option<LibraryArtifact>> {
+        let fingerprint = library_source_fingerprint(root_path)?;
+        let Some(entry) = read_library_cache(cache_directory, fingerprint) else {
+            return Ok(None);
+        };
+        if entry.artifact.root_path != root_path {
+            return Ok(None);
+        }
+
+        for (dependency_root, expected_fingerprint) in entry
+            .artifact
+            .dependency_roots
+            .iter()
+            .zip(&entry.dependency_fingerprints)
+        {
+            // Dependency failures are reported by the uncached load path instead.
+            let Ok(dependency) = self
+                .load_library_from_directory_internal_with_stack(dependency_root, loading_stack)
+            else {
+                return Ok(None);
+            };
+            if dependency.fingerprint != *expected_fingerprint {
+                return Ok(None);
+            }
+        }
+
+        Ok(Some(entry.artifact.with_export_types()))
+    }
+
+    fn dependency_fingerprints(&self, dependency_roots: &[PathBuf]) -> Option<Vec<u64>> {
+        dependency_roots
+            .iter()
+            .map(|root| {
+                self.get_loaded_library(root)
+                    .map(|library| library.fingerprint)
+            })
+            .collect()
+    }
+
     fn dependency_roots(&self, root: &Path) -> Vec<PathBuf> {
         let state = self.inner.read().expect("library registry lock poisoned");
         state
@@ -239,10 +650,10 @@ impl LibraryRegistry {
             .unwrap_or_default()
     }
 
-    fn closure_diagnostics(&self, root: &Path) -> Vec<Diagnostic> {
+    fn closure_diagnostics(&self, roots: &[PathBuf]) -> Vec<Diagnostic> {
         let mut diagnostics = Vec::new();
         let mut seen = FxHashSet::default();
-        let mut queue = vec![root.to_path_buf()];
+        let mut queue = roots.to_vec();
 
         while let Some(current) = queue.pop() {
             if !seen.insert(current.clone()) {
@@ -265,6 +676,10 @@ impl LibraryRegistry {
 pub struct ProgramBuildContext {
     registry: LibraryRegistry,
     visible_roots: FxHashSet<PathBuf>,
+    /// Configured worker count for module analysis; `0` selects the available parallelism.
+    analysis_workers: usize,
+    /// Whether workspace builds keep only the import closure of the entry module.
+    prune_to_entry_closure: bool,
 }
 
 impl Default for ProgramBuildContext {
@@ -278,6 +693,8 @@ impl ProgramBuildContext {
         Self {
             registry: LibraryRegistry::new(),
             visible_roots: FxHashSet::default(),
+            analysis_workers: 0,
+            prune_to_entry_closure: false,
         }
     }
 
@@ -285,6 +702,48 @@ impl ProgramBuildContext {
         registry.build_context()
     }
 
+    /// Returns this context with a fixed number of module analysis workers.
+    ///
+    /// Workspace builds parse, lower, and analyze submitted modules on up to this many threads:
+    /// the calling thread plus helpers from a process-wide pool of long-lived threads. `0` selects
+    /// the available hardware parallelism, which is also the default; `1` analyzes every module
+    /// on the calling thread, which suits hosts that already run builds on their own worker pool.
+    pub fn with_analysis_workers(mut self, workers: usize) -> Self {
+        self.set_analysis_workers(workers);
+        self
+    }
+
+    /// Sets the number of module analysis workers; see [`Self::with_analysis_workers`].
+    pub fn set_analysis_workers(&mut self, workers: usize) {
+        self.analysis_workers = workers;
+    }
+
+    /// Returns the number of worker threads module analysis will use.
+    pub fn analysis_workers(&self) -> usize {
+        resolve_worker_count(self.analysis_workers)
+    }
+
+    /// Returns this context with workspace builds limited to the entry module's import closure.
+    ///
+    /// When enabled, [`build_workspace_program_artifact`] parses the entry module first, follows
+    /// its workspace imports transitively, and analyzes and stores only the modules it reaches.
+    /// Submitted modules outside that closure are neither analyzed nor reported. Validation still
+    /// covers every submitted module. Disabled by default.
+    pub fn with_entry_closure_pruning(mut self, enabled: bool) -> Self {
+        self.set_entry_closure_pruning(enabled);
+        self
+    }
+
+    /// Enables or disables entry import-closure pruning; see [`Self::with_entry_closure_pruning`].
+    pub fn set_entry_closure_pruning(&mut self, enabled: bool) {
+        self.prune_to_entry_closure = enabled;
+    }
+
+    /// Returns true when workspace builds keep only the entry module's import closure.
+    pub fn entry_closure_pruning(&self) -> bool {
+        self.prune_to_entry_closure
+    }
+
     fn visible_library(&self, root: &Path) -> Option<Arc<LibraryArtifact>> {
         if !self.visible_roots.contains(root) {
             return None;
@@ -363,6 +822,9 @@ struct LocalLibraryCandidate {
 struct ResolvedBuildContextImport {
     normalized_root: PathBuf,
     library: Arc<LibraryArtifact>,
+    /// Whether the import binds every export under its own name, so the library's frozen
+    /// export types apply to the importing module.
+    shares_export_types: bool,
 }
 
 #[derive(Debug, Clone)]
@@ -391,7 +853,25 @@ struct GraphSourceFile {
     source: Arc<str>,
     source_id: SourceId,
     diagnostics: Vec<Diagnostic>,
-    preserved_module: Option<LoweredModule>,
+    /// Lowered module shared with every peer module that sees it during analysis.
+    preserved_module: Option<Arc<LoweredModule>>,
+    parse_time: Duration,
+    lower_time: Duration,
+}
+
+impl GraphSourceFile {
+    /// Wraps the previous analysis of an unchanged module so rebuilt modules can see it as a peer.
+    fn reused(module: &LogicalSourceModule, previous: &ModuleArtifact) -> Self {
+        Self {
+            identity: module.identity.clone(),
+            source: module.source.clone(),
+            source_id: previous.source_id,
+            diagnostics: Vec::new(),
+            preserved_module: previous.lowered_module.clone(),
+            parse_time: Duration::ZERO,
+            lower_time: Duration::ZERO,
+        }
+    }
 }
 
 #[derive(Debug, Default)]
@@ -399,6 +879,27 @@ struct LogicalProgramAnalysis {
     modules: Vec<ModuleArtifact>,
     libraries: Vec<Arc<LibraryArtifact>>,
     source_map: FxHashMap<String, Arc<str>>,
+    stats: ProgramBuildStats,
+}
+
+impl ProgramBuildStats {
+    /// Starts build stats from the parse and lower timings of the modules parsed for a build.
+    fn from_source_files<'a>(source_files: impl IntoIterator<Item = &'a GraphSourceFile>) -> Self {
+        let mut stats = Self::default();
+        for source_file in source_files {
+            stats.parsed_modules += 1;
+            stats.parse += source_file.parse_time;
+            stats.lower += source_file.lower_time;
+        }
+        stats
+    }
+}
+
+/// Runs `f` and returns its result together with the elapsed wall-clock time.
+fn timed<T>(f: impl FnOnce() -> T) -> (T, Duration) {
+    let started = Instant::now();
+    let value = f();
+    (value, started.elapsed())
 }
 
 impl LogicalProgramAnalysis {
@@ -479,7 +980,104 @@ pub fn build_workspace_program_artifact(
         return Err(diagnostics_to_api(&[diagnostic], ""));
     }
 
-    let artifact = build_program_artifact_from_graph(&graph, &entry_identity, build_context);
+    let artifact = if build_context.entry_closure_pruning() {
+        let (graph, source_files) = entry_import_closure(&graph, &entry_identity, build_context);
+        let analysis = analyze_logical_source_files(&graph, source_files, build_context);
+        assemble_program_artifact(&graph, &entry_identity, analysis)
+    } else {
+        build_program_artifact_from_graph(&graph, &entry_identity, build_context)
+    };
+    if has_error_diagnostics(&artifact.diagnostics) {
+        let source_map = graph.source_map();
+        return Err(diagnostics_to_api_with_sources(
+            &artifact.diagnostics,
+            "",
+            &source_map,
+        ));
+    }
+
+    Ok(artifact)
+}
+
+/// Rebuilds a workspace program artifact after some of its modules changed.
+///
+/// `changed_modules` holds the new or edited modules; every other module keeps the source it had
+/// in `previous`. Only modules whose source or transitive workspace imports changed, or whose
+/// library imports no longer resolve to the same library fingerprints, are parsed and analyzed
+/// again. The other analyzed modules are reused from `previous`, so the result matches a full
+/// [`build_workspace_program_artifact`] of the updated workspace.
+///
+/// With [`ProgramBuildContext::with_entry_closure_pruning`], only the modules the entry module
+/// still reaches are kept. Modules that an earlier pruned build dropped are not part of
+/// `previous`, so they are only considered again when `changed_modules` submits them.
+pub fn rebuild_workspace_program_artifact(
+    previous: &ProgramArtifact,
+    changed_modules: &NxWorkspace,
+    build_context: &ProgramBuildContext,
+) -> Result<ProgramArtifact, Vec<NxDiagnostic>> {
+    let mut modules = Vec::with_capacity(previous.root_modules.len());
+    for module in &previous.root_modules {
+        let Some(source) = previous.source_map.get(&module.file_name) else {
+            let diagnostic = Diagnostic::error("workspace-rebuild-error")
+                .with_message(format!(
+                    "Previous program artifact has no source for module '{}'",
+                    module.file_name
+                ))
+                .build();
+            return Err(diagnostics_to_api(&[diagnostic], ""));
+        };
+        modules.push(LogicalSourceModule {
+            identity: module.file_name.clone(),
+            source: source.clone(),
+        });
+    }
+
+    let mut changed = FxHashSet::default();
+    for module in changed_modules.modules() {
+        let source = module.source_arc();
+        match modules
+            .iter_mut()
+            .find(|existing| existing.identity == module.identity())
+        {
+            Some(existing) if existing.source == source => {}
+            Some(existing) => {
+                existing.source = source;
+                changed.insert(existing.identity.clone());
+            }
+            None => {
+                modules.push(LogicalSourceModule {
+                    identity: module.identity().to_string(),
+                    source,
+                });
+                changed.insert(module.identity().to_string());
+            }
+        }
+    }
+
+    let graph = match LogicalModuleGraph::from_modules(modules) {
+        Ok(graph) => graph,
+        Err(error) => {
+            return Err(diagnostics_to_api(
+                &[source_provider_error_diagnostic(&error)],
+                "",
+            ));
+        }
+    };
+
+    let (graph, parsed) = if build_context.entry_closure_pruning() {
+        rebuild_entry_import_closure(
+            &graph,
+            &previous.entry_identity,
+            previous,
+            &changed,
+            build_context,
+        )
+    } else {
+        (graph, FxHashMap::default())
+    };
+    let analysis =
+        reanalyze_logical_module_graph(&graph, build_context, previous, &changed, parsed);
+    let artifact = assemble_program_artifact(&graph, &previous.entry_identity, analysis);
     if has_error_diagnostics(&artifact.diagnostics) {
         let source_map = graph.source_map();
         return Err(diagnostics_to_api_with_sources(
@@ -498,14 +1096,15 @@ fn build_library_artifact_with_registry(
 ) -> io::Result<LibraryArtifact> {
     let root_path = fs::canonicalize(root_path)?;
     let source_files = read_library_source_files(&root_path)?;
-    let mut hasher = DefaultHasher::new();
-    root_path.hash(&mut hasher);
+    let fingerprint = library_fingerprint(
+        &root_path,
+        source_files
+            .iter()
+            .map(|source_file| (source_file.path.as_path(), source_file.source.as_str())),
+    );
 
     let mut dependency_roots = FxHashSet::default();
     for source_file in &source_files {
-        source_file.path.hash(&mut hasher);
-        source_file.source.hash(&mut hasher);
-
         if let Some(module) = source_file.preserved_module.as_ref() {
             collect_library_dependencies(&module.imports, &source_file.path, &mut dependency_roots);
         }
@@ -570,8 +1169,44 @@ fn build_library_artifact_with_registry(
         visible_to_library_items,
         dependency_roots,
         diagnostics,
-        fingerprint: hasher.finish(),
-    })
+        fingerprint,
+        export_types: Arc::default(),
+    }
+    .with_export_types())
+}
+
+/// Hashes one library's root path and source files into its artifact fingerprint.
+fn library_fingerprint<'a>(
+    root_path: &Path,
+    source_files: impl IntoIterator<Item = (&'a Path, &'a str)>,
+) -> u64 {
+    let mut hasher = DefaultHasher::new();
+    root_path.hash(&mut hasher);
+    for (path, source) in source_files {
+        path.hash(&mut hasher);
+        source.hash(&mut hasher);
+    }
+    hasher.finish()
+}
+
+/// Computes the fingerprint of a canonical library root from its sources without analyzing them.
+fn library_source_fingerprint(root_path: &Path) -> io::Result<u64> {
+    let mut source_paths = Vec::new();
+    collect_nx_files(root_path, &mut source_paths)?;
+    source_paths.sort();
+
+    let mut sources = Vec::with_capacity(source_paths.len());
+    for source_path in &source_paths {
+        sources.push(fs::read_to_string(source_path)?);
+    }
+
+    Ok(library_fingerprint(
+        root_path,
+        source_paths
+            .iter()
+            .map(PathBuf::as_path)
+            .zip(sources.iter().map(String::as_str)),
+    ))
 }
 
 fn discover_library_dependency_roots(root_path: &Path) -> io::Result<Vec<PathBuf>> {
@@ -589,6 +1224,44 @@ fn discover_library_dependency_roots(root_path: &Path) -> io::Result<Vec<PathBuf
     Ok(dependency_roots)
 }
 
+fn library_load_error(root_path: &Path, error: &io::Error) -> Diagnostic {
+    Diagnostic::error("library-load-error")
+        .with_message(format!(
+            "Failed to load library artifact from '{}': {}",
+            root_path.display(),
+            error
+        ))
+        .build()
+}
+
+/// Finds a dependency cycle among libraries that can never become ready.
+///
+/// Every pending library has at least one pending dependency, so following the first one from
+/// the smallest root always returns to a library already on the path.
+fn pending_library_cycle(pending: &FxHashMap<PathBuf, Vec<PathBuf>>) -> Vec<PathBuf> {
+    let mut current = pending
+        .keys()
+        .min()
+        .expect("pending libraries should not be empty")
+        .clone();
+    let mut path = Vec::new();
+    loop {
+        if let Some(index) = path.iter().position(|root| root == &current) {
+            let mut cycle = path.split_off(index);
+            cycle.push(current);
+            return cycle;
+        }
+
+        let next = pending[&current]
+            .iter()
+            .find(|dependency_root| pending.contains_key(*dependency_root))
+            .expect("pending library should have a pending dependency")
+            .clone();
+        path.push(current);
+        current = next;
+    }
+}
+
 fn circular_library_dependency_message(cycle: &[PathBuf]) -> String {
     let chain = cycle
         .iter()
@@ -637,7 +1310,7 @@ fn analyze_library_source_file(
         return parse_failure_artifact(&source_file.file_name, source_file.source_id, diagnostics);
     };
     let mut prepared_module = PreparedModule::new(&source_file.file_name, preserved_module);
-    apply_build_context_imports(
+    let resolved_imports = apply_build_context_imports(
         &mut prepared_module,
         &source_file.path,
         dependency_context,
@@ -649,7 +1322,12 @@ fn analyze_library_source_file(
         source_files,
         current_file_index,
     );
-    finalize_module_artifact(&source_file.file_name, prepared_module, diagnostics)
+    finalize_module_artifact(
+        &source_file.file_name,
+        prepared_module,
+        diagnostics,
+        &resolved_imports,
+    )
 }
 
 fn apply_current_library_items(
@@ -761,14 +1439,29 @@ fn analyze_logical_module_graph(
     graph: &LogicalModuleGraph,
     build_context: &ProgramBuildContext,
 ) -> LogicalProgramAnalysis {
-    let source_files = parse_logical_source_files(graph);
+    let source_files = parse_logical_source_files(graph, build_context.analysis_workers());
+    analyze_logical_source_files(graph, source_files, build_context)
+}
+
+fn analyze_logical_source_files(
+    graph: &LogicalModuleGraph,
+    source_files: Vec<GraphSourceFile>,
+    build_context: &ProgramBuildContext,
+) -> LogicalProgramAnalysis {
+    // Modules are analyzed against their peers' lowered HIR rather than against each other's
+    // analysis results, so every module can be parsed, lowered, and analyzed independently.
+    let workers = build_context.analysis_workers();
     let source_map = graph.source_map();
+    let analyzed = parallel_map(source_files.len(), workers, |index| {
+        timed(|| analyze_logical_source_file(&source_files, build_context, index))
+    });
+    let mut stats = ProgramBuildStats::from_source_files(&source_files);
     let mut modules = Vec::with_capacity(source_files.len());
     let mut libraries_by_root = FxHashMap::<PathBuf, Arc<LibraryArtifact>>::default();
 
-    for index in 0..source_files.len() {
-        let (mut artifact, libraries, selection_diagnostics) =
-            analyze_logical_source_file(&source_files, build_context, index);
+    for ((mut artifact, libraries, selection_diagnostics), elapsed) in analyzed {
+        stats.analyzed_modules += 1;
+        stats.analyze += elapsed;
         artifact.diagnostics.extend(selection_diagnostics);
         modules.push(artifact);
 
@@ -786,29 +1479,398 @@ fn analyze_logical_module_graph(
         modules,
         libraries,
         source_map,
+        stats,
     }
 }
 
-fn parse_logical_source_files(graph: &LogicalModuleGraph) -> Vec<GraphSourceFile> {
-    graph
-        .modules()
+fn parse_logical_source_files(graph: &LogicalModuleGraph, workers: usize) -> Vec<GraphSourceFile> {
+    let modules = graph.modules();
+    parallel_map(modules.len(), workers, |index| {
+        parse_logical_source_file(&modules[index])
+    })
+}
+
+fn parse_logical_source_file(module: &LogicalSourceModule) -> GraphSourceFile {
+    let (parse_result, parse_time) =
+        timed(|| syntax_parse_str(module.source.as_ref(), &module.identity));
+    let source_id = SourceId::new(parse_result.source_id.as_u32());
+    let diagnostics = normalize_diagnostics_file_name(parse_result.errors, &module.identity);
+    let (preserved_module, lower_time) = timed(|| {
+        parse_result
+            .tree
+            .map(|tree| Arc::new(lower(tree.root(), source_id)))
+    });
+
+    GraphSourceFile {
+        identity: module.identity.clone(),
+        source: module.source.clone(),
+        source_id,
+        diagnostics,
+        preserved_module,
+        parse_time,
+        lower_time,
+    }
+}
+
+/// Parses the workspace modules reachable from `entry_identity` through workspace imports.
+///
+/// Modules are parsed one import frontier at a time. Returns the pruned graph together with the
+/// parsed modules, both in the submission order of `graph`.
+fn entry_import_closure(
+    graph: &LogicalModuleGraph,
+    entry_identity: &str,
+    build_context: &ProgramBuildContext,
+) -> (LogicalModuleGraph, Vec<GraphSourceFile>) {
+    let workers = build_context.analysis_workers();
+    let modules = graph.modules();
+    let identity_to_index = modules
         .iter()
-        .map(|module| {
-            let parse_result = syntax_parse_str(module.source.as_ref(), &module.identity);
-            let source_id = SourceId::new(parse_result.source_id.as_u32());
-            let diagnostics =
-                normalize_diagnostics_file_name(parse_result.errors, &module.identity);
-            let preserved_module = parse_result.tree.map(|tree| lower(tree.root(), source_id));
-
-            GraphSourceFile {
-                identity: module.identity.clone(),
-                source: module.source.clone(),
-                source_id,
-                diagnostics,
-                preserved_module,
+        .enumerate()
+        .map(|(index, module)| (module.identity.as_str(), index))
+        .collect::<FxHashMap<_, _>>();
+
+    let mut parsed = FxHashMap::default();
+    let mut frontier = vec![identity_to_index[entry_identity]];
+    while !frontier.is_empty() {
+        let source_files = parallel_map(frontier.len(), workers, |index| {
+            parse_logical_source_file(&modules[frontier[index]])
+        });
+
+        let mut next_frontier = Vec::new();
+        for (index, source_file) in frontier.into_iter().zip(source_files) {
+            if let Some(module) = source_file.preserved_module.as_ref() {
+                next_frontier.extend(
+                    workspace_import_targets(&source_file.identity, &module.imports)
+                        .filter_map(|target| identity_to_index.get(target.as_str()).copied()),
+                );
             }
+            parsed.insert(index, source_file);
+        }
+        next_frontier.sort_unstable();
+        next_frontier.dedup();
+        next_frontier.retain(|index| !parsed.contains_key(index));
+        frontier = next_frontier;
+    }
+
+    let mut indices = parsed.keys().copied().collect::<Vec<_>>();
+    indices.sort_unstable();
+    let closure = LogicalModuleGraph::from_modules(
+        indices
+            .iter()
+            .map(|index| modules[*index].clone())
+            .collect(),
+    )
+    .expect("a subset of a valid module graph is valid");
+    let source_files = indices
+        .iter()
+        .map(|index| parsed.remove(index).expect("parsed source file"))
+        .collect();
+    (closure, source_files)
+}
+
+/// Restricts a rebuild graph to the modules reachable from `entry_identity`.
+///
+/// Unchanged modules are followed through the imports recorded in `previous`, so only changed
+/// modules are parsed. Their parse results are returned by identity for reuse by
+/// [`reanalyze_logical_module_graph`].
+fn rebuild_entry_import_closure(
+    graph: &LogicalModuleGraph,
+    entry_identity: &str,
+    previous: &ProgramArtifact,
+    changed: &FxHashSet<String>,
+    build_context: &ProgramBuildContext,
+) -> (LogicalModuleGraph, FxHashMap<String, GraphSourceFile>) {
+    let workers = build_context.analysis_workers();
+    let modules = graph.modules();
+    let identity_to_index = modules
+        .iter()
+        .enumerate()
+        .map(|(index, module)| (module.identity.as_str(), index))
+        .collect::<FxHashMap<_, _>>();
+    let previous_modules = previous
+        .root_modules
+        .iter()
+        .map(|module| (module.file_name.as_str(), module))
+        .collect::<FxHashMap<_, _>>();
+
+    let mut parsed = FxHashMap::default();
+    let mut reached = FxHashSet::default();
+    let mut frontier = vec![identity_to_index[entry_identity]];
+    while !frontier.is_empty() {
+        reached.extend(frontier.iter().copied());
+        let changed_frontier = frontier
+            .iter()
+            .copied()
+            .filter(|index| changed.contains(&modules[*index].identity))
+            .collect::<Vec<_>>();
+        parsed.extend(changed_frontier.iter().copied().zip(parallel_map(
+            changed_frontier.len(),
+            workers,
+            |index| parse_logical_source_file(&modules[changed_frontier[index]]),
+        )));
+
+        let mut next_frontier = Vec::new();
+        for index in frontier {
+            let identity = modules[index].identity.as_str();
+            let imports = match parsed.get(&index) {
+                Some(source_file) => source_file
+                    .preserved_module
+                    .as_ref()
+                    .map(|module| module.imports.as_slice())
+                    .unwrap_or_default(),
+                None => previous_modules[identity].imports.as_slice(),
+            };
+            next_frontier.extend(
+                workspace_import_targets(identity, imports)
+                    .filter_map(|target| identity_to_index.get(target.as_str()).copied()),
+            );
+        }
+        next_frontier.sort_unstable();
+        next_frontier.dedup();
+        next_frontier.retain(|index| !reached.contains(index));
+        frontier = next_frontier;
+    }
+
+    let mut indices = reached.into_iter().collect::<Vec<_>>();
+    indices.sort_unstable();
+    let closure = LogicalModuleGraph::from_modules(
+        indices
+            .iter()
+            .map(|index| modules[*index].clone())
+            .collect(),
+    )
+    .expect("a subset of a valid module graph is valid");
+    let parsed = parsed
+        .into_iter()
+        .map(|(index, source_file)| (modules[index].identity.clone(), source_file))
+        .collect();
+    (closure, parsed)
+}
+
+/// Returns the normalized workspace identities targeted by local imports of one module.
+fn workspace_import_targets<'a>(
+    identity: &'a str,
+    imports: &'a [Import],
+) -> impl Iterator<Item = String> + 'a {
+    imports.iter().filter_map(move |import| {
+        if is_git_library_path(&import.library_path) || is_http_library_path(&import.library_path) {
+            return None;
+        }
+        normalize_workspace_import_identity(identity, &import.library_path).ok()
+    })
+}
+
+/// Analyzes the modules of `graph` that `changed` affects and reuses the rest from `previous`.
+///
+/// A module is affected when it changed, when it transitively imports an affected workspace
+/// module, or when one of its library imports no longer resolves to the library snapshot that
+/// `previous` selected. Affected modules and their direct workspace import targets are parsed
+/// again; like in a full build, affected modules see every other workspace module as a peer, the
+/// ones not parsed again through their previously lowered module. `pre_parsed` holds changed
+/// modules a caller already parsed, keyed by identity.
+fn reanalyze_logical_module_graph(
+    graph: &LogicalModuleGraph,
+    build_context: &ProgramBuildContext,
+    previous: &ProgramArtifact,
+    changed: &FxHashSet<String>,
+    mut pre_parsed: FxHashMap<String, GraphSourceFile>,
+) -> LogicalProgramAnalysis {
+    let workers = build_context.analysis_workers();
+    let modules = graph.modules();
+    let previous_modules = previous
+        .root_modules
+        .iter()
+        .map(|module| (module.file_name.as_str(), module))
+        .collect::<FxHashMap<_, _>>();
+    let previous_libraries = previous
+        .libraries
+        .iter()
+        .map(|library| (library.root_path.as_path(), library.fingerprint))
+        .collect::<FxHashMap<_, _>>();
+
+    // Changed modules are parsed first because their new imports decide which importers are
+    // affected.
+    let changed_indices = (0..modules.len())
+        .filter(|index| changed.contains(&modules[*index].identity))
+        .collect::<Vec<_>>();
+    let mut parsed = changed_indices
+        .iter()
+        .filter_map(|index| {
+            pre_parsed
+                .remove(&modules[*index].identity)
+                .map(|source_file| (*index, source_file))
         })
-        .collect()
+        .collect::<FxHashMap<_, _>>();
+    let unparsed_changed = changed_indices
+        .into_iter()
+        .filter(|index| !parsed.contains_key(index))
+        .collect::<Vec<_>>();
+    parsed.extend(unparsed_changed.iter().copied().zip(parallel_map(
+        unparsed_changed.len(),
+        workers,
+        |index| parse_logical_source_file(&modules[unparsed_changed[index]]),
+    )));
+
+    let mut affected = vec![false; modules.len()];
+    let mut import_targets = Vec::with_capacity(modules.len());
+    let mut reused_library_imports = vec![Vec::new(); modules.len()];
+    for (index, module) in modules.iter().enumerate() {
+        let imports = match parsed.get(&index) {
+            Some(source_file) => source_file
+                .preserved_module
+                .as_ref()
+                .map(|module| module.imports.as_slice())
+                .unwrap_or_default(),
+            None => previous_modules[module.identity.as_str()]
+                .imports
+                .as_slice(),
+        };
+
+        let mut targets = Vec::new();
+        for import in imports {
+            if is_git_library_path(&import.library_path)
+                || is_http_library_path(&import.library_path)
+            {
+                continue;
+            }
+            let Ok(identity) =
+                normalize_workspace_import_identity(&module.identity, &import.library_path)
+            else {
+                continue;
+            };
+            if graph.contains_identity(&identity) {
+                targets.push(identity);
+                continue;
+            }
+            if parsed.contains_key(&index) {
+                continue;
+            }
+
+            match build_context.visible_library_by_logical_identity(&identity) {
+                LogicalLibraryResolution::Found(normalized_root, library)
+                    if previous_libraries.get(library.root_path.as_path())
+                        == Some(&library.fingerprint) =>
+                {
+                    reused_library_imports[index].push(ResolvedBuildContextImport {
+                        normalized_root,
+                        library,
+                        shares_export_types: false,
+                    });
+                }
+                _ => affected[index] = true,
+            }
+        }
+
+        affected[index] |= parsed.contains_key(&index);
+        import_targets.push(targets);
+    }
+
+    let identity_to_index = modules
+        .iter()
+        .enumerate()
+        .map(|(index, module)| (module.identity.as_str(), index))
+        .collect::<FxHashMap<_, _>>();
+    loop {
+        let mut propagated = false;
+        for index in 0..modules.len() {
+            if !affected[index]
+                && import_targets[index]
+                    .iter()
+                    .any(|target| affected[identity_to_index[target.as_str()]])
+            {
+                affected[index] = true;
+                propagated = true;
+            }
+        }
+        if !propagated {
+            break;
+        }
+    }
+
+    let mut required = affected.clone();
+    for index in (0..modules.len()).filter(|index| affected[*index]) {
+        for target in &import_targets[index] {
+            required[identity_to_index[target.as_str()]] = true;
+        }
+    }
+    let unparsed = (0..modules.len())
+        .filter(|index| required[*index] && !parsed.contains_key(index))
+        .collect::<Vec<_>>();
+    parsed.extend(
+        unparsed
+            .iter()
+            .copied()
+            .zip(parallel_map(unparsed.len(), workers, |index| {
+                parse_logical_source_file(&modules[unparsed[index]])
+            })),
+    );
+
+    // Peer lookups through signatures of imported items can reach any workspace module, so
+    // modules that were not parsed again take part through their previous lowered module.
+    let mut stats = ProgramBuildStats::from_source_files(parsed.values());
+    let source_files = modules
+        .iter()
+        .enumerate()
+        .map(|(index, module)| {
+            parsed.remove(&index).unwrap_or_else(|| {
+                GraphSourceFile::reused(module, previous_modules[module.identity.as_str()])
+            })
+        })
+        .collect::<Vec<_>>();
+    let analyzed_indices = (0..modules.len())
+        .filter(|index| affected[*index])
+        .collect::<Vec<_>>();
+    let mut analyzed = analyzed_indices
+        .iter()
+        .copied()
+        .zip(parallel_map(analyzed_indices.len(), workers, |index| {
+            timed(|| {
+                analyze_logical_source_file(&source_files, build_context, analyzed_indices[index])
+            })
+        }))
+        .collect::<FxHashMap<_, _>>();
+
+    let mut root_modules = Vec::with_capacity(modules.len());
+    let mut libraries_by_root = FxHashMap::<PathBuf, Arc<LibraryArtifact>>::default();
+    for (index, module) in modules.iter().enumerate() {
+        let libraries = match analyzed.remove(&index) {
+            Some(((mut artifact, libraries, selection_diagnostics), elapsed)) => {
+                stats.analyzed_modules += 1;
+                stats.analyze += elapsed;
+                artifact.diagnostics.extend(selection_diagnostics);
+                root_modules.push(artifact);
+                libraries
+            }
+            None => {
+                let previous_module = previous_modules[module.identity.as_str()];
+                root_modules.push(previous_module.clone());
+                // The reused module's diagnostics already hold its selection diagnostics.
+                selected_program_libraries(
+                    &reused_library_imports[index],
+                    &module.identity,
+                    module.source.as_ref(),
+                    build_context,
+                )
+                .libraries
+            }
+        };
+
+        for library in libraries {
+            libraries_by_root
+                .entry(library.root_path.clone())
+                .or_insert(library);
+        }
+    }
+
+    let mut libraries = libraries_by_root.into_values().collect::<Vec<_>>();
+    libraries.sort_by(|lhs, rhs| lhs.root_path.cmp(&rhs.root_path));
+
+    LogicalProgramAnalysis {
+        modules: root_modules,
+        libraries,
+        source_map: graph.source_map(),
+        stats,
+    }
 }
 
 fn analyze_logical_source_file(
@@ -818,7 +1880,7 @@ fn analyze_logical_source_file(
 ) -> (ModuleArtifact, Vec<Arc<LibraryArtifact>>, Vec<Diagnostic>) {
     let source_file = &source_files[current_file_index];
     let diagnostics = source_file.diagnostics.clone();
-    let Some(preserved_module) = source_file.preserved_module.clone() else {
+    let Some(preserved_module) = source_file.preserved_module.as_deref() else {
         return (
             parse_failure_artifact(&source_file.identity, source_file.source_id, diagnostics),
             Vec::new(),
@@ -826,7 +1888,7 @@ fn analyze_logical_source_file(
         );
     };
 
-    let mut prepared_module = PreparedModule::new(&source_file.identity, preserved_module);
+    let mut prepared_module = PreparedModule::new(&source_file.identity, preserved_module.clone());
     add_graph_peer_modules(&mut prepared_module, source_files, current_file_index);
     let resolved_imports = apply_graph_imports(
         &mut prepared_module,
@@ -842,7 +1904,12 @@ fn analyze_logical_source_file(
     );
 
     (
-        finalize_module_artifact(&source_file.identity, prepared_module, diagnostics),
+        finalize_module_artifact(
+            &source_file.identity,
+            prepared_module,
+            diagnostics,
+            &resolved_imports,
+        ),
         selection.libraries,
         selection.diagnostics,
     )
@@ -859,7 +1926,7 @@ fn add_graph_peer_modules(
         }
 
         if let Some(peer_module) = source_file.preserved_module.as_ref() {
-            module.add_peer_module(source_file.identity.clone(), Arc::new(peer_module.clone()));
+            module.add_peer_module(source_file.identity.clone(), Arc::clone(peer_module));
         }
     }
 }
@@ -954,7 +2021,12 @@ fn apply_graph_imports(
                 resolved_imports.push(ResolvedBuildContextImport {
                     normalized_root,
                     library: library.clone(),
+                    shares_export_types: matches!(
+                        import.kind,
+                        ImportKind::Wildcard { alias: None }
+                    ),
                 });
+                add_library_peer_modules(module, &library);
 
                 match &import.kind {
                     ImportKind::Wildcard { alias } => {
@@ -1184,6 +2256,14 @@ fn build_program_artifact_from_graph(
     build_context: &ProgramBuildContext,
 ) -> ProgramArtifact {
     let analysis = analyze_logical_module_graph(graph, build_context);
+    assemble_program_artifact(graph, entry_identity, analysis)
+}
+
+fn assemble_program_artifact(
+    graph: &LogicalModuleGraph,
+    entry_identity: &str,
+    analysis: LogicalProgramAnalysis,
+) -> ProgramArtifact {
     let mut hasher = DefaultHasher::new();
     entry_identity.hash(&mut hasher);
     for module in graph.modules() {
@@ -1198,9 +2278,12 @@ fn build_program_artifact_from_graph(
     let root_modules = analysis.modules;
     let libraries = analysis.libraries;
     let source_map = analysis.source_map;
+    let mut build_stats = analysis.stats;
 
     let fingerprint = hasher.finish();
-    let resolved_program = build_resolved_program(&root_modules, &libraries, fingerprint);
+    let (resolved_program, link) =
+        timed(|| build_resolved_program(&root_modules, &libraries, fingerprint));
+    build_stats.link = link;
     let entry_module_id = resolved_program.source_provider_module_id(entry_identity);
 
     ProgramArtifact {
@@ -1210,8 +2293,10 @@ fn build_program_artifact_from_graph(
         libraries,
         diagnostics,
         fingerprint,
-        resolved_program,
+        resolved_program: Arc::new(resolved_program),
+        build_stats,
         source_map,
+        interpreters: InterpreterPool::new(),
     }
 }
 
@@ -1235,8 +2320,14 @@ fn finalize_module_artifact(
     file_name: &str,
     prepared_module: PreparedModule,
     diagnostics: Vec<Diagnostic>,
+    resolved_imports: &[ResolvedBuildContextImport],
 ) -> ModuleArtifact {
-    analyze_prepared_module(file_name, prepared_module, diagnostics)
+    let imported = resolved_imports
+        .iter()
+        .filter(|import| import.shares_export_types)
+        .map(|import| Arc::clone(&import.library.export_types))
+        .collect();
+    analyze_prepared_module_with_imports(file_name, prepared_module, diagnostics, imported)
 }
 
 fn apply_build_context_imports(
@@ -1349,7 +2440,9 @@ fn apply_build_context_imports(
         resolved_imports.push(ResolvedBuildContextImport {
             normalized_root: normalized_root.clone(),
             library: library.clone(),
+            shares_export_types: matches!(import.kind, ImportKind::Wildcard { alias: None }),
         });
+        add_library_peer_modules(module, &library);
 
         match &import.kind {
             ImportKind::Wildcard { alias } => {
@@ -1406,6 +2499,37 @@ fn apply_build_context_imports(
     resolved_imports
 }
 
+fn add_library_peer_modules(module: &mut PreparedModule, library: &LibraryArtifact) {
+    for artifact in &library.modules {
+        if let Some(lowered_module) = artifact.lowered_module.as_ref() {
+            module.add_peer_module(artifact.file_name.clone(), lowered_module.clone());
+        }
+    }
+}
+
+/// Resolves the types of `library`'s exports as an unaliased wildcard import binds them.
+fn freeze_library_export_types(library: &LibraryArtifact) -> ImportedTypeEnvironment {
+    let mut module = PreparedModule::new(
+        library.root_path.display().to_string(),
+        LoweredModule::new(SourceId::new(0)),
+    );
+    let mut export_names = library.exported_items.keys().collect::<Vec<_>>();
+    export_names.sort();
+
+    let mut imported_visible_names = FxHashMap::default();
+    for export_name in export_names {
+        add_imported_interface_bindings(
+            &mut module,
+            export_name,
+            TextSpan::default(),
+            library,
+            &library.exported_items[export_name],
+            &mut imported_visible_names,
+        );
+    }
+    ImportedTypeEnvironment::from_prepared_module(&module)
+}
+
 fn add_ambiguous_interface_diagnostic(
     module: &mut PreparedModule,
     visible_name: &str,
@@ -1437,12 +2561,6 @@ fn add_imported_interface_bindings(
     item_indices: &[usize],
     imported_visible_names: &mut FxHashMap<(PreparedNamespace, String), String>,
 ) {
-    for artifact in &library.modules {
-        if let Some(lowered_module) = artifact.lowered_module.as_ref() {
-            module.add_peer_module(artifact.file_name.clone(), lowered_module.clone());
-        }
-    }
-
     let mut candidates = FxHashMap::<PreparedNamespace, Vec<usize>>::default();
 
     for item_index in item_indices {
@@ -1822,7 +2940,7 @@ fn build_resolved_program(
         }
     }
 
-    ResolvedProgram::new(
+    let mut program = ResolvedProgram::new(
         fingerprint,
         root_module_ids,
         modules,
@@ -1831,7 +2949,14 @@ fn build_resolved_program(
         entry_records,
         entry_enums,
         imports,
-    )
+    );
+    // Link every module's import bindings once at build time so each evaluation of the artifact
+    // starts from prepared modules instead of rebuilding them, compile operator expressions to
+    // closures, then render static markup once so evaluations reuse it.
+    program.prelink_modules();
+    program.compile_expressions();
+    program.fold_static_elements();
+    program
 }
 
 fn add_graph_resolved_imports(
@@ -2778,6 +3903,71 @@ let root() = { helper() }"#;
             .any(|diagnostic| { diagnostic.message().contains("does not export 'helper'") }));
     }
 
+    #[test]
+    fn unaliased_library_imports_reuse_frozen_export_types() {
+        let temp = TempDir::new().expect("temp dir");
+        let app_dir = temp.path().join("app");
+        let ui_dir = temp.path().join("ui");
+        fs::create_dir_all(&app_dir).expect("app dir");
+        fs::create_dir_all(&ui_dir).expect("ui dir");
+
+        fs::write(
+            ui_dir.join("sizes.nx"),
+            r#"export type Size = int
+export let grow(size:Size): Size = { size + 1 }"#,
+        )
+        .expect("sizes file");
+
+        let registry = LibraryRegistry::new();
+        let ui_snapshot = registry
+            .load_library_from_directory(&ui_dir)
+            .expect("Expected ui registry load");
+        assert_eq!(ui_snapshot.export_types.len(), 1);
+        let build_context = registry.build_context();
+
+        let build = |file_name: &str, source: &str| {
+            let main_path = app_dir.join(file_name);
+            fs::write(&main_path, source).expect("main file");
+            build_program_artifact_from_source(
+                source,
+                &main_path.display().to_string(),
+                &build_context,
+            )
+            .expect("Expected program artifact")
+        };
+
+        for (file_name, source) in [
+            (
+                "wildcard.nx",
+                "import \"../ui\"\nlet root(): int = { grow(41) }",
+            ),
+            (
+                "aliased.nx",
+                "import \"../ui\" as Ui\nlet root() = { Ui.grow(41) }",
+            ),
+        ] {
+            let artifact = build(file_name, source);
+            assert!(
+                !has_error_diagnostics(&artifact.diagnostics),
+                "Expected {file_name} to type-check: {:?}",
+                artifact.diagnostics
+            );
+            let EvalResult::Ok(value) = eval_program_artifact(&artifact) else {
+                panic!("Expected {file_name} evaluation to succeed");
+            };
+            assert_eq!(value, nx_value::NxValue::Int(42));
+        }
+
+        let mismatch = build(
+            "mismatch.nx",
+            "import \"../ui\"\nlet root(): string = { grow(41) }",
+        );
+        assert!(mismatch
+            .diagnostics
+            .iter()
+            .any(|diagnostic| diagnostic.code() == Some("return-type-mismatch")));
+    }
+
     #[test]
     fn program_artifact_record_inheritance_resolves_imported_abstract_base() {
         let temp = TempDir::new().expect("temp dir");
@@ -2889,6 +4079,76 @@ let root() = { <Button /> }"#,
             .is_some());
     }
 
+    #[test]
+    fn library_registry_reuses_persistent_cache_until_sources_change() {
+        let temp = TempDir::new().expect("temp dir");
+        let widgets_dir = temp.path().join("widgets");
+        let ui_dir = temp.path().join("ui");
+        let cache_dir = temp.path().join("cache");
+        fs::create_dir_all(&widgets_dir).expect("widgets dir");
+        fs::create_dir_all(&ui_dir).expect("ui dir");
+
+        fs::write(
+            ui_dir.join("button.nx"),
+            r#"export let <Button /> = <button />"#,
+        )
+        .expect("ui file");
+        fs::write(
+            widgets_dir.join("search-box.nx"),
+            r#"import "../ui"
+export let <SearchBox /> = <Button />"#,
+        )
+        .expect("widgets file");
+
+        let count_cache_entries = || {
+            fs::read_dir(&cache_dir)
+                .expect("cache dir")
+                .filter(|entry| {
+                    entry.as_ref().expect("cache entry").path().extension()
+                        == Some("nxlib".as_ref())
+                })
+                .count()
+        };
+
+        let first = LibraryRegistry::new();
+        first.set_cache_directory(Some(cache_dir.clone()));
+        let analyzed = first
+            .load_library_from_directory(&widgets_dir)
+            .expect("Expected analyzed load to succeed");
+        assert_eq!(count_cache_entries(), 2);
+
+        let second = LibraryRegistry::new();
+        second.set_cache_directory(Some(cache_dir.clone()));
+        let cached = second
+            .load_library_from_directory(&widgets_dir)
+            .expect("Expected cached load to succeed");
+        assert_eq!(cached.fingerprint, analyzed.fingerprint);
+        assert_eq!(cached.exports, analyzed.exports);
+        assert_eq!(cached.interface_items, analyzed.interface_items);
+        assert_eq!(
+            cached.modules[0].lowered_module,
+            analyzed.modules[0].lowered_module
+        );
+
+        fs::write(
+            ui_dir.join("button.nx"),
+            r#"export let <Button /> = <button />
+export let <Link /> = <a />"#,
+        )
+        .expect("updated ui file");
+
+        let third = LibraryRegistry::new();
+        third.set_cache_directory(Some(cache_dir.clone()));
+        third
+            .load_library_from_directory(&widgets_dir)
+            .expect("Expected reload after source change to succeed");
+        let ui = third
+            .get_loaded_library(&fs::canonicalize(&ui_dir).unwrap())
+            .expect("ui library should be loaded");
+        assert!(ui.exports.contains_key("Link"));
+        assert_eq!(count_cache_entries(), 3);
+    }
+
     #[test]
     fn library_registry_rejects_circular_library_dependencies() {
         let temp = TempDir::new().expect("temp dir");
@@ -2949,6 +4209,110 @@ let from_b() = { from_a() }"#,
             .is_none());
     }
 
+    #[test]
+    fn library_registry_loads_many_roots_with_shared_dependencies() {
+        let temp = TempDir::new().expect("temp dir");
+        let core_dir = temp.path().join("core");
+        let ui_dir = temp.path().join("ui");
+        let forms_dir = temp.path().join("forms");
+        for dir in [&core_dir, &ui_dir, &forms_dir] {
+            fs::create_dir_all(dir).expect("library dir");
+        }
+
+        fs::write(
+            core_dir.join("answer.nx"),
+            r#"export let answer(): int = { 42 }"#,
+        )
+        .expect("core file");
+        fs::write(
+            ui_dir.join("label.nx"),
+            r#"import "../core"
+export let label(): int = { answer() }"#,
+        )
+        .expect("ui file");
+        fs::write(
+            forms_dir.join("field.nx"),
+            r#"import "../core"
+export let field(): int = { answer() }"#,
+        )
+        .expect("forms file");
+
+        let registry = LibraryRegistry::new();
+        let libraries = registry
+            .load_libraries_from_directories([&ui_dir, &forms_dir])
+            .expect("Expected bulk load to succeed");
+
+        assert_eq!(libraries.len(), 2);
+        assert!(libraries[0].exports.contains_key("label"));
+        assert!(libraries[1].exports.contains_key("field"));
+        let core_root = fs::canonicalize(&core_dir).expect("canonical core");
+        assert_eq!(libraries[0].dependency_roots, vec![core_root.clone()]);
+        assert_eq!(registry.loaded_roots().len(), 3);
+
+        let core = registry
+            .get_loaded_library(&core_root)
+            .expect("core library should be loaded");
+        let reloaded = registry
+            .load_library_from_directory(&core_dir)
+            .expect("Expected loaded core library");
+        assert!(Arc::ptr_eq(&core, &reloaded));
+
+        let sequential = LibraryRegistry::new()
+            .load_library_from_directory(&ui_dir)
+            .expect("Expected sequential load to succeed");
+        assert_eq!(sequential.fingerprint, libraries[0].fingerprint);
+
+        let single_worker = LibraryRegistry::new();
+        single_worker.set_load_workers(1);
+        assert_eq!(single_worker.load_workers(), 1);
+        let single_worker_libraries = single_worker
+            .load_libraries_from_directories([&ui_dir, &forms_dir])
+            .expect("Expected single-worker bulk load to succeed");
+        assert_eq!(
+            single_worker_libraries
+                .iter()
+                .map(|library| library.fingerprint)
+                .collect::<Vec<_>>(),
+            libraries
+                .iter()
+                .map(|library| library.fingerprint)
+                .collect::<Vec<_>>()
+        );
+    }
+
+    #[test]
+    fn library_registry_bulk_load_rejects_circular_library_dependencies() {
+        let temp = TempDir::new().expect("temp dir");
+        let a_dir = temp.path().join("a");
+        let b_dir = temp.path().join("b");
+        fs::create_dir_all(&a_dir).expect("a dir");
+        fs::create_dir_all(&b_dir).expect("b dir");
+        fs::write(a_dir.join("entry.nx"), r#"import "../b""#).expect("a file");
+        fs::write(b_dir.join("entry.nx"), r#"import "../a""#).expect("b file");
+
+        let registry = LibraryRegistry::new();
+        let error = registry
+            .load_libraries_from_directories([&b_dir, &a_dir])
+            .expect_err("Expected circular library dependency to fail");
+        let a_root = fs::canonicalize(&a_dir).expect("canonical a");
+        let b_root = fs::canonicalize(&b_dir).expect("canonical b");
+        let expected_chain = format!(
+            "{} -> {} -> {}",
+            a_root.display(),
+            b_root.display(),
+            a_root.display()
+        );
+
+        assert_eq!(error.len(), 1);
+        assert!(
+            error[0].message.contains(&expected_chain),
+            "Expected circular dependency chain '{}', got {:?}",
+            expected_chain,
+            error
+        );
+        assert!(registry.loaded_roots().is_empty());
+    }
+
     #[test]
     fn program_artifact_uses_registry_backed_build_context() {
         let temp = TempDir::new().expect("temp dir");
@@ -2998,6 +4362,54 @@ let root() = { answer() }"#;
         assert_eq!(value, nx_value::NxValue::Int(42));
     }
 
+    #[test]
+    fn program_artifact_image_restores_without_sources() {
+        let temp = TempDir::new().expect("temp dir");
+        let app_dir = temp.path().join("app");
+        let ui_dir = temp.path().join("ui");
+        fs::create_dir_all(&app_dir).expect("app dir");
+        fs::create_dir_all(&ui_dir).expect("ui dir");
+
+        fs::write(
+            ui_dir.join("answer.nx"),
+            r#"export let answer(): int = { 42 }"#,
+        )
+        .expect("ui file");
+        let registry = LibraryRegistry::new();
+        registry
+            .load_library_from_directory(&ui_dir)
+            .expect("Expected registry load");
+
+        let main_path = app_dir.join("main.nx");
+        let source = r#"import "../ui"
+let root() = { answer() }"#;
+        fs::write(&main_path, source).expect("main file");
+        let artifact = build_program_artifact_from_source(
+            source,
+            &main_path.display().to_string(),
+            &registry.build_context(),
+        )
+        .expect("Expected program artifact");
+
+        let image = artifact.to_image().expect("Expected program image");
+        drop(temp);
+
+        let restored = ProgramArtifact::from_image(&image).expect("Expected image to load");
+        assert_eq!(restored.fingerprint, artifact.fingerprint);
+        assert_eq!(restored.entry_identity, artifact.entry_identity);
+        assert_eq!(restored.entry_module_id, artifact.entry_module_id);
+        assert_eq!(restored.libraries.len(), 1);
+        assert!(restored.resolved_program.is_prelinked());
+
+        let EvalResult::Ok(value) = eval_program_artifact(&restored) else {
+            panic!("Expected restored program artifact evaluation to succeed");
+        };
+        assert_eq!(value, nx_value::NxValue::Int(42));
+
+        assert!(ProgramArtifact::from_image(&image[..image.len() / 2]).is_err());
+        assert!(ProgramArtifact::from_image(b"not an image").is_err());
+    }
+
     #[test]
     fn imported_content_bindings_match_local_behavior() {
         let temp = TempDir::new().expect("temp dir");
@@ -3617,6 +5029,12 @@ let root(): int = { answer() }"#
                 .source_provider_module_id("app/main.nx")
         );
 
+        assert!(artifact.resolved_program.is_prelinked());
+        assert!(artifact
+            .resolved_program
+            .prelinked_module(entry_module_id)
+            .is_some());
+
         let entry_module = artifact
             .resolved_program
             .module(entry_module_id)
@@ -3651,6 +5069,265 @@ let root(): int = { answer() }"#
         );
     }
 
+    fn fan_in_workspace(module_count: usize, extra_entry_source: &str) -> NxWorkspace {
+        let mut modules = (0..module_count)
+            .map(|index| {
+                workspace_module(
+                    &format!("shared/value{index}.nx"),
+                    format!("export let value{index}(): int = {{ {index} }}").into_bytes(),
+                )
+            })
+            .collect::<Vec<_>>();
+        let imports = (0..module_count)
+            .map(|index| format!("import {{ value{index} }} from \"../shared/value{index}.nx\"\n"))
+            .collect::<String>();
+        let sum = (0..module_count)
+            .map(|index| format!("value{index}()"))
+            .collect::<Vec<_>>()
+            .join(" + ");
+        modules.push(workspace_module(
+            "app/main.nx",
+            format!("{imports}let root(): int = {{ {sum} }}\n{extra_entry_source}").into_bytes(),
+        ));
+        workspace(modules)
+    }
+
+    #[test]
+    fn workspace_analysis_is_independent_of_analysis_workers() {
+        let sequential = ProgramBuildContext::empty().with_analysis_workers(1);
+        let parallel = ProgramBuildContext::empty().with_analysis_workers(4);
+        assert_eq!(sequential.analysis_workers(), 1);
+        assert_eq!(parallel.analysis_workers(), 4);
+
+        let broken = fan_in_workspace(24, r#"let broken(): int = { "text" }"#);
+        let sequential_diagnostics = validate_workspace(&broken, &sequential);
+        assert!(!sequential_diagnostics.is_empty());
+        assert_eq!(
+            validate_workspace(&broken, &parallel),
+            sequential_diagnostics
+        );
+
+        let valid = fan_in_workspace(24, "");
+        let sequential = build_workspace_program_artifact(&valid, "app/main.nx", &sequential)
+            .expect("sequential artifact");
+        let parallel = build_workspace_program_artifact(&valid, "app/main.nx", &parallel)
+            .expect("parallel artifact");
+        assert_eq!(parallel.fingerprint, sequential.fingerprint);
+        assert_eq!(
+            parallel
+                .root_modules
+                .iter()
+                .map(|module| module.file_name.as_str())
+                .collect::<Vec<_>>(),
+            sequential
+                .root_modules
+                .iter()
+                .map(|module| module.file_name.as_str())
+                .collect::<Vec<_>>()
+        );
+
+        let EvalResult::Ok(value) = eval_program_artifact(&parallel) else {
+            panic!("Expected parallel workspace artifact evaluation to succeed");
+        };
+        assert_eq!(value, nx_value::NxValue::Int((0..24).sum()));
+    }
+
+    #[test]
+    fn entry_closure_pruning_keeps_only_modules_reachable_from_entry() {
+        let mut modules = fan_in_workspace(2, "").modules().to_vec();
+        modules.push(workspace_module(
+            "tools/broken.nx",
+            r#"let broken(): int = { "text" }"#,
+        ));
+        let workspace = workspace(modules);
+
+        let full_context = ProgramBuildContext::empty();
+        assert!(!full_context.entry_closure_pruning());
+        assert!(
+            build_workspace_program_artifact(&workspace, "app/main.nx", &full_context).is_err()
+        );
+
+        let pruned_context = ProgramBuildContext::empty().with_entry_closure_pruning(true);
+        let artifact = build_workspace_program_artifact(&workspace, "app/main.nx", &pruned_context)
+            .expect("Expected pruned build to ignore modules outside the entry closure");
+        assert_eq!(
+            artifact
+                .root_modules
+                .iter()
+                .map(|module| module.file_name.as_str())
+                .collect::<Vec<_>>(),
+            vec!["shared/value0.nx", "shared/value1.nx", "app/main.nx"]
+        );
+        assert!(!artifact.source_map.contains_key("tools/broken.nx"));
+
+        let EvalResult::Ok(value) = eval_program_artifact(&artifact) else {
+            panic!("Expected pruned workspace artifact evaluation to succeed");
+        };
+        assert_eq!(value, nx_value::NxValue::Int(1));
+    }
+
+    #[test]
+    fn rebuild_workspace_program_artifact_reanalyzes_only_affected_modules() {
+        let build_context = ProgramBuildContext::empty();
+        let previous = build_workspace_program_artifact(
+            &fan_in_workspace(4, ""),
+            "app/main.nx",
+            &build_context,
+        )
+        .expect("previous artifact");
+
+        let changes = workspace(vec![
+            workspace_module("shared/value1.nx", r#"export let value1(): int = { 10 }"#),
+            workspace_module("shared/unused.nx", r#"export let unused(): int = { 7 }"#),
+        ]);
+        let rebuilt = rebuild_workspace_program_artifact(&previous, &changes, &build_context)
+            .expect("rebuilt artifact");
+
+        let lowered_module = |artifact: &ProgramArtifact, file_name: &str| {
+            artifact
+                .root_modules
+                .iter()
+                .find(|module| module.file_name == file_name)
+                .and_then(|module| module.lowered_module.clone())
+                .expect("lowered module")
+        };
+        for reused in ["shared/value0.nx", "shared/value2.nx", "shared/value3.nx"] {
+            assert!(Arc::ptr_eq(
+                &lowered_module(&previous, reused),
+                &lowered_module(&rebuilt, reused)
+            ));
+        }
+        for reanalyzed in ["shared/value1.nx", "app/main.nx"] {
+            assert!(!Arc::ptr_eq(
+                &lowered_module(&previous, reanalyzed),
+                &lowered_module(&rebuilt, reanalyzed)
+            ));
+        }
+
+        let mut full_modules = fan_in_workspace(4, "").modules().to_vec();
+        full_modules[1] = changes.modules()[0].clone();
+        full_modules.push(changes.modules()[1].clone());
+        let full = build_workspace_program_artifact(
+            &workspace(full_modules),
+            "app/main.nx",
+            &build_context,
+        )
+        .expect("full artifact");
+        assert_eq!(rebuilt.fingerprint, full.fingerprint);
+        assert_eq!(rebuilt.entry_module_id, full.entry_module_id);
+
+        let EvalResult::Ok(value) = eval_program_artifact(&rebuilt) else {
+            panic!("Expected rebuilt workspace artifact evaluation to succeed");
+        };
+        assert_eq!(value, nx_value::NxValue::Int(15));
+
+        let broken = workspace(vec![workspace_module(
+            "shared/value2.nx",
+            r#"export let value2(): int = { "text" }"#,
+        )]);
+        assert!(rebuild_workspace_program_artifact(&rebuilt, &broken, &build_context).is_err());
+    }
+
+    #[test]
+    fn rebuild_workspace_program_artifact_resolves_types_from_untouched_modules() {
+        let build_context = ProgramBuildContext::empty();
+        let meta = workspace_module("shared/meta.nx", r#"export type Meta = { depth:int }"#);
+        let make = workspace_module(
+            "shared/make.nx",
+            r#"import { Meta } from "./meta.nx"
+export let make(depth:int): Meta = { <Meta depth={depth} /> }"#,
+        );
+        let main = |offset: i64| {
+            workspace_module(
+                "app/main.nx",
+                format!(
+                    "import {{ make }} from \"../shared/make.nx\"\nlet root(): int = {{ make(41).depth + {offset} }}"
+                )
+                .into_bytes(),
+            )
+        };
+        let previous = build_workspace_program_artifact(
+            &workspace(vec![meta.clone(), make.clone(), main(1)]),
+            "app/main.nx",
+            &build_context,
+        )
+        .expect("previous artifact");
+
+        let rebuilt = rebuild_workspace_program_artifact(
+            &previous,
+            &workspace(vec![main(2)]),
+            &build_context,
+        )
+        .expect("Expected rebuilt module to resolve Meta through the untouched module");
+        let full = build_workspace_program_artifact(
+            &workspace(vec![meta, make, main(2)]),
+            "app/main.nx",
+            &build_context,
+        )
+        .expect("full artifact");
+        assert_eq!(rebuilt.fingerprint, full.fingerprint);
+        assert_eq!(rebuilt.diagnostics, full.diagnostics);
+
+        let EvalResult::Ok(value) = eval_program_artifact(&rebuilt) else {
+            panic!("Expected rebuilt workspace artifact evaluation to succeed");
+        };
+        assert_eq!(value, nx_value::NxValue::Int(43));
+    }
+
+    #[test]
+    fn rebuild_workspace_program_artifact_honors_entry_closure_pruning() {
+        let pruned_context = ProgramBuildContext::empty().with_entry_closure_pruning(true);
+        let previous = build_workspace_program_artifact(
+            &fan_in_workspace(2, ""),
+            "app/main.nx",
+            &pruned_context,
+        )
+        .expect("previous artifact");
+
+        let main = workspace_module(
+            "app/main.nx",
+            r#"import { value0 } from "../shared/value0.nx"
+let root(): int = { value0() + 5 }"#,
+        );
+        let broken = workspace_module("tools/broken.nx", r#"let broken(): int = { "text" }"#);
+        let changes = workspace(vec![main.clone(), broken.clone()]);
+        assert!(rebuild_workspace_program_artifact(
+            &previous,
+            &changes,
+            &ProgramBuildContext::empty()
+        )
+        .is_err());
+
+        let rebuilt = rebuild_workspace_program_artifact(&previous, &changes, &pruned_context)
+            .expect("Expected pruned rebuild to ignore modules outside the entry closure");
+        assert_eq!(
+            rebuilt
+                .root_modules
+                .iter()
+                .map(|module| module.file_name.as_str())
+                .collect::<Vec<_>>(),
+            vec!["shared/value0.nx", "app/main.nx"]
+        );
+        assert!(!rebuilt.source_map.contains_key("tools/broken.nx"));
+        assert!(!rebuilt.source_map.contains_key("shared/value1.nx"));
+
+        let mut full_modules = fan_in_workspace(2, "").modules().to_vec();
+        full_modules[2] = main;
+        full_modules.push(broken);
+        let full = build_workspace_program_artifact(
+            &workspace(full_modules),
+            "app/main.nx",
+            &pruned_context,
+        )
+        .expect("full artifact");
+        assert_eq!(rebuilt.fingerprint, full.fingerprint);
+
+        let EvalResult::Ok(value) = eval_program_artifact(&rebuilt) else {
+            panic!("Expected pruned rebuilt artifact evaluation to succeed");
+        };
+        assert_eq!(value, nx_value::NxValue::Int(5));
+    }
+
     #[test]
     fn build_workspace_program_artifact_reports_missing_entry() {
         let workspace = workspace(vec![workspace_module(
@@ -3,11 +3,14 @@ use crate::eval::{
     build_source_program_artifact, program_artifact_error_diagnostics, program_root_source,
     runtime_error_diagnostics,
 };
-use crate::value::{from_nx_value, to_nx_value};
+use crate::render_cache::{ComponentRenderCache, RenderCacheKeyRef};
+use crate::value::{from_nx_value, to_nx_value, value_from_msgpack_slice};
 use crate::{NxDiagnostic, NxSeverity};
-use nx_interpreter::Interpreter;
+use nx_interpreter::{CallMemo, Interpreter, ModuleQualifiedItemRef, ResourceLimits, Value};
 use nx_value::NxValue;
 use serde::{Deserialize, Serialize};
+use std::borrow::Cow;
+use std::sync::Arc;
 
 #[derive(Clone, Copy)]
 enum ComponentLookup<'a> {
@@ -64,6 +67,61 @@ pub enum ComponentEvaluateEvalResult {
     Err(Vec<NxDiagnostic>),
 }
 
+/// One component evaluation within a batch submitted to
+/// [`evaluate_component_batch_program_artifact`].
+#[derive(Debug, Clone, Copy)]
+pub struct ComponentEvaluateRequest<'a> {
+    /// Entry component name to evaluate.
+    pub component_name: &'a str,
+    /// Explicit component props.
+    pub props: &'a NxValue,
+    /// Host-owned current component state.
+    pub state: &'a NxValue,
+}
+
+/// Host-supplied props or state for the `*_runtime` component entry points.
+#[derive(Debug, Clone, Copy)]
+pub enum ComponentInput<'a> {
+    /// An already-decoded public value.
+    Value(&'a NxValue),
+    /// A MessagePack-encoded [`NxValue`], decoded straight into interpreter values for the call
+    /// without building an intermediate public value tree.
+    MessagePack(&'a [u8]),
+}
+
+impl<'a> From<&'a NxValue> for ComponentInput<'a> {
+    fn from(value: &'a NxValue) -> Self {
+        Self::Value(value)
+    }
+}
+
+/// A named entry component resolved once from a [`ProgramArtifact`].
+///
+/// Only valid with the artifact that produced it; other artifacts reject it with an
+/// `invalid-input` diagnostic.
+#[derive(Debug, Clone)]
+pub struct ResolvedComponent {
+    name: String,
+    entry: ModuleQualifiedItemRef,
+    program_fingerprint: u64,
+    source: String,
+}
+
+impl ResolvedComponent {
+    /// Returns the entry component name this component was resolved from.
+    pub fn name(&self) -> &str {
+        &self.name
+    }
+}
+
+/// Result of resolving a named component from a program artifact.
+pub enum ComponentResolveEvalResult {
+    /// Resolution succeeded.
+    Ok(ResolvedComponent),
+    /// Resolution failed with diagnostics.
+    Err(Vec<NxDiagnostic>),
+}
+
 /// Result of dispatching actions from source text.
 pub enum ComponentDispatchEvalResult {
     /// Dispatch succeeded.
@@ -89,7 +147,13 @@ pub fn initialize_component_source(
         Err(diagnostics) => return ComponentInitEvalResult::Err(diagnostics),
     };
 
-    initialize_component_program_artifact_with_source(&program, source, component_name, props)
+    public_init_result(initialize_component_runtime_with_source(
+        &program,
+        source,
+        component_name,
+        props.into(),
+        ResourceLimits::default(),
+    ))
 }
 
 /// Initializes a named component from a resolved [`ProgramArtifact`].
@@ -98,36 +162,75 @@ pub fn initialize_component_program_artifact(
     component_name: &str,
     props: &NxValue,
 ) -> ComponentInitEvalResult {
+    public_init_result(initialize_component_program_artifact_runtime(
+        program,
+        component_name,
+        props.into(),
+    ))
+}
+
+/// Initializes a named component like [`initialize_component_program_artifact`] but keeps the
+/// rendered interpreter [`Value`], so callers can serialize it directly through
+/// [`NxValueView`](crate::NxValueView) without building an [`NxValue`] tree.
+pub fn initialize_component_program_artifact_runtime(
+    program: &ProgramArtifact,
+    component_name: &str,
+    props: ComponentInput<'_>,
+) -> Result<nx_interpreter::ComponentInitResult, Vec<NxDiagnostic>> {
+    initialize_component_program_artifact_runtime_with_limits(
+        program,
+        component_name,
+        props,
+        ResourceLimits::default(),
+    )
+}
+
+/// Initializes a named component like [`initialize_component_program_artifact_runtime`] under
+/// caller-supplied [`ResourceLimits`], such as a deadline or cancellation token.
+pub fn initialize_component_program_artifact_runtime_with_limits(
+    program: &ProgramArtifact,
+    component_name: &str,
+    props: ComponentInput<'_>,
+    limits: ResourceLimits,
+) -> Result<nx_interpreter::ComponentInitResult, Vec<NxDiagnostic>> {
     let source = program_root_source(program);
-    initialize_component_program_artifact_with_source(program, &source, component_name, props)
+    initialize_component_runtime_with_source(program, &source, component_name, props, limits)
 }
 
-fn initialize_component_program_artifact_with_source(
+fn initialize_component_runtime_with_source(
     program: &ProgramArtifact,
     source: &str,
     component_name: &str,
-    props: &NxValue,
-) -> ComponentInitEvalResult {
+    props: ComponentInput<'_>,
+    limits: ResourceLimits,
+) -> Result<nx_interpreter::ComponentInitResult, Vec<NxDiagnostic>> {
     if let Some(diagnostics) = program_artifact_error_diagnostics(program, source) {
-        return ComponentInitEvalResult::Err(diagnostics);
+        return Err(diagnostics);
     }
 
-    if let Err(message) = validate_host_input_value(ComponentLookup::Program(program), props) {
-        return ComponentInitEvalResult::Err(invalid_input_diagnostics(message));
-    }
+    let props = component_init_inputs(program, props)?;
+    let interpreter = program.interpreter();
+    interpreter
+        .initialize_resolved_component_with_limits(component_name, props, limits)
+        .map_err(|error| runtime_error_diagnostics(source, error))
+}
 
-    let props = match from_nx_value(props) {
-        Ok(props) => props,
-        Err(error) => return ComponentInitEvalResult::Err(invalid_input_diagnostics(error)),
-    };
+fn component_init_inputs(
+    program: &ProgramArtifact,
+    props: ComponentInput<'_>,
+) -> Result<Value, Vec<NxDiagnostic>> {
+    host_input_value(ComponentLookup::Program(program), props).map_err(invalid_input_diagnostics)
+}
 
-    let interpreter = Interpreter::from_resolved_program(program.resolved_program.clone());
-    match interpreter.initialize_resolved_component(component_name, props) {
+fn public_init_result(
+    result: Result<nx_interpreter::ComponentInitResult, Vec<NxDiagnostic>>,
+) -> ComponentInitEvalResult {
+    match result {
         Ok(result) => ComponentInitEvalResult::Ok(ComponentInitResult {
             rendered: to_nx_value(&result.rendered),
             state_snapshot: result.state_snapshot,
         }),
-        Err(error) => ComponentInitEvalResult::Err(runtime_error_diagnostics(source, error)),
+        Err(diagnostics) => ComponentInitEvalResult::Err(diagnostics),
     }
 }
 
@@ -149,7 +252,14 @@ pub fn evaluate_component_source(
         Err(diagnostics) => return ComponentEvaluateEvalResult::Err(diagnostics),
     };
 
-    evaluate_component_program_artifact_with_source(&program, source, component_name, props, state)
+    public_evaluate_result(evaluate_component_runtime_with_source(
+        &program,
+        source,
+        component_name,
+        props.into(),
+        state.into(),
+        ResourceLimits::default(),
+    ))
 }
 
 /// Evaluates a named component from a resolved [`ProgramArtifact`] using explicit props and
@@ -162,43 +272,413 @@ pub fn evaluate_component_program_artifact(
     props: &NxValue,
     state: &NxValue,
 ) -> ComponentEvaluateEvalResult {
+    public_evaluate_result(evaluate_component_program_artifact_runtime(
+        program,
+        component_name,
+        props.into(),
+        state.into(),
+    ))
+}
+
+/// Evaluates a named component like [`evaluate_component_program_artifact`] but keeps the
+/// rendered interpreter [`Value`] for direct serialization through
+/// [`NxValueView`](crate::NxValueView).
+pub fn evaluate_component_program_artifact_runtime(
+    program: &ProgramArtifact,
+    component_name: &str,
+    props: ComponentInput<'_>,
+    state: ComponentInput<'_>,
+) -> Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>> {
+    evaluate_component_program_artifact_runtime_with_limits(
+        program,
+        component_name,
+        props,
+        state,
+        ResourceLimits::default(),
+    )
+}
+
+/// Evaluates a named component like [`evaluate_component_program_artifact_runtime`] under
+/// caller-supplied [`ResourceLimits`], such as a deadline or cancellation token.
+pub fn evaluate_component_program_artifact_runtime_with_limits(
+    program: &ProgramArtifact,
+    component_name: &str,
+    props: ComponentInput<'_>,
+    state: ComponentInput<'_>,
+    limits: ResourceLimits,
+) -> Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>> {
     let source = program_root_source(program);
-    evaluate_component_program_artifact_with_source(program, &source, component_name, props, state)
+    evaluate_component_runtime_with_source(program, &source, component_name, props, state, limits)
 }
 
-fn evaluate_component_program_artifact_with_source(
+fn evaluate_component_runtime_with_source(
     program: &ProgramArtifact,
     source: &str,
     component_name: &str,
-    props: &NxValue,
-    state: &NxValue,
-) -> ComponentEvaluateEvalResult {
+    props: ComponentInput<'_>,
+    state: ComponentInput<'_>,
+    limits: ResourceLimits,
+) -> Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>> {
     if let Some(diagnostics) = program_artifact_error_diagnostics(program, source) {
-        return ComponentEvaluateEvalResult::Err(diagnostics);
+        return Err(diagnostics);
+    }
+
+    let interpreter = program.interpreter();
+    evaluate_component_with_interpreter(
+        &interpreter,
+        program,
+        source,
+        component_name,
+        props,
+        state,
+        limits,
+    )
+}
+
+fn evaluate_component_with_interpreter(
+    interpreter: &Interpreter,
+    program: &ProgramArtifact,
+    source: &str,
+    component_name: &str,
+    props: ComponentInput<'_>,
+    state: ComponentInput<'_>,
+    limits: ResourceLimits,
+) -> Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>> {
+    let (props, state) = component_evaluate_inputs(program, props, state)?;
+    interpreter
+        .evaluate_resolved_component_with_limits(component_name, props, state, limits)
+        .map_err(|error| runtime_error_diagnostics(source, error))
+}
+
+fn component_evaluate_inputs(
+    program: &ProgramArtifact,
+    props: ComponentInput<'_>,
+    state: ComponentInput<'_>,
+) -> Result<(Value, Value), Vec<NxDiagnostic>> {
+    let lookup = ComponentLookup::Program(program);
+    let props = host_input_value(lookup, props).map_err(invalid_input_diagnostics)?;
+    let state = host_input_value(lookup, state).map_err(invalid_input_diagnostics)?;
+    Ok((props, state))
+}
+
+fn host_input_value(
+    lookup: ComponentLookup<'_>,
+    input: ComponentInput<'_>,
+) -> Result<Value, String> {
+    match input {
+        ComponentInput::Value(value) => {
+            validate_host_input_value(lookup, value)?;
+            from_nx_value(value).map_err(|error| error.to_string())
+        }
+        ComponentInput::MessagePack(bytes) => value_from_msgpack_slice(bytes, &|type_name| {
+            lookup_contains_component(lookup, type_name)
+        }),
     }
+}
 
-    if let Err(message) = validate_host_input_value(ComponentLookup::Program(program), props) {
-        return ComponentEvaluateEvalResult::Err(invalid_input_diagnostics(message));
+fn public_evaluate_result(
+    result: Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>>,
+) -> ComponentEvaluateEvalResult {
+    match result {
+        Ok(result) => ComponentEvaluateEvalResult::Ok(ComponentEvaluateResult {
+            rendered: to_nx_value(&result.rendered),
+        }),
+        Err(diagnostics) => ComponentEvaluateEvalResult::Err(diagnostics),
     }
-    if let Err(message) = validate_host_input_value(ComponentLookup::Program(program), state) {
-        return ComponentEvaluateEvalResult::Err(invalid_input_diagnostics(message));
+}
+
+/// Evaluates a batch of named components from one resolved [`ProgramArtifact`].
+///
+/// Every request is evaluated independently against one shared interpreter, so the artifact's root
+/// source and runtime module preparation are resolved once per batch instead of once per
+/// component. Results are returned in request order; a failing request does not stop the batch.
+pub fn evaluate_component_batch_program_artifact(
+    program: &ProgramArtifact,
+    requests: &[ComponentEvaluateRequest<'_>],
+) -> Vec<ComponentEvaluateEvalResult> {
+    evaluate_component_batch_program_artifact_runtime(program, requests)
+        .into_iter()
+        .map(public_evaluate_result)
+        .collect()
+}
+
+/// Evaluates a batch like [`evaluate_component_batch_program_artifact`] but keeps each rendered
+/// interpreter [`Value`] for direct serialization through [`NxValueView`](crate::NxValueView).
+pub fn evaluate_component_batch_program_artifact_runtime(
+    program: &ProgramArtifact,
+    requests: &[ComponentEvaluateRequest<'_>],
+) -> Vec<Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>>> {
+    evaluate_component_batch_program_artifact_runtime_with_limits(
+        program,
+        requests,
+        ResourceLimits::default(),
+    )
+}
+
+/// Evaluates a batch like [`evaluate_component_batch_program_artifact_runtime`] under
+/// caller-supplied [`ResourceLimits`]. Each request gets its own budget under `limits`; a request
+/// that exceeds it fails on its own without stopping the rest of the batch.
+pub fn evaluate_component_batch_program_artifact_runtime_with_limits(
+    program: &ProgramArtifact,
+    requests: &[ComponentEvaluateRequest<'_>],
+    limits: ResourceLimits,
+) -> Vec<Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>>> {
+    let source = program_root_source(program);
+    if let Some(diagnostics) = program_artifact_error_diagnostics(program, &source) {
+        return requests.iter().map(|_| Err(diagnostics.clone())).collect();
     }
 
-    let props = match from_nx_value(props) {
-        Ok(props) => props,
-        Err(error) => return ComponentEvaluateEvalResult::Err(invalid_input_diagnostics(error)),
+    let interpreter = program.interpreter();
+    requests
+        .iter()
+        .map(|request| {
+            evaluate_component_with_interpreter(
+                &interpreter,
+                program,
+                &source,
+                request.component_name,
+                request.props.into(),
+                request.state.into(),
+                limits.clone(),
+            )
+        })
+        .collect()
+}
+
+/// Resolves a named entry component from a [`ProgramArtifact`] once for repeated calls.
+///
+/// The returned [`ResolvedComponent`] carries the resolved entry item, the artifact's root source,
+/// and the outcome of the artifact diagnostic check, so
+/// [`initialize_resolved_component_program_artifact`] and
+/// [`evaluate_resolved_component_program_artifact`] skip all per-call name resolution.
+pub fn resolve_component_program_artifact(
+    program: &ProgramArtifact,
+    component_name: &str,
+) -> ComponentResolveEvalResult {
+    let source = program_root_source(program);
+    if let Some(diagnostics) = program_artifact_error_diagnostics(program, &source) {
+        return ComponentResolveEvalResult::Err(diagnostics);
+    }
+
+    let interpreter = program.interpreter();
+    match interpreter.resolve_entry_component(component_name) {
+        Ok(entry) => ComponentResolveEvalResult::Ok(ResolvedComponent {
+            name: component_name.to_string(),
+            entry,
+            program_fingerprint: program.fingerprint,
+            source,
+        }),
+        Err(error) => ComponentResolveEvalResult::Err(runtime_error_diagnostics(&source, error)),
+    }
+}
+
+/// Initializes a component previously resolved by [`resolve_component_program_artifact`].
+pub fn initialize_resolved_component_program_artifact(
+    program: &ProgramArtifact,
+    component: &ResolvedComponent,
+    props: &NxValue,
+) -> ComponentInitEvalResult {
+    public_init_result(initialize_resolved_component_program_artifact_runtime(
+        program,
+        component,
+        props.into(),
+    ))
+}
+
+/// Initializes a resolved component like [`initialize_resolved_component_program_artifact`] but
+/// keeps the rendered interpreter [`Value`] for direct serialization through
+/// [`NxValueView`](crate::NxValueView).
+pub fn initialize_resolved_component_program_artifact_runtime(
+    program: &ProgramArtifact,
+    component: &ResolvedComponent,
+    props: ComponentInput<'_>,
+) -> Result<nx_interpreter::ComponentInitResult, Vec<NxDiagnostic>> {
+    initialize_resolved_component_program_artifact_runtime_with_limits(
+        program,
+        component,
+        props,
+        ResourceLimits::default(),
+    )
+}
+
+/// Initializes a resolved component like
+/// [`initialize_resolved_component_program_artifact_runtime`] under caller-supplied
+/// [`ResourceLimits`], such as a deadline or cancellation token.
+pub fn initialize_resolved_component_program_artifact_runtime_with_limits(
+    program: &ProgramArtifact,
+    component: &ResolvedComponent,
+    props: ComponentInput<'_>,
+    limits: ResourceLimits,
+) -> Result<nx_interpreter::ComponentInitResult, Vec<NxDiagnostic>> {
+    ensure_resolved_component_program(program, component)?;
+    let props = component_init_inputs(program, props)?;
+
+    let interpreter = program.interpreter();
+    interpreter
+        .initialize_resolved_component_entry_with_limits(
+            &component.name,
+            &component.entry,
+            props,
+            limits,
+        )
+        .map_err(|error| runtime_error_diagnostics(&component.source, error))
+}
+
+/// Evaluates a component previously resolved by [`resolve_component_program_artifact`] using
+/// explicit props and host-owned current state.
+pub fn evaluate_resolved_component_program_artifact(
+    program: &ProgramArtifact,
+    component: &ResolvedComponent,
+    props: &NxValue,
+    state: &NxValue,
+) -> ComponentEvaluateEvalResult {
+    public_evaluate_result(evaluate_resolved_component_program_artifact_runtime(
+        program,
+        component,
+        props.into(),
+        state.into(),
+    ))
+}
+
+/// Evaluates a resolved component like [`evaluate_resolved_component_program_artifact`] but keeps
+/// the rendered interpreter [`Value`] for direct serialization through
+/// [`NxValueView`](crate::NxValueView).
+pub fn evaluate_resolved_component_program_artifact_runtime(
+    program: &ProgramArtifact,
+    component: &ResolvedComponent,
+    props: ComponentInput<'_>,
+    state: ComponentInput<'_>,
+) -> Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>> {
+    evaluate_resolved_component_program_artifact_runtime_with_limits(
+        program,
+        component,
+        props,
+        state,
+        ResourceLimits::default(),
+    )
+}
+
+/// Evaluates a resolved component like [`evaluate_resolved_component_program_artifact_runtime`]
+/// under caller-supplied [`ResourceLimits`], such as a deadline or cancellation token.
+pub fn evaluate_resolved_component_program_artifact_runtime_with_limits(
+    program: &ProgramArtifact,
+    component: &ResolvedComponent,
+    props: ComponentInput<'_>,
+    state: ComponentInput<'_>,
+    limits: ResourceLimits,
+) -> Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>> {
+    evaluate_resolved_component_runtime(program, component, props, state, limits, None)
+}
+
+fn evaluate_resolved_component_runtime(
+    program: &ProgramArtifact,
+    component: &ResolvedComponent,
+    props: ComponentInput<'_>,
+    state: ComponentInput<'_>,
+    limits: ResourceLimits,
+    call_memo: Option<Arc<dyn CallMemo>>,
+) -> Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>> {
+    ensure_resolved_component_program(program, component)?;
+    let (props, state) = component_evaluate_inputs(program, props, state)?;
+
+    let interpreter = program.interpreter();
+    let evaluate = |interpreter: &Interpreter| {
+        interpreter.evaluate_resolved_component_entry_with_limits(
+            &component.name,
+            &component.entry,
+            props,
+            state,
+            limits,
+        )
     };
-    let state = match from_nx_value(state) {
-        Ok(state) => state,
-        Err(error) => return ComponentEvaluateEvalResult::Err(invalid_input_diagnostics(error)),
+    match call_memo {
+        Some(memo) => interpreter.with_call_memo(memo, evaluate),
+        None => evaluate(&*interpreter),
+    }
+    .map_err(|error| runtime_error_diagnostics(&component.source, error))
+}
+
+/// Evaluates a resolved component like [`evaluate_resolved_component_program_artifact_runtime`],
+/// answering repeated evaluations with identical props and state from `cache`.
+///
+/// Only successful renders are cached. Cache keys use the MessagePack encoding of the inputs, so
+/// a hit for [`ComponentInput::MessagePack`] inputs skips decoding them as well as rendering.
+pub fn evaluate_resolved_component_program_artifact_cached(
+    program: &ProgramArtifact,
+    component: &ResolvedComponent,
+    props: ComponentInput<'_>,
+    state: ComponentInput<'_>,
+    cache: &ComponentRenderCache,
+) -> Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>> {
+    evaluate_resolved_component_program_artifact_cached_with_limits(
+        program,
+        component,
+        props,
+        state,
+        cache,
+        ResourceLimits::default(),
+    )
+}
+
+/// Evaluates a resolved component like [`evaluate_resolved_component_program_artifact_cached`],
+/// rendering cache misses under caller-supplied [`ResourceLimits`]. Cache hits do no interpreter
+/// work and so never count against the limits. Inside a render, calls to functions named with
+/// [`ComponentRenderCache::memoize_function`] are answered from the cache too, and each such hit
+/// counts the operations and call depth the call used when it ran.
+pub fn evaluate_resolved_component_program_artifact_cached_with_limits(
+    program: &ProgramArtifact,
+    component: &ResolvedComponent,
+    props: ComponentInput<'_>,
+    state: ComponentInput<'_>,
+    cache: &ComponentRenderCache,
+    limits: ResourceLimits,
+) -> Result<nx_interpreter::ComponentEvaluateResult, Vec<NxDiagnostic>> {
+    ensure_resolved_component_program(program, component)?;
+    let props_bytes = component_input_bytes(props)?;
+    let state_bytes = component_input_bytes(state)?;
+    let key = RenderCacheKeyRef {
+        program_fingerprint: program.fingerprint,
+        call_module: None,
+        target: &component.name,
+        props: &props_bytes,
+        state: &state_bytes,
     };
+    if let Some(rendered) = cache.get(key) {
+        return Ok(nx_interpreter::ComponentEvaluateResult { rendered });
+    }
 
-    let interpreter = Interpreter::from_resolved_program(program.resolved_program.clone());
-    match interpreter.evaluate_resolved_component(component_name, props, state) {
-        Ok(result) => ComponentEvaluateEvalResult::Ok(ComponentEvaluateResult {
-            rendered: to_nx_value(&result.rendered),
+    let result = evaluate_resolved_component_runtime(
+        program,
+        component,
+        props,
+        state,
+        limits,
+        cache.function_call_memo(program.fingerprint),
+    )?;
+    cache.insert(key, &result.rendered);
+    Ok(result)
+}
+
+fn component_input_bytes(input: ComponentInput<'_>) -> Result<Cow<'_, [u8]>, Vec<NxDiagnostic>> {
+    match input {
+        ComponentInput::Value(value) => value.to_msgpack_vec().map(Cow::Owned).map_err(|error| {
+            invalid_input_diagnostics(format!("messagepack encode failed: {error}"))
         }),
-        Err(error) => ComponentEvaluateEvalResult::Err(runtime_error_diagnostics(source, error)),
+        ComponentInput::MessagePack(bytes) => Ok(Cow::Borrowed(bytes)),
+    }
+}
+
+fn ensure_resolved_component_program(
+    program: &ProgramArtifact,
+    component: &ResolvedComponent,
+) -> Result<(), Vec<NxDiagnostic>> {
+    if program.fingerprint == component.program_fingerprint {
+        Ok(())
+    } else {
+        Err(invalid_input_diagnostics(format!(
+            "resolved component '{}' belongs to a different program artifact",
+            component.name
+        )))
     }
 }
 
@@ -219,12 +699,13 @@ pub fn dispatch_component_actions_source(
         Err(diagnostics) => return ComponentDispatchEvalResult::Err(diagnostics),
     };
 
-    dispatch_component_actions_program_artifact_with_source(
+    public_dispatch_result(dispatch_component_actions_runtime_with_source(
         &program,
         source,
         state_snapshot,
         actions,
-    )
+        ResourceLimits::default(),
+    ))
 }
 
 /// Dispatches actions against a component snapshot produced by a resolved [`ProgramArtifact`].
@@ -233,54 +714,109 @@ pub fn dispatch_component_actions_program_artifact(
     state_snapshot: &[u8],
     actions: &[NxValue],
 ) -> ComponentDispatchEvalResult {
+    public_dispatch_result(dispatch_component_actions_program_artifact_runtime(
+        program,
+        state_snapshot,
+        actions,
+    ))
+}
+
+/// Dispatches actions like [`dispatch_component_actions_program_artifact`] but keeps the effect
+/// interpreter [`Value`]s for direct serialization through [`NxValueView`](crate::NxValueView).
+pub fn dispatch_component_actions_program_artifact_runtime(
+    program: &ProgramArtifact,
+    state_snapshot: &[u8],
+    actions: &[NxValue],
+) -> Result<nx_interpreter::ComponentDispatchResult, Vec<NxDiagnostic>> {
+    dispatch_component_actions_program_artifact_runtime_with_limits(
+        program,
+        state_snapshot,
+        actions,
+        ResourceLimits::default(),
+    )
+}
+
+/// Dispatches actions like [`dispatch_component_actions_program_artifact_runtime`] under
+/// caller-supplied [`ResourceLimits`]. The deadline covers the whole batch of actions.
+pub fn dispatch_component_actions_program_artifact_runtime_with_limits(
+    program: &ProgramArtifact,
+    state_snapshot: &[u8],
+    actions: &[NxValue],
+    limits: ResourceLimits,
+) -> Result<nx_interpreter::ComponentDispatchResult, Vec<NxDiagnostic>> {
     let source = program_root_source(program);
-    dispatch_component_actions_program_artifact_with_source(
+    dispatch_component_actions_runtime_with_source(
         program,
         &source,
         state_snapshot,
         actions,
+        limits,
     )
 }
 
-fn dispatch_component_actions_program_artifact_with_source(
+fn dispatch_component_actions_runtime_with_source(
     program: &ProgramArtifact,
     source: &str,
     state_snapshot: &[u8],
     actions: &[NxValue],
-) -> ComponentDispatchEvalResult {
+    limits: ResourceLimits,
+) -> Result<nx_interpreter::ComponentDispatchResult, Vec<NxDiagnostic>> {
     if let Some(diagnostics) = program_artifact_error_diagnostics(program, source) {
-        return ComponentDispatchEvalResult::Err(diagnostics);
+        return Err(diagnostics);
     }
 
     for (index, action) in actions.iter().enumerate() {
-        if let Err(message) = validate_dispatch_action_input(
+        validate_dispatch_action_input(
             ComponentLookup::Program(program),
             action,
             &format!("$[{index}]"),
-        ) {
-            return ComponentDispatchEvalResult::Err(invalid_input_diagnostics(message));
-        }
+        )
+        .map_err(invalid_input_diagnostics)?;
     }
 
-    let interpreter = Interpreter::from_resolved_program(program.resolved_program.clone());
-    let actions = match actions
+    let interpreter = program.interpreter();
+    let actions = actions
         .iter()
         .map(from_nx_value)
         .collect::<Result<Vec<_>, _>>()
-    {
-        Ok(actions) => actions,
-        Err(error) => return ComponentDispatchEvalResult::Err(invalid_input_diagnostics(error)),
-    };
+        .map_err(invalid_input_diagnostics)?;
 
-    match interpreter.dispatch_resolved_component_actions(state_snapshot, actions) {
+    interpreter
+        .dispatch_resolved_component_actions_with_limits(state_snapshot, actions, limits)
+        .map_err(|error| runtime_error_diagnostics(source, error))
+}
+
+fn public_dispatch_result(
+    result: Result<nx_interpreter::ComponentDispatchResult, Vec<NxDiagnostic>>,
+) -> ComponentDispatchEvalResult {
+    match result {
         Ok(result) => ComponentDispatchEvalResult::Ok(ComponentDispatchResult {
             effects: result.effects.iter().map(to_nx_value).collect(),
             state_snapshot: result.state_snapshot,
         }),
-        Err(error) => ComponentDispatchEvalResult::Err(runtime_error_diagnostics(source, error)),
+        Err(diagnostics) => ComponentDispatchEvalResult::Err(diagnostics),
     }
 }
 
+/// Computes a compact delta that turns the `previous` component state snapshot into `next`.
+///
+/// Hosts that keep `previous` can store or transmit the delta instead of the full snapshot and
+/// rebuild `next` with [`apply_component_snapshot_delta`]. No program artifact is required.
+pub fn component_snapshot_delta(
+    previous: &[u8],
+    next: &[u8],
+) -> Result<Vec<u8>, Vec<NxDiagnostic>> {
+    nx_interpreter::component_snapshot_delta(previous, next).map_err(invalid_input_diagnostics)
+}
+
+/// Rebuilds a full component state snapshot from the snapshot a delta was computed against.
+pub fn apply_component_snapshot_delta(
+    base: &[u8],
+    delta: &[u8],
+) -> Result<Vec<u8>, Vec<NxDiagnostic>> {
+    nx_interpreter::apply_component_snapshot_delta(base, delta).map_err(invalid_input_diagnostics)
+}
+
 pub(crate) fn invalid_input_diagnostics(message: impl ToString) -> Vec<NxDiagnostic> {
     vec![NxDiagnostic {
         severity: NxSeverity::Error,
@@ -447,6 +983,51 @@ mod tests {
         assert!(!result.state_snapshot.is_empty());
     }
 
+    #[test]
+    fn component_snapshot_delta_rebuilds_next_snapshot() {
+        let source = r#"
+            component <SearchBox placeholder:string = "Find docs" /> = {
+              state { query:string = {placeholder} }
+              <TextInput value={query} placeholder={placeholder} />
+            }
+        "#;
+        let initialize = |placeholder: &str| {
+            let props = NxValue::Record {
+                type_name: None,
+                properties: BTreeMap::from([(
+                    "placeholder".to_string(),
+                    NxValue::String(placeholder.to_string()),
+                )]),
+            };
+            match initialize_component_source(
+                source,
+                "component-delta.nx",
+                &ProgramBuildContext::empty(),
+                "SearchBox",
+                &props,
+            ) {
+                ComponentInitEvalResult::Ok(result) => result.state_snapshot,
+                ComponentInitEvalResult::Err(diagnostics) => {
+                    panic!("Expected initialization to succeed, got {diagnostics:?}")
+                }
+            }
+        };
+        let previous = initialize("Find docs");
+        let next = initialize("Find packages");
+
+        let delta = component_snapshot_delta(&previous, &next).expect("Expected delta");
+        assert_eq!(
+            apply_component_snapshot_delta(&previous, &delta).expect("Expected delta to apply"),
+            next
+        );
+
+        let diagnostics = apply_component_snapshot_delta(&next, &delta)
+            .expect_err("Expected delta to reject a different base snapshot");
+        assert!(diagnostics[0]
+            .message
+            .contains("Invalid component state snapshot"));
+    }
+
     #[test]
     fn evaluate_component_program_artifact_returns_rendered_output() {
         let source = r#"
@@ -493,6 +1074,366 @@ mod tests {
         );
     }
 
+    #[test]
+    fn evaluate_component_program_artifact_runtime_reads_messagepack_inputs() {
+        let source = r#"
+            component <SearchBox placeholder:string = "Find docs" /> = {
+              state { query:string }
+              <TextInput value={query} placeholder={placeholder} />
+            }
+
+            component <Wrapper child:object /> = {
+              child
+            }
+        "#;
+        let program = build_program_artifact_from_source(
+            source,
+            "component-evaluate-msgpack.nx",
+            &ProgramBuildContext::empty(),
+        )
+        .expect("Expected program artifact");
+        let props = NxValue::Record {
+            type_name: None,
+            properties: BTreeMap::from([(
+                "placeholder".to_string(),
+                NxValue::String("Search".to_string()),
+            )]),
+        };
+        let state = NxValue::Record {
+            type_name: None,
+            properties: BTreeMap::from([(
+                "query".to_string(),
+                NxValue::String("docs".to_string()),
+            )]),
+        };
+        let props_bytes = props.to_msgpack_vec().expect("props should encode");
+        let state_bytes = state.to_msgpack_vec().expect("state should encode");
+
+        let from_bytes = evaluate_component_program_artifact_runtime(
+            &program,
+            "SearchBox",
+            ComponentInput::MessagePack(&props_bytes),
+            ComponentInput::MessagePack(&state_bytes),
+        )
+        .expect("Expected MessagePack inputs to evaluate");
+        let from_values = evaluate_component_program_artifact_runtime(
+            &program,
+            "SearchBox",
+            (&props).into(),
+            (&state).into(),
+        )
+        .expect("Expected value inputs to evaluate");
+        assert_eq!(from_bytes.rendered, from_values.rendered);
+
+        let component_props = NxValue::Record {
+            type_name: None,
+            properties: BTreeMap::from([(
+                "child".to_string(),
+                NxValue::Record {
+                    type_name: Some("SearchBox".to_string()),
+                    properties: BTreeMap::new(),
+                },
+            )]),
+        }
+        .to_msgpack_vec()
+        .expect("props should encode");
+        let Err(diagnostics) = initialize_component_program_artifact_runtime(
+            &program,
+            "Wrapper",
+            ComponentInput::MessagePack(&component_props),
+        ) else {
+            panic!("Expected component-shaped MessagePack props to be rejected");
+        };
+        assert_eq!(diagnostics[0].code.as_deref(), Some("invalid-input"));
+        assert!(diagnostics[0].message.contains("$.child"));
+
+        let Err(diagnostics) = initialize_component_program_artifact_runtime(
+            &program,
+            "SearchBox",
+            ComponentInput::MessagePack(&[0xc1]),
+        ) else {
+            panic!("Expected malformed MessagePack props to be rejected");
+        };
+        assert!(diagnostics[0]
+            .message
+            .starts_with("messagepack decode failed"));
+    }
+
+    #[test]
+    fn evaluate_component_batch_program_artifact_returns_results_in_request_order() {
+        let source = r#"
+            component <SearchBox placeholder:string = "Find docs" /> = {
+              state { query:string }
+              <TextInput value={query} placeholder={placeholder} />
+            }
+        "#;
+        let program = build_program_artifact_from_source(
+            source,
+            "component-evaluate-batch.nx",
+            &ProgramBuildContext::empty(),
+        )
+        .expect("Expected program artifact");
+        let props = empty_record();
+        let states = ["first", "second"].map(|query| NxValue::Record {
+            type_name: None,
+            properties: BTreeMap::from([("query".to_string(), NxValue::String(query.to_string()))]),
+        });
+        let missing_state = empty_record();
+        let requests = [
+            ComponentEvaluateRequest {
+                component_name: "SearchBox",
+                props: &props,
+                state: &states[0],
+            },
+            ComponentEvaluateRequest {
+                component_name: "SearchBox",
+                props: &props,
+                state: &missing_state,
+            },
+            ComponentEvaluateRequest {
+                component_name: "SearchBox",
+                props: &props,
+                state: &states[1],
+            },
+        ];
+
+        let results = evaluate_component_batch_program_artifact(&program, &requests);
+        assert_eq!(results.len(), 3);
+
+        let rendered_value = |result: &ComponentEvaluateEvalResult| {
+            let ComponentEvaluateEvalResult::Ok(result) = result else {
+                panic!("Expected batch component evaluation to succeed");
+            };
+            let NxValue::Record { properties, .. } = &result.rendered else {
+                panic!("Expected rendered element record");
+            };
+            properties.get("value").cloned()
+        };
+        assert_eq!(
+            rendered_value(&results[0]),
+            Some(NxValue::String("first".to_string()))
+        );
+        let ComponentEvaluateEvalResult::Err(diagnostics) = &results[1] else {
+            panic!("Expected missing state to fail without stopping the batch");
+        };
+        assert!(diagnostics.iter().any(|diagnostic| diagnostic
+            .message
+            .contains("Missing required component field 'query'")));
+        assert_eq!(
+            rendered_value(&results[2]),
+            Some(NxValue::String("second".to_string()))
+        );
+    }
+
+    #[test]
+    fn cached_resolved_component_evaluation_reuses_rendered_output() {
+        let source = r#"
+            component <SearchBox placeholder:string = "Find docs" /> = {
+              state { query:string }
+              <TextInput value={query} placeholder={placeholder} />
+            }
+        "#;
+        let program = build_program_artifact_from_source(
+            source,
+            "component-render-cache.nx",
+            &ProgramBuildContext::empty(),
+        )
+        .expect("Expected program artifact");
+        let ComponentResolveEvalResult::Ok(component) =
+            resolve_component_program_artifact(&program, "SearchBox")
+        else {
+            panic!("Expected SearchBox to resolve");
+        };
+
+        let cache = ComponentRenderCache::new(1024 * 1024);
+        let props = empty_record();
+        let state_for = |query: &str| NxValue::Record {
+            type_name: None,
+            properties: BTreeMap::from([("query".to_string(), NxValue::String(query.to_string()))]),
+        };
+        let evaluate = |state: &NxValue| {
+            evaluate_resolved_component_program_artifact_cached(
+                &program,
+                &component,
+                (&props).into(),
+                state.into(),
+                &cache,
+            )
+            .expect("Expected cached evaluation to succeed")
+            .rendered
+        };
+
+        let first = evaluate(&state_for("docs"));
+        assert_eq!(evaluate(&state_for("docs")), first);
+        assert_ne!(evaluate(&state_for("other")), first);
+
+        let uncached = evaluate_resolved_component_program_artifact_runtime(
+            &program,
+            &component,
+            (&props).into(),
+            (&state_for("docs")).into(),
+        )
+        .expect("Expected uncached evaluation to succeed");
+        assert_eq!(uncached.rendered, first);
+
+        let stats = cache.stats();
+        assert_eq!((stats.hits, stats.misses, stats.entries), (1, 2, 2));
+
+        let missing_query = empty_record();
+        assert!(evaluate_resolved_component_program_artifact_cached(
+            &program,
+            &component,
+            (&props).into(),
+            (&missing_query).into(),
+            &cache,
+        )
+        .is_err());
+        assert_eq!(cache.stats().entries, 2);
+    }
+
+    #[test]
+    fn cached_resolved_component_evaluation_memoizes_element_function_calls() {
+        let source = r#"
+            let <Badge label:string /> = <span>{label}</span>
+            component <Results title:string = "Docs" /> = {
+              state { query:string }
+              <section><Badge label={title} /><Badge label={title} /><Badge label={query} /></section>
+            }
+        "#;
+        let program = build_program_artifact_from_source(
+            source,
+            "component-call-memo.nx",
+            &ProgramBuildContext::empty(),
+        )
+        .expect("Expected program artifact");
+        let ComponentResolveEvalResult::Ok(component) =
+            resolve_component_program_artifact(&program, "Results")
+        else {
+            panic!("Expected Results to resolve");
+        };
+
+        let cache = ComponentRenderCache::new(1024 * 1024);
+        cache.memoize_function("Badge");
+        let props = empty_record();
+        let state_for = |query: &str| NxValue::Record {
+            type_name: None,
+            properties: BTreeMap::from([("query".to_string(), NxValue::String(query.to_string()))]),
+        };
+        let cached = |query: &str, limits: ResourceLimits| {
+            evaluate_resolved_component_program_artifact_cached_with_limits(
+                &program,
+                &component,
+                (&props).into(),
+                (&state_for(query)).into(),
+                &cache,
+                limits,
+            )
+            .map(|result| result.rendered)
+        };
+        let uncached = |query: &str, limits: ResourceLimits| {
+            evaluate_resolved_component_program_artifact_runtime_with_limits(
+                &program,
+                &component,
+                (&props).into(),
+                (&state_for(query)).into(),
+                limits,
+            )
+            .map(|result| result.rendered)
+        };
+
+        let first = cached("docs", ResourceLimits::default()).expect("first render");
+        assert_eq!(
+            Ok(first),
+            uncached("docs", ResourceLimits::default()),
+            "Expected memoized calls to render like uncached ones"
+        );
+        let stats = cache.stats();
+        assert_eq!((stats.hits, stats.misses, stats.entries), (1, 3, 3));
+
+        cached("other", ResourceLimits::default()).expect("second render");
+        let stats = cache.stats();
+        assert_eq!((stats.hits, stats.misses, stats.entries), (3, 5, 5));
+
+        for max_operations in (1..400).step_by(7) {
+            let limits = ResourceLimits {
+                max_operations,
+                ..ResourceLimits::default()
+            };
+            let query = format!("limited{max_operations}");
+            assert_eq!(
+                cached(&query, limits.clone()).is_ok(),
+                uncached(&query, limits).is_ok(),
+                "Expected memoized calls to count against max_operations = {max_operations}"
+            );
+        }
+    }
+
+    #[test]
+    fn resolved_component_evaluates_repeatedly_and_rejects_other_artifacts() {
+        let source = r#"
+            component <SearchBox placeholder:string = "Find docs" /> = {
+              state { query:string }
+              <TextInput value={query} placeholder={placeholder} />
+            }
+        "#;
+        let program = build_program_artifact_from_source(
+            source,
+            "component-resolved.nx",
+            &ProgramBuildContext::empty(),
+        )
+        .expect("Expected program artifact");
+        let other_program = build_program_artifact_from_source(
+            "component <SearchBox /> = { <TextInput /> }",
+            "component-resolved-other.nx",
+            &ProgramBuildContext::empty(),
+        )
+        .expect("Expected program artifact");
+
+        let ComponentResolveEvalResult::Ok(component) =
+            resolve_component_program_artifact(&program, "SearchBox")
+        else {
+            panic!("Expected SearchBox to resolve");
+        };
+        assert_eq!(component.name(), "SearchBox");
+
+        let props = empty_record();
+        for query in ["first", "second"] {
+            let state = NxValue::Record {
+                type_name: None,
+                properties: BTreeMap::from([(
+                    "query".to_string(),
+                    NxValue::String(query.to_string()),
+                )]),
+            };
+            let ComponentEvaluateEvalResult::Ok(result) =
+                evaluate_resolved_component_program_artifact(&program, &component, &props, &state)
+            else {
+                panic!("Expected resolved component evaluation to succeed");
+            };
+            let NxValue::Record { properties, .. } = &result.rendered else {
+                panic!("Expected rendered element record");
+            };
+            assert_eq!(
+                properties.get("value"),
+                Some(&NxValue::String(query.to_string()))
+            );
+        }
+
+        let ComponentResolveEvalResult::Err(diagnostics) =
+            resolve_component_program_artifact(&program, "MissingBox")
+        else {
+            panic!("Expected missing component resolution to fail");
+        };
+        assert!(!diagnostics.is_empty());
+
+        let ComponentInitEvalResult::Err(diagnostics) =
+            initialize_resolved_component_program_artifact(&other_program, &component, &props)
+        else {
+            panic!("Expected a different artifact to reject the resolved component");
+        };
+        assert_eq!(diagnostics[0].code.as_deref(), Some("invalid-input"));
+    }
+
     #[test]
     fn evaluate_component_source_returns_static_diagnostics_before_runtime_work() {
         let result = evaluate_component_source(
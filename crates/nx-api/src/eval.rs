@@ -7,7 +7,7 @@ use crate::value::to_nx_value;
 use crate::NxDiagnostic;
 use nx_diagnostics::{Diagnostic, Label, Severity};
 use nx_hir::Item;
-use nx_interpreter::{Interpreter, RuntimeError};
+use nx_interpreter::{ResourceLimits, RuntimeError, RuntimeErrorKind, Value};
 use nx_value::NxValue;
 use std::fs;
 use std::path::Path;
@@ -26,7 +26,13 @@ pub enum EvalResult {
 }
 
 pub(crate) fn runtime_error_diagnostics(source: &str, error: RuntimeError) -> Vec<NxDiagnostic> {
-    let diag = Diagnostic::error("runtime-error")
+    // Interrupted evaluations get their own codes so hosts can tell them from program errors.
+    let code = match error.kind() {
+        RuntimeErrorKind::DeadlineExceeded { .. } => "deadline-exceeded",
+        RuntimeErrorKind::Cancelled => "evaluation-cancelled",
+        _ => "runtime-error",
+    };
+    let diag = Diagnostic::error(code)
         .with_message(error.to_string())
         .build();
     diagnostics_to_api(&[diag], source)
@@ -131,9 +137,13 @@ fn no_root_diagnostics(file_name: &str, source: &str) -> Vec<NxDiagnostic> {
     diagnostics_to_api(&[diag], source)
 }
 
-fn eval_program_artifact_with_source(program: &ProgramArtifact, source: &str) -> EvalResult {
+fn eval_program_artifact_runtime_with_source(
+    program: &ProgramArtifact,
+    source: &str,
+    limits: ResourceLimits,
+) -> Result<Value, Vec<NxDiagnostic>> {
     if let Some(diagnostics) = program_artifact_error_diagnostics(program, source) {
-        return EvalResult::Err(diagnostics);
+        return Err(diagnostics);
     }
 
     let Some(root_module) = program
@@ -141,17 +151,17 @@ fn eval_program_artifact_with_source(program: &ProgramArtifact, source: &str) ->
         .iter()
         .find(|module| module.file_name == program.entry_identity)
     else {
-        return EvalResult::Err(no_root_diagnostics("input.nx", source));
+        return Err(no_root_diagnostics("input.nx", source));
     };
     let Some(entry_module_id) = program.entry_module_id else {
-        return EvalResult::Err(no_root_diagnostics(&root_module.file_name, source));
+        return Err(no_root_diagnostics(&root_module.file_name, source));
     };
     let Some(module) = program
         .resolved_program
         .module(entry_module_id)
         .map(|module| module.lowered_module.as_ref())
     else {
-        return EvalResult::Err(no_root_diagnostics(&root_module.file_name, source));
+        return Err(no_root_diagnostics(&root_module.file_name, source));
     };
 
     let has_root = module
@@ -159,13 +169,24 @@ fn eval_program_artifact_with_source(program: &ProgramArtifact, source: &str) ->
         .iter()
         .any(|item| matches!(item, Item::Function(f) if f.name.as_str() == "root"));
     if !has_root {
-        return EvalResult::Err(no_root_diagnostics(&root_module.file_name, source));
+        return Err(no_root_diagnostics(&root_module.file_name, source));
     }
 
-    let interpreter = Interpreter::from_resolved_program(program.resolved_program.clone());
-    match interpreter.execute_resolved_program_module_function(entry_module_id, "root", vec![]) {
+    let interpreter = program.interpreter();
+    interpreter
+        .execute_resolved_program_module_function_with_limits(
+            entry_module_id,
+            "root",
+            vec![],
+            limits,
+        )
+        .map_err(|error| runtime_error_diagnostics(source, error))
+}
+
+fn eval_program_artifact_with_source(program: &ProgramArtifact, source: &str) -> EvalResult {
+    match eval_program_artifact_runtime_with_source(program, source, ResourceLimits::default()) {
         Ok(value) => EvalResult::Ok(to_nx_value(&value)),
-        Err(error) => EvalResult::Err(runtime_error_diagnostics(source, error)),
+        Err(diagnostics) => EvalResult::Err(diagnostics),
     }
 }
 
@@ -177,6 +198,30 @@ pub fn eval_program_artifact(program: &ProgramArtifact) -> EvalResult {
     eval_program_artifact_with_source(program, &source)
 }
 
+/// Evaluates the `root()` entrypoint like [`eval_program_artifact`] but returns the interpreter
+/// [`Value`], so hosts can serialize it through [`NxValueView`](crate::NxValueView) without
+/// building an intermediate [`NxValue`] tree.
+pub fn eval_program_artifact_runtime(
+    program: &ProgramArtifact,
+) -> Result<Value, Vec<NxDiagnostic>> {
+    eval_program_artifact_runtime_with_limits(program, ResourceLimits::default())
+}
+
+/// Evaluates the `root()` entrypoint like [`eval_program_artifact_runtime`] under caller-supplied
+/// [`ResourceLimits`], such as a wall-clock deadline or a host [`CancellationToken`].
+///
+/// An evaluation stopped by its deadline reports a `deadline-exceeded` diagnostic, and one stopped
+/// by its token reports `evaluation-cancelled`.
+///
+/// [`CancellationToken`]: nx_interpreter::CancellationToken
+pub fn eval_program_artifact_runtime_with_limits(
+    program: &ProgramArtifact,
+    limits: ResourceLimits,
+) -> Result<Value, Vec<NxDiagnostic>> {
+    let source = program_root_source(program);
+    eval_program_artifact_runtime_with_source(program, &source, limits)
+}
+
 /// Builds a reusable [`ProgramArtifact`] from source text and returns public diagnostics if static
 /// analysis fails.
 pub fn load_program_artifact_from_source(
@@ -653,4 +698,100 @@ let root() = { answer() }"#;
         let bytes = value.to_msgpack_vec().unwrap();
         assert_eq!(NxValue::from_msgpack_slice(&bytes).unwrap(), expected);
     }
+
+    #[test]
+    fn shared_program_artifact_evaluates_concurrently_and_reuses_interpreters() {
+        fn assert_send_sync<T: Send + Sync>() {}
+        assert_send_sync::<ProgramArtifact>();
+
+        let source = "let root(): int = { 40 + 2 }";
+        let program = std::sync::Arc::new(
+            build_program_artifact_from_source(
+                source,
+                "shared-eval.nx",
+                &ProgramBuildContext::empty(),
+            )
+            .expect("Expected program artifact"),
+        );
+
+        std::thread::scope(|scope| {
+            for _ in 0..4 {
+                let program = &program;
+                scope.spawn(move || {
+                    for _ in 0..3 {
+                        let EvalResult::Ok(value) = eval_program_artifact(program) else {
+                            panic!("Expected shared artifact evaluation to succeed");
+                        };
+                        assert_eq!(value, NxValue::Int(42));
+                    }
+                });
+            }
+        });
+
+        let interpreter = program.interpreter();
+        assert!(std::sync::Arc::ptr_eq(
+            interpreter.resolved_program().expect("bound program"),
+            &program.resolved_program
+        ));
+    }
+
+    #[test]
+    fn eval_stats_record_calling_thread_work_and_build_phases() {
+        let source = "let double(x:int): int = { x * 2 }\nlet root(): int = { double(21) }";
+        let program =
+            build_program_artifact_from_source(source, "stats.nx", &ProgramBuildContext::empty())
+                .expect("Expected program artifact");
+        assert_eq!(program.build_stats.parsed_modules, 1);
+        assert_eq!(program.build_stats.analyzed_modules, 1);
+
+        crate::set_eval_stats_enabled(true);
+        crate::reset_eval_stats();
+        for _ in 0..2 {
+            let EvalResult::Ok(value) = eval_program_artifact(&program) else {
+                panic!("Expected evaluation to succeed");
+            };
+            assert_eq!(value, NxValue::Int(42));
+        }
+        let stats = crate::eval_stats();
+        crate::set_eval_stats_enabled(false);
+
+        assert_eq!(stats.evaluations, 2);
+        assert_eq!(stats.peak_call_depth, 1);
+        assert!(stats.operations > 0);
+        crate::reset_eval_stats();
+        assert_eq!(crate::eval_stats(), crate::EvalStats::default());
+    }
+
+    #[test]
+    fn eval_program_artifact_with_limits_reports_interrupt_codes() {
+        let source = concat!(
+            "let spin(n:int): int = { if n <= 0 { 0 } else { spin(n - 1) + spin(n - 1) } }\n",
+            "let root(): int = { spin(40) }",
+        );
+        let program =
+            build_program_artifact_from_source(source, "spin.nx", &ProgramBuildContext::empty())
+                .expect("Expected program artifact");
+        let unbounded = ResourceLimits {
+            max_operations: usize::MAX,
+            ..ResourceLimits::default()
+        };
+
+        let deadline = ResourceLimits {
+            max_duration: Some(std::time::Duration::from_millis(10)),
+            ..unbounded.clone()
+        };
+        let diagnostics = eval_program_artifact_runtime_with_limits(&program, deadline)
+            .expect_err("Expected the deadline to stop evaluation");
+        assert_eq!(diagnostics[0].code.as_deref(), Some("deadline-exceeded"));
+
+        let token = nx_interpreter::CancellationToken::new();
+        token.cancel();
+        let cancelled = ResourceLimits {
+            cancellation: Some(token),
+            ..unbounded
+        };
+        let diagnostics = eval_program_artifact_runtime_with_limits(&program, cancelled)
+            .expect_err("Expected the cancelled token to stop evaluation");
+        assert_eq!(diagnostics[0].code.as_deref(), Some("evaluation-cancelled"));
+    }
 }
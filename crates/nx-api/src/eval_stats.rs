@@ -0,0 +1,62 @@
+//! Opt-in evaluation statistics collected per thread.
+//!
+//! Collection is off by default. Once enabled with [`set_eval_stats_enabled`], every evaluation
+//! adds the time it held a pooled interpreter and that interpreter's work counters to the calling
+//! thread's totals, which [`eval_stats`] reads and [`reset_eval_stats`] clears. Keeping the totals
+//! per thread lets concurrent callers measure their own calls without coordinating.
+
+use nx_interpreter::EvaluationStats;
+use std::cell::Cell;
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::time::Duration;
+
+static ENABLED: AtomicBool = AtomicBool::new(false);
+
+thread_local! {
+    static THREAD_STATS: Cell<EvalStats> = Cell::new(EvalStats::default());
+}
+
+/// Evaluation work recorded on one thread since its last [`reset_eval_stats`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct EvalStats {
+    /// Top-level interpreter calls: function executions, component initializations and
+    /// evaluations, and action handler invocations.
+    pub evaluations: u64,
+    /// Interpreter operations counted against the operation limit, summed across calls.
+    pub operations: u64,
+    /// Deepest interpreter call stack reached by any call.
+    pub peak_call_depth: u64,
+    /// Wall-clock time spent evaluating, from interpreter checkout until it was returned.
+    pub eval_time: Duration,
+}
+
+/// Turns evaluation statistics collection on or off for every thread.
+pub fn set_eval_stats_enabled(enabled: bool) {
+    ENABLED.store(enabled, Ordering::Relaxed);
+}
+
+/// Returns whether evaluation statistics are being collected.
+pub fn eval_stats_enabled() -> bool {
+    ENABLED.load(Ordering::Relaxed)
+}
+
+/// Returns the statistics recorded on the calling thread since the last [`reset_eval_stats`].
+pub fn eval_stats() -> EvalStats {
+    THREAD_STATS.with(Cell::get)
+}
+
+/// Clears the statistics recorded on the calling thread.
+pub fn reset_eval_stats() {
+    THREAD_STATS.with(|stats| stats.set(EvalStats::default()));
+}
+
+pub(crate) fn record_eval_stats(interpreter: EvaluationStats, elapsed: Duration) {
+    THREAD_STATS.with(|stats| {
+        let mut total = stats.get();
+        total.evaluations += interpreter.evaluations;
+        total.operations += interpreter.operations;
+        total.peak_call_depth = total.peak_call_depth.max(interpreter.peak_call_depth);
+        total.eval_time += elapsed;
+        stats.set(total);
+    });
+}
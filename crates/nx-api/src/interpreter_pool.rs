@@ -0,0 +1,165 @@
+//! Reusable interpreters for evaluating one shared program artifact.
+//!
+//! A [`ProgramArtifact`](crate::ProgramArtifact) is immutable once built, so any number of threads
+//! may evaluate it at the same time. Interpreters are not `Sync`, but they carry caches worth
+//! keeping between calls (prepared modules, record layouts, and a reusable execution context).
+//! Those caches are keyed by what the program declares, never by host input, so a long-lived
+//! pooled interpreter stays bounded however varied the props and snapshots it is given.
+//! Each artifact therefore keeps a small pool of idle interpreters bound to its shared resolved
+//! program: a call checks one out, evaluates on the calling thread, and returns it when done.
+//! The checkout is also where opt-in [evaluation statistics](crate::eval_stats) are recorded.
+
+use crate::eval_stats::{eval_stats_enabled, record_eval_stats};
+use nx_interpreter::{Interpreter, ResolvedProgram};
+use std::fmt;
+use std::ops::Deref;
+use std::sync::{Arc, Mutex};
+use std::time::Instant;
+
+/// Idle interpreters bound to one resolved program.
+///
+/// The pool never holds more interpreters than the peak number of concurrent evaluations.
+pub(crate) struct InterpreterPool {
+    idle: Mutex<Vec<Interpreter>>,
+}
+
+impl InterpreterPool {
+    pub(crate) fn new() -> Self {
+        Self {
+            idle: Mutex::new(Vec::new()),
+        }
+    }
+
+    /// Checks out an idle interpreter for `program`, creating one when every pooled interpreter
+    /// is in use.
+    pub(crate) fn acquire<'a>(&'a self, program: &Arc<ResolvedProgram>) -> PooledInterpreter<'a> {
+        let interpreter = self
+            .lock()
+            .pop()
+            .filter(|interpreter| {
+                interpreter
+                    .resolved_program()
+                    .is_some_and(|bound| Arc::ptr_eq(bound, program))
+            })
+            .unwrap_or_else(|| Interpreter::from_resolved_program(Arc::clone(program)));
+        let started = eval_stats_enabled().then(|| {
+            // Drop counters left over from calls made while collection was off.
+            interpreter.take_evaluation_stats();
+            Instant::now()
+        });
+        PooledInterpreter {
+            pool: self,
+            interpreter: Some(interpreter),
+            started,
+        }
+    }
+
+    fn idle_count(&self) -> usize {
+        self.lock().len()
+    }
+
+    fn lock(&self) -> std::sync::MutexGuard<'_, Vec<Interpreter>> {
+        // Pushing and popping cannot leave the list inconsistent, so ignore poisoning.
+        self.idle
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+    }
+}
+
+impl Default for InterpreterPool {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// Clones of an artifact start with an empty pool; interpreters are never shared between pools.
+impl Clone for InterpreterPool {
+    fn clone(&self) -> Self {
+        Self::new()
+    }
+}
+
+impl fmt::Debug for InterpreterPool {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("InterpreterPool")
+            .field("idle", &self.idle_count())
+            .finish()
+    }
+}
+
+/// Interpreter checked out of an [`InterpreterPool`] for the duration of one call.
+pub(crate) struct PooledInterpreter<'a> {
+    pool: &'a InterpreterPool,
+    interpreter: Option<Interpreter>,
+    /// Checkout time, set when evaluation statistics are enabled.
+    started: Option<Instant>,
+}
+
+impl Deref for PooledInterpreter<'_> {
+    type Target = Interpreter;
+
+    fn deref(&self) -> &Interpreter {
+        self.interpreter
+            .as_ref()
+            .expect("pooled interpreter is present until drop")
+    }
+}
+
+impl Drop for PooledInterpreter<'_> {
+    fn drop(&mut self) {
+        // An interpreter unwound mid-evaluation is discarded rather than handed to the next call.
+        if std::thread::panicking() {
+            return;
+        }
+        if let Some(interpreter) = self.interpreter.take() {
+            if let Some(started) = self.started {
+                record_eval_stats(interpreter.take_evaluation_stats(), started.elapsed());
+            }
+            self.pool.lock().push(interpreter);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use nx_interpreter::Value;
+
+    fn program() -> Arc<ResolvedProgram> {
+        let module = nx_hir::lower_source_module("let root() = { 40 + 2 }", "main.nx")
+            .expect("Expected module to lower");
+        Arc::new(ResolvedProgram::single_root_module(
+            7,
+            "main.nx",
+            Arc::new(module),
+        ))
+    }
+
+    #[test]
+    fn pool_reuses_interpreters_after_release() {
+        let program = program();
+        let pool = InterpreterPool::new();
+
+        {
+            let interpreter = pool.acquire(&program);
+            assert_eq!(
+                interpreter
+                    .execute_resolved_program_function("root", vec![])
+                    .expect("Expected root evaluation to succeed"),
+                Value::Int(42)
+            );
+            let second = pool.acquire(&program);
+            assert!(Arc::ptr_eq(
+                second.resolved_program().expect("bound program"),
+                &program
+            ));
+        }
+        assert_eq!(pool.idle_count(), 2);
+
+        let reused = pool.acquire(&program);
+        assert_eq!(pool.idle_count(), 1);
+        drop(reused);
+        assert_eq!(pool.idle_count(), 2);
+        assert_eq!(pool.clone().idle_count(), 0);
+    }
+}
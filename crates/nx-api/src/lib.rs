@@ -7,6 +7,8 @@
 //! - [`evaluate_component_source`] / [`evaluate_component_program_artifact`]: pure component
 //!   rendering from explicit props and host-owned current state, returning the rendered value
 //!   directly without lifecycle wrapper fields
+//! - [`evaluate_component_batch_program_artifact`]: evaluate many components from one
+//!   [`ProgramArtifact`] against a shared interpreter
 //! - [`NxWorkspace`] / [`NxWorkspaceModule`]: validate and build programs from logical in-memory
 //!   source modules without temporary files
 //! - [`initialize_component_source`] / [`dispatch_component_actions_source`]: component lifecycle
@@ -14,6 +16,25 @@
 //!   initialize a named component, and dispatch action batches
 //! - [`initialize_component_program_artifact`] / [`dispatch_component_actions_program_artifact`]:
 //!   component lifecycle entry points that execute a resolved [`ProgramArtifact`]
+//! - [`resolve_component_program_artifact`]: resolve a named component once into a
+//!   [`ResolvedComponent`] for repeated [`initialize_resolved_component_program_artifact`] and
+//!   [`evaluate_resolved_component_program_artifact`] calls
+//! - [`evaluate_resolved_component_program_artifact_cached`] / [`ComponentRenderCache`]: opt-in,
+//!   memory-bounded memoization of rendered output keyed by component, props, and state, and of
+//!   calls to host-selected element functions inside a render
+//! - [`component_snapshot_delta`] / [`apply_component_snapshot_delta`]: exchange component state
+//!   snapshots as compact deltas against the previous snapshot
+//! - [`rebuild_workspace_program_artifact`]: rebuild a workspace [`ProgramArtifact`] after some
+//!   modules changed, reusing the analysis of modules the change does not affect
+//! - [`ProgramArtifact::to_image`] / [`ProgramArtifact::from_image`]: serialize a built program
+//!   artifact into a self-contained binary image and restore it without sources or libraries
+//! - [`eval_program_artifact_runtime`] and the other `*_runtime` entry points: the same
+//!   evaluations returning interpreter [`Value`](nx_interpreter::Value)s, which [`NxValueView`]
+//!   serializes in the [`NxValue`](nx_value::NxValue) wire shape without an intermediate tree;
+//!   component props and state arrive as [`ComponentInput`], which can borrow MessagePack bytes
+//!   that are decoded straight into interpreter values
+//! - [`set_eval_stats_enabled`] / [`eval_stats`]: opt-in per-thread evaluation counters and
+//!   timings; [`ProgramArtifact::build_stats`] records per-phase build timings
 //! - [`NxDiagnostic`]: a stable, serde-friendly diagnostic model for tooling and FFI
 //! - [`to_nx_value`] / [`from_nx_value`]: convert between interpreter
 //!   [`Value`](nx_interpreter::Value) and [`NxValue`](nx_value::NxValue), rejecting runtime-only
@@ -24,31 +45,66 @@
 //! normalized identity before consulting [`ProgramBuildContext`], and maps diagnostics from the
 //! submitted source text before any file-backed fallback. Workspace modules validate UTF-8 at
 //! construction and share decoded source text internally.
+//!
+//! A built [`ProgramArtifact`] is immutable and `Send + Sync`. Share it behind an `Arc` and
+//! evaluate it from as many threads as needed: every entry point checks out one of the artifact's
+//! pooled interpreters for the duration of the call, so prepared modules, record layouts, and
+//! execution-context storage are reused across calls rather than rebuilt each time.
 
+mod artifact_image;
 mod artifacts;
 mod component;
 mod diagnostics;
 mod eval;
+mod eval_stats;
+mod interpreter_pool;
+mod library_cache;
+mod parallel;
+mod render_cache;
 mod source_graph;
 mod value;
 mod workspace;
 
 pub use artifacts::{
     build_library_artifact_from_directory, build_program_artifact_from_source,
-    build_workspace_program_artifact, validate_workspace, LibraryArtifact, LibraryExport,
-    LibraryRegistry, ProgramArtifact, ProgramBuildContext,
+    build_workspace_program_artifact, rebuild_workspace_program_artifact, validate_workspace,
+    LibraryArtifact, LibraryExport, LibraryRegistry, ProgramArtifact, ProgramBuildContext,
+    ProgramBuildStats,
 };
 pub use component::{
-    dispatch_component_actions_program_artifact, dispatch_component_actions_source,
-    evaluate_component_program_artifact, evaluate_component_source,
-    initialize_component_program_artifact, initialize_component_source,
-    ComponentDispatchEvalResult, ComponentDispatchResult, ComponentEvaluateEvalResult,
-    ComponentEvaluateResult, ComponentInitEvalResult, ComponentInitResult,
+    apply_component_snapshot_delta, component_snapshot_delta,
+    dispatch_component_actions_program_artifact,
+    dispatch_component_actions_program_artifact_runtime,
+    dispatch_component_actions_program_artifact_runtime_with_limits,
+    dispatch_component_actions_source, evaluate_component_batch_program_artifact,
+    evaluate_component_batch_program_artifact_runtime,
+    evaluate_component_batch_program_artifact_runtime_with_limits,
+    evaluate_component_program_artifact, evaluate_component_program_artifact_runtime,
+    evaluate_component_program_artifact_runtime_with_limits, evaluate_component_source,
+    evaluate_resolved_component_program_artifact,
+    evaluate_resolved_component_program_artifact_cached,
+    evaluate_resolved_component_program_artifact_cached_with_limits,
+    evaluate_resolved_component_program_artifact_runtime,
+    evaluate_resolved_component_program_artifact_runtime_with_limits,
+    initialize_component_program_artifact, initialize_component_program_artifact_runtime,
+    initialize_component_program_artifact_runtime_with_limits, initialize_component_source,
+    initialize_resolved_component_program_artifact,
+    initialize_resolved_component_program_artifact_runtime,
+    initialize_resolved_component_program_artifact_runtime_with_limits,
+    resolve_component_program_artifact, ComponentDispatchEvalResult, ComponentDispatchResult,
+    ComponentEvaluateEvalResult, ComponentEvaluateRequest, ComponentEvaluateResult,
+    ComponentInitEvalResult, ComponentInitResult, ComponentInput, ComponentResolveEvalResult,
+    ResolvedComponent,
 };
 pub use diagnostics::{NxDiagnostic, NxDiagnosticLabel, NxSeverity, NxTextSpan};
 pub use eval::{
-    eval_program_artifact, eval_source, load_library_artifact_from_directory,
+    eval_program_artifact, eval_program_artifact_runtime,
+    eval_program_artifact_runtime_with_limits, eval_source, load_library_artifact_from_directory,
     load_program_artifact_from_source, EvalResult,
 };
-pub use value::{from_nx_value, to_nx_value, FromNxValueError};
+pub use eval_stats::{
+    eval_stats, eval_stats_enabled, reset_eval_stats, set_eval_stats_enabled, EvalStats,
+};
+pub use render_cache::{ComponentRenderCache, ComponentRenderCacheStats};
+pub use value::{from_nx_value, to_nx_value, FromNxValueError, NxValueView};
 pub use workspace::{NxWorkspace, NxWorkspaceInputError, NxWorkspaceModule};
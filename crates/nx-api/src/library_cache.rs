@@ -0,0 +1,137 @@
+//! Persistent on-disk cache for analyzed library artifacts.
+//!
+//! One cache entry is one file named after the library fingerprint. The file holds one
+//! artifact image of the [`LibraryArtifact`] together with the fingerprints of the dependency
+//! libraries it was analyzed against.
+
+use crate::artifact_image::{decode_image, encode_image};
+use crate::artifacts::LibraryArtifact;
+use serde::{Deserialize, Serialize};
+use std::fs;
+use std::io;
+use std::path::{Path, PathBuf};
+
+const CACHE_MAGIC: &[u8; 4] = b"NXLC";
+const CACHE_FORMAT_VERSION: u32 = 2;
+const CACHE_FILE_EXTENSION: &str = "nxlib";
+
+#[derive(Serialize)]
+struct LibraryCacheEntryRef<'a> {
+    fingerprint: u64,
+    dependency_fingerprints: &'a [u64],
+    artifact: &'a LibraryArtifact,
+}
+
+/// Decoded cache entry for one library.
+#[derive(Deserialize)]
+pub(crate) struct LibraryCacheEntry {
+    fingerprint: u64,
+    /// Fingerprints of `artifact.dependency_roots`, in the same order.
+    pub dependency_fingerprints: Vec<u64>,
+    pub artifact: LibraryArtifact,
+}
+
+pub(crate) fn library_cache_path(cache_directory: &Path, fingerprint: u64) -> PathBuf {
+    cache_directory.join(format!("{fingerprint:016x}.{CACHE_FILE_EXTENSION}"))
+}
+
+/// Reads the cache entry for one library fingerprint.
+///
+/// Missing, unreadable, corrupt, or incompatible entries are all reported as a cache miss.
+pub(crate) fn read_library_cache(
+    cache_directory: &Path,
+    fingerprint: u64,
+) -> Option<LibraryCacheEntry> {
+    let bytes = fs::read(library_cache_path(cache_directory, fingerprint)).ok()?;
+    decode_library_cache(&bytes, fingerprint)
+}
+
+fn decode_library_cache(bytes: &[u8], fingerprint: u64) -> Option<LibraryCacheEntry> {
+    let entry: LibraryCacheEntry = decode_image(bytes, CACHE_MAGIC, CACHE_FORMAT_VERSION).ok()?;
+    let valid = entry.fingerprint == fingerprint
+        && entry.artifact.fingerprint == fingerprint
+        && entry.dependency_fingerprints.len() == entry.artifact.dependency_roots.len();
+    valid.then_some(entry)
+}
+
+fn encode_library_cache(
+    artifact: &LibraryArtifact,
+    dependency_fingerprints: &[u64],
+) -> io::Result<Vec<u8>> {
+    encode_image(
+        CACHE_MAGIC,
+        CACHE_FORMAT_VERSION,
+        &LibraryCacheEntryRef {
+            fingerprint: artifact.fingerprint,
+            dependency_fingerprints,
+            artifact,
+        },
+    )
+}
+
+/// Writes the cache entry for one analyzed library.
+///
+/// The entry is written to a temporary file and renamed into place, so concurrent readers never
+/// observe a partially written entry.
+pub(crate) fn write_library_cache(
+    cache_directory: &Path,
+    artifact: &LibraryArtifact,
+    dependency_fingerprints: &[u64],
+) -> io::Result<()> {
+    let bytes = encode_library_cache(artifact, dependency_fingerprints)?;
+    fs::create_dir_all(cache_directory)?;
+
+    let path = library_cache_path(cache_directory, artifact.fingerprint);
+    let temp_path =
+        path.with_extension(format!("{CACHE_FILE_EXTENSION}.{}.tmp", std::process::id()));
+    fs::write(&temp_path, &bytes)?;
+    fs::rename(&temp_path, &path).inspect_err(|_| {
+        let _ = fs::remove_file(&temp_path);
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use rustc_hash::FxHashMap;
+
+    fn empty_artifact(fingerprint: u64) -> LibraryArtifact {
+        LibraryArtifact {
+            root_path: PathBuf::from("/libraries/ui"),
+            modules: Vec::new(),
+            exports: FxHashMap::default(),
+            interface_items: Vec::new(),
+            exported_items: FxHashMap::default(),
+            visible_to_library_items: FxHashMap::default(),
+            dependency_roots: vec![PathBuf::from("/libraries/core")],
+            diagnostics: Vec::new(),
+            fingerprint,
+            export_types: Default::default(),
+        }
+    }
+
+    #[test]
+    fn cache_entry_round_trips_for_matching_fingerprint() {
+        let artifact = empty_artifact(7);
+        let bytes = encode_library_cache(&artifact, &[11]).expect("encode cache entry");
+
+        let entry = decode_library_cache(&bytes, 7).expect("matching entry should decode");
+        assert_eq!(entry.dependency_fingerprints, vec![11]);
+        assert_eq!(entry.artifact.root_path, artifact.root_path);
+        assert_eq!(entry.artifact.dependency_roots, artifact.dependency_roots);
+    }
+
+    #[test]
+    fn cache_entry_rejects_stale_or_corrupt_bytes() {
+        let artifact = empty_artifact(7);
+        let bytes = encode_library_cache(&artifact, &[11]).expect("encode cache entry");
+
+        assert!(decode_library_cache(&bytes, 8).is_none());
+        assert!(decode_library_cache(&bytes[..bytes.len() / 2], 7).is_none());
+        assert!(decode_library_cache(b"not a cache entry", 7).is_none());
+
+        let mut wrong_version = bytes.clone();
+        wrong_version[4..8].copy_from_slice(&(CACHE_FORMAT_VERSION + 1).to_le_bytes());
+        assert!(decode_library_cache(&wrong_version, 7).is_none());
+    }
+}
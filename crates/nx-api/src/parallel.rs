@@ -0,0 +1,291 @@
+//! Persistent worker pool used to analyze independent modules concurrently.
+//!
+//! Builds share one lazily started pool of long-lived threads instead of spawning fresh threads
+//! per phase, so thread-local state such as the pooled parsers survives from one build to the
+//! next and concurrent builds never run more than the pool's threads plus their own callers.
+
+use std::any::Any;
+use std::cell::Cell;
+use std::collections::VecDeque;
+use std::num::NonZeroUsize;
+use std::panic::{self, AssertUnwindSafe};
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Arc, Condvar, Mutex, MutexGuard, OnceLock, PoisonError};
+use std::thread;
+
+thread_local! {
+    /// Set on pool threads so work they run never fans out again.
+    static ON_POOL_THREAD: Cell<bool> = const { Cell::new(false) };
+}
+
+/// Resolves a configured worker count, where `0` selects the available hardware parallelism.
+pub(crate) fn resolve_worker_count(configured: usize) -> usize {
+    if configured != 0 {
+        return configured;
+    }
+
+    thread::available_parallelism()
+        .map(NonZeroUsize::get)
+        .unwrap_or(1)
+}
+
+/// Computes `f(0)..f(len)` on up to `workers` threads and returns the results in index order.
+///
+/// The calling thread always takes part, and up to `workers - 1` threads from the shared pool
+/// help it. Workers claim the next unprocessed index from a shared counter, so threads that finish
+/// cheap items keep taking work while others are still busy with expensive ones. With one worker,
+/// at most one item, or when called from a pool thread, everything runs on the calling thread.
+/// A panic in `f` is re-raised on the calling thread once every helper has stopped.
+pub(crate) fn parallel_map<R, F>(len: usize, workers: usize, f: F) -> Vec<R>
+where
+    R: Send,
+    F: Fn(usize) -> R + Sync,
+{
+    let workers = workers.min(len);
+    if workers <= 1 || ON_POOL_THREAD.with(Cell::get) {
+        return (0..len).map(f).collect();
+    }
+
+    let next_index = AtomicUsize::new(0);
+    let results = Mutex::new(Vec::with_capacity(len));
+    let panic_payload = Mutex::new(None::<Box<dyn Any + Send>>);
+    let work = || {
+        let outcome = panic::catch_unwind(AssertUnwindSafe(|| {
+            let mut claimed = Vec::new();
+            loop {
+                let index = next_index.fetch_add(1, Ordering::Relaxed);
+                if index >= len {
+                    break claimed;
+                }
+                claimed.push((index, f(index)));
+            }
+        }));
+        match outcome {
+            Ok(claimed) => lock(&results).extend(claimed),
+            Err(payload) => {
+                lock(&panic_payload).get_or_insert(payload);
+            }
+        }
+    };
+
+    let work: &(dyn Fn() + Sync) = &work;
+    // SAFETY: helpers only call `work` between `MapJob::enter` and `MapJob::leave`, and
+    // `MapJob::close` below waits until no helper is inside before `work` goes out of scope.
+    let work = unsafe {
+        std::mem::transmute::<*const (dyn Fn() + Sync + '_), *const (dyn Fn() + Sync + 'static)>(
+            work as *const (dyn Fn() + Sync + '_),
+        )
+    };
+    let job = Arc::new(MapJob::new(work));
+    pool().submit(&job, workers - 1);
+    // SAFETY: `work` still borrows live locals here.
+    unsafe { (*work)() };
+    job.close();
+
+    if let Some(payload) = panic_payload
+        .into_inner()
+        .unwrap_or_else(PoisonError::into_inner)
+    {
+        panic::resume_unwind(payload);
+    }
+
+    let mut results = results.into_inner().unwrap_or_else(PoisonError::into_inner);
+    results.sort_unstable_by_key(|(index, _)| *index);
+    results.into_iter().map(|(_, result)| result).collect()
+}
+
+fn lock<T>(mutex: &Mutex<T>) -> MutexGuard<'_, T> {
+    mutex.lock().unwrap_or_else(PoisonError::into_inner)
+}
+
+fn pool() -> &'static WorkerPool {
+    static POOL: OnceLock<WorkerPool> = OnceLock::new();
+    POOL.get_or_init(|| WorkerPool {
+        queue: Mutex::new(PoolQueue::default()),
+        job_ready: Condvar::new(),
+    })
+}
+
+/// Process-wide pool of helper threads; it grows to the largest helper count any call asked for.
+struct WorkerPool {
+    queue: Mutex<PoolQueue>,
+    job_ready: Condvar,
+}
+
+#[derive(Default)]
+struct PoolQueue {
+    jobs: VecDeque<Arc<MapJob>>,
+    threads: usize,
+}
+
+impl WorkerPool {
+    /// Queues `job` for up to `helpers` pool threads, starting threads the pool does not have yet.
+    fn submit(&'static self, job: &Arc<MapJob>, helpers: usize) {
+        let mut queue = lock(&self.queue);
+        while queue.threads < helpers {
+            let spawned = thread::Builder::new()
+                .name(format!("nx-analysis-{}", queue.threads + 1))
+                .spawn(move || self.run_worker());
+            if spawned.is_err() {
+                break;
+            }
+            queue.threads += 1;
+        }
+
+        for _ in 0..helpers.min(queue.threads) {
+            queue.jobs.push_back(Arc::clone(job));
+        }
+        drop(queue);
+        self.job_ready.notify_all();
+    }
+
+    fn run_worker(&self) {
+        ON_POOL_THREAD.with(|flag| flag.set(true));
+        loop {
+            let job = {
+                let mut queue = lock(&self.queue);
+                loop {
+                    if let Some(job) = queue.jobs.pop_front() {
+                        break job;
+                    }
+                    queue = self
+                        .job_ready
+                        .wait(queue)
+                        .unwrap_or_else(PoisonError::into_inner);
+                }
+            };
+            job.help();
+        }
+    }
+}
+
+/// One `parallel_map` call as seen by the pool threads helping with it.
+struct MapJob {
+    state: Mutex<MapJobState>,
+    helpers_done: Condvar,
+    /// Borrowed work closure; only valid while the job is open.
+    work: *const (dyn Fn() + Sync + 'static),
+}
+
+// SAFETY: `work` is `Sync` and is only dereferenced while the owning call keeps it alive.
+unsafe impl Send for MapJob {}
+unsafe impl Sync for MapJob {}
+
+#[derive(Default)]
+struct MapJobState {
+    closed: bool,
+    active_helpers: usize,
+}
+
+impl MapJob {
+    fn new(work: *const (dyn Fn() + Sync + 'static)) -> Self {
+        Self {
+            state: Mutex::new(MapJobState::default()),
+            helpers_done: Condvar::new(),
+            work,
+        }
+    }
+
+    /// Runs the work closure on a pool thread unless the caller already finished the job.
+    fn help(&self) {
+        if !self.enter() {
+            return;
+        }
+        // SAFETY: `enter` succeeded, so `close` has not returned and the closure is alive. The
+        // closure catches panics from the mapped function itself.
+        unsafe { (*self.work)() };
+        self.leave();
+    }
+
+    fn enter(&self) -> bool {
+        let mut state = lock(&self.state);
+        if state.closed {
+            return false;
+        }
+        state.active_helpers += 1;
+        true
+    }
+
+    fn leave(&self) {
+        let mut state = lock(&self.state);
+        state.active_helpers -= 1;
+        if state.active_helpers == 0 {
+            self.helpers_done.notify_all();
+        }
+    }
+
+    /// Stops new helpers from joining and waits for the ones already running.
+    fn close(&self) {
+        let mut state = lock(&self.state);
+        state.closed = true;
+        while state.active_helpers > 0 {
+            state = self
+                .helpers_done
+                .wait(state)
+                .unwrap_or_else(PoisonError::into_inner);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::time::Duration;
+
+    #[test]
+    fn parallel_map_preserves_index_order() {
+        let results = parallel_map(100, 8, |index| index * 2);
+        assert_eq!(results, (0..100).map(|index| index * 2).collect::<Vec<_>>());
+    }
+
+    #[test]
+    fn parallel_map_runs_inline_for_one_worker() {
+        let caller = thread::current().id();
+        let results = parallel_map(3, 1, |_| thread::current().id() == caller);
+        assert_eq!(results, vec![true; 3]);
+    }
+
+    #[test]
+    fn parallel_map_helps_on_persistent_pool_threads() {
+        let caller = thread::current().id();
+        for _ in 0..3 {
+            let helpers = parallel_map(16, 4, |_| {
+                thread::sleep(Duration::from_millis(1));
+                let current = thread::current();
+                (current.id() != caller).then(|| current.name().map(str::to_string))
+            });
+            for name in helpers.into_iter().flatten() {
+                assert!(name.is_some_and(|name| name.starts_with("nx-analysis-")));
+            }
+        }
+    }
+
+    #[test]
+    fn parallel_map_runs_nested_calls_inline_on_pool_threads() {
+        let results = parallel_map(16, 4, |_| {
+            thread::sleep(Duration::from_millis(1));
+            let current = thread::current().id();
+            let nested = parallel_map(4, 4, |_| thread::current().id());
+            !ON_POOL_THREAD.with(Cell::get) || nested.iter().all(|id| *id == current)
+        });
+        assert_eq!(results, vec![true; 16]);
+    }
+
+    #[test]
+    fn parallel_map_reraises_panics_after_helpers_stop() {
+        let outcome = panic::catch_unwind(|| {
+            parallel_map(32, 4, |index| {
+                assert_ne!(index, 7, "item failed");
+                index
+            })
+        });
+        assert!(outcome.is_err());
+        assert_eq!(parallel_map(4, 4, |index| index), vec![0, 1, 2, 3]);
+    }
+
+    #[test]
+    fn resolve_worker_count_defaults_to_available_parallelism() {
+        assert_eq!(resolve_worker_count(3), 3);
+        assert!(resolve_worker_count(0) >= 1);
+    }
+}
@@ -0,0 +1,525 @@
+//! Bounded in-memory cache of rendered component output.
+//!
+//! Component evaluation is pure: the rendered value depends only on the program, the component,
+//! and the explicit props and state. [`ComponentRenderCache`] memoizes rendered values under that
+//! key so repeated evaluations with unchanged inputs skip input decoding and rendering entirely.
+//!
+//! Hosts can also name functions, typically element functions that many components render with
+//! the same arguments, whose calls are memoized inside cached evaluations. Those calls are keyed by
+//! the MessagePack encoding of their arguments and answered through the interpreter's
+//! [`CallMemo`] hook, which charges each hit the work the call did when it ran.
+
+use crate::value::NxValueView;
+use nx_interpreter::{CallMemo, CallTarget, CallUsage, MemoizedCall, Value};
+use rustc_hash::{FxHashMap, FxHashSet, FxHasher};
+use std::hash::{Hash, Hasher};
+use std::mem::size_of;
+use std::sync::{Arc, Mutex, RwLock};
+
+/// Counters describing the current contents and effectiveness of a [`ComponentRenderCache`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct ComponentRenderCacheStats {
+    /// Evaluations and memoized function calls answered from the cache.
+    pub hits: u64,
+    /// Evaluations that had to render and memoized function calls that had to run.
+    pub misses: u64,
+    /// Rendered values currently cached.
+    pub entries: u64,
+    /// Approximate bytes retained by cached keys and rendered values.
+    pub bytes: u64,
+    /// Upper bound for `bytes` configured when the cache was created.
+    pub capacity_bytes: u64,
+}
+
+/// Opt-in memoization of rendered component output, shared across evaluations.
+///
+/// Entries are keyed by program fingerprint, component name, and the MessagePack encoding of the
+/// props and state, or for memoized function calls by program fingerprint, function, and the
+/// encoding of the arguments. When an insertion pushes the retained size over the configured
+/// capacity, least recently used entries are evicted first; rendered values larger than the whole
+/// capacity are not cached. The cache is safe to share between threads.
+pub struct ComponentRenderCache {
+    shared: Arc<RenderCacheShared>,
+}
+
+/// Cache contents, shared with the [`FunctionCallMemo`]s of running evaluations.
+struct RenderCacheShared {
+    capacity_bytes: usize,
+    state: Mutex<RenderCacheState>,
+    /// Declared names of the functions whose calls are memoized.
+    memoized_functions: RwLock<Arc<FxHashSet<Box<str>>>>,
+}
+
+/// Marks the end of the recency list.
+const NIL: usize = usize::MAX;
+
+/// Cached entries in slab slots threaded on a doubly linked recency list, so lookups, promotions,
+/// and evictions are all constant time.
+struct RenderCacheState {
+    /// Slot of each cached entry by key hash.
+    index: FxHashMap<u64, usize>,
+    slots: Vec<RenderCacheSlot>,
+    /// Vacant slots left behind by evictions, reused before the slab grows.
+    free: Vec<usize>,
+    /// Most recently used slot.
+    head: usize,
+    /// Least recently used slot, evicted first.
+    tail: usize,
+    bytes: usize,
+    hits: u64,
+    misses: u64,
+}
+
+struct RenderCacheSlot {
+    entry: Option<RenderCacheEntry>,
+    prev: usize,
+    next: usize,
+}
+
+struct RenderCacheEntry {
+    hash: u64,
+    key: RenderCacheKey,
+    rendered: Value,
+    /// Work a memoized function call did, charged again on every hit.
+    usage: CallUsage,
+    cost: usize,
+}
+
+impl Default for RenderCacheState {
+    fn default() -> Self {
+        Self {
+            index: FxHashMap::default(),
+            slots: Vec::new(),
+            free: Vec::new(),
+            head: NIL,
+            tail: NIL,
+            bytes: 0,
+            hits: 0,
+            misses: 0,
+        }
+    }
+}
+
+impl RenderCacheState {
+    fn entry(&self, slot: usize) -> &RenderCacheEntry {
+        self.slots[slot]
+            .entry
+            .as_ref()
+            .expect("indexed render cache slot is occupied")
+    }
+
+    fn unlink(&mut self, slot: usize) {
+        let (prev, next) = (self.slots[slot].prev, self.slots[slot].next);
+        match prev {
+            NIL => self.head = next,
+            prev => self.slots[prev].next = next,
+        }
+        match next {
+            NIL => self.tail = prev,
+            next => self.slots[next].prev = prev,
+        }
+    }
+
+    fn push_front(&mut self, slot: usize) {
+        self.slots[slot].prev = NIL;
+        self.slots[slot].next = self.head;
+        match self.head {
+            NIL => self.tail = slot,
+            head => self.slots[head].prev = slot,
+        }
+        self.head = slot;
+    }
+
+    fn promote(&mut self, slot: usize) {
+        if self.head != slot {
+            self.unlink(slot);
+            self.push_front(slot);
+        }
+    }
+
+    fn insert(&mut self, entry: RenderCacheEntry) {
+        self.bytes += entry.cost;
+        if let Some(&slot) = self.index.get(&entry.hash) {
+            let previous = self.slots[slot].entry.replace(entry);
+            self.bytes -= previous.map_or(0, |previous| previous.cost);
+            self.promote(slot);
+            return;
+        }
+
+        let hash = entry.hash;
+        let slot = match self.free.pop() {
+            Some(slot) => {
+                self.slots[slot].entry = Some(entry);
+                slot
+            }
+            None => {
+                self.slots.push(RenderCacheSlot {
+                    entry: Some(entry),
+                    prev: NIL,
+                    next: NIL,
+                });
+                self.slots.len() - 1
+            }
+        };
+        self.push_front(slot);
+        self.index.insert(hash, slot);
+    }
+
+    fn evict_least_recently_used(&mut self) -> bool {
+        let slot = self.tail;
+        if slot == NIL {
+            return false;
+        }
+
+        self.unlink(slot);
+        let evicted = self.slots[slot]
+            .entry
+            .take()
+            .expect("linked render cache slot is occupied");
+        self.index.remove(&evicted.hash);
+        self.bytes -= evicted.cost;
+        self.free.push(slot);
+        true
+    }
+}
+
+/// Full cache key, kept alongside each entry so a hash collision is a miss rather than a wrong
+/// answer.
+#[derive(PartialEq, Eq)]
+struct RenderCacheKey {
+    program_fingerprint: u64,
+    call_module: Option<u32>,
+    target: Box<str>,
+    props: Box<[u8]>,
+    state: Box<[u8]>,
+}
+
+/// Borrowed form of [`RenderCacheKey`] used for lookups.
+///
+/// Component renders have no `call_module` and name the component as `target`. Memoized function
+/// calls name the defining runtime module and the function, and keep the encoded arguments in
+/// `props` with an empty `state`.
+#[derive(Clone, Copy)]
+pub(crate) struct RenderCacheKeyRef<'a> {
+    pub program_fingerprint: u64,
+    pub call_module: Option<u32>,
+    pub target: &'a str,
+    pub props: &'a [u8],
+    pub state: &'a [u8],
+}
+
+impl RenderCacheKeyRef<'_> {
+    fn hash_value(&self) -> u64 {
+        let mut hasher = FxHasher::default();
+        self.program_fingerprint.hash(&mut hasher);
+        self.call_module.hash(&mut hasher);
+        self.target.hash(&mut hasher);
+        self.props.hash(&mut hasher);
+        self.state.hash(&mut hasher);
+        hasher.finish()
+    }
+
+    fn matches(&self, key: &RenderCacheKey) -> bool {
+        self.program_fingerprint == key.program_fingerprint
+            && self.call_module == key.call_module
+            && self.target == &*key.target
+            && self.props == &*key.props
+            && self.state == &*key.state
+    }
+
+    fn to_key(self) -> RenderCacheKey {
+        RenderCacheKey {
+            program_fingerprint: self.program_fingerprint,
+            call_module: self.call_module,
+            target: self.target.into(),
+            props: self.props.into(),
+            state: self.state.into(),
+        }
+    }
+
+    fn retained_bytes(&self) -> usize {
+        size_of::<RenderCacheEntry>() + self.target.len() + self.props.len() + self.state.len()
+    }
+}
+
+impl ComponentRenderCache {
+    /// Creates an empty cache that retains at most roughly `capacity_bytes` of keys and rendered
+    /// values.
+    pub fn new(capacity_bytes: usize) -> Self {
+        Self {
+            shared: Arc::new(RenderCacheShared {
+                capacity_bytes,
+                state: Mutex::new(RenderCacheState::default()),
+                memoized_functions: RwLock::new(Arc::default()),
+            }),
+        }
+    }
+
+    /// Memoizes calls to functions declared as `name` in evaluations that use this cache.
+    ///
+    /// Meant for element functions that many components call with the same arguments. Element and
+    /// ordinary calls are both memoized, keyed by the function's defining module and the
+    /// MessagePack encoding of the arguments. Calls with action handler arguments and results that
+    /// hold action handlers are never memoized, because handlers capture values their encoding
+    /// leaves out. Clearing the cache keeps the memoized function names.
+    pub fn memoize_function(&self, name: &str) {
+        let mut functions = self
+            .shared
+            .memoized_functions
+            .write()
+            .unwrap_or_else(|poisoned| poisoned.into_inner());
+        Arc::make_mut(&mut functions).insert(name.into());
+    }
+
+    /// Returns the current hit/miss counters and retained size.
+    pub fn stats(&self) -> ComponentRenderCacheStats {
+        let state = self.shared.lock();
+        ComponentRenderCacheStats {
+            hits: state.hits,
+            misses: state.misses,
+            entries: state.index.len() as u64,
+            bytes: state.bytes as u64,
+            capacity_bytes: self.shared.capacity_bytes as u64,
+        }
+    }
+
+    /// Drops every cached value and resets the counters.
+    pub fn clear(&self) {
+        *self.shared.lock() = RenderCacheState::default();
+    }
+
+    /// Returns the cached rendered value for `key`, counting a hit or a miss.
+    pub(crate) fn get(&self, key: RenderCacheKeyRef<'_>) -> Option<Value> {
+        self.shared.get(key).map(|(rendered, _)| rendered)
+    }
+
+    /// Caches a freshly rendered value for `key`, evicting least recently used entries as needed.
+    pub(crate) fn insert(&self, key: RenderCacheKeyRef<'_>, rendered: &Value) {
+        self.shared.insert(key, rendered, CallUsage::default());
+    }
+
+    /// Returns the memo answering memoized function calls of the program with
+    /// `program_fingerprint`, or `None` when no function is memoized.
+    pub(crate) fn function_call_memo(&self, program_fingerprint: u64) -> Option<Arc<dyn CallMemo>> {
+        let functions = Arc::clone(
+            &self
+                .shared
+                .memoized_functions
+                .read()
+                .unwrap_or_else(|poisoned| poisoned.into_inner()),
+        );
+        if functions.is_empty() {
+            return None;
+        }
+        Some(Arc::new(FunctionCallMemo {
+            shared: Arc::clone(&self.shared),
+            functions,
+            program_fingerprint,
+        }))
+    }
+}
+
+impl RenderCacheShared {
+    fn get(&self, key: RenderCacheKeyRef<'_>) -> Option<(Value, CallUsage)> {
+        let mut state = self.lock();
+        let slot = state
+            .index
+            .get(&key.hash_value())
+            .copied()
+            .filter(|slot| key.matches(&state.entry(*slot).key));
+
+        let Some(slot) = slot else {
+            state.misses += 1;
+            return None;
+        };
+        state.hits += 1;
+        state.promote(slot);
+        let entry = state.entry(slot);
+        Some((entry.rendered.clone(), entry.usage))
+    }
+
+    fn insert(&self, key: RenderCacheKeyRef<'_>, rendered: &Value, usage: CallUsage) {
+        let cost = key.retained_bytes() + estimated_value_bytes(rendered);
+        if cost > self.capacity_bytes {
+            return;
+        }
+
+        let entry = RenderCacheEntry {
+            hash: key.hash_value(),
+            key: key.to_key(),
+            rendered: rendered.clone(),
+            usage,
+            cost,
+        };
+        let mut state = self.lock();
+        state.insert(entry);
+        while state.bytes > self.capacity_bytes && state.evict_least_recently_used() {}
+    }
+
+    fn lock(&self) -> std::sync::MutexGuard<'_, RenderCacheState> {
+        // The state stays consistent between statements, so a panic elsewhere cannot poison it.
+        self.state
+            .lock()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+    }
+}
+
+/// [`CallMemo`] answering the memoized function calls of one program from a render cache.
+struct FunctionCallMemo {
+    shared: Arc<RenderCacheShared>,
+    functions: Arc<FxHashSet<Box<str>>>,
+    program_fingerprint: u64,
+}
+
+impl FunctionCallMemo {
+    fn key_ref<'a>(&self, target: CallTarget<'a>, key: &'a [u8]) -> RenderCacheKeyRef<'a> {
+        RenderCacheKeyRef {
+            program_fingerprint: self.program_fingerprint,
+            call_module: Some(target.module.as_u32()),
+            target: target.function,
+            props: key,
+            state: &[],
+        }
+    }
+}
+
+impl CallMemo for FunctionCallMemo {
+    fn key(&self, target: CallTarget<'_>, args: &[Value]) -> Option<Vec<u8>> {
+        if !self.functions.contains(target.function) || args.iter().any(holds_action_handler) {
+            return None;
+        }
+
+        // MessagePack values are self-delimiting, so concatenated arguments decode unambiguously.
+        let mut key = Vec::new();
+        for arg in args {
+            rmp_serde::encode::write(&mut key, &NxValueView::new(arg)).ok()?;
+        }
+        Some(key)
+    }
+
+    fn get(&self, target: CallTarget<'_>, key: &[u8]) -> Option<MemoizedCall> {
+        self.shared
+            .get(self.key_ref(target, key))
+            .map(|(value, usage)| MemoizedCall { value, usage })
+    }
+
+    fn insert(&self, target: CallTarget<'_>, key: &[u8], call: &MemoizedCall) {
+        if !holds_action_handler(&call.value) {
+            self.shared
+                .insert(self.key_ref(target, key), &call.value, call.usage);
+        }
+    }
+}
+
+/// Returns whether `value` contains an action handler, whose captured values its encoding omits.
+fn holds_action_handler(value: &Value) -> bool {
+    match value {
+        Value::ActionHandler { .. } => true,
+        Value::Array(elements) => elements.iter().any(holds_action_handler),
+        Value::Record { fields, .. } => fields.iter().any(|(_, value)| holds_action_handler(value)),
+        _ => false,
+    }
+}
+
+/// Approximates the memory retained by one rendered value tree.
+///
+/// Shared array and record storage is counted once per reference, so the estimate errs on the
+/// high side for values that share structure.
+fn estimated_value_bytes(value: &Value) -> usize {
+    size_of::<Value>()
+        + match value {
+            Value::String(value) => value.len(),
+            Value::Array(elements) => elements.iter().map(estimated_value_bytes).sum(),
+            Value::Record { fields, .. }
+            | Value::ActionHandler {
+                captured: fields, ..
+            } => fields
+                .iter()
+                .map(|(name, value)| name.len() + estimated_value_bytes(value))
+                .sum(),
+            _ => 0,
+        }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use smol_str::SmolStr;
+
+    fn key<'a>(component: &'a str, props: &'a [u8]) -> RenderCacheKeyRef<'a> {
+        RenderCacheKeyRef {
+            program_fingerprint: 1,
+            call_module: None,
+            target: component,
+            props,
+            state: &[0x80],
+        }
+    }
+
+    #[test]
+    fn cache_counts_hits_and_misses() {
+        let cache = ComponentRenderCache::new(64 * 1024);
+        let rendered = Value::String(SmolStr::new("rendered"));
+
+        assert_eq!(cache.get(key("Card", b"a")), None);
+        cache.insert(key("Card", b"a"), &rendered);
+        assert_eq!(cache.get(key("Card", b"a")), Some(rendered));
+        assert_eq!(cache.get(key("Card", b"b")), None);
+        assert_eq!(cache.get(key("Other", b"a")), None);
+
+        let stats = cache.stats();
+        assert_eq!((stats.hits, stats.misses, stats.entries), (1, 3, 1));
+        assert!(stats.bytes > 0 && stats.bytes <= stats.capacity_bytes);
+
+        cache.clear();
+        assert_eq!(
+            cache.stats(),
+            ComponentRenderCacheStats {
+                capacity_bytes: 64 * 1024,
+                ..ComponentRenderCacheStats::default()
+            }
+        );
+    }
+
+    #[test]
+    fn cache_evicts_least_recently_used_entries_within_capacity() {
+        let rendered = Value::Int(1);
+        let entry_cost = key("Card", b"a").retained_bytes() + estimated_value_bytes(&rendered);
+        let cache = ComponentRenderCache::new(entry_cost * 2);
+
+        cache.insert(key("Card", b"a"), &rendered);
+        cache.insert(key("Card", b"b"), &rendered);
+        assert!(cache.get(key("Card", b"a")).is_some());
+        cache.insert(key("Card", b"c"), &rendered);
+
+        assert!(cache.get(key("Card", b"a")).is_some());
+        assert!(cache.get(key("Card", b"b")).is_none());
+        assert!(cache.get(key("Card", b"c")).is_some());
+        assert!(cache.stats().bytes as usize <= entry_cost * 2);
+
+        let oversized = Value::String(SmolStr::new("x".repeat(entry_cost * 2)));
+        cache.insert(key("Card", b"d"), &oversized);
+        assert!(cache.get(key("Card", b"d")).is_none());
+    }
+
+    #[test]
+    fn cache_reuses_evicted_slots_and_replaces_entries_in_place() {
+        let rendered = Value::Int(1);
+        let entry_cost = key("Card", b"a").retained_bytes() + estimated_value_bytes(&rendered);
+        let cache = ComponentRenderCache::new(entry_cost * 3);
+
+        for props in [b"a", b"b", b"c", b"d", b"e", b"f"] {
+            cache.insert(key("Card", props), &rendered);
+        }
+        cache.insert(key("Card", b"e"), &Value::Int(2));
+        cache.insert(key("Card", b"g"), &rendered);
+
+        assert!(cache.get(key("Card", b"d")).is_none());
+        assert_eq!(cache.get(key("Card", b"e")), Some(Value::Int(2)));
+        assert!(cache.get(key("Card", b"f")).is_some());
+        assert!(cache.get(key("Card", b"g")).is_some());
+        assert_eq!(cache.stats().entries, 3);
+        assert_eq!(cache.stats().bytes as usize, entry_cost * 3);
+        assert!(cache.shared.lock().slots.len() <= 4);
+    }
+}
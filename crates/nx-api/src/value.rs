@@ -1,6 +1,9 @@
 use nx_hir::Name;
-use nx_interpreter::Value;
+use nx_interpreter::{RecordFields, Value};
 use nx_value::NxValue;
+use serde::de::{DeserializeSeed, Deserializer, Error as _, MapAccess, SeqAccess, Visitor};
+use serde::ser::{SerializeMap, Serializer};
+use serde::Serialize;
 use smol_str::SmolStr;
 use std::collections::BTreeMap;
 use std::error::Error;
@@ -91,6 +94,60 @@ pub fn to_nx_value(value: &Value) -> NxValue {
     }
 }
 
+/// Borrowed view that serializes an interpreter [`Value`] exactly as [`to_nx_value`] followed by
+/// [`NxValue`]'s own serialization would, without building the intermediate [`NxValue`] tree.
+///
+/// Serializing through a view walks the value once and streams it straight into the serializer's
+/// writer, so large rendered trees need no second allocation pass.
+#[derive(Clone, Copy)]
+pub struct NxValueView<'a>(&'a Value);
+
+impl<'a> NxValueView<'a> {
+    /// Wraps a runtime value for serialization in the public value format.
+    pub fn new(value: &'a Value) -> Self {
+        Self(value)
+    }
+}
+
+impl Serialize for NxValueView<'_> {
+    fn serialize<S: Serializer>(&self, serializer: S) -> Result<S::Ok, S::Error> {
+        match self.0 {
+            Value::Null => serializer.serialize_unit(),
+            Value::Boolean(value) => serializer.serialize_bool(*value),
+            Value::Int32(value) => serializer.serialize_i32(*value),
+            Value::Int(value) => serializer.serialize_i64(*value),
+            Value::Float32(value) => serializer.serialize_f32(*value),
+            Value::Float(value) => serializer.serialize_f64(*value),
+            Value::String(value) => serializer.serialize_str(value),
+            Value::Array(elements) => serializer.collect_seq(elements.iter().map(NxValueView)),
+            Value::EnumValue { member, .. } => serializer.serialize_str(member.as_str()),
+            Value::Record { type_name, fields } => {
+                // Record layouts keep fields sorted by name, matching the `BTreeMap` order of
+                // `NxValue::Record` properties.
+                let mut map = serializer.serialize_map(Some(fields.len() + 1))?;
+                map.serialize_entry("$type", type_name.as_str())?;
+                for (key, value) in fields.iter() {
+                    map.serialize_entry(key.as_str(), &NxValueView(value))?;
+                }
+                map.end()
+            }
+            Value::ActionHandler {
+                component,
+                emit,
+                action_name,
+                ..
+            } => {
+                let mut map = serializer.serialize_map(Some(4))?;
+                map.serialize_entry("$type", "ActionHandler")?;
+                map.serialize_entry("action", action_name.as_str())?;
+                map.serialize_entry("component", component.as_str())?;
+                map.serialize_entry("emit", emit.as_str())?;
+                map.end()
+            }
+        }
+    }
+}
+
 /// Converts a serializable [`NxValue`] into the interpreter [`Value`] representation.
 ///
 /// This reverse conversion rejects runtime-only values that do not have a faithful public
@@ -113,7 +170,8 @@ fn from_nx_value_at_path(value: &NxValue, path: &str) -> Result<Value, FromNxVal
                 .iter()
                 .enumerate()
                 .map(|(index, element)| from_nx_value_at_path(element, &format!("{path}[{index}]")))
-                .collect::<Result<Vec<_>, _>>()?,
+                .collect::<Result<Vec<_>, _>>()?
+                .into(),
         )),
         NxValue::Record {
             type_name,
@@ -124,7 +182,9 @@ fn from_nx_value_at_path(value: &NxValue, path: &str) -> Result<Value, FromNxVal
             }
 
             Ok(Value::Record {
-                type_name: Name::new(type_name.as_deref().unwrap_or("object")),
+                type_name: type_name
+                    .as_deref()
+                    .map_or_else(|| Name::new("object"), Name::external),
                 fields: properties
                     .iter()
                     .map(|(key, value)| {
@@ -133,21 +193,229 @@ fn from_nx_value_at_path(value: &NxValue, path: &str) -> Result<Value, FromNxVal
                             from_nx_value_at_path(value, &format!("{path}.{key}"))?,
                         ))
                     })
-                    .collect::<Result<_, _>>()?,
+                    .collect::<Result<RecordFields, _>>()?,
             })
         }
     }
 }
 
-fn fields_to_properties(
-    fields: &rustc_hash::FxHashMap<smol_str::SmolStr, Value>,
-) -> BTreeMap<String, NxValue> {
-    let mut obj = BTreeMap::new();
-    for (key, value) in fields {
-        obj.insert(key.to_string(), to_nx_value(value));
+/// Decodes MessagePack host input straight into an interpreter [`Value`].
+///
+/// The result matches decoding an [`NxValue`] and converting it with [`from_nx_value`], but the
+/// input is walked once: keys and strings are read from the borrowed input bytes into
+/// [`SmolStr`]s, and no intermediate public value tree is built. Records whose `$type` satisfies
+/// `is_output_only_type`, or that encode an `ActionHandler`, are rejected with the same messages
+/// as the two-step path.
+pub(crate) fn value_from_msgpack_slice(
+    bytes: &[u8],
+    is_output_only_type: &dyn Fn(&str) -> bool,
+) -> Result<Value, String> {
+    let mut decoder = MsgpackValueDecoder {
+        is_output_only_type,
+        path: Vec::new(),
+        invalid_input: None,
+    };
+    let mut deserializer = rmp_serde::Deserializer::from_read_ref(bytes);
+    let result = MsgpackValueSeed {
+        decoder: &mut decoder,
+    }
+    .deserialize(&mut deserializer);
+
+    match (result, decoder.invalid_input) {
+        (_, Some(message)) => Err(message),
+        (Ok(value), None) => Ok(value),
+        (Err(error), None) => Err(format!("messagepack decode failed: {error}")),
+    }
+}
+
+enum PathSegment {
+    Field(SmolStr),
+    Index(usize),
+}
+
+struct MsgpackValueDecoder<'a> {
+    is_output_only_type: &'a dyn Fn(&str) -> bool,
+    /// Position of the value being decoded; only formatted when an error is reported.
+    path: Vec<PathSegment>,
+    invalid_input: Option<String>,
+}
+
+impl MsgpackValueDecoder<'_> {
+    fn path_string(&self) -> String {
+        let mut path = String::from("$");
+        for segment in &self.path {
+            match segment {
+                PathSegment::Field(name) => {
+                    path.push('.');
+                    path.push_str(name);
+                }
+                PathSegment::Index(index) => path.push_str(&format!("[{index}]")),
+            }
+        }
+        path
     }
 
-    obj
+    fn reject<E: serde::de::Error>(&mut self, message: String) -> E {
+        let error = E::custom(&message);
+        self.invalid_input = Some(message);
+        error
+    }
+}
+
+struct MsgpackValueSeed<'d, 'a> {
+    decoder: &'d mut MsgpackValueDecoder<'a>,
+}
+
+impl<'de> DeserializeSeed<'de> for MsgpackValueSeed<'_, '_> {
+    type Value = Value;
+
+    fn deserialize<D: Deserializer<'de>>(self, deserializer: D) -> Result<Value, D::Error> {
+        deserializer.deserialize_any(self)
+    }
+}
+
+// Implements the same visit methods as `NxValue`'s visitor so integer widths and other
+// forwarded cases map identically.
+impl<'de> Visitor<'de> for MsgpackValueSeed<'_, '_> {
+    type Value = Value;
+
+    fn expecting(&self, formatter: &mut fmt::Formatter<'_>) -> fmt::Result {
+        formatter.write_str("a JSON-like value")
+    }
+
+    fn visit_unit<E: serde::de::Error>(self) -> Result<Value, E> {
+        Ok(Value::Null)
+    }
+
+    fn visit_none<E: serde::de::Error>(self) -> Result<Value, E> {
+        Ok(Value::Null)
+    }
+
+    fn visit_bool<E: serde::de::Error>(self, v: bool) -> Result<Value, E> {
+        Ok(Value::Boolean(v))
+    }
+
+    fn visit_i32<E: serde::de::Error>(self, v: i32) -> Result<Value, E> {
+        Ok(Value::Int32(v))
+    }
+
+    fn visit_i64<E: serde::de::Error>(self, v: i64) -> Result<Value, E> {
+        Ok(Value::Int(v))
+    }
+
+    fn visit_u64<E: serde::de::Error>(self, v: u64) -> Result<Value, E> {
+        Ok(i64::try_from(v).map_or(Value::Float(v as f64), Value::Int))
+    }
+
+    fn visit_f32<E: serde::de::Error>(self, v: f32) -> Result<Value, E> {
+        Ok(Value::Float32(v))
+    }
+
+    fn visit_f64<E: serde::de::Error>(self, v: f64) -> Result<Value, E> {
+        Ok(Value::Float(v))
+    }
+
+    fn visit_str<E: serde::de::Error>(self, v: &str) -> Result<Value, E> {
+        Ok(Value::String(SmolStr::new(v)))
+    }
+
+    fn visit_seq<A: SeqAccess<'de>>(self, mut seq: A) -> Result<Value, A::Error> {
+        let mut values = Vec::with_capacity(seq.size_hint().unwrap_or(0).min(4096));
+        loop {
+            self.decoder.path.push(PathSegment::Index(values.len()));
+            let value = seq.next_element_seed(MsgpackValueSeed {
+                decoder: &mut *self.decoder,
+            })?;
+            self.decoder.path.pop();
+            match value {
+                Some(value) => values.push(value),
+                None => break,
+            }
+        }
+        Ok(Value::Array(values.into()))
+    }
+
+    fn visit_map<A: MapAccess<'de>>(self, mut map: A) -> Result<Value, A::Error> {
+        let mut type_name = None::<SmolStr>;
+        let mut fields = Vec::with_capacity(map.size_hint().unwrap_or(0).min(4096));
+        while let Some(key) = map.next_key_seed(MsgpackKeySeed)? {
+            self.decoder.path.push(PathSegment::Field(key.clone()));
+            let value = map.next_value_seed(MsgpackValueSeed {
+                decoder: &mut *self.decoder,
+            })?;
+            self.decoder.path.pop();
+
+            if key == "$type" {
+                match value {
+                    Value::String(name) => type_name = Some(name),
+                    other => {
+                        // Matches the message of the `NxValue` decoder, which the two-step path
+                        // reports as a MessagePack decode failure.
+                        return Err(self.decoder.reject(format!(
+                            "messagepack decode failed: expected \"$type\" to be a string, got {:?}",
+                            to_nx_value(&other)
+                        )));
+                    }
+                }
+                continue;
+            }
+            fields.push((key, value));
+        }
+
+        if let Some(type_name) = &type_name {
+            if (self.decoder.is_output_only_type)(type_name) {
+                let path = self.decoder.path_string();
+                return Err(self.decoder.reject(format!(
+                    "NxValue at {path} uses component type '{type_name}', but component values \
+                     are output-only and cannot be provided as host input"
+                )));
+            }
+            if type_name == "ActionHandler" {
+                let path = self.decoder.path_string();
+                return Err(self
+                    .decoder
+                    .reject(FromNxValueError::unsupported_action_handler(&path).to_string()));
+            }
+        }
+
+        Ok(Value::Record {
+            type_name: type_name
+                .as_deref()
+                .map_or_else(|| Name::new("object"), Name::external),
+            fields: fields.into_iter().collect(),
+        })
+    }
+}
+
+/// Reads a record key into a [`SmolStr`] without an intermediate owned `String`.
+struct MsgpackKeySeed;
+
+impl<'de> DeserializeSeed<'de> for MsgpackKeySeed {
+    type Value = SmolStr;
+
+    fn deserialize<D: Deserializer<'de>>(self, deserializer: D) -> Result<SmolStr, D::Error> {
+        deserializer.deserialize_str(self)
+    }
+}
+
+impl<'de> Visitor<'de> for MsgpackKeySeed {
+    type Value = SmolStr;
+
+    fn expecting(&self, formatter: &mut fmt::Formatter<'_>) -> fmt::Result {
+        formatter.write_str("a string key")
+    }
+
+    fn visit_str<E: serde::de::Error>(self, v: &str) -> Result<SmolStr, E> {
+        Ok(SmolStr::new(v))
+    }
+}
+
+fn fields_to_properties(fields: &RecordFields) -> BTreeMap<String, NxValue> {
+    // Record layouts keep fields sorted by name, so this builds the map from sorted input.
+    fields
+        .iter()
+        .map(|(key, value)| (key.to_string(), to_nx_value(value)))
+        .collect()
 }
 
 #[cfg(test)]
@@ -181,12 +449,126 @@ mod tests {
     fn interpreter_enum_value_lowers_to_bare_authored_member_string() {
         let runtime = Value::EnumValue {
             type_name: Name::new("Status"),
-            member: SmolStr::new("active"),
+            member: Name::new("active"),
         };
 
         assert_eq!(to_nx_value(&runtime), NxValue::String("active".to_string()));
     }
 
+    #[test]
+    fn nx_value_view_serializes_like_converted_nx_value() {
+        let runtime = Value::Record {
+            type_name: Name::new("Panel"),
+            fields: [
+                (SmolStr::new("title"), Value::String(SmolStr::new("Docs"))),
+                (SmolStr::new("count"), Value::Int32(-3)),
+                (SmolStr::new("ratio"), Value::Float32(0.25)),
+                (
+                    SmolStr::new("status"),
+                    Value::EnumValue {
+                        type_name: Name::new("Status"),
+                        member: Name::new("active"),
+                    },
+                ),
+                (
+                    SmolStr::new("items"),
+                    Value::Array(vec![Value::Null, Value::Boolean(true), Value::Float(1.5)].into()),
+                ),
+            ]
+            .into_iter()
+            .collect(),
+        };
+        let expected = to_nx_value(&runtime);
+
+        assert_eq!(
+            rmp_serde::to_vec(&NxValueView::new(&runtime)).unwrap(),
+            expected.to_msgpack_vec().unwrap()
+        );
+        assert_eq!(
+            rmp_serde::to_vec_named(&NxValueView::new(&runtime)).unwrap(),
+            rmp_serde::to_vec_named(&expected).unwrap()
+        );
+    }
+
+    #[test]
+    fn value_from_msgpack_slice_matches_two_step_conversion() {
+        let value = NxValue::Record {
+            type_name: Some("Row".to_string()),
+            properties: BTreeMap::from([
+                ("id".to_string(), NxValue::Int(7)),
+                ("big".to_string(), NxValue::Int32(-70_000)),
+                ("score".to_string(), NxValue::Float32(0.5)),
+                (
+                    "tags".to_string(),
+                    NxValue::Array(vec![
+                        NxValue::String("a".to_string()),
+                        NxValue::Null,
+                        NxValue::Bool(false),
+                    ]),
+                ),
+                (
+                    "nested".to_string(),
+                    NxValue::Record {
+                        type_name: None,
+                        properties: BTreeMap::from([(
+                            "label".to_string(),
+                            NxValue::String("a label longer than the inline limit".to_string()),
+                        )]),
+                    },
+                ),
+            ]),
+        };
+        let bytes = value.to_msgpack_vec().unwrap();
+
+        assert_eq!(
+            value_from_msgpack_slice(&bytes, &|_| false).unwrap(),
+            from_nx_value(&value).unwrap()
+        );
+    }
+
+    #[test]
+    fn value_from_msgpack_slice_reports_rejected_records_with_paths() {
+        let handler = NxValue::Record {
+            type_name: Some("ActionHandler".to_string()),
+            properties: BTreeMap::new(),
+        };
+        let value = NxValue::Record {
+            type_name: None,
+            properties: BTreeMap::from([(
+                "rows".to_string(),
+                NxValue::Array(vec![NxValue::Null, handler]),
+            )]),
+        };
+        let bytes = value.to_msgpack_vec().unwrap();
+
+        assert_eq!(
+            value_from_msgpack_slice(&bytes, &|_| false).unwrap_err(),
+            from_nx_value(&value).unwrap_err().to_string()
+        );
+        assert!(
+            value_from_msgpack_slice(&bytes, &|name| name == "ActionHandler")
+                .unwrap_err()
+                .contains("NxValue at $.rows[1] uses component type 'ActionHandler'")
+        );
+    }
+
+    #[test]
+    fn value_from_msgpack_slice_reports_non_string_type_like_two_step_conversion() {
+        let bytes = rmp_serde::to_vec_named(&BTreeMap::from([
+            ("$type", NxValue::Int(3)),
+            ("id", NxValue::Int(7)),
+        ]))
+        .unwrap();
+        let two_step_error = NxValue::from_msgpack_slice(&bytes)
+            .map_err(|error| format!("messagepack decode failed: {error}"))
+            .unwrap_err();
+
+        assert_eq!(
+            value_from_msgpack_slice(&bytes, &|_| false).unwrap_err(),
+            two_step_error
+        );
+    }
+
     #[test]
     fn from_nx_value_rejects_action_handler_records() {
         let value = NxValue::Record {
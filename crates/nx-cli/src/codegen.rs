@@ -20,6 +20,8 @@ pub struct GenerateTypesOptions {
     pub language: TargetLanguage,
     pub csharp_namespace: Option<String>,
     pub typescript_package_prefix: Option<String>,
+    /// Also emit typed MessagePack encoders and decoders for the generated types.
+    pub serializers: bool,
     pub format: FormatOptions,
 }
 
@@ -173,6 +175,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -198,6 +201,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -225,6 +229,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -248,6 +253,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -274,6 +280,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -298,6 +305,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -323,6 +331,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -352,6 +361,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -377,6 +387,108 @@ mod tests {
         assert!(output.contains("export type UiEvent = UiEventClicked | UiEventClosed;"));
     }
 
+    #[test]
+    fn generates_typescript_message_pack_codecs_when_serializers_are_enabled() {
+        let source = r#"
+            export enum Theme = | light | dark
+            export type Person = { name:string age:int? theme:Theme tags:string[] }
+            export type LoadState =
+              | idle
+              | failed { message:string retryable:bool = true attempts:int = -1 label:string = "Retry" }
+        "#;
+        let module = lower_module(source, "types.nx");
+        let opts = GenerateTypesOptions {
+            language: TargetLanguage::TypeScript,
+            csharp_namespace: None,
+            typescript_package_prefix: None,
+            serializers: true,
+            format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
+        };
+
+        let output = generate_types(&module, Path::new("types.nx"), &opts).unwrap();
+
+        assert!(output.contains("export class NxMessagePackReader {"));
+        assert!(output.contains("export class NxMessagePackWriter {"));
+        assert!(
+            output.contains("export function decodePerson(reader: NxMessagePackReader): Person {")
+        );
+        assert!(output.contains("const value = { $type: \"Person\" } as Person;"));
+        assert!(output.contains("value.age = reader.tryReadNil() ? null : reader.readInteger();"));
+        assert!(output.contains("value.theme = reader.readString() as Person[\"theme\"];"));
+        assert!(output.contains("value.tags = reader.readArray(() => reader.readString());"));
+        assert!(output.contains(
+            "export function encodePerson(writer: NxMessagePackWriter, value: Person): void {"
+        ));
+        assert!(output.contains("writer.writeMapHeader(5);"));
+        assert!(output.contains("writer.writeString(value.$type);"));
+        assert!(output
+            .contains("value.age == null ? writer.writeNil() : writer.writeInteger(value.age);"));
+        assert!(
+            output.contains("writer.writeArray(value.tags, (item0) => writer.writeString(item0));")
+        );
+        assert!(output.contains(
+            "const value = { $type: \"LoadState.failed\", retryable: true, attempts: -1, label: \"Retry\" } as LoadStateFailed;"
+        ));
+        assert!(output.contains("const discriminator = reader.peekDiscriminator();"));
+        assert!(output.contains("return decodeLoadStateFailed(reader);"));
+        assert!(output.contains("encodeLoadStateIdle(writer, value);"));
+        assert!(!output.contains("decodeTheme"));
+    }
+
+    #[test]
+    fn generates_typescript_library_codecs_with_cross_module_imports() {
+        let temp_dir = TempDir::new().expect("temp dir");
+        let library_dir = temp_dir.path().join("ui");
+        fs::create_dir_all(&library_dir).expect("library dir");
+        fs::write(
+            library_dir.join("items.nx"),
+            "export type Item = { name:string }",
+        )
+        .expect("items file");
+        fs::write(
+            library_dir.join("state.nx"),
+            "export type LoadState = | loaded { items:Item[] }",
+        )
+        .expect("state file");
+
+        let artifact = build_library_artifact_from_directory(&library_dir).expect("library build");
+        let opts = GenerateTypesOptions {
+            language: TargetLanguage::TypeScript,
+            csharp_namespace: None,
+            typescript_package_prefix: None,
+            serializers: true,
+            format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
+        };
+
+        let files = generate_library_types(&artifact, &opts).unwrap();
+        let file = |name: &str| {
+            files
+                .iter()
+                .find(|file| file.relative_path == PathBuf::from(name))
+                .unwrap_or_else(|| panic!("{name}"))
+        };
+
+        let state = file("state.ts");
+        assert!(state.content.contains(
+            "import type { NxMessagePackReader, NxMessagePackWriter, NxRecord } from \"./_nx\";"
+        ));
+        assert!(state
+            .content
+            .contains("import { decodeItem, encodeItem } from \"./items\";"));
+        assert!(state
+            .content
+            .contains("value.items = reader.readArray(() => decodeItem(reader));"));
+        assert!(state
+            .content
+            .contains("writer.writeArray(value.items, (item0) => encodeItem(writer, item0));"));
+        assert!(file("_nx.ts")
+            .content
+            .contains("export class NxMessagePackReader {"));
+        assert!(file("index.ts")
+            .content
+            .contains("export { NxMessagePackReader, NxMessagePackWriter } from \"./_nx\";"));
+    }
+
     #[test]
     fn generates_csharp_alias_only_output_without_global_usings() {
         let source = r#"
@@ -388,6 +500,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -408,6 +521,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -429,6 +543,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -447,6 +562,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -476,6 +592,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -521,6 +638,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -562,6 +680,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -603,6 +722,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -644,6 +764,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -668,6 +789,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -704,6 +826,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -734,6 +857,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -764,6 +888,46 @@ mod tests {
         assert!(output.contains("public string Source { get; set; } = default!;"));
     }
 
+    #[test]
+    fn generates_csharp_message_pack_formatters_when_serializers_are_enabled() {
+        let source = r#"
+            export enum Theme = | light | dark
+            export type Person = { name:string age:int? theme:Theme }
+            export type LoadState =
+              | idle
+              | failed { message:string retryable:bool = true }
+        "#;
+        let module = lower_module(source, "types.nx");
+        let opts = GenerateTypesOptions {
+            language: TargetLanguage::CSharp,
+            csharp_namespace: Some("Test.Models".to_string()),
+            typescript_package_prefix: None,
+            serializers: true,
+            format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
+        };
+
+        let output = generate_types(&module, Path::new("types.nx"), &opts).unwrap();
+
+        assert!(output.contains("using MessagePack.Formatters;"));
+        assert!(output.contains("[MessagePackFormatter(typeof(PersonMessagePackFormatter))]"));
+        assert!(output.contains(
+            "internal sealed class PersonMessagePackFormatter : IMessagePackFormatter<Person>"
+        ));
+        assert!(output.contains("writer.WriteString(\"$type\"u8);"));
+        assert!(output.contains("result.Age = reader.TryReadNil() ? null : reader.ReadInt64();"));
+        assert!(output.contains(
+            "result.Theme = options.Resolver.GetFormatterWithVerify<Theme>().Deserialize(ref reader, options);"
+        ));
+        assert!(output.contains("[MessagePackFormatter(typeof(LoadStateMessagePackFormatter))]"));
+        assert!(output.contains(
+            "[MessagePackFormatter(typeof(NxPolymorphicConcreteMessagePackFormatter<LoadState, LoadStateFailed, LoadStateMessagePackFormatter>))]"
+        ));
+        assert!(output.contains("if (discriminator.SequenceEqual(\"LoadState.failed\"u8))"));
+        assert!(output.contains("return ReadLoadStateFailed(ref reader, count, options);"));
+        assert!(!output.contains("[MessagePackObject]"));
+        assert!(!output.contains("NxPolymorphicMessagePackFormatter<LoadState>"));
+    }
+
     #[test]
     fn generates_typescript_library_files_for_nested_modules() {
         let temp_dir = TempDir::new().expect("temp dir");
@@ -785,6 +949,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -829,6 +994,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -890,6 +1056,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -946,6 +1113,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -1002,6 +1170,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -1061,6 +1230,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1104,6 +1274,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1125,6 +1296,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1158,6 +1330,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1200,6 +1373,7 @@ mod tests {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -1224,6 +1398,7 @@ mod tests {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1267,6 +1442,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models.ChatLink".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1291,6 +1467,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1323,6 +1500,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1358,6 +1536,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1380,6 +1559,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1442,6 +1622,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1482,6 +1663,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1531,6 +1713,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models.ChatLink".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1584,6 +1767,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models.ChatLink".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1635,6 +1819,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models.ChatLink".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
@@ -1686,6 +1871,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: Some("@org/nx-".to_string()),
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -1735,6 +1921,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: Some("@org/nx-".to_string()),
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -1785,6 +1972,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: Some("@org/nx-".to_string()),
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -1833,6 +2021,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -1881,6 +2070,7 @@ export type ChatLink = {
             language: TargetLanguage::TypeScript,
             csharp_namespace: None,
             typescript_package_prefix: Some("@org/nx-".to_string()),
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::TypeScript),
         };
 
@@ -1933,6 +2123,7 @@ export type QuestionFlowInitialExperience = {
             language: TargetLanguage::CSharp,
             csharp_namespace: Some("Test.Models.ChatLink".to_string()),
             typescript_package_prefix: None,
+            serializers: false,
             format: options::FormatOptions::defaults_for(TargetLanguage::CSharp),
         };
 
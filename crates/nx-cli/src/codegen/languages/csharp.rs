@@ -121,6 +121,7 @@ fn render_module(
         graph,
         imported_types_by_visible_name: &imported_type_lookup,
         qualify_generated_types: false,
+        generate_formatters: opts.serializers,
     };
 
     let needs_enum_serialization_helpers = module
@@ -137,10 +138,20 @@ fn render_module(
             }
     });
 
+    let needs_generated_formatters = body_items.iter().any(|declaration| {
+        declaration_has_generated_formatter(&declaration.item, &namespace_context)
+    });
+
     writer.line("using System;");
     writer.line("using System.Text.Json.Serialization;");
     writer.line("using MessagePack;");
-    if needs_enum_serialization_helpers || needs_polymorphic_serialization_helpers {
+    if needs_generated_formatters {
+        writer.line("using MessagePack.Formatters;");
+    }
+    if needs_enum_serialization_helpers
+        || needs_polymorphic_serialization_helpers
+        || needs_generated_formatters
+    {
         writer.line("using NxLang.Nx.Serialization;");
     }
 
@@ -220,10 +231,13 @@ fn emit_record(
 ) {
     emit_record_json_polymorphism_attributes(writer, record, context);
 
+    let safe_name = sanitize_csharp_identifier(&record.name);
+    let formatter = generated_record_formatter(record, context);
     let polymorphic_root = polymorphic_message_pack_root_name(record, context);
-    if let Some(root_name) = polymorphic_root.as_ref() {
+    if let Some(formatter) = formatter.as_ref() {
+        emit_generated_formatter_attribute(writer, &safe_name, formatter);
+    } else if let Some(root_name) = polymorphic_root.as_ref() {
         let safe_root = sanitize_csharp_identifier(root_name);
-        let safe_name = sanitize_csharp_identifier(&record.name);
         if root_name == &record.name {
             writer.line(&format!(
                 "[MessagePackFormatter(typeof(NxPolymorphicMessagePackFormatter<{safe_root}>))]"
@@ -242,7 +256,7 @@ fn emit_record(
         writer.line("// no concrete exported descendants at code-generation time.");
     }
 
-    if polymorphic_root.is_none() {
+    if polymorphic_root.is_none() && formatter.is_none() {
         writer.line("[MessagePackObject]");
     }
     let class_modifier = if record.is_abstract {
@@ -268,6 +282,10 @@ fn emit_record(
     writer.block(&header, |writer| {
         emit_record_fields(writer, &record.fields, context);
     });
+
+    if let Some(formatter) = formatter.as_ref() {
+        emit_generated_formatter(writer, &safe_name, formatter, context);
+    }
 }
 
 fn emit_union(
@@ -286,9 +304,14 @@ fn emit_union(
             escape_csharp_string_literal(&case.name)
         ));
     }
-    writer.line(&format!(
-        "[MessagePackFormatter(typeof(NxPolymorphicMessagePackFormatter<{union_name}>))]"
-    ));
+    let formatter = generated_union_formatter(union_def, context);
+    if let Some(formatter) = formatter.as_ref() {
+        emit_generated_formatter_attribute(writer, &union_name, formatter);
+    } else {
+        writer.line(&format!(
+            "[MessagePackFormatter(typeof(NxPolymorphicMessagePackFormatter<{union_name}>))]"
+        ));
+    }
 
     let header = if let Some(base) = &union_def.base {
         format!(
@@ -301,9 +324,13 @@ fn emit_union(
 
     writer.block(&header, |_| {});
 
+    if let Some(formatter) = formatter.as_ref() {
+        emit_generated_formatter(writer, &union_name, formatter, context);
+    }
+
     for case in &union_def.cases {
         writer.blank_line();
-        emit_union_case(writer, union_def, case, context);
+        emit_union_case(writer, union_def, case, formatter.is_some(), context);
     }
 }
 
@@ -311,14 +338,25 @@ fn emit_union_case(
     writer: &mut CodeWriter,
     union_def: &ExportedUnion,
     case: &ExportedUnionCase,
+    has_generated_formatter: bool,
     context: &CSharpRenderContext<'_>,
 ) {
     let union_name = sanitize_csharp_identifier(&union_def.name);
     let case_type_name = csharp_union_case_type_name(&union_def.name, &case.name);
 
-    writer.line(&format!(
-        "[MessagePackFormatter(typeof(NxPolymorphicConcreteMessagePackFormatter<{union_name}, {case_type_name}>))]"
-    ));
+    if has_generated_formatter {
+        emit_generated_formatter_attribute(
+            writer,
+            &case_type_name,
+            &GeneratedFormatter::PolymorphicMember {
+                root_name: union_def.name.clone(),
+            },
+        );
+    } else {
+        writer.line(&format!(
+            "[MessagePackFormatter(typeof(NxPolymorphicConcreteMessagePackFormatter<{union_name}, {case_type_name}>))]"
+        ));
+    }
     writer.block(
         &format!("public sealed class {case_type_name} : {union_name}"),
         |writer| {
@@ -332,16 +370,24 @@ fn emit_external_state(
     state: &ExportedExternalState,
     context: &CSharpRenderContext<'_>,
 ) {
-    writer.line("[MessagePackObject]");
-    writer.block(
-        &format!(
-            "public sealed class {}",
-            sanitize_csharp_identifier(&state.name)
-        ),
-        |writer| {
-            emit_record_fields(writer, &state.fields, context);
-        },
-    );
+    let state_name = sanitize_csharp_identifier(&state.name);
+    let formatter = context
+        .generate_formatters
+        .then(|| GeneratedFormatter::Plain {
+            fields: state.fields.clone(),
+        });
+    if let Some(formatter) = formatter.as_ref() {
+        emit_generated_formatter_attribute(writer, &state_name, formatter);
+    } else {
+        writer.line("[MessagePackObject]");
+    }
+    writer.block(&format!("public sealed class {state_name}"), |writer| {
+        emit_record_fields(writer, &state.fields, context);
+    });
+
+    if let Some(formatter) = formatter.as_ref() {
+        emit_generated_formatter(writer, &state_name, formatter, context);
+    }
 }
 
 fn emit_record_json_polymorphism_attributes(
@@ -499,6 +545,460 @@ fn emit_enum_wire_format(writer: &mut CodeWriter, enum_def: &ExportedEnum) {
     );
 }
 
+/// MessagePack formatter generated for a type when `--serializers` is requested.
+///
+/// Generated formatters read and write the same canonical maps as `[MessagePackObject]` and the
+/// reflection-based polymorphic formatters, but with field access compiled in: keys are matched as
+/// UTF-8 spans and primitive fields never go through a resolver lookup.
+enum GeneratedFormatter {
+    /// A map of the type's fields.
+    Plain { fields: Vec<ExportedRecordField> },
+    /// A polymorphic root that dispatches on the `$type` discriminator.
+    PolymorphicRoot {
+        cases: Vec<PolymorphicFormatterCase>,
+    },
+    /// A type below a generated polymorphic root, encoded through the root's formatter.
+    PolymorphicMember { root_name: String },
+}
+
+struct PolymorphicFormatterCase {
+    type_name: String,
+    discriminator: String,
+    fields: Vec<ExportedRecordField>,
+}
+
+fn declaration_has_generated_formatter(
+    declaration: &ExportedType,
+    context: &CSharpRenderContext<'_>,
+) -> bool {
+    match declaration {
+        ExportedType::Alias(_) | ExportedType::Enum(_) => false,
+        ExportedType::Union(union_def) => generated_union_formatter(union_def, context).is_some(),
+        ExportedType::Record(record) => generated_record_formatter(record, context).is_some(),
+        ExportedType::ExternalState(_) => context.generate_formatters,
+    }
+}
+
+/// Returns `None` when formatters are not requested or when some inherited fields live outside
+/// the type graph, in which case the record keeps the reflection-based metadata.
+fn generated_record_formatter(
+    record: &ExportedRecord,
+    context: &CSharpRenderContext<'_>,
+) -> Option<GeneratedFormatter> {
+    if !context.generate_formatters {
+        return None;
+    }
+
+    if let Some(root_name) = polymorphic_message_pack_root_name(record, context) {
+        let root = context.graph.record(&root_name)?;
+        let cases = record_polymorphic_formatter_cases(root, context)?;
+        return Some(if root_name == record.name {
+            GeneratedFormatter::PolymorphicRoot { cases }
+        } else {
+            GeneratedFormatter::PolymorphicMember { root_name }
+        });
+    }
+
+    if record.is_abstract || record.base.is_some() {
+        return None;
+    }
+
+    Some(GeneratedFormatter::Plain {
+        fields: record.fields.clone(),
+    })
+}
+
+fn generated_union_formatter(
+    union_def: &ExportedUnion,
+    context: &CSharpRenderContext<'_>,
+) -> Option<GeneratedFormatter> {
+    if !context.generate_formatters {
+        return None;
+    }
+
+    let cases = union_def
+        .cases
+        .iter()
+        .map(|case| {
+            Some(PolymorphicFormatterCase {
+                type_name: csharp_union_case_type_name(&union_def.name, &case.name),
+                discriminator: format!("{}.{}", union_def.name, case.name),
+                fields: union_case_wire_fields(union_def, case, context.graph)?,
+            })
+        })
+        .collect::<Option<Vec<_>>>()?;
+    Some(GeneratedFormatter::PolymorphicRoot { cases })
+}
+
+fn record_polymorphic_formatter_cases(
+    root: &ExportedRecord,
+    context: &CSharpRenderContext<'_>,
+) -> Option<Vec<PolymorphicFormatterCase>> {
+    let graph = context.graph;
+    graph
+        .polymorphic_descendants(&root.name)
+        .iter()
+        .map(|descendant| {
+            let fields = match descendant {
+                ExportedPolymorphicDescendant::Record { name } => {
+                    let record = graph.record(name)?;
+                    let mut fields = graph.inherited_record_fields(record.base.as_deref())?;
+                    fields.extend(record.fields.iter().cloned());
+                    fields
+                }
+                ExportedPolymorphicDescendant::UnionCase {
+                    union_name,
+                    case_name,
+                } => {
+                    let ExportedType::Union(union_def) = &graph.declaration(union_name)?.item
+                    else {
+                        return None;
+                    };
+                    let case = union_def
+                        .cases
+                        .iter()
+                        .find(|case| &case.name == case_name)?;
+                    union_case_wire_fields(union_def, case, graph)?
+                }
+            };
+            let (type_name, discriminator) = csharp_polymorphic_descendant_metadata(descendant);
+            Some(PolymorphicFormatterCase {
+                type_name,
+                discriminator,
+                fields,
+            })
+        })
+        .collect()
+}
+
+fn union_case_wire_fields(
+    union_def: &ExportedUnion,
+    case: &ExportedUnionCase,
+    graph: &ExportedTypeGraph,
+) -> Option<Vec<ExportedRecordField>> {
+    let mut fields = graph.inherited_record_fields(union_def.base.as_deref())?;
+    fields.extend(case.fields.iter().cloned());
+    Some(fields)
+}
+
+fn emit_generated_formatter_attribute(
+    writer: &mut CodeWriter,
+    type_name: &str,
+    formatter: &GeneratedFormatter,
+) {
+    match formatter {
+        GeneratedFormatter::Plain { .. } | GeneratedFormatter::PolymorphicRoot { .. } => {
+            writer.line(&format!(
+                "[MessagePackFormatter(typeof({type_name}MessagePackFormatter))]"
+            ));
+        }
+        GeneratedFormatter::PolymorphicMember { root_name } => {
+            let safe_root = sanitize_csharp_identifier(root_name);
+            writer.line(&format!(
+                "[MessagePackFormatter(typeof(NxPolymorphicConcreteMessagePackFormatter<{safe_root}, {type_name}, {safe_root}MessagePackFormatter>))]"
+            ));
+        }
+    }
+}
+
+fn emit_generated_formatter(
+    writer: &mut CodeWriter,
+    type_name: &str,
+    formatter: &GeneratedFormatter,
+    context: &CSharpRenderContext<'_>,
+) {
+    match formatter {
+        GeneratedFormatter::Plain { fields } => {
+            writer.blank_line();
+            emit_plain_message_pack_formatter(writer, type_name, fields, context);
+        }
+        GeneratedFormatter::PolymorphicRoot { cases } => {
+            writer.blank_line();
+            emit_polymorphic_message_pack_formatter(writer, type_name, cases, context);
+        }
+        GeneratedFormatter::PolymorphicMember { .. } => {}
+    }
+}
+
+fn emit_plain_message_pack_formatter(
+    writer: &mut CodeWriter,
+    type_name: &str,
+    fields: &[ExportedRecordField],
+    context: &CSharpRenderContext<'_>,
+) {
+    writer.block(
+        &format!(
+            "internal sealed class {type_name}MessagePackFormatter : IMessagePackFormatter<{type_name}>"
+        ),
+        |writer| {
+            writer.block(
+                &format!(
+                    "public void Serialize(ref MessagePackWriter writer, {type_name} value, MessagePackSerializerOptions options)"
+                ),
+                |writer| {
+                    writer.block("if (value is null)", |writer| {
+                        writer.line("writer.WriteNil();");
+                        writer.line("return;");
+                    });
+                    writer.blank_line();
+                    emit_message_pack_map_write(writer, None, fields, context);
+                },
+            );
+
+            writer.blank_line();
+
+            writer.block(
+                &format!(
+                    "public {type_name} Deserialize(ref MessagePackReader reader, MessagePackSerializerOptions options)"
+                ),
+                |writer| {
+                    writer.block("if (reader.TryReadNil())", |writer| {
+                        writer.line("return null!;");
+                    });
+                    writer.blank_line();
+                    writer.line("options.Security.DepthStep(ref reader);");
+                    writer.block("try", |writer| {
+                        writer.line("int count = reader.ReadMapHeader();");
+                        emit_message_pack_map_read(writer, type_name, fields, context);
+                    });
+                    writer.block("finally", |writer| {
+                        writer.line("reader.Depth--;");
+                    });
+                },
+            );
+        },
+    );
+}
+
+fn emit_polymorphic_message_pack_formatter(
+    writer: &mut CodeWriter,
+    type_name: &str,
+    cases: &[PolymorphicFormatterCase],
+    context: &CSharpRenderContext<'_>,
+) {
+    writer.block(
+        &format!(
+            "internal sealed class {type_name}MessagePackFormatter : IMessagePackFormatter<{type_name}>"
+        ),
+        |writer| {
+            writer.block(
+                &format!(
+                    "public void Serialize(ref MessagePackWriter writer, {type_name} value, MessagePackSerializerOptions options)"
+                ),
+                |writer| {
+                    writer.block("switch (value)", |writer| {
+                        writer.line("case null:");
+                        writer.indent();
+                        writer.line("writer.WriteNil();");
+                        writer.line("break;");
+                        writer.dedent();
+                        for case in cases {
+                            writer.line(&format!("case {} typed:", case.type_name));
+                            writer.indent();
+                            writer.line(&format!(
+                                "Write{}(ref writer, typed, options);",
+                                case.type_name
+                            ));
+                            writer.line("break;");
+                            writer.dedent();
+                        }
+                        writer.line("default:");
+                        writer.indent();
+                        writer.line(&format!(
+                            "throw NxMessagePackFormatterHelpers.UnregisteredType(typeof({type_name}), value.GetType());"
+                        ));
+                        writer.dedent();
+                    });
+                },
+            );
+
+            writer.blank_line();
+
+            writer.block(
+                &format!(
+                    "public {type_name} Deserialize(ref MessagePackReader reader, MessagePackSerializerOptions options)"
+                ),
+                |writer| {
+                    writer.block("if (reader.TryReadNil())", |writer| {
+                        writer.line("return null!;");
+                    });
+                    writer.blank_line();
+                    writer.line("options.Security.DepthStep(ref reader);");
+                    writer.block("try", |writer| {
+                        writer.line("int count = reader.ReadMapHeader();");
+                        writer.line("MessagePackReader peek = reader.CreatePeekReader();");
+                        writer.line(&format!(
+                            "ReadOnlySpan<byte> discriminator = NxMessagePackFormatterHelpers.FindDiscriminator(ref peek, count, typeof({type_name}));"
+                        ));
+                        for case in cases {
+                            writer.block(
+                                &format!(
+                                    "if (discriminator.SequenceEqual(\"{}\"u8))",
+                                    escape_csharp_string_literal(&case.discriminator)
+                                ),
+                                |writer| {
+                                    writer.line(&format!(
+                                        "return Read{}(ref reader, count, options);",
+                                        case.type_name
+                                    ));
+                                },
+                            );
+                        }
+                        writer.line(&format!(
+                            "throw NxMessagePackFormatterHelpers.UnknownDiscriminator(discriminator, typeof({type_name}));"
+                        ));
+                    });
+                    writer.block("finally", |writer| {
+                        writer.line("reader.Depth--;");
+                    });
+                },
+            );
+
+            for case in cases {
+                let case_type = &case.type_name;
+                writer.blank_line();
+                writer.block(
+                    &format!(
+                        "private static void Write{case_type}(ref MessagePackWriter writer, {case_type} value, MessagePackSerializerOptions options)"
+                    ),
+                    |writer| {
+                        emit_message_pack_map_write(
+                            writer,
+                            Some(&case.discriminator),
+                            &case.fields,
+                            context,
+                        );
+                    },
+                );
+                writer.blank_line();
+                writer.block(
+                    &format!(
+                        "private static {case_type} Read{case_type}(ref MessagePackReader reader, int count, MessagePackSerializerOptions options)"
+                    ),
+                    |writer| {
+                        emit_message_pack_map_read(writer, case_type, &case.fields, context);
+                    },
+                );
+            }
+        },
+    );
+}
+
+fn emit_message_pack_map_write(
+    writer: &mut CodeWriter,
+    discriminator: Option<&str>,
+    fields: &[ExportedRecordField],
+    context: &CSharpRenderContext<'_>,
+) {
+    writer.line(&format!(
+        "writer.WriteMapHeader({});",
+        fields.len() + usize::from(discriminator.is_some())
+    ));
+    if let Some(discriminator) = discriminator {
+        writer.line("writer.WriteString(\"$type\"u8);");
+        writer.line(&format!(
+            "writer.WriteString(\"{}\"u8);",
+            escape_csharp_string_literal(discriminator)
+        ));
+    }
+
+    for field in fields {
+        writer.line(&format!(
+            "writer.WriteString(\"{}\"u8);",
+            escape_csharp_string_literal(&field.name)
+        ));
+        let value = format!("value.{}", sanitize_csharp_member_name(&field.name));
+        let field_type = csharp_type(&field.ty, context);
+        match message_pack_primitive_read_method(&field_type) {
+            Some(method) if method != "ReadString" && field_type.is_nullable => {
+                writer.block(&format!("if ({value}.HasValue)"), |writer| {
+                    writer.line(&format!("writer.Write({value}.GetValueOrDefault());"));
+                });
+                writer.block("else", |writer| {
+                    writer.line("writer.WriteNil();");
+                });
+            }
+            Some(_) => writer.line(&format!("writer.Write({value});")),
+            None => writer.line(&format!(
+                "options.Resolver.GetFormatterWithVerify<{}>().Serialize(ref writer, {value}, options);",
+                field_type.text
+            )),
+        }
+    }
+}
+
+fn emit_message_pack_map_read(
+    writer: &mut CodeWriter,
+    type_name: &str,
+    fields: &[ExportedRecordField],
+    context: &CSharpRenderContext<'_>,
+) {
+    writer.line(&format!("{type_name} result = new();"));
+    writer.block("for (int i = 0; i < count; i++)", |writer| {
+        if fields.is_empty() {
+            writer.line("reader.Skip();");
+            writer.line("reader.Skip();");
+            return;
+        }
+
+        writer.line("ReadOnlySpan<byte> key = NxMessagePackFormatterHelpers.ReadKey(ref reader);");
+        for (index, field) in fields.iter().enumerate() {
+            let keyword = if index == 0 { "if" } else { "else if" };
+            writer.block(
+                &format!(
+                    "{keyword} (key.SequenceEqual(\"{}\"u8))",
+                    escape_csharp_string_literal(&field.name)
+                ),
+                |writer| {
+                    writer.line(&format!(
+                        "result.{} = {};",
+                        sanitize_csharp_member_name(&field.name),
+                        message_pack_value_read(&csharp_type(&field.ty, context))
+                    ));
+                },
+            );
+        }
+        writer.block("else", |writer| {
+            writer.line("reader.Skip();");
+        });
+    });
+    writer.line("return result;");
+}
+
+fn message_pack_value_read(field_type: &CSharpType) -> String {
+    match message_pack_primitive_read_method(field_type) {
+        Some("ReadString") if field_type.is_nullable => "reader.ReadString()".to_string(),
+        Some("ReadString") => "reader.ReadString()!".to_string(),
+        Some(method) if field_type.is_nullable => {
+            format!("reader.TryReadNil() ? null : reader.{method}()")
+        }
+        Some(method) => format!("reader.{method}()"),
+        None => format!(
+            "options.Resolver.GetFormatterWithVerify<{}>().Deserialize(ref reader, options)",
+            field_type.text
+        ),
+    }
+}
+
+/// Fields of these types are read and written directly; everything else goes through the resolver.
+fn message_pack_primitive_read_method(field_type: &CSharpType) -> Option<&'static str> {
+    let text = if field_type.is_nullable {
+        field_type.text.strip_suffix('?')?
+    } else {
+        field_type.text.as_str()
+    };
+
+    match text {
+        "string" => Some("ReadString"),
+        "bool" => Some("ReadBoolean"),
+        "int" => Some("ReadInt32"),
+        "long" => Some("ReadInt64"),
+        "float" => Some("ReadSingle"),
+        "double" => Some("ReadDouble"),
+        _ => None,
+    }
+}
+
 #[derive(Clone, Debug)]
 struct CSharpType {
     text: String,
@@ -511,6 +1011,7 @@ struct CSharpRenderContext<'a> {
     graph: &'a ExportedTypeGraph,
     imported_types_by_visible_name: &'a FxHashMap<String, ImportedType>,
     qualify_generated_types: bool,
+    generate_formatters: bool,
 }
 
 fn graph_resolves_record_base(context: &CSharpRenderContext<'_>, record: &ExportedRecord) -> bool {
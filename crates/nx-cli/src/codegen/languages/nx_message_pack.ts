@@ -0,0 +1,601 @@
+const nxUtf8Decoder = new TextDecoder();
+const nxUtf8Encoder = new TextEncoder();
+const nxMinSafeInteger = BigInt(Number.MIN_SAFE_INTEGER);
+const nxMaxSafeInteger = BigInt(Number.MAX_SAFE_INTEGER);
+const nxMinInt64 = -(BigInt(1) << BigInt(63));
+const nxMaxInt64 = (BigInt(1) << BigInt(63)) - BigInt(1);
+
+/** Reads the canonical NX MessagePack wire format for generated decoders. */
+export class NxMessagePackReader {
+  private readonly bytes: Uint8Array;
+  private readonly view: DataView;
+  private offset = 0;
+
+  constructor(bytes: Uint8Array) {
+    this.bytes = bytes;
+    this.view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+  }
+
+  tryReadNil(): boolean {
+    if (this.offset >= this.bytes.length || this.view.getUint8(this.offset) !== 0xc0) {
+      return false;
+    }
+    this.offset += 1;
+    return true;
+  }
+
+  readBoolean(): boolean {
+    const byte = this.view.getUint8(this.offset++);
+    if (byte === 0xc2 || byte === 0xc3) {
+      return byte === 0xc3;
+    }
+    throw this.unexpected(byte, "a boolean");
+  }
+
+  /** Reads an NX `int`, throwing rather than rounding values beyond the safe integer range. */
+  readInteger(): number {
+    const at = this.offset;
+    const value = this.readIntegerValue();
+    if (typeof value === "bigint") {
+      throw new RangeError(
+        `NX MessagePack integer ${value} at offset ${at} is outside the safe JavaScript integer range.`,
+      );
+    }
+    return value;
+  }
+
+  /** Reads an NX `float`, which may also arrive as an integer. */
+  readNumber(): number {
+    const byte = this.view.getUint8(this.offset);
+    const at = this.offset + 1;
+    if (byte === 0xca) {
+      this.offset += 5;
+      return this.view.getFloat32(at);
+    }
+    if (byte === 0xcb) {
+      this.offset += 9;
+      return this.view.getFloat64(at);
+    }
+    return Number(this.readIntegerValue());
+  }
+
+  readString(): string {
+    const byte = this.view.getUint8(this.offset++);
+    let length: number;
+    if (byte >= 0xa0 && byte <= 0xbf) {
+      length = byte & 0x1f;
+    } else if (byte === 0xd9) {
+      length = this.view.getUint8(this.offset);
+      this.offset += 1;
+    } else if (byte === 0xda) {
+      length = this.view.getUint16(this.offset);
+      this.offset += 2;
+    } else if (byte === 0xdb) {
+      length = this.view.getUint32(this.offset);
+      this.offset += 4;
+    } else {
+      throw this.unexpected(byte, "a string");
+    }
+
+    const start = this.offset;
+    const end = start + length;
+    if (end > this.bytes.length) {
+      throw new RangeError("NX MessagePack string runs past the end of the payload.");
+    }
+    this.offset = end;
+    if (length <= 32) {
+      let text = "";
+      for (let index = start; index < end; index++) {
+        const code = this.view.getUint8(index);
+        if (code >= 0x80) {
+          return nxUtf8Decoder.decode(this.bytes.subarray(start, end));
+        }
+        text += String.fromCharCode(code);
+      }
+      return text;
+    }
+    return nxUtf8Decoder.decode(this.bytes.subarray(start, end));
+  }
+
+  /** Reads a map key. Non-string keys are skipped and read as "", which matches no NX field. */
+  readKey(): string {
+    const byte = this.view.getUint8(this.offset);
+    if ((byte >= 0xa0 && byte <= 0xbf) || (byte >= 0xd9 && byte <= 0xdb)) {
+      return this.readString();
+    }
+    this.skip();
+    return "";
+  }
+
+  readMapHeader(): number {
+    const byte = this.view.getUint8(this.offset++);
+    if (byte >= 0x80 && byte <= 0x8f) {
+      return byte & 0x0f;
+    }
+    const at = this.offset;
+    if (byte === 0xde) {
+      this.offset += 2;
+      return this.view.getUint16(at);
+    }
+    if (byte === 0xdf) {
+      this.offset += 4;
+      return this.view.getUint32(at);
+    }
+    throw this.unexpected(byte, "a map");
+  }
+
+  readArrayHeader(): number {
+    const byte = this.view.getUint8(this.offset++);
+    if (byte >= 0x90 && byte <= 0x9f) {
+      return byte & 0x0f;
+    }
+    const at = this.offset;
+    if (byte === 0xdc) {
+      this.offset += 2;
+      return this.view.getUint16(at);
+    }
+    if (byte === 0xdd) {
+      this.offset += 4;
+      return this.view.getUint32(at);
+    }
+    throw this.unexpected(byte, "an array");
+  }
+
+  readArray<T>(readItem: () => T): T[] {
+    const length = this.readArrayHeader();
+    const items = new Array<T>(length);
+    for (let index = 0; index < length; index++) {
+      items[index] = readItem();
+    }
+    return items;
+  }
+
+  /** Returns the `$type` discriminator of the map at the current position without consuming the map. */
+  peekDiscriminator(): string {
+    const start = this.offset;
+    try {
+      for (let count = this.readMapHeader(); count > 0; count--) {
+        if (this.readKey() === "$type") {
+          return this.readString();
+        }
+        this.skip();
+      }
+    } finally {
+      this.offset = start;
+    }
+    throw new Error("Expected an NX MessagePack map with a string '$type' key.");
+  }
+
+  /** Reads any value, for fields whose NX type has no generated decoder. */
+  readValue(): unknown {
+    const byte = this.view.getUint8(this.offset);
+    if (byte === 0xc0) {
+      this.offset += 1;
+      return null;
+    }
+    if (byte === 0xc2 || byte === 0xc3) {
+      return this.readBoolean();
+    }
+    if ((byte >= 0xa0 && byte <= 0xbf) || (byte >= 0xd9 && byte <= 0xdb)) {
+      return this.readString();
+    }
+    if ((byte >= 0x90 && byte <= 0x9f) || byte === 0xdc || byte === 0xdd) {
+      return this.readArray(() => this.readValue());
+    }
+    if ((byte >= 0x80 && byte <= 0x8f) || byte === 0xde || byte === 0xdf) {
+      // Payload keys such as "__proto__" must stay plain entries, so the map has no prototype.
+      const value: Record<string, unknown> = Object.create(null);
+      for (let count = this.readMapHeader(); count > 0; count--) {
+        const key = this.readKey();
+        value[key] = this.readValue();
+      }
+      return value;
+    }
+    if (byte >= 0xc4 && byte <= 0xc6) {
+      return this.readBinary();
+    }
+    if (byte === 0xca || byte === 0xcb) {
+      return this.readNumber();
+    }
+    return this.readIntegerValue();
+  }
+
+  skip(): void {
+    let remaining = 1;
+    while (remaining > 0) {
+      remaining -= 1;
+      const byte = this.view.getUint8(this.offset++);
+      if (byte <= 0x7f || byte >= 0xe0 || byte === 0xc0 || byte === 0xc2 || byte === 0xc3) {
+        continue;
+      }
+      if (byte <= 0x8f) {
+        remaining += (byte & 0x0f) * 2;
+        continue;
+      }
+      if (byte <= 0x9f) {
+        remaining += byte & 0x0f;
+        continue;
+      }
+      if (byte <= 0xbf) {
+        this.offset += byte & 0x1f;
+        continue;
+      }
+      const at = this.offset;
+      switch (byte) {
+        case 0xc4:
+        case 0xd9:
+          this.offset += 1 + this.view.getUint8(at);
+          break;
+        case 0xc5:
+        case 0xda:
+          this.offset += 2 + this.view.getUint16(at);
+          break;
+        case 0xc6:
+        case 0xdb:
+          this.offset += 4 + this.view.getUint32(at);
+          break;
+        case 0xc7:
+          this.offset += 2 + this.view.getUint8(at);
+          break;
+        case 0xc8:
+          this.offset += 3 + this.view.getUint16(at);
+          break;
+        case 0xc9:
+          this.offset += 5 + this.view.getUint32(at);
+          break;
+        case 0xcc:
+        case 0xd0:
+          this.offset += 1;
+          break;
+        case 0xcd:
+        case 0xd1:
+        case 0xd4:
+          this.offset += 2;
+          break;
+        case 0xd5:
+          this.offset += 3;
+          break;
+        case 0xca:
+        case 0xce:
+        case 0xd2:
+          this.offset += 4;
+          break;
+        case 0xd6:
+          this.offset += 5;
+          break;
+        case 0xcb:
+        case 0xcf:
+        case 0xd3:
+          this.offset += 8;
+          break;
+        case 0xd7:
+          this.offset += 9;
+          break;
+        case 0xd8:
+          this.offset += 17;
+          break;
+        case 0xdc:
+          remaining += this.view.getUint16(at);
+          this.offset += 2;
+          break;
+        case 0xdd:
+          remaining += this.view.getUint32(at);
+          this.offset += 4;
+          break;
+        case 0xde:
+          remaining += this.view.getUint16(at) * 2;
+          this.offset += 2;
+          break;
+        case 0xdf:
+          remaining += this.view.getUint32(at) * 2;
+          this.offset += 4;
+          break;
+        default:
+          throw this.unexpected(byte, "a MessagePack value");
+      }
+    }
+  }
+
+  /** Reads any integer, as a bigint when it does not fit a safe JavaScript integer. */
+  private readIntegerValue(): number | bigint {
+    const byte = this.view.getUint8(this.offset++);
+    if (byte <= 0x7f) {
+      return byte;
+    }
+    if (byte >= 0xe0) {
+      return byte - 0x100;
+    }
+    const at = this.offset;
+    switch (byte) {
+      case 0xcc:
+        this.offset += 1;
+        return this.view.getUint8(at);
+      case 0xcd:
+        this.offset += 2;
+        return this.view.getUint16(at);
+      case 0xce:
+        this.offset += 4;
+        return this.view.getUint32(at);
+      case 0xcf: {
+        this.offset += 8;
+        const value = this.view.getBigUint64(at);
+        return value <= nxMaxSafeInteger ? Number(value) : value;
+      }
+      case 0xd0:
+        this.offset += 1;
+        return this.view.getInt8(at);
+      case 0xd1:
+        this.offset += 2;
+        return this.view.getInt16(at);
+      case 0xd2:
+        this.offset += 4;
+        return this.view.getInt32(at);
+      case 0xd3: {
+        this.offset += 8;
+        const value = this.view.getBigInt64(at);
+        return value >= nxMinSafeInteger && value <= nxMaxSafeInteger ? Number(value) : value;
+      }
+      default:
+        throw this.unexpected(byte, "an integer");
+    }
+  }
+
+  private readBinary(): Uint8Array {
+    const byte = this.view.getUint8(this.offset++);
+    let length: number;
+    if (byte === 0xc4) {
+      length = this.view.getUint8(this.offset);
+      this.offset += 1;
+    } else if (byte === 0xc5) {
+      length = this.view.getUint16(this.offset);
+      this.offset += 2;
+    } else {
+      length = this.view.getUint32(this.offset);
+      this.offset += 4;
+    }
+    const start = this.offset;
+    this.offset += length;
+    return this.bytes.slice(start, this.offset);
+  }
+
+  private unexpected(byte: number, expected: string): Error {
+    return new Error(
+      `Expected ${expected} in NX MessagePack payload at offset ${this.offset - 1}, found 0x${byte.toString(16)}.`,
+    );
+  }
+}
+
+/** Writes the canonical NX MessagePack wire format for generated encoders. */
+export class NxMessagePackWriter {
+  private bytes = new Uint8Array(256);
+  private view = new DataView(this.bytes.buffer);
+  private offset = 0;
+
+  /** Returns the bytes written so far. */
+  finish(): Uint8Array {
+    return this.bytes.subarray(0, this.offset);
+  }
+
+  writeNil(): void {
+    this.ensure(1);
+    this.bytes[this.offset++] = 0xc0;
+  }
+
+  writeBoolean(value: boolean): void {
+    this.ensure(1);
+    this.bytes[this.offset++] = value ? 0xc3 : 0xc2;
+  }
+
+  /**
+   * Writes an NX `int`. Numbers must be safe integers and bigints must fit in an i64; anything else
+   * throws, so an integer field is never written as a float or rounded.
+   */
+  writeInteger(value: number | bigint): void {
+    if (typeof value === "bigint") {
+      if (value < nxMinSafeInteger || value > nxMaxSafeInteger) {
+        this.writeInt64(value);
+        return;
+      }
+      value = Number(value);
+    } else if (!Number.isSafeInteger(value)) {
+      throw new RangeError(`Cannot write ${value} as an NX integer; expected a safe integer or a bigint.`);
+    }
+    this.ensure(9);
+    const at = this.offset;
+    if (value >= 0) {
+      if (value <= 0x7f) {
+        this.bytes[at] = value;
+        this.offset += 1;
+      } else if (value <= 0xff) {
+        this.bytes[at] = 0xcc;
+        this.view.setUint8(at + 1, value);
+        this.offset += 2;
+      } else if (value <= 0xffff) {
+        this.bytes[at] = 0xcd;
+        this.view.setUint16(at + 1, value);
+        this.offset += 3;
+      } else if (value <= 0xffffffff) {
+        this.bytes[at] = 0xce;
+        this.view.setUint32(at + 1, value);
+        this.offset += 5;
+      } else {
+        this.bytes[at] = 0xcf;
+        this.view.setBigUint64(at + 1, BigInt(value));
+        this.offset += 9;
+      }
+    } else if (value >= -0x20) {
+      this.bytes[at] = value & 0xff;
+      this.offset += 1;
+    } else if (value >= -0x80) {
+      this.bytes[at] = 0xd0;
+      this.view.setInt8(at + 1, value);
+      this.offset += 2;
+    } else if (value >= -0x8000) {
+      this.bytes[at] = 0xd1;
+      this.view.setInt16(at + 1, value);
+      this.offset += 3;
+    } else if (value >= -0x80000000) {
+      this.bytes[at] = 0xd2;
+      this.view.setInt32(at + 1, value);
+      this.offset += 5;
+    } else {
+      this.bytes[at] = 0xd3;
+      this.view.setBigInt64(at + 1, BigInt(value));
+      this.offset += 9;
+    }
+  }
+
+  writeFloat(value: number): void {
+    this.ensure(9);
+    this.bytes[this.offset] = 0xcb;
+    this.view.setFloat64(this.offset + 1, value);
+    this.offset += 9;
+  }
+
+  writeString(value: string): void {
+    let ascii = true;
+    for (let index = 0; index < value.length; index++) {
+      if (value.charCodeAt(index) >= 0x80) {
+        ascii = false;
+        break;
+      }
+    }
+    const encoded = ascii ? null : nxUtf8Encoder.encode(value);
+    const length = encoded === null ? value.length : encoded.length;
+
+    this.ensure(5 + length);
+    if (length <= 0x1f) {
+      this.bytes[this.offset++] = 0xa0 | length;
+    } else if (length <= 0xff) {
+      this.bytes[this.offset++] = 0xd9;
+      this.bytes[this.offset++] = length;
+    } else if (length <= 0xffff) {
+      this.bytes[this.offset++] = 0xda;
+      this.view.setUint16(this.offset, length);
+      this.offset += 2;
+    } else {
+      this.bytes[this.offset++] = 0xdb;
+      this.view.setUint32(this.offset, length);
+      this.offset += 4;
+    }
+
+    if (encoded === null) {
+      for (let index = 0; index < length; index++) {
+        this.bytes[this.offset++] = value.charCodeAt(index);
+      }
+    } else {
+      this.bytes.set(encoded, this.offset);
+      this.offset += length;
+    }
+  }
+
+  writeMapHeader(length: number): void {
+    this.writeContainerHeader(length, 0x80, 0xde);
+  }
+
+  writeArrayHeader(length: number): void {
+    this.writeContainerHeader(length, 0x90, 0xdc);
+  }
+
+  writeArray<T>(items: readonly T[], writeItem: (item: T) => void): void {
+    this.writeArrayHeader(items.length);
+    for (const item of items) {
+      writeItem(item);
+    }
+  }
+
+  /** Writes any value, for fields whose NX type has no generated encoder. */
+  writeValue(value: unknown): void {
+    if (value === null || value === undefined) {
+      this.writeNil();
+    } else if (typeof value === "boolean") {
+      this.writeBoolean(value);
+    } else if (typeof value === "number") {
+      if (Number.isSafeInteger(value)) {
+        this.writeInteger(value);
+      } else {
+        this.writeFloat(value);
+      }
+    } else if (typeof value === "bigint") {
+      this.writeInteger(value);
+    } else if (typeof value === "string") {
+      this.writeString(value);
+    } else if (value instanceof Uint8Array) {
+      this.writeBinary(value);
+    } else if (Array.isArray(value)) {
+      this.writeArray(value, (item) => this.writeValue(item));
+    } else if (typeof value === "object") {
+      const entries = Object.entries(value);
+      this.writeMapHeader(entries.length);
+      for (const [key, item] of entries) {
+        this.writeString(key);
+        this.writeValue(item);
+      }
+    } else {
+      throw new Error(`Cannot encode a ${typeof value} value as NX MessagePack.`);
+    }
+  }
+
+  private writeInt64(value: bigint): void {
+    if (value < nxMinInt64 || value > nxMaxInt64) {
+      throw new RangeError(`Cannot write ${value} as an NX integer; it does not fit in 64 bits.`);
+    }
+    this.ensure(9);
+    if (value >= BigInt(0)) {
+      this.bytes[this.offset] = 0xcf;
+      this.view.setBigUint64(this.offset + 1, value);
+    } else {
+      this.bytes[this.offset] = 0xd3;
+      this.view.setBigInt64(this.offset + 1, value);
+    }
+    this.offset += 9;
+  }
+
+  private writeBinary(value: Uint8Array): void {
+    this.ensure(5 + value.length);
+    if (value.length <= 0xff) {
+      this.bytes[this.offset++] = 0xc4;
+      this.bytes[this.offset++] = value.length;
+    } else if (value.length <= 0xffff) {
+      this.bytes[this.offset++] = 0xc5;
+      this.view.setUint16(this.offset, value.length);
+      this.offset += 2;
+    } else {
+      this.bytes[this.offset++] = 0xc6;
+      this.view.setUint32(this.offset, value.length);
+      this.offset += 4;
+    }
+    this.bytes.set(value, this.offset);
+    this.offset += value.length;
+  }
+
+  private writeContainerHeader(length: number, fixPrefix: number, prefix16: number): void {
+    this.ensure(5);
+    if (length <= 0x0f) {
+      this.bytes[this.offset++] = fixPrefix | length;
+    } else if (length <= 0xffff) {
+      this.bytes[this.offset++] = prefix16;
+      this.view.setUint16(this.offset, length);
+      this.offset += 2;
+    } else {
+      this.bytes[this.offset++] = prefix16 + 1;
+      this.view.setUint32(this.offset, length);
+      this.offset += 4;
+    }
+  }
+
+  private ensure(additional: number): void {
+    const required = this.offset + additional;
+    if (required <= this.bytes.length) {
+      return;
+    }
+    let capacity = this.bytes.length * 2;
+    while (capacity < required) {
+      capacity *= 2;
+    }
+    const next = new Uint8Array(capacity);
+    next.set(this.bytes.subarray(0, this.offset));
+    this.bytes = next;
+    this.view = new DataView(next.buffer);
+  }
+}
@@ -1,15 +1,16 @@
 use crate::codegen::model::{
     ExportedAlias, ExportedEnum, ExportedExternalState, ExportedModule,
-    ExportedPolymorphicDescendant, ExportedRecord, ExportedType, ExportedTypeGraph, ExportedUnion,
-    ExportedUnionCase, ImportedType,
+    ExportedPolymorphicDescendant, ExportedRecord, ExportedRecordField, ExportedType,
+    ExportedTypeGraph, ExportedUnion, ExportedUnionCase, ImportedType,
 };
 use crate::codegen::writer::CodeWriter;
 use crate::codegen::{GenerateTypesOptions, GeneratedFile};
-use nx_hir::ast::TypeRef;
+use nx_hir::ast::{Literal, TypeRef};
 use std::collections::{BTreeMap, BTreeSet};
 use std::path::{Path, PathBuf};
 
 const NX_RECORD_HELPER_MODULE_BASENAME: &str = "_nx";
+const NX_MESSAGE_PACK_RUNTIME: &str = include_str!("nx_message_pack.ts");
 
 #[derive(Clone, Copy, Debug, PartialEq, Eq)]
 enum NxRecordMode {
@@ -33,6 +34,56 @@ impl TypeScriptImportSpecifier {
     }
 }
 
+/// A generated `decode`/`encode` function pair for one exported TypeScript type.
+struct TypeScriptCodec {
+    type_name: String,
+    body: TypeScriptCodecBody,
+}
+
+enum TypeScriptCodecBody {
+    /// A MessagePack map of the wire fields, tagged with `$type` for NX records.
+    Map {
+        discriminator: Option<String>,
+        fields: Vec<ExportedRecordField>,
+    },
+    /// A polymorphic type that dispatches to its concrete cases on the `$type` discriminator.
+    Dispatch { cases: Vec<TypeScriptCodecCase> },
+}
+
+struct TypeScriptCodecCase {
+    discriminator: String,
+    type_name: String,
+    /// The NX declaration whose module defines the case codec.
+    owner_name: String,
+}
+
+/// How a generated codec reads and writes one field value.
+enum TypeScriptFieldCodec {
+    String,
+    Integer,
+    Float,
+    Boolean,
+    /// An NX enum, read as a plain string.
+    Enum,
+    /// An exported type with its own generated codec.
+    Named(String),
+    /// A type without a generated codec, read and written as a plain MessagePack value.
+    Value,
+    Nullable(Box<TypeScriptFieldCodec>),
+    Array(Box<TypeScriptFieldCodec>),
+}
+
+impl TypeScriptFieldCodec {
+    /// Whether the decoded value already has the declared field type without a type assertion.
+    fn is_exact(&self) -> bool {
+        match self {
+            Self::Enum | Self::Value => false,
+            Self::Nullable(inner) | Self::Array(inner) => inner.is_exact(),
+            _ => true,
+        }
+    }
+}
+
 struct TypeScriptImportContext<'a> {
     graph: &'a ExportedTypeGraph,
     imported_types_by_visible_name: BTreeMap<String, ImportedType>,
@@ -62,8 +113,11 @@ pub fn emit_library(
     opts: &GenerateTypesOptions,
 ) -> Result<Vec<GeneratedFile>, String> {
     let mut files = Vec::new();
-    let has_records = graph.modules.iter().any(|m| module_needs_nx_record(m));
-    let helper_module_path = has_records.then(|| nx_record_helper_module_path(graph));
+    let needs_helper_module = graph
+        .modules
+        .iter()
+        .any(|m| module_needs_nx_record(m) || (opts.serializers && module_has_codecs(m, graph)));
+    let helper_module_path = needs_helper_module.then(|| nx_record_helper_module_path(graph));
 
     if let Some(helper_module_path) = &helper_module_path {
         files.push(GeneratedFile {
@@ -153,13 +207,24 @@ fn render_module(
         package_prefix: opts.typescript_package_prefix.as_deref(),
     };
 
+    let needs_codecs = opts.serializers && module_has_codecs(module, graph);
     let mut wrote_import = false;
     if include_imports {
-        if module_needs_nx_record(module) && nx_record_mode == NxRecordMode::Import {
+        let mut helper_names = Vec::new();
+        if needs_codecs {
+            helper_names.extend(["NxMessagePackReader", "NxMessagePackWriter"]);
+        }
+        if module_needs_nx_record(module) {
+            helper_names.push("NxRecord");
+        }
+        if !helper_names.is_empty() && nx_record_mode == NxRecordMode::Import {
             let helper_module_path = helper_module_path
                 .expect("record-bearing library modules require an NxRecord helper module");
             let specifier = relative_module_specifier(&module.module_path, helper_module_path);
-            writer.line(&format!("import type {{ NxRecord }} from \"{specifier}\";"));
+            writer.line(&format!(
+                "import type {{ {} }} from \"{specifier}\";",
+                helper_names.join(", ")
+            ));
             wrote_import = true;
         }
 
@@ -174,6 +239,18 @@ fn render_module(
             wrote_import = true;
         }
 
+        if needs_codecs {
+            for (specifier, function_names) in &collect_module_codec_imports(module, graph) {
+                let names = function_names
+                    .iter()
+                    .cloned()
+                    .collect::<Vec<_>>()
+                    .join(", ");
+                writer.line(&format!("import {{ {names} }} from \"{specifier}\";"));
+                wrote_import = true;
+            }
+        }
+
         if wrote_import {
             writer.blank_line();
         }
@@ -184,8 +261,19 @@ fn render_module(
         writer.blank_line();
     }
 
+    if needs_codecs && nx_record_mode == NxRecordMode::Inline {
+        emit_nx_message_pack_runtime(&mut writer);
+        writer.blank_line();
+    }
+
     for (index, declaration) in module.declarations.iter().enumerate() {
         emit_declaration(&mut writer, &declaration.item, graph);
+        if opts.serializers {
+            for codec in declaration_codecs(&declaration.item, graph) {
+                writer.blank_line();
+                emit_codec(&mut writer, &codec, graph);
+            }
+        }
         if index + 1 != module.declarations.len() {
             writer.blank_line();
         }
@@ -198,6 +286,10 @@ fn render_nx_record_module(opts: &GenerateTypesOptions) -> String {
     let mut writer = CodeWriter::new(opts.format.clone());
     write_header(&mut writer);
     emit_nx_record(&mut writer);
+    if opts.serializers {
+        writer.blank_line();
+        emit_nx_message_pack_runtime(&mut writer);
+    }
     writer.finish()
 }
 
@@ -234,6 +326,12 @@ fn render_index(
             "export type {{ NxRecord }} from \"{}\";",
             module_path_specifier(helper_module_path)
         ));
+        if opts.serializers {
+            writer.line(&format!(
+                "export {{ NxMessagePackReader, NxMessagePackWriter }} from \"{}\";",
+                module_path_specifier(helper_module_path)
+            ));
+        }
     }
 
     for module in &graph.modules {
@@ -259,6 +357,26 @@ fn emit_nx_record(writer: &mut CodeWriter) {
     );
 }
 
+/// Writes the MessagePack reader and writer that generated codecs are built on.
+fn emit_nx_message_pack_runtime(writer: &mut CodeWriter) {
+    for line in NX_MESSAGE_PACK_RUNTIME.trim_end().lines() {
+        if line.trim().is_empty() {
+            writer.blank_line();
+            continue;
+        }
+
+        let text = line.trim_start_matches(' ');
+        let depth = (line.len() - text.len()) / 2;
+        for _ in 0..depth {
+            writer.indent();
+        }
+        writer.line(text);
+        for _ in 0..depth {
+            writer.dedent();
+        }
+    }
+}
+
 fn emit_declaration(
     writer: &mut CodeWriter,
     declaration: &ExportedType,
@@ -467,6 +585,457 @@ fn module_needs_nx_record(module: &ExportedModule) -> bool {
         })
 }
 
+fn module_has_codecs(module: &ExportedModule, graph: &ExportedTypeGraph) -> bool {
+    module
+        .declarations
+        .iter()
+        .any(|declaration| !declaration_codecs(&declaration.item, graph).is_empty())
+}
+
+/// Returns the codecs generated for `declaration`, in emission order. Types whose wire fields
+/// cannot be resolved in this graph, such as records extending an imported base, get none.
+fn declaration_codecs(
+    declaration: &ExportedType,
+    graph: &ExportedTypeGraph,
+) -> Vec<TypeScriptCodec> {
+    match declaration {
+        ExportedType::Alias(_) | ExportedType::Enum(_) => Vec::new(),
+        ExportedType::Record(record) if record.is_abstract => {
+            let cases = graph
+                .polymorphic_descendants(&record.name)
+                .iter()
+                .map(|descendant| polymorphic_codec_case(descendant, graph))
+                .collect::<Option<Vec<_>>>();
+            match cases {
+                Some(cases) if !cases.is_empty() => vec![TypeScriptCodec {
+                    type_name: sanitize_ts_type_name(&record.name),
+                    body: TypeScriptCodecBody::Dispatch { cases },
+                }],
+                _ => Vec::new(),
+            }
+        }
+        ExportedType::Record(record) => {
+            let Some(mut fields) = graph.inherited_record_fields(record.base.as_deref()) else {
+                return Vec::new();
+            };
+            fields.extend(record.fields.iter().cloned());
+            vec![TypeScriptCodec {
+                type_name: sanitize_ts_type_name(&record.name),
+                body: TypeScriptCodecBody::Map {
+                    discriminator: Some(record.name.clone()),
+                    fields,
+                },
+            }]
+        }
+        ExportedType::Union(union_def) => {
+            if union_def.cases.is_empty() {
+                return Vec::new();
+            }
+            let Some(base_fields) = graph.inherited_record_fields(union_def.base.as_deref()) else {
+                return Vec::new();
+            };
+
+            let mut codecs = Vec::new();
+            let mut cases = Vec::new();
+            for case in &union_def.cases {
+                let discriminator = format!("{}.{}", union_def.name, case.name);
+                let type_name = ts_union_case_type_name(&union_def.name, &case.name);
+                let mut fields = base_fields.clone();
+                fields.extend(case.fields.iter().cloned());
+                codecs.push(TypeScriptCodec {
+                    type_name: type_name.clone(),
+                    body: TypeScriptCodecBody::Map {
+                        discriminator: Some(discriminator.clone()),
+                        fields,
+                    },
+                });
+                cases.push(TypeScriptCodecCase {
+                    discriminator,
+                    type_name,
+                    owner_name: union_def.name.clone(),
+                });
+            }
+            codecs.push(TypeScriptCodec {
+                type_name: sanitize_ts_type_name(&union_def.name),
+                body: TypeScriptCodecBody::Dispatch { cases },
+            });
+            codecs
+        }
+        ExportedType::ExternalState(state) => vec![TypeScriptCodec {
+            type_name: sanitize_ts_type_name(&state.name),
+            body: TypeScriptCodecBody::Map {
+                discriminator: None,
+                fields: state.fields.clone(),
+            },
+        }],
+    }
+}
+
+fn polymorphic_codec_case(
+    descendant: &ExportedPolymorphicDescendant,
+    graph: &ExportedTypeGraph,
+) -> Option<TypeScriptCodecCase> {
+    match descendant {
+        ExportedPolymorphicDescendant::Record { name } => {
+            let record = graph.record(name)?;
+            graph.inherited_record_fields(record.base.as_deref())?;
+            Some(TypeScriptCodecCase {
+                discriminator: name.clone(),
+                type_name: sanitize_ts_type_name(name),
+                owner_name: name.clone(),
+            })
+        }
+        ExportedPolymorphicDescendant::UnionCase {
+            union_name,
+            case_name,
+        } => {
+            let ExportedType::Union(union_def) = &graph.declaration(union_name)?.item else {
+                return None;
+            };
+            graph.inherited_record_fields(union_def.base.as_deref())?;
+            Some(TypeScriptCodecCase {
+                discriminator: format!("{union_name}.{case_name}"),
+                type_name: ts_union_case_type_name(union_name, case_name),
+                owner_name: union_name.clone(),
+            })
+        }
+    }
+}
+
+fn ts_field_codec(
+    ty: &TypeRef,
+    graph: &ExportedTypeGraph,
+    seen_aliases: &mut BTreeSet<String>,
+) -> TypeScriptFieldCodec {
+    let name = match ty {
+        TypeRef::Nullable(inner) => {
+            return TypeScriptFieldCodec::Nullable(Box::new(ts_field_codec(
+                inner,
+                graph,
+                seen_aliases,
+            )));
+        }
+        TypeRef::Array(inner) => {
+            return TypeScriptFieldCodec::Array(Box::new(ts_field_codec(
+                inner,
+                graph,
+                seen_aliases,
+            )));
+        }
+        TypeRef::Function { .. } => return TypeScriptFieldCodec::Value,
+        TypeRef::Name(name) => name.as_str(),
+    };
+
+    match name {
+        "string" => TypeScriptFieldCodec::String,
+        "i32" | "i64" | "int" => TypeScriptFieldCodec::Integer,
+        "f32" | "f64" | "float" => TypeScriptFieldCodec::Float,
+        "bool" => TypeScriptFieldCodec::Boolean,
+        _ => match graph.declaration(name).map(|declaration| &declaration.item) {
+            Some(ExportedType::Alias(alias)) if seen_aliases.insert(name.to_string()) => {
+                let codec = ts_field_codec(&alias.target, graph, seen_aliases);
+                seen_aliases.remove(name);
+                codec
+            }
+            Some(ExportedType::Enum(_)) => TypeScriptFieldCodec::Enum,
+            Some(item) if !declaration_codecs(item, graph).is_empty() => {
+                TypeScriptFieldCodec::Named(name.to_string())
+            }
+            _ => TypeScriptFieldCodec::Value,
+        },
+    }
+}
+
+fn collect_codec_names(codec: &TypeScriptFieldCodec, out: &mut BTreeSet<String>) {
+    match codec {
+        TypeScriptFieldCodec::Named(name) => {
+            out.insert(name.clone());
+        }
+        TypeScriptFieldCodec::Nullable(inner) | TypeScriptFieldCodec::Array(inner) => {
+            collect_codec_names(inner, out);
+        }
+        _ => {}
+    }
+}
+
+fn collect_module_codec_imports(
+    module: &ExportedModule,
+    graph: &ExportedTypeGraph,
+) -> BTreeMap<String, BTreeSet<String>> {
+    let mut imports = BTreeMap::<String, BTreeSet<String>>::new();
+
+    for declaration in &module.declarations {
+        for codec in declaration_codecs(&declaration.item, graph) {
+            match &codec.body {
+                TypeScriptCodecBody::Map { fields, .. } => {
+                    let mut names = BTreeSet::new();
+                    for field in fields {
+                        let codec = ts_field_codec(&field.ty, graph, &mut BTreeSet::new());
+                        collect_codec_names(&codec, &mut names);
+                    }
+                    for name in names {
+                        add_codec_import(
+                            module,
+                            graph,
+                            &name,
+                            &sanitize_ts_type_name(&name),
+                            &mut imports,
+                        );
+                    }
+                }
+                TypeScriptCodecBody::Dispatch { cases } => {
+                    for case in cases {
+                        add_codec_import(
+                            module,
+                            graph,
+                            &case.owner_name,
+                            &case.type_name,
+                            &mut imports,
+                        );
+                    }
+                }
+            }
+        }
+    }
+
+    imports
+}
+
+fn add_codec_import(
+    module: &ExportedModule,
+    graph: &ExportedTypeGraph,
+    owner_name: &str,
+    type_name: &str,
+    imports: &mut BTreeMap<String, BTreeSet<String>>,
+) {
+    let Some(owner_module) = graph.owner_module(owner_name) else {
+        return;
+    };
+    if owner_module == module.module_path.as_path() {
+        return;
+    }
+
+    let specifier = relative_module_specifier(&module.module_path, owner_module);
+    let names = imports.entry(specifier).or_default();
+    names.insert(format!("decode{type_name}"));
+    names.insert(format!("encode{type_name}"));
+}
+
+fn emit_codec(writer: &mut CodeWriter, codec: &TypeScriptCodec, graph: &ExportedTypeGraph) {
+    match &codec.body {
+        TypeScriptCodecBody::Map {
+            discriminator,
+            fields,
+        } => emit_map_codec(
+            writer,
+            &codec.type_name,
+            discriminator.as_deref(),
+            fields,
+            graph,
+        ),
+        TypeScriptCodecBody::Dispatch { cases } => {
+            emit_dispatch_codec(writer, &codec.type_name, cases)
+        }
+    }
+}
+
+fn emit_map_codec(
+    writer: &mut CodeWriter,
+    type_name: &str,
+    discriminator: Option<&str>,
+    fields: &[ExportedRecordField],
+    graph: &ExportedTypeGraph,
+) {
+    let codecs = fields
+        .iter()
+        .map(|field| ts_field_codec(&field.ty, graph, &mut BTreeSet::new()))
+        .collect::<Vec<_>>();
+
+    writer.block(
+        &format!("export function decode{type_name}(reader: NxMessagePackReader): {type_name}"),
+        |writer| {
+            // Literal defaults seed the value so payloads that omit those keys still decode to
+            // what NX would have produced.
+            let members = discriminator
+                .map(|discriminator| format!("$type: \"{}\"", escape_ts_string(discriminator)))
+                .into_iter()
+                .chain(fields.iter().filter_map(|field| {
+                    let literal = field.default_literal.as_ref()?;
+                    Some(format!(
+                        "{}: {}",
+                        ts_property_key(&field.name),
+                        ts_literal(literal)
+                    ))
+                }))
+                .collect::<Vec<_>>();
+            let initial = if members.is_empty() {
+                "{}".to_string()
+            } else {
+                format!("{{ {} }}", members.join(", "))
+            };
+            writer.line(&format!("const value = {initial} as {type_name};"));
+            writer.block(
+                "for (let count = reader.readMapHeader(); count > 0; count--)",
+                |writer| {
+                    if fields.is_empty() {
+                        writer.line("reader.readKey();");
+                        writer.line("reader.skip();");
+                        return;
+                    }
+
+                    writer.block("switch (reader.readKey())", |writer| {
+                        for (field, codec) in fields.iter().zip(&codecs) {
+                            let key = escape_ts_string(&field.name);
+                            let mut read = ts_decode_expr(codec);
+                            if !codec.is_exact() {
+                                if read.contains(" ? ") {
+                                    read = format!("({read})");
+                                }
+                                read = format!("{read} as {type_name}[\"{key}\"]");
+                            }
+                            writer.line(&format!("case \"{key}\":"));
+                            writer.indent();
+                            writer.line(&format!(
+                                "value{} = {read};",
+                                ts_property_access(&field.name)
+                            ));
+                            writer.line("break;");
+                            writer.dedent();
+                        }
+                        writer.line("default:");
+                        writer.indent();
+                        writer.line("reader.skip();");
+                        writer.line("break;");
+                        writer.dedent();
+                    });
+                },
+            );
+            writer.line("return value;");
+        },
+    );
+
+    writer.blank_line();
+
+    writer.block(
+        &format!(
+            "export function encode{type_name}(writer: NxMessagePackWriter, value: {type_name}): void"
+        ),
+        |writer| {
+            writer.line(&format!(
+                "writer.writeMapHeader({});",
+                fields.len() + usize::from(discriminator.is_some())
+            ));
+            if discriminator.is_some() {
+                writer.line("writer.writeString(\"$type\");");
+                writer.line("writer.writeString(value.$type);");
+            }
+            for (field, codec) in fields.iter().zip(&codecs) {
+                writer.line(&format!(
+                    "writer.writeString(\"{}\");",
+                    escape_ts_string(&field.name)
+                ));
+                let value = format!("value{}", ts_property_access(&field.name));
+                writer.line(&format!("{};", ts_encode_expr(codec, &value, 0)));
+            }
+        },
+    );
+}
+
+fn emit_dispatch_codec(writer: &mut CodeWriter, type_name: &str, cases: &[TypeScriptCodecCase]) {
+    writer.block(
+        &format!("export function decode{type_name}(reader: NxMessagePackReader): {type_name}"),
+        |writer| {
+            writer.line("const discriminator = reader.peekDiscriminator();");
+            writer.block("switch (discriminator)", |writer| {
+                for case in cases {
+                    writer.line(&format!(
+                        "case \"{}\":",
+                        escape_ts_string(&case.discriminator)
+                    ));
+                    writer.indent();
+                    writer.line(&format!("return decode{}(reader);", case.type_name));
+                    writer.dedent();
+                }
+            });
+            writer.line(&format!(
+                "throw new Error(`Unknown NX $type discriminator '${{discriminator}}' for {type_name}.`);"
+            ));
+        },
+    );
+
+    writer.blank_line();
+
+    writer.block(
+        &format!(
+            "export function encode{type_name}(writer: NxMessagePackWriter, value: {type_name}): void"
+        ),
+        |writer| {
+            writer.block("switch (value.$type)", |writer| {
+                for case in cases {
+                    writer.line(&format!(
+                        "case \"{}\":",
+                        escape_ts_string(&case.discriminator)
+                    ));
+                    writer.indent();
+                    writer.line(&format!("encode{}(writer, value);", case.type_name));
+                    writer.line("return;");
+                    writer.dedent();
+                }
+            });
+            writer.line(&format!(
+                "throw new Error(\"Unknown NX $type discriminator for {type_name}.\");"
+            ));
+        },
+    );
+}
+
+fn ts_decode_expr(codec: &TypeScriptFieldCodec) -> String {
+    match codec {
+        TypeScriptFieldCodec::String | TypeScriptFieldCodec::Enum => {
+            "reader.readString()".to_string()
+        }
+        TypeScriptFieldCodec::Integer => "reader.readInteger()".to_string(),
+        TypeScriptFieldCodec::Float => "reader.readNumber()".to_string(),
+        TypeScriptFieldCodec::Boolean => "reader.readBoolean()".to_string(),
+        TypeScriptFieldCodec::Named(name) => {
+            format!("decode{}(reader)", sanitize_ts_type_name(name))
+        }
+        TypeScriptFieldCodec::Value => "reader.readValue()".to_string(),
+        TypeScriptFieldCodec::Nullable(inner) => {
+            format!("reader.tryReadNil() ? null : {}", ts_decode_expr(inner))
+        }
+        TypeScriptFieldCodec::Array(inner) => {
+            format!("reader.readArray(() => {})", ts_decode_expr(inner))
+        }
+    }
+}
+
+fn ts_encode_expr(codec: &TypeScriptFieldCodec, value: &str, depth: usize) -> String {
+    match codec {
+        TypeScriptFieldCodec::String | TypeScriptFieldCodec::Enum => {
+            format!("writer.writeString({value})")
+        }
+        TypeScriptFieldCodec::Integer => format!("writer.writeInteger({value})"),
+        TypeScriptFieldCodec::Float => format!("writer.writeFloat({value})"),
+        TypeScriptFieldCodec::Boolean => format!("writer.writeBoolean({value})"),
+        TypeScriptFieldCodec::Named(name) => {
+            format!("encode{}(writer, {value})", sanitize_ts_type_name(name))
+        }
+        TypeScriptFieldCodec::Value => format!("writer.writeValue({value})"),
+        TypeScriptFieldCodec::Nullable(inner) => format!(
+            "{value} == null ? writer.writeNil() : {}",
+            ts_encode_expr(inner, value, depth)
+        ),
+        TypeScriptFieldCodec::Array(inner) => {
+            let item = format!("item{depth}");
+            format!(
+                "writer.writeArray({value}, ({item}) => {})",
+                ts_encode_expr(inner, &item, depth + 1)
+            )
+        }
+    }
+}
+
 fn collect_module_imports(
     module: &ExportedModule,
     context: &TypeScriptImportContext<'_>,
@@ -714,6 +1283,14 @@ fn ts_property_key(name: &str) -> String {
     }
 }
 
+fn ts_property_access(name: &str) -> String {
+    if is_ts_identifier(name) {
+        format!(".{name}")
+    } else {
+        format!("[\"{}\"]", escape_ts_string(name))
+    }
+}
+
 fn is_ts_identifier(name: &str) -> bool {
     let mut chars = name.chars();
     let Some(first) = chars.next() else {
@@ -768,6 +1345,37 @@ fn sanitize_ts_member_name(name: &str) -> String {
     sanitize_ts_type_name(&out)
 }
 
+/// Renders an NX literal as the TypeScript expression for the same value.
+fn ts_literal(literal: &Literal) -> String {
+    match literal {
+        Literal::String(value) => {
+            let mut out = String::from("\"");
+            for ch in value.chars() {
+                match ch {
+                    '\\' => out.push_str("\\\\"),
+                    '"' => out.push_str("\\\""),
+                    '\n' => out.push_str("\\n"),
+                    '\r' => out.push_str("\\r"),
+                    '\t' => out.push_str("\\t"),
+                    ch if ch.is_control() || ch == '\u{2028}' || ch == '\u{2029}' => {
+                        out.push_str(&format!("\\u{{{:x}}}", ch as u32));
+                    }
+                    ch => out.push(ch),
+                }
+            }
+            out.push('"');
+            out
+        }
+        Literal::Int(value) => value.to_string(),
+        Literal::Float(value) if value.0.is_nan() => "NaN".to_string(),
+        Literal::Float(value) if value.0 == f64::INFINITY => "Infinity".to_string(),
+        Literal::Float(value) if value.0 == f64::NEG_INFINITY => "-Infinity".to_string(),
+        Literal::Float(value) => format!("{:?}", value.0),
+        Literal::Boolean(value) => value.to_string(),
+        Literal::Null => "null".to_string(),
+    }
+}
+
 fn escape_ts_string(value: &str) -> String {
     value.replace('\\', "\\\\").replace('\"', "\\\"")
 }
@@ -1,6 +1,7 @@
 use nx_api::{build_library_artifact_from_directory, LibraryArtifact};
 use nx_hir::{
-    ast::TypeRef, Component, EnumDef, ImportKind, InterfaceItemKind, Item, LoweredModule,
+    ast::{self, TypeRef},
+    Component, EnumDef, ExprId, ImportKind, InterfaceItemKind, Item, LoweredModule,
     PreparedItemKind, RecordDef, RecordKind, SelectiveImport, TypeAlias, UnionCaseDef, UnionDef,
     Visibility,
 };
@@ -26,6 +27,8 @@ pub struct ExportedRecordField {
     pub name: String,
     pub ty: TypeRef,
     pub has_default: bool,
+    /// The default value when it is a literal that generated code can inline.
+    pub default_literal: Option<ast::Literal>,
 }
 
 #[derive(Clone, Debug, PartialEq, Eq)]
@@ -341,6 +344,30 @@ impl ExportedTypeGraph {
         descendants.into_iter().collect()
     }
 
+    /// Returns the fields declared by `base` and its ancestors, outermost ancestor first, or
+    /// `None` when part of the chain does not resolve to a record in this graph.
+    pub fn inherited_record_fields(&self, base: Option<&str>) -> Option<Vec<ExportedRecordField>> {
+        let mut chain = Vec::new();
+        let mut seen = BTreeSet::new();
+        let mut next = base;
+        while let Some(name) = next {
+            let record = self.resolve_record(name)?;
+            if !seen.insert(record.name.as_str()) {
+                return None;
+            }
+            chain.push(record);
+            next = record.base.as_deref();
+        }
+
+        Some(
+            chain
+                .into_iter()
+                .rev()
+                .flat_map(|record| record.fields.iter().cloned())
+                .collect(),
+        )
+    }
+
     fn build_from_exported_modules(
         modules: Vec<ExportedModule>,
     ) -> Result<ExportedTypeGraphBuild, String> {
@@ -561,14 +588,14 @@ fn collect_exported_declarations(module: &LoweredModule) -> Vec<ExportedTypeDecl
             }),
             Item::Union(union_def) => declarations.push(ExportedTypeDecl {
                 visibility: union_def.visibility,
-                item: ExportedType::Union(export_union(union_def)),
+                item: ExportedType::Union(export_union(module, union_def)),
             }),
             Item::Record(record) => declarations.push(ExportedTypeDecl {
                 visibility: record.visibility,
-                item: ExportedType::Record(export_record(record)),
+                item: ExportedType::Record(export_record(module, record)),
             }),
             Item::Component(component) => {
-                if let Some(record) = export_external_component_contract(component) {
+                if let Some(record) = export_external_component_contract(module, component) {
                     declarations.push(ExportedTypeDecl {
                         visibility: component.visibility,
                         item: ExportedType::Record(record),
@@ -939,7 +966,7 @@ fn export_enum(def: &EnumDef) -> ExportedEnum {
     }
 }
 
-fn export_record(def: &RecordDef) -> ExportedRecord {
+fn export_record(module: &LoweredModule, def: &RecordDef) -> ExportedRecord {
     ExportedRecord {
         name: def.name.as_str().to_string(),
         kind: def.kind,
@@ -948,39 +975,38 @@ fn export_record(def: &RecordDef) -> ExportedRecord {
         fields: def
             .properties
             .iter()
-            .map(|field| ExportedRecordField {
-                name: field.name.as_str().to_string(),
-                ty: field.ty.clone(),
-                has_default: field.default.is_some(),
-            })
+            .map(|field| export_record_field(module, field.name.as_str(), &field.ty, field.default))
             .collect(),
     }
 }
 
-fn export_union(def: &UnionDef) -> ExportedUnion {
+fn export_union(module: &LoweredModule, def: &UnionDef) -> ExportedUnion {
     ExportedUnion {
         name: def.name.as_str().to_string(),
         base: def.base.as_ref().map(|name| name.as_str().to_string()),
-        cases: def.cases.iter().map(export_union_case).collect(),
+        cases: def
+            .cases
+            .iter()
+            .map(|case| export_union_case(module, case))
+            .collect(),
     }
 }
 
-fn export_union_case(case: &UnionCaseDef) -> ExportedUnionCase {
+fn export_union_case(module: &LoweredModule, case: &UnionCaseDef) -> ExportedUnionCase {
     ExportedUnionCase {
         name: case.name.as_str().to_string(),
         fields: case
             .fields
             .iter()
-            .map(|field| ExportedRecordField {
-                name: field.name.as_str().to_string(),
-                ty: field.ty.clone(),
-                has_default: field.default.is_some(),
-            })
+            .map(|field| export_record_field(module, field.name.as_str(), &field.ty, field.default))
             .collect(),
     }
 }
 
-fn export_external_component_contract(component: &Component) -> Option<ExportedRecord> {
+fn export_external_component_contract(
+    module: &LoweredModule,
+    component: &Component,
+) -> Option<ExportedRecord> {
     if !component.is_external {
         return None;
     }
@@ -996,11 +1022,7 @@ fn export_external_component_contract(component: &Component) -> Option<ExportedR
         fields: component
             .props
             .iter()
-            .map(|field| ExportedRecordField {
-                name: field.name.as_str().to_string(),
-                ty: field.ty.clone(),
-                has_default: field.default.is_some(),
-            })
+            .map(|field| export_record_field(module, field.name.as_str(), &field.ty, field.default))
             .collect(),
     })
 }
@@ -1020,11 +1042,48 @@ fn export_external_state(component: &Component) -> Option<ExportedExternalState>
                 name: field.name.as_str().to_string(),
                 ty: field.ty.clone(),
                 has_default: false,
+                default_literal: None,
             })
             .collect(),
     })
 }
 
+fn export_record_field(
+    module: &LoweredModule,
+    name: &str,
+    ty: &TypeRef,
+    default: Option<ExprId>,
+) -> ExportedRecordField {
+    ExportedRecordField {
+        name: name.to_string(),
+        ty: ty.clone(),
+        has_default: default.is_some(),
+        default_literal: default.and_then(|expr_id| literal_default(module, expr_id)),
+    }
+}
+
+/// Returns the literal a default expression evaluates to, folding a negated numeric literal.
+/// Defaults that need evaluation, such as calls or enum members, return `None`.
+fn literal_default(module: &LoweredModule, expr_id: ExprId) -> Option<ast::Literal> {
+    match module.expr(expr_id) {
+        ast::Expr::Literal(literal) => Some(literal.clone()),
+        ast::Expr::UnaryOp {
+            op: ast::UnOp::Neg,
+            expr,
+            ..
+        } => match module.expr(*expr) {
+            ast::Expr::Literal(ast::Literal::Int(value)) => {
+                value.checked_neg().map(ast::Literal::Int)
+            }
+            ast::Expr::Literal(ast::Literal::Float(value)) => {
+                Some(ast::Literal::Float(ast::OrderedFloat(-value.0)))
+            }
+            _ => None,
+        },
+        _ => None,
+    }
+}
+
 fn module_output_stem(path: &Path) -> Result<PathBuf, String> {
     let stem = path.with_extension("");
     if stem.as_os_str().is_empty() {
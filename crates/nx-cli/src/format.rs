@@ -3,9 +3,7 @@
 //! This module provides formatting of runtime values in NX syntax,
 //! which resembles XML with self-closing tags for elements.
 
-use nx_interpreter::Value;
-use rustc_hash::FxHashMap;
-use smol_str::SmolStr;
+use nx_interpreter::{RecordFields, Value};
 use std::fmt::Write;
 
 /// Pretty print a Value to NX format string.
@@ -69,7 +67,7 @@ fn format_value_inner(value: &Value, output: &mut String, indent: usize) {
 
 fn format_record_with_name(
     tag_name: &str,
-    fields: &FxHashMap<SmolStr, Value>,
+    fields: &RecordFields,
     output: &mut String,
     indent: usize,
 ) {
@@ -131,7 +129,7 @@ fn format_nested_element(tag_name: &str, value: &Value, output: &mut String, ind
             write!(output, "<{}>", tag_name).unwrap();
             output.push('\n');
             let child_indent = indent + 2;
-            for elem in elements {
+            for elem in elements.iter() {
                 write!(output, "{:indent$}", "", indent = child_indent).unwrap();
                 format_value_inner(elem, output, child_indent);
                 output.push('\n');
@@ -165,12 +163,7 @@ fn format_nested_element(tag_name: &str, value: &Value, output: &mut String, ind
     }
 }
 
-fn format_nested_record(
-    tag_name: &str,
-    fields: &FxHashMap<SmolStr, Value>,
-    output: &mut String,
-    indent: usize,
-) {
+fn format_nested_record(tag_name: &str, fields: &RecordFields, output: &mut String, indent: usize) {
     let mut field_vec: Vec<_> = fields.iter().collect();
     field_vec.sort_by_key(|(k, _)| k.as_str());
 
@@ -251,6 +244,7 @@ fn escape_string(s: &str) -> String {
 mod tests {
     use super::*;
     use rustc_hash::FxHashMap;
+    use smol_str::SmolStr;
 
     #[test]
     fn test_format_int() {
@@ -289,7 +283,7 @@ mod tests {
 
         let value = Value::Record {
             type_name: nx_hir::Name::new("result"),
-            fields,
+            fields: fields.into(),
         };
         let output = format_value(&value);
 
@@ -304,14 +298,14 @@ mod tests {
     fn test_format_enum_value() {
         let value = Value::EnumValue {
             type_name: nx_hir::Name::new("Status"),
-            member: SmolStr::new("active"),
+            member: nx_hir::Name::new("active"),
         };
         assert_eq!(format_value(&value), "Status.active");
     }
 
     #[test]
     fn test_format_array_of_primitives() {
-        let value = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)]);
+        let value = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)].into());
         assert_eq!(format_value(&value), "1\n2\n3");
     }
 
@@ -327,13 +321,13 @@ mod tests {
             SmolStr::new("address"),
             Value::Record {
                 type_name: nx_hir::Name::new("Address"),
-                fields: inner_fields,
+                fields: inner_fields.into(),
             },
         );
 
         let value = Value::Record {
             type_name: nx_hir::Name::new("result"),
-            fields,
+            fields: fields.into(),
         };
         let output = format_value(&value);
 
@@ -361,7 +355,7 @@ mod tests {
             emit: nx_hir::Name::new("SearchSubmitted"),
             action_name: nx_hir::Name::new("SearchSubmitted"),
             body,
-            captured: FxHashMap::default(),
+            captured: RecordFields::default(),
         };
 
         assert_eq!(
@@ -12,9 +12,8 @@ pub fn format_value_json_pretty(value: &Value) -> Result<String, String> {
 mod tests {
     use super::*;
     use nx_hir::{LoweredModule, Name, SourceId};
-    use nx_interpreter::RuntimeModuleId;
+    use nx_interpreter::{RecordFields, RuntimeModuleId};
     use nx_value::NxValue;
-    use rustc_hash::FxHashMap;
     use std::collections::BTreeMap;
 
     #[test]
@@ -27,7 +26,7 @@ mod tests {
             emit: Name::new("SearchSubmitted"),
             action_name: Name::new("SearchSubmitted"),
             body,
-            captured: FxHashMap::default(),
+            captured: RecordFields::default(),
         };
 
         let formatted = format_value_json_pretty(&value).expect("Action handler should serialize");
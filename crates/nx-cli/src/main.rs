@@ -1,7 +1,8 @@
 //! NX CLI - Command-line tools for parsing, checking, and running NX code.
 //!
 //! Provides commands like:
-//! - `nxlang run <file>` - Run an NX file and output the result
+//! - `nxlang run <file>` - Run an NX file or program artifact image and output the result
+//! - `nxlang build <file> --emit-artifact <image>` - Build an NX file into a program artifact image
 //! - `nxlang generate <path> --language <csharp|typescript>` - Generate language-specific type definitions
 //! - `nxlang parse <file>` - Parse and display AST (future)
 //! - `nxlang check <file>` - Type check and report errors (future)
@@ -43,8 +44,9 @@ enum Commands {
     ///
     /// Executes the root function in the NX file and prints the result.
     /// If the file has no root element/function, an error is reported.
+    /// Files with the `.nxa` extension are loaded as program artifact images written by `build`.
     Run {
-        /// Path to the NX file to run
+        /// Path to the NX file or program artifact image to run
         file: PathBuf,
 
         /// Output format for the evaluation result
@@ -56,6 +58,20 @@ enum Commands {
         output: Option<PathBuf>,
     },
 
+    /// Build an NX file into a program artifact image
+    ///
+    /// The image holds the analyzed program and its libraries, so `run` and the language
+    /// bindings can load it without the original sources. Images are tied to the NX version
+    /// that wrote them.
+    Build {
+        /// Path to the NX file to build
+        file: PathBuf,
+
+        /// Path of the program artifact image to write, conventionally with a `.nxa` extension
+        #[arg(long = "emit-artifact")]
+        emit_artifact: PathBuf,
+    },
+
     /// Generate language-specific type definitions from an NX file or library directory
     ///
     /// Outputs exported NX type declarations. File input generates one file. Directory input
@@ -83,6 +99,18 @@ enum Commands {
         /// Package prefix for TypeScript dependency-library imports (only used for --language typescript)
         #[arg(long = "typescript-package-prefix")]
         typescript_package_prefix: Option<String>,
+
+        /// Also generate typed MessagePack encoders and decoders for the exported types
+        #[arg(long)]
+        serializers: bool,
+
+        /// Directory used to cache analyzed libraries between runs (only used for library input)
+        #[arg(long = "library-cache")]
+        library_cache: Option<PathBuf>,
+
+        /// Threads used to analyze libraries; 0 uses all available cores (only used for library input)
+        #[arg(short = 'j', long, default_value_t = 0)]
+        jobs: usize,
     },
 }
 
@@ -116,6 +144,10 @@ fn main() -> ExitCode {
             format,
             output,
         } => run_file(&file, format, output.as_ref()),
+        Commands::Build {
+            file,
+            emit_artifact,
+        } => build_artifact(&file, &emit_artifact),
         Commands::Generate {
             file,
             language,
@@ -123,6 +155,9 @@ fn main() -> ExitCode {
             editorconfig,
             csharp_namespace,
             typescript_package_prefix,
+            serializers,
+            library_cache,
+            jobs,
         } => generate_types(
             &file,
             language,
@@ -130,6 +165,9 @@ fn main() -> ExitCode {
             editorconfig.as_ref(),
             &csharp_namespace,
             typescript_package_prefix.as_deref(),
+            serializers,
+            library_cache,
+            jobs,
         ),
     }
 }
@@ -141,24 +179,12 @@ fn run_file(path: &PathBuf, format: OutputFormat, output: Option<&PathBuf>) -> E
         return ExitCode::from(1);
     }
 
-    // Check if it's an .nx file
-    if path.extension().and_then(|e| e.to_str()) != Some("nx") {
-        eprintln!(
-            "Warning: File '{}' does not have .nx extension",
-            path.display()
-        );
-    }
-
-    // Read the source file once
-    let source = match std::fs::read_to_string(path) {
-        Ok(s) => s,
-        Err(e) => {
-            eprintln!("Error reading file: {}", e);
-            return ExitCode::from(1);
-        }
+    let program = if path.extension().and_then(|e| e.to_str()) == Some(PROGRAM_IMAGE_EXTENSION) {
+        load_program_image_for_run(path)
+    } else {
+        read_source_program_for_run(path)
     };
-
-    let program = match load_source_program_for_run(&source, path.as_path()) {
+    let program = match program {
         Ok(program) => program,
         Err(exit_code) => return exit_code,
     };
@@ -213,6 +239,36 @@ fn run_file(path: &PathBuf, format: OutputFormat, output: Option<&PathBuf>) -> E
     }
 }
 
+fn build_artifact(path: &PathBuf, emit_artifact: &Path) -> ExitCode {
+    if !path.exists() {
+        eprintln!("Error: File not found: {}", path.display());
+        return ExitCode::from(1);
+    }
+
+    let program = match read_source_program_for_run(path) {
+        Ok(program) => program,
+        Err(exit_code) => return exit_code,
+    };
+    let image = match program.to_image() {
+        Ok(image) => image,
+        Err(e) => {
+            eprintln!("Error: Failed to serialize program artifact: {}", e);
+            return ExitCode::from(1);
+        }
+    };
+
+    if let Err(e) = std::fs::write(emit_artifact, image) {
+        eprintln!(
+            "Error writing program artifact to '{}': {}",
+            emit_artifact.display(),
+            e
+        );
+        return ExitCode::from(1);
+    }
+
+    ExitCode::SUCCESS
+}
+
 fn generate_types(
     path: &PathBuf,
     language: GenLanguage,
@@ -220,6 +276,9 @@ fn generate_types(
     editorconfig: Option<&PathBuf>,
     csharp_namespace: &str,
     typescript_package_prefix: Option<&str>,
+    serializers: bool,
+    library_cache: Option<PathBuf>,
+    jobs: usize,
 ) -> ExitCode {
     let input_kind = match classify_generate_input(path) {
         Ok(kind) => kind,
@@ -261,12 +320,15 @@ fn generate_types(
         language: target_language,
         csharp_namespace,
         typescript_package_prefix,
+        serializers,
         format,
     };
 
     match input_kind {
         GenerateInputKind::SourceFile => generate_types_from_file(path, output, &opts),
-        GenerateInputKind::LibraryDirectory => generate_types_from_library(path, output, &opts),
+        GenerateInputKind::LibraryDirectory => {
+            generate_types_from_library(path, output, &opts, library_cache, jobs)
+        }
     }
 }
 
@@ -370,6 +432,8 @@ fn generate_types_from_library(
     path: &Path,
     output: Option<&PathBuf>,
     opts: &codegen::GenerateTypesOptions,
+    library_cache: Option<PathBuf>,
+    jobs: usize,
 ) -> ExitCode {
     let Some(output_root) = output else {
         eprintln!("Error: Library generation requires an output directory");
@@ -382,8 +446,10 @@ fn generate_types_from_library(
     }
 
     let registry = LibraryRegistry::new();
-    let library = match registry.load_library_from_directory(path) {
-        Ok(library) => library,
+    registry.set_cache_directory(library_cache);
+    registry.set_load_workers(jobs);
+    let library = match registry.load_libraries_from_directories([path]) {
+        Ok(mut libraries) => libraries.remove(0),
         Err(diagnostics) => return render_api_diagnostics(&diagnostics),
     };
 
@@ -522,6 +588,49 @@ fn load_source_module(
     }
 }
 
+/// File extension `run` treats as a program artifact image instead of NX source.
+const PROGRAM_IMAGE_EXTENSION: &str = "nxa";
+
+fn read_source_program_for_run(path: &Path) -> Result<ProgramArtifact, ExitCode> {
+    // Check if it's an .nx file
+    if path.extension().and_then(|e| e.to_str()) != Some("nx") {
+        eprintln!(
+            "Warning: File '{}' does not have .nx extension",
+            path.display()
+        );
+    }
+
+    // Read the source file once
+    let source = match std::fs::read_to_string(path) {
+        Ok(s) => s,
+        Err(e) => {
+            eprintln!("Error reading file: {}", e);
+            return Err(ExitCode::from(1));
+        }
+    };
+
+    load_source_program_for_run(&source, path)
+}
+
+fn load_program_image_for_run(path: &Path) -> Result<ProgramArtifact, ExitCode> {
+    let image = match std::fs::read(path) {
+        Ok(image) => image,
+        Err(e) => {
+            eprintln!("Error reading file: {}", e);
+            return Err(ExitCode::from(1));
+        }
+    };
+
+    ProgramArtifact::from_image(&image).map_err(|e| {
+        eprintln!(
+            "Error: Failed to load program artifact '{}': {}",
+            path.display(),
+            e
+        );
+        ExitCode::from(1)
+    })
+}
+
 fn load_source_program_for_run(source: &str, path: &Path) -> Result<ProgramArtifact, ExitCode> {
     let file_name = path.display().to_string();
     let build_context = ProgramBuildContext::empty();
@@ -987,6 +1096,42 @@ let root() = { Ui.title() }"#,
         assert_eq!(value, NxValue::Int(42));
     }
 
+    #[test]
+    fn test_cli_build_emits_artifact_image_that_run_loads() {
+        let (dir, file_path) = create_temp_nx_file("let root() = { 40 + 2 }");
+        let image_path = dir.path().join("test.nxa");
+
+        let output = run_cli(&[
+            "build",
+            file_path.to_str().unwrap(),
+            "--emit-artifact",
+            image_path.to_str().unwrap(),
+        ]);
+        assert!(output.status.success());
+        fs::remove_file(&file_path).unwrap();
+
+        let output = run_cli(&["run", image_path.to_str().unwrap(), "--format", "json"]);
+        assert!(output.status.success());
+        let stdout = String::from_utf8_lossy(&output.stdout);
+        assert_eq!(
+            NxValue::from_json_str(stdout.trim()).unwrap(),
+            NxValue::Int(42)
+        );
+    }
+
+    #[test]
+    fn test_cli_run_rejects_corrupt_artifact_image() {
+        let dir = TempDir::new().unwrap();
+        let image_path = dir.path().join("broken.nxa");
+        fs::write(&image_path, b"not an image").unwrap();
+
+        let output = run_cli(&["run", image_path.to_str().unwrap()]);
+
+        assert!(!output.status.success());
+        let stderr = String::from_utf8_lossy(&output.stderr);
+        assert!(stderr.contains("Failed to load program artifact"));
+    }
+
     #[test]
     fn test_cli_run_file_not_found() {
         let output = run_cli(&["run", "/nonexistent/path/to/file.nx"]);
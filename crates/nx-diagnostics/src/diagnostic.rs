@@ -1,9 +1,10 @@
 //! Core diagnostic types for representing errors, warnings, and information messages.
 
+use serde::{Deserialize, Serialize};
 use text_size::TextRange;
 
 /// Severity level of a diagnostic message.
-#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub enum Severity {
     /// A fatal error that prevents compilation.
     Error,
@@ -28,7 +29,7 @@ impl Severity {
 }
 
 /// A label pointing to a specific location in source code.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct Label {
     /// The source file this label refers to.
     pub file: String,
@@ -69,7 +70,7 @@ impl Label {
 }
 
 /// A diagnostic message (error, warning, info, or hint).
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct Diagnostic {
     /// Severity level of this diagnostic.
     severity: Severity,
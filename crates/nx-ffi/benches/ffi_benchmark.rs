@@ -0,0 +1,236 @@
+//! End-to-end benchmarks through the exported C ABI declared in `bindings/c/nx.h`.
+//!
+//! Every measured call crosses the same `extern "C"` entry points a native host uses, including
+//! MessagePack input decoding and MessagePack or JSON output encoding into an `NxBuffer`.
+
+use criterion::{black_box, criterion_group, criterion_main, Bencher, BenchmarkId, Criterion};
+use nx_api::{load_program_artifact_from_source, ProgramBuildContext};
+use nx_ffi::{
+    nx_build_program_artifact, nx_component_dispatch_actions_program_artifact,
+    nx_component_evaluate, nx_component_init, nx_create_library_registry,
+    nx_create_program_build_context, nx_eval_program_artifact, nx_free_buffer, nx_free_component,
+    nx_free_library_registry, nx_free_program_artifact, nx_free_program_build_context,
+    nx_resolve_component_program_artifact, NxBuffer, NxComponentHandle, NxEvalStatus,
+    NxLibraryRegistryHandle, NxOutputFormat, NxProgramArtifactHandle, NxProgramBuildContextHandle,
+};
+use nx_interpreter::Interpreter;
+use nx_value::NxValue;
+use std::collections::BTreeMap;
+use std::fs;
+use std::path::Path;
+
+const COMPONENT_FILE_NAME: &str = "component.nx";
+
+fn component_source() -> String {
+    fs::read_to_string(Path::new(env!("CARGO_MANIFEST_DIR")).join("../../examples/nx/component.nx"))
+        .expect("examples/nx/component.nx should be readable")
+}
+
+fn empty_buffer() -> NxBuffer {
+    NxBuffer {
+        ptr: std::ptr::null_mut(),
+        len: 0,
+        cap: 0,
+    }
+}
+
+fn expect_ok(status: NxEvalStatus, out: NxBuffer, operation: &str) {
+    let ok = matches!(status, NxEvalStatus::Ok);
+    nx_free_buffer(out);
+    assert!(ok, "{operation} should succeed");
+}
+
+/// Makes one call outside measurement and checks that it succeeds with output, so a benchmark
+/// never silently times an error path.
+fn assert_ok_output(operation: &str, call: impl FnOnce(*mut NxBuffer) -> NxEvalStatus) {
+    let mut out = empty_buffer();
+    let status = call(&mut out as *mut NxBuffer);
+    let len = out.len;
+    nx_free_buffer(out);
+    assert!(
+        matches!(status, NxEvalStatus::Ok),
+        "{operation} should succeed"
+    );
+    assert!(len > 0, "{operation} should produce output");
+}
+
+fn measure_call(b: &mut Bencher<'_>, call: impl Fn(*mut NxBuffer) -> NxEvalStatus) {
+    b.iter(|| {
+        let mut out = empty_buffer();
+        let status = call(&mut out as *mut NxBuffer);
+        black_box(&status);
+        nx_free_buffer(out);
+    });
+}
+
+fn build_component_artifact(source: &str) -> *mut NxProgramArtifactHandle {
+    let mut registry: *mut NxLibraryRegistryHandle = std::ptr::null_mut();
+    assert!(matches!(
+        nx_create_library_registry(&mut registry as *mut *mut NxLibraryRegistryHandle),
+        NxEvalStatus::Ok
+    ));
+    let mut build_context: *mut NxProgramBuildContextHandle = std::ptr::null_mut();
+    assert!(matches!(
+        nx_create_program_build_context(
+            registry as *const NxLibraryRegistryHandle,
+            &mut build_context as *mut *mut NxProgramBuildContextHandle,
+        ),
+        NxEvalStatus::Ok
+    ));
+    nx_free_library_registry(registry);
+
+    let mut program: *mut NxProgramArtifactHandle = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let status = nx_build_program_artifact(
+        build_context as *const NxProgramBuildContextHandle,
+        source.as_ptr(),
+        source.len(),
+        COMPONENT_FILE_NAME.as_ptr(),
+        COMPONENT_FILE_NAME.len(),
+        &mut program as *mut *mut NxProgramArtifactHandle,
+        &mut out as *mut NxBuffer,
+    );
+    nx_free_program_build_context(build_context);
+    expect_ok(status, out, "building examples/nx/component.nx");
+    program
+}
+
+fn resolve_component(
+    program: *const NxProgramArtifactHandle,
+    component_name: &str,
+) -> *mut NxComponentHandle {
+    let mut component: *mut NxComponentHandle = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let status = nx_resolve_component_program_artifact(
+        program,
+        component_name.as_ptr(),
+        component_name.len(),
+        &mut component as *mut *mut NxComponentHandle,
+        &mut out as *mut NxBuffer,
+    );
+    expect_ok(status, out, "resolving SearchBox");
+    component
+}
+
+fn msgpack_record(properties: &[(&str, &str)]) -> Vec<u8> {
+    rmp_serde::to_vec_named(&NxValue::Record {
+        type_name: None,
+        properties: properties
+            .iter()
+            .map(|(name, value)| (name.to_string(), NxValue::String(value.to_string())))
+            .collect::<BTreeMap<_, _>>(),
+    })
+    .expect("record should encode")
+}
+
+/// Builds a dispatchable snapshot from the example's root element, whose action handler props
+/// cannot be expressed as MessagePack input.
+fn handler_snapshot(source: &str) -> Vec<u8> {
+    let program = load_program_artifact_from_source(
+        source,
+        COMPONENT_FILE_NAME,
+        &ProgramBuildContext::empty(),
+    )
+    .expect("examples/nx/component.nx should build");
+    let interpreter = Interpreter::from_resolved_program(program.resolved_program.clone());
+    let entry_module_id = program.entry_module_id.expect("entry module id");
+    let props = interpreter
+        .execute_resolved_program_module_function(entry_module_id, "root", vec![])
+        .expect("component.nx root should render");
+    interpreter
+        .initialize_resolved_component("SearchBox", props)
+        .expect("SearchBox should initialize from the root element")
+        .state_snapshot
+}
+
+fn output_formats() -> [(&'static str, NxOutputFormat); 2] {
+    [
+        ("msgpack", NxOutputFormat::MessagePack),
+        ("json", NxOutputFormat::Json),
+    ]
+}
+
+fn ffi_benchmark(c: &mut Criterion) {
+    let source = component_source();
+    let program = build_component_artifact(&source);
+    let component = resolve_component(program, "SearchBox");
+    let props = msgpack_record(&[("placeholder", "Find docs")]);
+    let state = msgpack_record(&[("query", "docs")]);
+    let snapshot = handler_snapshot(&source);
+    let actions = rmp_serde::to_vec_named(&vec![NxValue::Record {
+        type_name: Some("SearchSubmitted".to_string()),
+        properties: BTreeMap::from([(
+            "searchString".to_string(),
+            NxValue::String("docs".to_string()),
+        )]),
+    }])
+    .expect("actions should encode");
+
+    let mut group = c.benchmark_group("ffi");
+    group.bench_function("build_program_artifact", |b| {
+        b.iter(|| nx_free_program_artifact(build_component_artifact(black_box(&source))));
+    });
+
+    for (format_name, format) in output_formats() {
+        let format = format as u32;
+        let eval = |out: *mut NxBuffer| nx_eval_program_artifact(program, format, out);
+        let init = |out: *mut NxBuffer| {
+            nx_component_init(
+                component,
+                props.as_ptr(),
+                props.len(),
+                std::ptr::null(),
+                format,
+                out,
+            )
+        };
+        let evaluate = |out: *mut NxBuffer| {
+            nx_component_evaluate(
+                component,
+                props.as_ptr(),
+                props.len(),
+                state.as_ptr(),
+                state.len(),
+                std::ptr::null(),
+                format,
+                out,
+            )
+        };
+        let dispatch = |out: *mut NxBuffer| {
+            nx_component_dispatch_actions_program_artifact(
+                program,
+                snapshot.as_ptr(),
+                snapshot.len(),
+                actions.as_ptr(),
+                actions.len(),
+                format,
+                out,
+            )
+        };
+
+        assert_ok_output("eval_program_artifact", eval);
+        group.bench_function(
+            BenchmarkId::new("eval_program_artifact", format_name),
+            |b| measure_call(b, eval),
+        );
+        assert_ok_output("component_init", init);
+        group.bench_function(BenchmarkId::new("component_init", format_name), |b| {
+            measure_call(b, init)
+        });
+        assert_ok_output("component_evaluate", evaluate);
+        group.bench_function(BenchmarkId::new("component_evaluate", format_name), |b| {
+            measure_call(b, evaluate)
+        });
+        assert_ok_output("component_dispatch", dispatch);
+        group.bench_function(BenchmarkId::new("component_dispatch", format_name), |b| {
+            measure_call(b, dispatch)
+        });
+    }
+    group.finish();
+
+    nx_free_component(component);
+    nx_free_program_artifact(program);
+}
+
+criterion_group!(benches, ffi_benchmark);
+criterion_main!(benches);
@@ -3,22 +3,38 @@
 use base64::engine::general_purpose::STANDARD as BASE64_STANDARD;
 use base64::Engine;
 use nx_api::{
-    build_workspace_program_artifact,
-    dispatch_component_actions_program_artifact as api_dispatch_component_actions_program_artifact,
-    eval_program_artifact as api_eval_program_artifact, eval_source,
-    evaluate_component_program_artifact as api_evaluate_component_program_artifact,
-    initialize_component_program_artifact as api_initialize_component_program_artifact,
-    load_program_artifact_from_source, validate_workspace, ComponentDispatchEvalResult,
-    ComponentDispatchResult, ComponentEvaluateEvalResult, ComponentInitEvalResult,
-    ComponentInitResult, EvalResult, LibraryRegistry, NxDiagnostic, NxSeverity, NxWorkspace,
-    NxWorkspaceModule as ApiNxWorkspaceModule, ProgramArtifact, ProgramBuildContext,
+    apply_component_snapshot_delta, build_workspace_program_artifact, component_snapshot_delta,
+    dispatch_component_actions_program_artifact_runtime_with_limits as api_dispatch_component_actions_program_artifact,
+    eval_program_artifact_runtime_with_limits as api_eval_program_artifact, eval_source,
+    eval_stats, eval_stats_enabled,
+    evaluate_component_batch_program_artifact_runtime_with_limits as api_evaluate_component_batch_program_artifact,
+    evaluate_component_program_artifact_runtime_with_limits as api_evaluate_component_program_artifact,
+    evaluate_resolved_component_program_artifact_cached_with_limits as api_evaluate_resolved_component_program_artifact_cached,
+    evaluate_resolved_component_program_artifact_runtime_with_limits as api_evaluate_resolved_component_program_artifact,
+    initialize_component_program_artifact_runtime_with_limits as api_initialize_component_program_artifact,
+    initialize_resolved_component_program_artifact_runtime_with_limits as api_initialize_resolved_component_program_artifact,
+    load_program_artifact_from_source, rebuild_workspace_program_artifact, reset_eval_stats,
+    resolve_component_program_artifact as api_resolve_component_program_artifact,
+    set_eval_stats_enabled, validate_workspace, ComponentEvaluateRequest, ComponentInput,
+    ComponentRenderCache, ComponentResolveEvalResult, EvalResult, LibraryRegistry, NxDiagnostic,
+    NxSeverity, NxValueView, NxWorkspace, NxWorkspaceModule as ApiNxWorkspaceModule,
+    ProgramArtifact, ProgramBuildContext, ResolvedComponent,
+};
+use nx_interpreter::{
+    CancellationToken, ComponentDispatchResult, ComponentInitResult, ResourceLimits, Value,
 };
 use nx_value::NxValue;
-use serde::Serialize;
+use serde::{Serialize, Serializer};
 use std::any::Any;
+use std::cell::Cell;
+use std::ffi::c_void;
+use std::io::{self, BufWriter, Write};
 use std::panic;
+use std::path::PathBuf;
+use std::sync::Arc;
+use std::time::{Duration, Instant};
 
-pub const NX_FFI_ABI_VERSION: u32 = 10;
+pub const NX_FFI_ABI_VERSION: u32 = 26;
 
 #[repr(C)]
 pub struct NxBuffer {
@@ -35,10 +51,95 @@ pub struct NxWorkspaceModule {
     pub source_utf8_len: usize,
 }
 
+/// Borrowed UTF-8 root directory of one library submitted to `nx_load_libraries_into_registry`.
+#[repr(C)]
+pub struct NxLibraryRoot {
+    pub root_path_ptr: *const u8,
+    pub root_path_len: usize,
+}
+
+/// Borrowed inputs for one component evaluation submitted to
+/// `nx_component_evaluate_batch_program_artifact`.
+///
+/// Empty props or state bytes evaluate with an empty record, matching
+/// `nx_component_evaluate_program_artifact`.
+#[repr(C)]
+pub struct NxComponentEvaluateRequest {
+    pub component_name_ptr: *const u8,
+    pub component_name_len: usize,
+    pub props_ptr: *const u8,
+    pub props_len: usize,
+    pub state_ptr: *const u8,
+    pub state_len: usize,
+}
+
+/// One offset-table entry at the start of a batch output buffer.
+///
+/// `offset` and `len` locate the entry payload in bytes from the start of the same buffer.
+/// Entries are written in native byte order but the buffer is not guaranteed to be aligned, so
+/// consumers should copy entries out instead of dereferencing them in place.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct NxBatchResultEntry {
+    pub status: u32,
+    pub reserved: u32,
+    pub offset: u64,
+    pub len: u64,
+}
+
+/// Borrowed view of one payload owned by an `NxOutputArenaHandle`.
+///
+/// The bytes stay valid until the arena is reset or freed. Views must not be passed to
+/// `nx_free_buffer`.
+#[repr(C)]
+pub struct NxBufferView {
+    pub ptr: *const u8,
+    pub len: usize,
+}
+
+/// Per-call evaluation limits accepted by the `*_with_limits` entry points.
+///
+/// Zero `max_operations` or `max_recursion_depth` keeps the default limit, and zero
+/// `max_duration_micros` means no deadline. `cancellation` may be null. The deadline and the
+/// cancellation flag are polled every 1024 operations, so an interrupted call returns
+/// shortly after either trips.
+#[repr(C)]
+pub struct NxEvalLimits {
+    pub max_operations: u64,
+    pub max_recursion_depth: u64,
+    pub max_duration_micros: u64,
+    pub cancellation: *const NxCancellationHandle,
+}
+
+/// Cancellation flag a host trips from any thread to stop the evaluations it was passed to.
+///
+/// Free the handle only after every call using it has returned.
+pub struct NxCancellationHandle;
+
+struct CancellationHandleInner {
+    token: CancellationToken,
+}
+
+/// Immutable program artifact built from a workspace, source, or image.
+///
+/// Evaluation functions may use one handle from multiple threads at the same time; each call
+/// reuses a pooled interpreter owned by the artifact. Free the handle only after every call using
+/// it has returned.
 pub struct NxProgramArtifactHandle;
 
 struct ProgramArtifactHandleInner {
-    program_artifact: ProgramArtifact,
+    program_artifact: Arc<ProgramArtifact>,
+}
+
+/// Entry component resolved once from a program artifact.
+///
+/// The handle shares ownership of the artifact, so it stays usable after the artifact handle it
+/// was resolved from is freed.
+pub struct NxComponentHandle;
+
+struct ComponentHandleInner {
+    program_artifact: Arc<ProgramArtifact>,
+    component: ResolvedComponent,
 }
 
 pub struct NxLibraryRegistryHandle;
@@ -53,6 +154,92 @@ struct ProgramBuildContextHandleInner {
     build_context: ProgramBuildContext,
 }
 
+pub struct NxOutputArenaHandle;
+
+struct OutputArenaHandleInner {
+    arena: OutputArena,
+}
+
+/// Memory-bounded cache of rendered component output shared by `nx_component_evaluate_cached`
+/// calls. The cache is safe to use from multiple threads at the same time.
+pub struct NxRenderCacheHandle;
+
+struct RenderCacheHandleInner {
+    cache: ComponentRenderCache,
+}
+
+/// Counters reported by `nx_get_render_cache_stats`.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct NxRenderCacheStats {
+    pub hits: u64,
+    pub misses: u64,
+    pub entries: u64,
+    pub bytes: u64,
+    pub capacity_bytes: u64,
+}
+
+/// Counters and timings reported by `nx_get_eval_stats` for the calling thread's most recent
+/// evaluation call.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct NxEvalStats {
+    pub evaluations: u64,
+    pub operations: u64,
+    pub peak_call_depth: u64,
+    pub eval_nanos: u64,
+    pub encode_nanos: u64,
+}
+
+/// Host callback that receives one chunk of a payload streamed by the `*_into_callback` entry
+/// points.
+///
+/// `ptr` and `len` describe bytes that are only valid for the duration of the call. Return `0`
+/// to receive the next chunk or any other value to stop the stream.
+pub type NxWriteCallback = extern "C" fn(user_data: *mut c_void, ptr: *const u8, len: usize) -> i32;
+
+/// Module counts and per-phase timings reported by `nx_get_program_artifact_build_stats`.
+#[repr(C)]
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct NxProgramBuildStats {
+    pub parsed_modules: u64,
+    pub analyzed_modules: u64,
+    pub parse_nanos: u64,
+    pub lower_nanos: u64,
+    pub analyze_nanos: u64,
+    pub link_nanos: u64,
+}
+
+thread_local! {
+    /// Time the calling thread spent encoding output payloads since its last `begin_eval_stats`.
+    static ENCODE_TIME: Cell<Duration> = Cell::new(Duration::ZERO);
+}
+
+/// Starts the statistics `nx_get_eval_stats` reports for the evaluation call now running on this
+/// thread.
+fn begin_eval_stats() {
+    if eval_stats_enabled() {
+        reset_eval_stats();
+        ENCODE_TIME.with(|encode_time| encode_time.set(Duration::ZERO));
+    }
+}
+
+/// Runs one payload encoding, adding its duration to the thread's encode time when statistics are
+/// enabled.
+fn timed_encode<T>(encode: impl FnOnce() -> T) -> T {
+    if !eval_stats_enabled() {
+        return encode();
+    }
+    let started = Instant::now();
+    let result = encode();
+    ENCODE_TIME.with(|encode_time| encode_time.set(encode_time.get() + started.elapsed()));
+    result
+}
+
+fn duration_nanos(duration: Duration) -> u64 {
+    u64::try_from(duration.as_nanos()).unwrap_or(u64::MAX)
+}
+
 impl NxBuffer {
     fn empty() -> Self {
         Self {
@@ -63,6 +250,15 @@ impl NxBuffer {
     }
 }
 
+impl NxBufferView {
+    fn empty() -> Self {
+        Self {
+            ptr: std::ptr::null(),
+            len: 0,
+        }
+    }
+}
+
 #[repr(u32)]
 pub enum NxEvalStatus {
     Ok = 0,
@@ -90,21 +286,79 @@ impl TryFrom<u32> for NxOutputFormat {
     }
 }
 
+/// Component init payload shape shared by both output formats; `S` is the snapshot encoding
+/// (raw MessagePack bytes or a base64 JSON string).
 #[derive(Serialize)]
-struct JsonComponentInitResult<'a> {
-    rendered: &'a NxValue,
-    state_snapshot: String,
+struct ComponentInitPayload<'a, S> {
+    rendered: NxValueView<'a>,
+    state_snapshot: S,
 }
 
+/// Component dispatch payload shape shared by both output formats.
 #[derive(Serialize)]
-struct JsonComponentDispatchResult<'a> {
-    effects: &'a [NxValue],
-    state_snapshot: String,
+struct ComponentDispatchPayload<'a, S> {
+    effects: EffectsView<'a>,
+    state_snapshot: S,
+}
+
+/// Serializes dispatch effects as a sequence of [`NxValueView`]s.
+struct EffectsView<'a>(&'a [Value]);
+
+impl Serialize for EffectsView<'_> {
+    fn serialize<S: Serializer>(&self, serializer: S) -> Result<S::Ok, S::Error> {
+        serializer.collect_seq(self.0.iter().map(NxValueView::new))
+    }
+}
+
+/// Serializes a state snapshot as a MessagePack binary value.
+struct SnapshotBytes<'a>(&'a [u8]);
+
+impl Serialize for SnapshotBytes<'_> {
+    fn serialize<S: Serializer>(&self, serializer: S) -> Result<S::Ok, S::Error> {
+        serializer.serialize_bytes(self.0)
+    }
+}
+
+fn msgpack_component_init_payload(
+    result: &ComponentInitResult,
+) -> ComponentInitPayload<'_, SnapshotBytes<'_>> {
+    ComponentInitPayload {
+        rendered: NxValueView::new(&result.rendered),
+        state_snapshot: SnapshotBytes(&result.state_snapshot),
+    }
+}
+
+fn json_component_init_payload(result: &ComponentInitResult) -> ComponentInitPayload<'_, String> {
+    ComponentInitPayload {
+        rendered: NxValueView::new(&result.rendered),
+        state_snapshot: BASE64_STANDARD.encode(&result.state_snapshot),
+    }
+}
+
+fn msgpack_component_dispatch_payload(
+    result: &ComponentDispatchResult,
+) -> ComponentDispatchPayload<'_, SnapshotBytes<'_>> {
+    ComponentDispatchPayload {
+        effects: EffectsView(&result.effects),
+        state_snapshot: SnapshotBytes(&result.state_snapshot),
+    }
+}
+
+fn json_component_dispatch_payload(
+    result: &ComponentDispatchResult,
+) -> ComponentDispatchPayload<'_, String> {
+    ComponentDispatchPayload {
+        effects: EffectsView(&result.effects),
+        state_snapshot: BASE64_STANDARD.encode(&result.state_snapshot),
+    }
 }
 
 enum FfiPayload {
     Msgpack(Vec<u8>),
     Json(String),
+    Batch(Vec<u8>),
+    /// The payload was already streamed to a host callback, so `out_buffer` stays empty.
+    Streamed,
 }
 
 impl FfiPayload {
@@ -112,7 +366,247 @@ impl FfiPayload {
         match self {
             Self::Msgpack(payload) => write_msgpack_payload(out_buffer, payload),
             Self::Json(payload) => write_json_payload(out_buffer, payload),
+            Self::Batch(payload) => unsafe {
+                *out_buffer = vec_to_buffer(payload);
+            },
+            Self::Streamed => {}
+        }
+    }
+}
+
+/// Builds one contiguous batch output buffer: an [`NxBatchResultEntry`] table sized for every
+/// request, followed by each entry payload serialized in place.
+struct BatchOutputWriter {
+    bytes: Vec<u8>,
+    entry_count: usize,
+    next_entry: usize,
+}
+
+impl BatchOutputWriter {
+    const ENTRY_SIZE: usize = std::mem::size_of::<NxBatchResultEntry>();
+
+    fn new(entry_count: usize) -> Self {
+        Self {
+            bytes: vec![0; entry_count * Self::ENTRY_SIZE],
+            entry_count,
+            next_entry: 0,
+        }
+    }
+
+    fn push(
+        &mut self,
+        status: NxEvalStatus,
+        write_payload: impl FnOnce(&mut Vec<u8>) -> Result<(), String>,
+    ) -> Result<(), String> {
+        debug_assert!(self.next_entry < self.entry_count);
+        let offset = self.bytes.len();
+        timed_encode(|| write_payload(&mut self.bytes))?;
+        let entry = NxBatchResultEntry {
+            status: status as u32,
+            reserved: 0,
+            offset: offset as u64,
+            len: (self.bytes.len() - offset) as u64,
+        };
+
+        let start = self.next_entry * Self::ENTRY_SIZE;
+        let table = &mut self.bytes[start..start + Self::ENTRY_SIZE];
+        table[0..4].copy_from_slice(&entry.status.to_ne_bytes());
+        table[4..8].copy_from_slice(&entry.reserved.to_ne_bytes());
+        table[8..16].copy_from_slice(&entry.offset.to_ne_bytes());
+        table[16..24].copy_from_slice(&entry.len.to_ne_bytes());
+        self.next_entry += 1;
+        Ok(())
+    }
+
+    fn finish(self) -> Vec<u8> {
+        debug_assert_eq!(self.next_entry, self.entry_count);
+        self.bytes
+    }
+}
+
+/// Interpreter-level result of one program-artifact entry point before it is serialized.
+///
+/// Values stay in interpreter form and are written through [`NxValueView`], so the payload is
+/// encoded in one pass without building an intermediate [`NxValue`] tree.
+enum FfiOutput {
+    Value(Value),
+    Diagnostics(Vec<NxDiagnostic>),
+    ComponentInit(ComponentInitResult),
+    ComponentDispatch(ComponentDispatchResult),
+}
+
+impl FfiOutput {
+    fn to_payload(&self, output_format: NxOutputFormat) -> Result<FfiPayload, String> {
+        timed_encode(|| match self {
+            Self::Value(value) => serialize_eval_payload(output_format, &NxValueView::new(value)),
+            Self::Diagnostics(diagnostics) => {
+                serialize_diagnostics_payload(output_format, diagnostics)
+            }
+            Self::ComponentInit(result) => serialize_component_init_payload(output_format, result),
+            Self::ComponentDispatch(result) => {
+                serialize_component_dispatch_payload(output_format, result)
+            }
+        })
+    }
+
+    fn write_into<W: Write + ?Sized>(
+        &self,
+        output_format: NxOutputFormat,
+        out: &mut W,
+    ) -> Result<(), String> {
+        timed_encode(|| match self {
+            Self::Value(value) => {
+                write_eval_payload_into(output_format, &NxValueView::new(value), out)
+            }
+            Self::Diagnostics(diagnostics) => {
+                write_diagnostics_payload_into(output_format, diagnostics, out)
+            }
+            Self::ComponentInit(result) => {
+                write_component_init_payload_into(output_format, result, out)
+            }
+            Self::ComponentDispatch(result) => {
+                write_component_dispatch_payload_into(output_format, result, out)
+            }
+        })
+    }
+}
+
+const OUTPUT_ARENA_MIN_CHUNK_SIZE: usize = 4096;
+
+/// Bytes buffered before a streamed payload is handed to the host callback. Larger single writes,
+/// such as long strings, are passed through in one chunk.
+const OUTPUT_CALLBACK_CHUNK_SIZE: usize = 64 * 1024;
+
+/// [`Write`] adapter that forwards every chunk to a host [`NxWriteCallback`].
+struct CallbackWriter {
+    write: NxWriteCallback,
+    user_data: *mut c_void,
+}
+
+impl Write for CallbackWriter {
+    fn write(&mut self, buf: &[u8]) -> io::Result<usize> {
+        if buf.is_empty() {
+            return Ok(0);
+        }
+        match (self.write)(self.user_data, buf.as_ptr(), buf.len()) {
+            0 => Ok(buf.len()),
+            code => Err(io::Error::other(format!(
+                "output callback stopped the stream with code {code}"
+            ))),
+        }
+    }
+
+    fn flush(&mut self) -> io::Result<()> {
+        Ok(())
+    }
+}
+
+/// Streams a successful output to `write` in chunks; diagnostics stay the `out_buffer` payload so
+/// the host learns about failures before any bytes reach its sink.
+///
+/// Encoding starts only once evaluation finished, so a status other than `Ok` never streams.
+/// When encoding or the callback fails mid-stream, the bytes already delivered are incomplete and
+/// the error is reported like any other entry-point failure.
+fn stream_output(
+    status: NxEvalStatus,
+    output: FfiOutput,
+    output_format: NxOutputFormat,
+    write: NxWriteCallback,
+    user_data: *mut c_void,
+) -> Result<(NxEvalStatus, FfiPayload), String> {
+    if !matches!(status, NxEvalStatus::Ok) {
+        return Ok((status, output.to_payload(output_format)?));
+    }
+
+    let mut sink = BufWriter::with_capacity(
+        OUTPUT_CALLBACK_CHUNK_SIZE,
+        CallbackWriter { write, user_data },
+    );
+    let written = output.write_into(output_format, &mut sink).and_then(|()| {
+        sink.flush()
+            .map_err(|e| format!("output stream failed: {e}"))
+    });
+    // Bytes still buffered after a failure are discarded instead of flushed on drop.
+    let _ = sink.into_parts();
+    written?;
+    Ok((NxEvalStatus::Ok, FfiPayload::Streamed))
+}
+
+/// Reusable output storage for the `*_into_arena` entry points.
+///
+/// Payloads are appended to one active chunk. When a payload outgrows the chunk it moves to a
+/// larger one and the old chunk is retired, so views handed out earlier never move. Resetting
+/// keeps only the active (largest) chunk, so a warmed-up arena serializes without allocating.
+#[derive(Default)]
+struct OutputArena {
+    active: Vec<u8>,
+    retired: Vec<Vec<u8>>,
+}
+
+impl OutputArena {
+    fn write_output(
+        &mut self,
+        output_format: NxOutputFormat,
+        output: &FfiOutput,
+    ) -> Result<NxBufferView, String> {
+        let mut writer = OutputArenaWriter {
+            start: self.active.len(),
+            arena: self,
+        };
+        let result = output.write_into(output_format, &mut writer);
+        let start = writer.start;
+        if let Err(message) = result {
+            self.active.truncate(start);
+            return Err(message);
+        }
+
+        let payload = &self.active[start..];
+        Ok(NxBufferView {
+            ptr: payload.as_ptr(),
+            len: payload.len(),
+        })
+    }
+
+    fn reset(&mut self) {
+        self.retired.clear();
+        self.active.clear();
+    }
+}
+
+struct OutputArenaWriter<'a> {
+    arena: &'a mut OutputArena,
+    start: usize,
+}
+
+impl OutputArenaWriter<'_> {
+    fn grow(&mut self, additional: usize) {
+        let arena = &mut *self.arena;
+        let written = arena.active.len() - self.start;
+        let capacity = (arena.active.capacity() * 2)
+            .max(written + additional)
+            .max(OUTPUT_ARENA_MIN_CHUNK_SIZE);
+        let mut next = Vec::with_capacity(capacity);
+        next.extend_from_slice(&arena.active[self.start..]);
+        let previous = std::mem::replace(&mut arena.active, next);
+        if self.start > 0 {
+            // Earlier payloads in the previous chunk may still be borrowed through views.
+            arena.retired.push(previous);
         }
+        self.start = 0;
+    }
+}
+
+impl Write for OutputArenaWriter<'_> {
+    fn write(&mut self, buf: &[u8]) -> io::Result<usize> {
+        if self.arena.active.capacity() - self.arena.active.len() < buf.len() {
+            self.grow(buf.len());
+        }
+        self.arena.active.extend_from_slice(buf);
+        Ok(buf.len())
+    }
+
+    fn flush(&mut self) -> io::Result<()> {
+        Ok(())
     }
 }
 
@@ -170,6 +664,31 @@ fn parse_output_format(output_format: u32) -> Result<NxOutputFormat, NxEvalStatu
     NxOutputFormat::try_from(output_format)
 }
 
+/// Converts optional `NxEvalLimits` into interpreter limits; a null pointer keeps every default.
+fn parse_eval_limits(limits_ptr: *const NxEvalLimits) -> ResourceLimits {
+    let mut limits = ResourceLimits::default();
+    if limits_ptr.is_null() {
+        return limits;
+    }
+
+    let descriptor = unsafe { &*limits_ptr };
+    if descriptor.max_operations != 0 {
+        limits.max_operations = usize::try_from(descriptor.max_operations).unwrap_or(usize::MAX);
+    }
+    if descriptor.max_recursion_depth != 0 {
+        limits.max_recursion_depth =
+            usize::try_from(descriptor.max_recursion_depth).unwrap_or(usize::MAX);
+    }
+    if descriptor.max_duration_micros != 0 {
+        limits.max_duration = Some(Duration::from_micros(descriptor.max_duration_micros));
+    }
+    if !descriptor.cancellation.is_null() {
+        let handle = unsafe { &*descriptor.cancellation.cast::<CancellationHandleInner>() };
+        limits.cancellation = Some(handle.token.clone());
+    }
+    limits
+}
+
 fn prepare_out_program_artifact_handle(
     out_handle: *mut *mut NxProgramArtifactHandle,
 ) -> Result<(), NxEvalStatus> {
@@ -253,6 +772,80 @@ fn finish_output_entry(
     }
 }
 
+fn prepare_out_component_handle(
+    out_handle: *mut *mut NxComponentHandle,
+) -> Result<(), NxEvalStatus> {
+    unsafe {
+        if out_handle.is_null() {
+            return Err(NxEvalStatus::InvalidArgument);
+        }
+
+        *out_handle = std::ptr::null_mut();
+    }
+
+    Ok(())
+}
+
+fn prepare_out_output_arena_handle(
+    out_handle: *mut *mut NxOutputArenaHandle,
+) -> Result<(), NxEvalStatus> {
+    unsafe {
+        if out_handle.is_null() {
+            return Err(NxEvalStatus::InvalidArgument);
+        }
+
+        *out_handle = std::ptr::null_mut();
+    }
+
+    Ok(())
+}
+
+fn prepare_out_view(out_view: *mut NxBufferView) -> Result<(), NxEvalStatus> {
+    unsafe {
+        if out_view.is_null() {
+            return Err(NxEvalStatus::InvalidArgument);
+        }
+        *out_view = NxBufferView::empty();
+    }
+
+    Ok(())
+}
+
+fn finish_arena_entry(
+    arena_ptr: *mut NxOutputArenaHandle,
+    out_view: *mut NxBufferView,
+    output_format: NxOutputFormat,
+    result: Result<Result<(NxEvalStatus, FfiOutput), String>, Box<dyn Any + Send>>,
+) -> NxEvalStatus {
+    let (status, output) = match result {
+        Ok(Ok(output)) => output,
+        Ok(Err(message)) => (
+            NxEvalStatus::Error,
+            FfiOutput::Diagnostics(ffi_error_diagnostics(message)),
+        ),
+        Err(_) => return NxEvalStatus::Panic,
+    };
+
+    let arena = unsafe { &mut (*arena_ptr.cast::<OutputArenaHandleInner>()).arena };
+    match arena.write_output(output_format, &output) {
+        Ok(view) => {
+            unsafe {
+                *out_view = view;
+            }
+            status
+        }
+        Err(message) => {
+            let diagnostics = FfiOutput::Diagnostics(ffi_error_diagnostics(message));
+            if let Ok(view) = arena.write_output(output_format, &diagnostics) {
+                unsafe {
+                    *out_view = view;
+                }
+            }
+            NxEvalStatus::Error
+        }
+    }
+}
+
 fn parse_file_name(file_name_ptr: *const u8, file_name_len: usize) -> Result<String, String> {
     let file_name = unsafe { slice_to_str(file_name_ptr, file_name_len) }.unwrap_or("input.nx");
     if file_name.is_empty() {
@@ -314,6 +907,18 @@ fn with_program_artifact<T>(
     f(&handle.program_artifact)
 }
 
+fn with_component<T>(
+    handle_ptr: *const NxComponentHandle,
+    f: impl FnOnce(&ProgramArtifact, &ResolvedComponent) -> Result<T, String>,
+) -> Result<T, String> {
+    if handle_ptr.is_null() {
+        return Err("component handle is null".to_string());
+    }
+
+    let handle = unsafe { &*handle_ptr.cast::<ComponentHandleInner>() };
+    f(&handle.program_artifact, &handle.component)
+}
+
 fn with_library_registry<T>(
     handle_ptr: *const NxLibraryRegistryHandle,
     f: impl FnOnce(&LibraryRegistry) -> Result<T, String>,
@@ -337,38 +942,41 @@ fn parse_msgpack_value(bytes: &[u8]) -> Result<NxValue, String> {
     NxValue::from_msgpack_slice(bytes).map_err(|e| format!("messagepack decode failed: {e}"))
 }
 
-fn parse_msgpack_actions(bytes: &[u8]) -> Result<Vec<NxValue>, String> {
-    rmp_serde::from_slice(bytes).map_err(|e| format!("messagepack decode failed: {e}"))
-}
+/// MessagePack encoding of an empty untyped record, used when the host passes no props or state.
+const EMPTY_RECORD_MSGPACK: &[u8] = &[0x80];
 
-fn json_component_init_payload(result: &ComponentInitResult) -> Result<String, String> {
-    serde_json::to_string(&JsonComponentInitResult {
-        rendered: &result.rendered,
-        state_snapshot: BASE64_STANDARD.encode(&result.state_snapshot),
-    })
-    .map_err(|e| format!("json serialize failed: {e}"))
+/// Borrows MessagePack props or state for one component call.
+///
+/// The bytes are decoded straight into interpreter values by the API, so no intermediate
+/// [`NxValue`] tree is built. An empty input stands for an empty record.
+unsafe fn msgpack_component_input<'a>(
+    ptr: *const u8,
+    len: usize,
+) -> Result<ComponentInput<'a>, String> {
+    if len == 0 {
+        return Ok(ComponentInput::MessagePack(EMPTY_RECORD_MSGPACK));
+    }
+
+    Ok(ComponentInput::MessagePack(unsafe {
+        slice_to_bytes(ptr, len)
+    }?))
 }
 
-fn json_component_dispatch_payload(result: &ComponentDispatchResult) -> Result<String, String> {
-    serde_json::to_string(&JsonComponentDispatchResult {
-        effects: &result.effects,
-        state_snapshot: BASE64_STANDARD.encode(&result.state_snapshot),
-    })
-    .map_err(|e| format!("json serialize failed: {e}"))
+fn parse_msgpack_actions(bytes: &[u8]) -> Result<Vec<NxValue>, String> {
+    rmp_serde::from_slice(bytes).map_err(|e| format!("messagepack decode failed: {e}"))
 }
 
-fn serialize_eval_payload(
+/// Serializes an evaluated value, either a public [`NxValue`] or an interpreter [`NxValueView`].
+fn serialize_eval_payload<T: Serialize + ?Sized>(
     output_format: NxOutputFormat,
-    value: &NxValue,
+    value: &T,
 ) -> Result<FfiPayload, String> {
     match output_format {
         NxOutputFormat::MessagePack => Ok(FfiPayload::Msgpack(
             rmp_serde::to_vec(value).map_err(|e| format!("messagepack serialize failed: {e}"))?,
         )),
         NxOutputFormat::Json => Ok(FfiPayload::Json(
-            value
-                .to_json_string()
-                .map_err(|e| format!("json serialize failed: {e}"))?,
+            serde_json::to_string(value).map_err(|e| format!("json serialize failed: {e}"))?,
         )),
     }
 }
@@ -389,41 +997,106 @@ fn serialize_diagnostics_payload(
     }
 }
 
-fn serialize_component_init_payload(
+fn write_eval_payload_into<T: Serialize + ?Sized, W: Write + ?Sized>(
     output_format: NxOutputFormat,
-    result: &ComponentInitResult,
-) -> Result<FfiPayload, String> {
+    value: &T,
+    out: &mut W,
+) -> Result<(), String> {
     match output_format {
-        NxOutputFormat::MessagePack => Ok(FfiPayload::Msgpack(
-            rmp_serde::to_vec_named(result)
-                .map_err(|e| format!("messagepack serialize failed: {e}"))?,
-        )),
-        NxOutputFormat::Json => Ok(FfiPayload::Json(json_component_init_payload(result)?)),
+        NxOutputFormat::MessagePack => rmp_serde::encode::write(out, value)
+            .map_err(|e| format!("messagepack serialize failed: {e}")),
+        NxOutputFormat::Json => {
+            serde_json::to_writer(out, value).map_err(|e| format!("json serialize failed: {e}"))
+        }
     }
 }
 
-fn serialize_component_dispatch_payload(
+fn write_diagnostics_payload_into<W: Write + ?Sized>(
     output_format: NxOutputFormat,
-    result: &ComponentDispatchResult,
-) -> Result<FfiPayload, String> {
+    diagnostics: &[NxDiagnostic],
+    out: &mut W,
+) -> Result<(), String> {
     match output_format {
-        NxOutputFormat::MessagePack => Ok(FfiPayload::Msgpack(
-            rmp_serde::to_vec_named(result)
-                .map_err(|e| format!("messagepack serialize failed: {e}"))?,
-        )),
-        NxOutputFormat::Json => Ok(FfiPayload::Json(json_component_dispatch_payload(result)?)),
+        NxOutputFormat::MessagePack => rmp_serde::encode::write_named(out, diagnostics)
+            .map_err(|e| format!("messagepack serialize failed: {e}")),
+        NxOutputFormat::Json => serde_json::to_writer(out, diagnostics)
+            .map_err(|e| format!("json serialize failed: {e}")),
     }
 }
 
-#[no_mangle]
-pub extern "C" fn nx_eval_source(
-    source_ptr: *const u8,
-    source_len: usize,
-    file_name_ptr: *const u8,
-    file_name_len: usize,
-    output_format: u32,
-    out_buffer: *mut NxBuffer,
-) -> NxEvalStatus {
+fn write_component_init_payload_into<W: Write + ?Sized>(
+    output_format: NxOutputFormat,
+    result: &ComponentInitResult,
+    out: &mut W,
+) -> Result<(), String> {
+    match output_format {
+        NxOutputFormat::MessagePack => {
+            rmp_serde::encode::write_named(out, &msgpack_component_init_payload(result))
+                .map_err(|e| format!("messagepack serialize failed: {e}"))
+        }
+        NxOutputFormat::Json => serde_json::to_writer(out, &json_component_init_payload(result))
+            .map_err(|e| format!("json serialize failed: {e}")),
+    }
+}
+
+fn write_component_dispatch_payload_into<W: Write + ?Sized>(
+    output_format: NxOutputFormat,
+    result: &ComponentDispatchResult,
+    out: &mut W,
+) -> Result<(), String> {
+    match output_format {
+        NxOutputFormat::MessagePack => {
+            rmp_serde::encode::write_named(out, &msgpack_component_dispatch_payload(result))
+                .map_err(|e| format!("messagepack serialize failed: {e}"))
+        }
+        NxOutputFormat::Json => {
+            serde_json::to_writer(out, &json_component_dispatch_payload(result))
+                .map_err(|e| format!("json serialize failed: {e}"))
+        }
+    }
+}
+
+fn serialize_component_init_payload(
+    output_format: NxOutputFormat,
+    result: &ComponentInitResult,
+) -> Result<FfiPayload, String> {
+    match output_format {
+        NxOutputFormat::MessagePack => Ok(FfiPayload::Msgpack(
+            rmp_serde::to_vec_named(&msgpack_component_init_payload(result))
+                .map_err(|e| format!("messagepack serialize failed: {e}"))?,
+        )),
+        NxOutputFormat::Json => Ok(FfiPayload::Json(
+            serde_json::to_string(&json_component_init_payload(result))
+                .map_err(|e| format!("json serialize failed: {e}"))?,
+        )),
+    }
+}
+
+fn serialize_component_dispatch_payload(
+    output_format: NxOutputFormat,
+    result: &ComponentDispatchResult,
+) -> Result<FfiPayload, String> {
+    match output_format {
+        NxOutputFormat::MessagePack => Ok(FfiPayload::Msgpack(
+            rmp_serde::to_vec_named(&msgpack_component_dispatch_payload(result))
+                .map_err(|e| format!("messagepack serialize failed: {e}"))?,
+        )),
+        NxOutputFormat::Json => Ok(FfiPayload::Json(
+            serde_json::to_string(&json_component_dispatch_payload(result))
+                .map_err(|e| format!("json serialize failed: {e}"))?,
+        )),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn nx_eval_source(
+    source_ptr: *const u8,
+    source_len: usize,
+    file_name_ptr: *const u8,
+    file_name_len: usize,
+    output_format: u32,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
     if let Err(status) = prepare_out_buffer(out_buffer) {
         return status;
     }
@@ -438,14 +1111,15 @@ pub extern "C" fn nx_eval_source(
         let file_name = parse_file_name(file_name_ptr, file_name_len)?;
         let build_context = ProgramBuildContext::empty();
 
+        begin_eval_stats();
         let payload = match eval_source(source, &file_name, &build_context) {
             EvalResult::Ok(value) => (
                 NxEvalStatus::Ok,
-                serialize_eval_payload(output_format, &value)?,
+                timed_encode(|| serialize_eval_payload(output_format, &value))?,
             ),
             EvalResult::Err(diagnostics) => (
                 NxEvalStatus::Error,
-                serialize_diagnostics_payload(output_format, &diagnostics)?,
+                timed_encode(|| serialize_diagnostics_payload(output_format, &diagnostics))?,
             ),
         };
 
@@ -485,7 +1159,9 @@ pub extern "C" fn nx_build_program_artifact(
 
         match load_program_artifact_from_source(source, &file_name, &build_context) {
             Ok(program_artifact) => {
-                let handle = Box::new(ProgramArtifactHandleInner { program_artifact });
+                let handle = Box::new(ProgramArtifactHandleInner {
+                    program_artifact: Arc::new(program_artifact),
+                });
                 unsafe {
                     *out_handle = Box::into_raw(handle).cast::<NxProgramArtifactHandle>();
                 }
@@ -568,7 +1244,9 @@ pub extern "C" fn nx_build_workspace_program_artifact(
         let handle = unsafe { &*build_context_ptr.cast::<ProgramBuildContextHandleInner>() };
         match build_workspace_program_artifact(&workspace, &entry_identity, &handle.build_context) {
             Ok(program_artifact) => {
-                let handle = Box::new(ProgramArtifactHandleInner { program_artifact });
+                let handle = Box::new(ProgramArtifactHandleInner {
+                    program_artifact: Arc::new(program_artifact),
+                });
                 unsafe {
                     *out_handle = Box::into_raw(handle).cast::<NxProgramArtifactHandle>();
                 }
@@ -585,6 +1263,67 @@ pub extern "C" fn nx_build_workspace_program_artifact(
     finish_msgpack_entry(out_buffer, result)
 }
 
+/// Rebuilds a workspace program artifact after the modules in `modules_ptr` changed.
+///
+/// Modules not listed keep the source they had in `previous_ptr`, whose entry module is kept as
+/// well. Only modules affected by the change are analyzed again. `previous_ptr` stays valid and
+/// unchanged; the rebuilt artifact is returned as a new handle.
+#[no_mangle]
+pub extern "C" fn nx_rebuild_workspace_program_artifact(
+    previous_ptr: *const NxProgramArtifactHandle,
+    build_context_ptr: *const NxProgramBuildContextHandle,
+    modules_ptr: *const NxWorkspaceModule,
+    module_count: usize,
+    out_handle: *mut *mut NxProgramArtifactHandle,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_program_artifact_handle(out_handle) {
+        return status;
+    }
+
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    if previous_ptr.is_null() || build_context_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let changed_modules = match parse_workspace_modules(modules_ptr, module_count) {
+        Ok(workspace) => workspace,
+        Err(status) => return status,
+    };
+
+    let result = panic::catch_unwind(|| {
+        let handle = unsafe { &*build_context_ptr.cast::<ProgramBuildContextHandleInner>() };
+        with_program_artifact(
+            previous_ptr,
+            |previous| match rebuild_workspace_program_artifact(
+                previous,
+                &changed_modules,
+                &handle.build_context,
+            ) {
+                Ok(program_artifact) => {
+                    let handle = Box::new(ProgramArtifactHandleInner {
+                        program_artifact: Arc::new(program_artifact),
+                    });
+                    unsafe {
+                        *out_handle = Box::into_raw(handle).cast::<NxProgramArtifactHandle>();
+                    }
+                    Ok((NxEvalStatus::Ok, Vec::new()))
+                }
+                Err(diagnostics) => {
+                    let payload = rmp_serde::to_vec_named(&diagnostics)
+                        .map_err(|e| format!("messagepack serialize failed: {e}"))?;
+                    Ok((NxEvalStatus::Error, payload))
+                }
+            },
+        )
+    });
+
+    finish_msgpack_entry(out_buffer, result)
+}
+
 #[no_mangle]
 pub extern "C" fn nx_create_library_registry(
     out_handle: *mut *mut NxLibraryRegistryHandle,
@@ -613,6 +1352,65 @@ pub extern "C" fn nx_free_library_registry(handle: *mut NxLibraryRegistryHandle)
     }
 }
 
+/// Sets the directory where `nx_load_library_into_registry` persists analyzed libraries.
+///
+/// Later loads, including loads from other processes that share the directory, reuse a cached
+/// library while its sources and dependency libraries are unchanged. An empty path disables the
+/// cache.
+#[no_mangle]
+pub extern "C" fn nx_set_library_registry_cache_directory(
+    registry_ptr: *const NxLibraryRegistryHandle,
+    cache_directory_ptr: *const u8,
+    cache_directory_len: usize,
+) -> NxEvalStatus {
+    if registry_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let cache_directory = unsafe { slice_to_str(cache_directory_ptr, cache_directory_len) }?;
+        with_library_registry(registry_ptr, |registry| {
+            registry.set_cache_directory(
+                (!cache_directory.is_empty()).then(|| PathBuf::from(cache_directory)),
+            );
+            Ok(())
+        })
+    });
+
+    match result {
+        Ok(Ok(())) => NxEvalStatus::Ok,
+        Ok(Err(_)) => NxEvalStatus::InvalidArgument,
+        Err(_) => NxEvalStatus::Panic,
+    }
+}
+
+/// Sets how many threads `nx_load_libraries_into_registry` discovers and analyzes libraries on.
+///
+/// `0` selects the available hardware parallelism, which is the default; `1` loads every library
+/// on the calling thread.
+#[no_mangle]
+pub extern "C" fn nx_set_library_registry_load_workers(
+    registry_ptr: *const NxLibraryRegistryHandle,
+    worker_count: usize,
+) -> NxEvalStatus {
+    if registry_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        with_library_registry(registry_ptr, |registry| {
+            registry.set_load_workers(worker_count);
+            Ok(())
+        })
+    });
+
+    match result {
+        Ok(Ok(())) => NxEvalStatus::Ok,
+        Ok(Err(_)) => NxEvalStatus::InvalidArgument,
+        Err(_) => NxEvalStatus::Panic,
+    }
+}
+
 #[no_mangle]
 pub extern "C" fn nx_load_library_into_registry(
     registry_ptr: *const NxLibraryRegistryHandle,
@@ -651,6 +1449,58 @@ pub extern "C" fn nx_load_library_into_registry(
     finish_msgpack_entry(out_buffer, result)
 }
 
+/// Loads many libraries and their dependency closures into a registry at once.
+///
+/// Independent libraries are analyzed concurrently. On failure, `out_buffer` receives the
+/// MessagePack diagnostics; libraries that finished loading stay in the registry.
+#[no_mangle]
+pub extern "C" fn nx_load_libraries_into_registry(
+    registry_ptr: *const NxLibraryRegistryHandle,
+    roots_ptr: *const NxLibraryRoot,
+    root_count: usize,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    if registry_ptr.is_null() || (root_count > 0 && roots_ptr.is_null()) {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let descriptors = if root_count == 0 {
+            &[][..]
+        } else {
+            unsafe { std::slice::from_raw_parts(roots_ptr, root_count) }
+        };
+        let mut root_paths = Vec::with_capacity(descriptors.len());
+        for descriptor in descriptors {
+            let root_path =
+                unsafe { slice_to_str(descriptor.root_path_ptr, descriptor.root_path_len) }?;
+            if root_path.is_empty() {
+                return Err("library root path is empty".to_string());
+            }
+            root_paths.push(root_path);
+        }
+
+        let bytes = with_library_registry(registry_ptr, |registry| {
+            match registry.load_libraries_from_directories(&root_paths) {
+                Ok(_) => Ok((NxEvalStatus::Ok, Vec::new())),
+                Err(diagnostics) => {
+                    let payload = rmp_serde::to_vec_named(&diagnostics)
+                        .map_err(|e| format!("messagepack serialize failed: {e}"))?;
+                    Ok((NxEvalStatus::Error, payload))
+                }
+            }
+        })?;
+
+        Ok(bytes)
+    });
+
+    finish_msgpack_entry(out_buffer, result)
+}
+
 #[no_mangle]
 pub extern "C" fn nx_create_program_build_context(
     registry_ptr: *const NxLibraryRegistryHandle,
@@ -681,6 +1531,44 @@ pub extern "C" fn nx_create_program_build_context(
     }
 }
 
+/// Sets how many threads workspace builds using this context parse and analyze modules on.
+///
+/// `0` selects the available hardware parallelism, which is the default; `1` analyzes on the
+/// calling thread. Do not call this while another thread is building with the same handle.
+#[no_mangle]
+pub extern "C" fn nx_set_program_build_context_analysis_workers(
+    build_context_ptr: *mut NxProgramBuildContextHandle,
+    worker_count: usize,
+) -> NxEvalStatus {
+    if build_context_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let handle = unsafe { &mut *build_context_ptr.cast::<ProgramBuildContextHandleInner>() };
+    handle.build_context.set_analysis_workers(worker_count);
+    NxEvalStatus::Ok
+}
+
+/// Limits workspace builds using this context to the entry module's import closure.
+///
+/// A nonzero `enabled` makes `nx_build_workspace_program_artifact` analyze and keep only the
+/// modules reachable from the entry module through workspace imports; `0` restores the default of
+/// analyzing every submitted module. Do not call this while another thread is building with the
+/// same handle.
+#[no_mangle]
+pub extern "C" fn nx_set_program_build_context_entry_closure_pruning(
+    build_context_ptr: *mut NxProgramBuildContextHandle,
+    enabled: u32,
+) -> NxEvalStatus {
+    if build_context_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let handle = unsafe { &mut *build_context_ptr.cast::<ProgramBuildContextHandleInner>() };
+    handle.build_context.set_entry_closure_pruning(enabled != 0);
+    NxEvalStatus::Ok
+}
+
 #[no_mangle]
 pub extern "C" fn nx_free_program_build_context(handle: *mut NxProgramBuildContextHandle) {
     if handle.is_null() {
@@ -703,11 +1591,100 @@ pub extern "C" fn nx_free_program_artifact(handle: *mut NxProgramArtifactHandle)
     }
 }
 
+/// Serializes a program artifact into a self-contained binary image.
+///
+/// On success `out_buffer` receives the image bytes, owned by the caller and released with
+/// `nx_free_buffer`. Pass them to `nx_load_program_artifact`, in this or a later process, to
+/// restore the artifact without re-analysis. The artifact handle stays owned by the caller. On
+/// failure the buffer holds MessagePack diagnostics instead.
+#[no_mangle]
+pub extern "C" fn nx_serialize_program_artifact(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    if program_artifact_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let handle = unsafe { &*program_artifact_ptr.cast::<ProgramArtifactHandleInner>() };
+        let image = handle
+            .program_artifact
+            .to_image()
+            .map_err(|e| format!("program artifact serialize failed: {e}"))?;
+        Ok((NxEvalStatus::Ok, image))
+    });
+
+    finish_msgpack_entry(out_buffer, result)
+}
+
+/// Restores a program artifact from an image written by `nx_serialize_program_artifact`.
+///
+/// The image bytes are only read during the call and may be freed afterwards. On success
+/// `*out_handle` receives a new artifact handle, owned by the caller and released with
+/// `nx_free_program_artifact`, and `out_buffer` is empty. Images from another NX version or image
+/// format, and truncated or corrupt images, return `NxEvalStatus_Error` with a null handle and a
+/// MessagePack diagnostic in `out_buffer` that names the mismatch; release it with
+/// `nx_free_buffer`.
+#[no_mangle]
+pub extern "C" fn nx_load_program_artifact(
+    image_ptr: *const u8,
+    image_len: usize,
+    out_handle: *mut *mut NxProgramArtifactHandle,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_program_artifact_handle(out_handle) {
+        return status;
+    }
+
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let image = unsafe { slice_to_bytes(image_ptr, image_len) }?;
+        let program_artifact = ProgramArtifact::from_image(image)
+            .map_err(|e| format!("program artifact load failed: {e}"))?;
+        let handle = Box::new(ProgramArtifactHandleInner {
+            program_artifact: Arc::new(program_artifact),
+        });
+        unsafe {
+            *out_handle = Box::into_raw(handle).cast::<NxProgramArtifactHandle>();
+        }
+        Ok((NxEvalStatus::Ok, Vec::new()))
+    });
+
+    finish_msgpack_entry(out_buffer, result)
+}
+
 #[no_mangle]
 pub extern "C" fn nx_eval_program_artifact(
     program_artifact_ptr: *const NxProgramArtifactHandle,
     output_format: u32,
     out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    nx_eval_program_artifact_with_limits(
+        program_artifact_ptr,
+        std::ptr::null(),
+        output_format,
+        out_buffer,
+    )
+}
+
+/// Evaluates the artifact's `root()` like `nx_eval_program_artifact` under `limits`.
+///
+/// `limits` may be null for the defaults. A call stopped by its deadline or cancellation handle
+/// returns `NxEvalStatus_Error` with a `deadline-exceeded` or `evaluation-cancelled` diagnostic.
+#[no_mangle]
+pub extern "C" fn nx_eval_program_artifact_with_limits(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    out_buffer: *mut NxBuffer,
 ) -> NxEvalStatus {
     if let Err(status) = prepare_out_buffer(out_buffer) {
         return status;
@@ -723,20 +1700,9 @@ pub extern "C" fn nx_eval_program_artifact(
     }
 
     let result = panic::catch_unwind(|| {
-        let payload = with_program_artifact(program_artifact_ptr, |program_artifact| {
-            match api_eval_program_artifact(program_artifact) {
-                EvalResult::Ok(value) => Ok((
-                    NxEvalStatus::Ok,
-                    serialize_eval_payload(output_format, &value)?,
-                )),
-                EvalResult::Err(diagnostics) => Ok((
-                    NxEvalStatus::Error,
-                    serialize_diagnostics_payload(output_format, &diagnostics)?,
-                )),
-            }
-        })?;
-
-        Ok(payload)
+        let (status, output) =
+            eval_program_artifact_output(program_artifact_ptr, parse_eval_limits(limits_ptr))?;
+        Ok((status, output.to_payload(output_format)?))
     });
 
     finish_output_entry(out_buffer, output_format, result)
@@ -751,6 +1717,31 @@ pub extern "C" fn nx_component_init_program_artifact(
     props_len: usize,
     output_format: u32,
     out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    nx_component_init_program_artifact_with_limits(
+        program_artifact_ptr,
+        component_name_ptr,
+        component_name_len,
+        props_ptr,
+        props_len,
+        std::ptr::null(),
+        output_format,
+        out_buffer,
+    )
+}
+
+/// Initializes a component like `nx_component_init_program_artifact` under `limits`, which may be
+/// null for the defaults.
+#[no_mangle]
+pub extern "C" fn nx_component_init_program_artifact_with_limits(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    component_name_ptr: *const u8,
+    component_name_len: usize,
+    props_ptr: *const u8,
+    props_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    out_buffer: *mut NxBuffer,
 ) -> NxEvalStatus {
     if let Err(status) = prepare_out_buffer(out_buffer) {
         return status;
@@ -766,32 +1757,15 @@ pub extern "C" fn nx_component_init_program_artifact(
     }
 
     let result = panic::catch_unwind(|| {
-        let component_name = unsafe { slice_to_str(component_name_ptr, component_name_len) }?;
-        let props = if props_len == 0 {
-            empty_record()
-        } else {
-            let bytes = unsafe { slice_to_bytes(props_ptr, props_len) }?;
-            parse_msgpack_value(bytes)?
-        };
-
-        let payload = with_program_artifact(program_artifact_ptr, |program_artifact| {
-            match api_initialize_component_program_artifact(
-                program_artifact,
-                component_name,
-                &props,
-            ) {
-                ComponentInitEvalResult::Ok(result) => Ok((
-                    NxEvalStatus::Ok,
-                    serialize_component_init_payload(output_format, &result)?,
-                )),
-                ComponentInitEvalResult::Err(diagnostics) => Ok((
-                    NxEvalStatus::Error,
-                    serialize_diagnostics_payload(output_format, &diagnostics)?,
-                )),
-            }
-        })?;
-
-        Ok(payload)
+        let (status, output) = component_init_output(
+            program_artifact_ptr,
+            component_name_ptr,
+            component_name_len,
+            props_ptr,
+            props_len,
+            parse_eval_limits(limits_ptr),
+        )?;
+        Ok((status, output.to_payload(output_format)?))
     });
 
     finish_output_entry(out_buffer, output_format, result)
@@ -813,7 +1787,36 @@ pub extern "C" fn nx_component_evaluate_program_artifact(
     output_format: u32,
     out_buffer: *mut NxBuffer,
 ) -> NxEvalStatus {
-    if let Err(status) = prepare_out_buffer(out_buffer) {
+    nx_component_evaluate_program_artifact_with_limits(
+        program_artifact_ptr,
+        component_name_ptr,
+        component_name_len,
+        props_ptr,
+        props_len,
+        state_ptr,
+        state_len,
+        std::ptr::null(),
+        output_format,
+        out_buffer,
+    )
+}
+
+/// Evaluates a component like `nx_component_evaluate_program_artifact` under `limits`, which may
+/// be null for the defaults.
+#[no_mangle]
+pub extern "C" fn nx_component_evaluate_program_artifact_with_limits(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    component_name_ptr: *const u8,
+    component_name_len: usize,
+    props_ptr: *const u8,
+    props_len: usize,
+    state_ptr: *const u8,
+    state_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
         return status;
     }
 
@@ -827,36 +1830,111 @@ pub extern "C" fn nx_component_evaluate_program_artifact(
     }
 
     let result = panic::catch_unwind(|| {
-        let component_name = unsafe { slice_to_str(component_name_ptr, component_name_len) }?;
-        let props = if props_len == 0 {
-            empty_record()
-        } else {
-            let bytes = unsafe { slice_to_bytes(props_ptr, props_len) }?;
-            parse_msgpack_value(bytes)?
-        };
-        let state = if state_len == 0 {
-            empty_record()
+        let (status, output) = component_evaluate_output(
+            program_artifact_ptr,
+            component_name_ptr,
+            component_name_len,
+            props_ptr,
+            props_len,
+            state_ptr,
+            state_len,
+            parse_eval_limits(limits_ptr),
+        )?;
+        Ok((status, output.to_payload(output_format)?))
+    });
+
+    finish_output_entry(out_buffer, output_format, result)
+}
+
+/// Evaluates many components from one program artifact in a single native call.
+///
+/// Each request is evaluated exactly like `nx_component_evaluate_program_artifact`, but all
+/// requests share one interpreter and all outputs are written into one `out_buffer`. The buffer
+/// starts with `request_count` `NxBatchResultEntry` records in request order, followed by the
+/// per-entry payloads: the rendered value on success or diagnostics on failure, in the selected
+/// format. The call returns `NxEvalStatus_Ok` whenever the batch itself ran; inspect each entry
+/// status for per-request results. Every request gets its own budget under `limits`, which may be
+/// null for the defaults, so a request that exceeds it fails alone.
+#[no_mangle]
+pub extern "C" fn nx_component_evaluate_batch_program_artifact(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    requests_ptr: *const NxComponentEvaluateRequest,
+    request_count: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    if program_artifact_ptr.is_null() || (request_count > 0 && requests_ptr.is_null()) {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let descriptors = if request_count == 0 {
+            &[][..]
         } else {
-            let bytes = unsafe { slice_to_bytes(state_ptr, state_len) }?;
-            parse_msgpack_value(bytes)?
+            unsafe { std::slice::from_raw_parts(requests_ptr, request_count) }
         };
+        let decoded = descriptors
+            .iter()
+            .map(parse_component_evaluate_request)
+            .collect::<Vec<_>>();
 
+        begin_eval_stats();
         let payload = with_program_artifact(program_artifact_ptr, |program_artifact| {
-            match api_evaluate_component_program_artifact(
+            let requests = decoded
+                .iter()
+                .filter_map(|request| request.as_ref().ok())
+                .map(|(component_name, props, state)| ComponentEvaluateRequest {
+                    component_name: component_name.as_str(),
+                    props,
+                    state,
+                })
+                .collect::<Vec<_>>();
+            let mut results = api_evaluate_component_batch_program_artifact(
                 program_artifact,
-                component_name,
-                &props,
-                &state,
-            ) {
-                ComponentEvaluateEvalResult::Ok(result) => Ok((
-                    NxEvalStatus::Ok,
-                    serialize_eval_payload(output_format, &result.rendered)?,
-                )),
-                ComponentEvaluateEvalResult::Err(diagnostics) => Ok((
-                    NxEvalStatus::Error,
-                    serialize_diagnostics_payload(output_format, &diagnostics)?,
-                )),
+                &requests,
+                parse_eval_limits(limits_ptr),
+            )
+            .into_iter();
+
+            let mut writer = BatchOutputWriter::new(decoded.len());
+            for request in &decoded {
+                match request {
+                    Ok(_) => match results
+                        .next()
+                        .expect("one batch result per decoded request")
+                    {
+                        Ok(result) => writer.push(NxEvalStatus::Ok, |out| {
+                            write_eval_payload_into(
+                                output_format,
+                                &NxValueView::new(&result.rendered),
+                                out,
+                            )
+                        })?,
+                        Err(diagnostics) => writer.push(NxEvalStatus::Error, |out| {
+                            write_diagnostics_payload_into(output_format, &diagnostics, out)
+                        })?,
+                    },
+                    Err(message) => writer.push(NxEvalStatus::Error, |out| {
+                        write_diagnostics_payload_into(
+                            output_format,
+                            &ffi_error_diagnostics(message.clone()),
+                            out,
+                        )
+                    })?,
+                }
             }
+
+            Ok((NxEvalStatus::Ok, FfiPayload::Batch(writer.finish())))
         })?;
 
         Ok(payload)
@@ -865,6 +1943,27 @@ pub extern "C" fn nx_component_evaluate_program_artifact(
     finish_output_entry(out_buffer, output_format, result)
 }
 
+fn parse_component_evaluate_request(
+    descriptor: &NxComponentEvaluateRequest,
+) -> Result<(String, NxValue, NxValue), String> {
+    let component_name =
+        unsafe { slice_to_str(descriptor.component_name_ptr, descriptor.component_name_len) }?;
+    let props = if descriptor.props_len == 0 {
+        empty_record()
+    } else {
+        let bytes = unsafe { slice_to_bytes(descriptor.props_ptr, descriptor.props_len) }?;
+        parse_msgpack_value(bytes)?
+    };
+    let state = if descriptor.state_len == 0 {
+        empty_record()
+    } else {
+        let bytes = unsafe { slice_to_bytes(descriptor.state_ptr, descriptor.state_len) }?;
+        parse_msgpack_value(bytes)?
+    };
+
+    Ok((component_name.to_string(), props, state))
+}
+
 #[no_mangle]
 pub extern "C" fn nx_component_dispatch_actions_program_artifact(
     program_artifact_ptr: *const NxProgramArtifactHandle,
@@ -874,6 +1973,31 @@ pub extern "C" fn nx_component_dispatch_actions_program_artifact(
     actions_len: usize,
     output_format: u32,
     out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    nx_component_dispatch_actions_program_artifact_with_limits(
+        program_artifact_ptr,
+        state_snapshot_ptr,
+        state_snapshot_len,
+        actions_ptr,
+        actions_len,
+        std::ptr::null(),
+        output_format,
+        out_buffer,
+    )
+}
+
+/// Dispatches actions like `nx_component_dispatch_actions_program_artifact` under `limits`, which
+/// may be null for the defaults. The deadline covers the whole batch of actions.
+#[no_mangle]
+pub extern "C" fn nx_component_dispatch_actions_program_artifact_with_limits(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    state_snapshot_ptr: *const u8,
+    state_snapshot_len: usize,
+    actions_ptr: *const u8,
+    actions_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    out_buffer: *mut NxBuffer,
 ) -> NxEvalStatus {
     if let Err(status) = prepare_out_buffer(out_buffer) {
         return status;
@@ -889,39 +2013,1107 @@ pub extern "C" fn nx_component_dispatch_actions_program_artifact(
     }
 
     let result = panic::catch_unwind(|| {
-        let state_snapshot = if state_snapshot_len == 0 {
-            &[][..]
-        } else {
-            unsafe { slice_to_bytes(state_snapshot_ptr, state_snapshot_len) }?
-        };
-        let actions = if actions_len == 0 {
-            Vec::new()
-        } else {
-            let bytes = unsafe { slice_to_bytes(actions_ptr, actions_len) }?;
-            parse_msgpack_actions(bytes)?
-        };
+        let (status, output) = component_dispatch_output(
+            program_artifact_ptr,
+            state_snapshot_ptr,
+            state_snapshot_len,
+            actions_ptr,
+            actions_len,
+            parse_eval_limits(limits_ptr),
+        )?;
+        Ok((status, output.to_payload(output_format)?))
+    });
 
-        let payload = with_program_artifact(program_artifact_ptr, |program_artifact| {
+    finish_output_entry(out_buffer, output_format, result)
+}
+
+fn eval_program_artifact_output(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    limits: ResourceLimits,
+) -> Result<(NxEvalStatus, FfiOutput), String> {
+    begin_eval_stats();
+    with_program_artifact(program_artifact_ptr, |program_artifact| {
+        Ok(match api_eval_program_artifact(program_artifact, limits) {
+            Ok(value) => (NxEvalStatus::Ok, FfiOutput::Value(value)),
+            Err(diagnostics) => (NxEvalStatus::Error, FfiOutput::Diagnostics(diagnostics)),
+        })
+    })
+}
+
+fn component_init_output(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    component_name_ptr: *const u8,
+    component_name_len: usize,
+    props_ptr: *const u8,
+    props_len: usize,
+    limits: ResourceLimits,
+) -> Result<(NxEvalStatus, FfiOutput), String> {
+    begin_eval_stats();
+    let component_name = unsafe { slice_to_str(component_name_ptr, component_name_len) }?;
+    let props = unsafe { msgpack_component_input(props_ptr, props_len) }?;
+
+    with_program_artifact(program_artifact_ptr, |program_artifact| {
+        Ok(
+            match api_initialize_component_program_artifact(
+                program_artifact,
+                component_name,
+                props,
+                limits,
+            ) {
+                Ok(result) => (NxEvalStatus::Ok, FfiOutput::ComponentInit(result)),
+                Err(diagnostics) => (NxEvalStatus::Error, FfiOutput::Diagnostics(diagnostics)),
+            },
+        )
+    })
+}
+
+fn component_evaluate_output(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    component_name_ptr: *const u8,
+    component_name_len: usize,
+    props_ptr: *const u8,
+    props_len: usize,
+    state_ptr: *const u8,
+    state_len: usize,
+    limits: ResourceLimits,
+) -> Result<(NxEvalStatus, FfiOutput), String> {
+    begin_eval_stats();
+    let component_name = unsafe { slice_to_str(component_name_ptr, component_name_len) }?;
+    let props = unsafe { msgpack_component_input(props_ptr, props_len) }?;
+    let state = unsafe { msgpack_component_input(state_ptr, state_len) }?;
+
+    with_program_artifact(program_artifact_ptr, |program_artifact| {
+        Ok(
+            match api_evaluate_component_program_artifact(
+                program_artifact,
+                component_name,
+                props,
+                state,
+                limits,
+            ) {
+                Ok(result) => (NxEvalStatus::Ok, FfiOutput::Value(result.rendered)),
+                Err(diagnostics) => (NxEvalStatus::Error, FfiOutput::Diagnostics(diagnostics)),
+            },
+        )
+    })
+}
+
+fn component_dispatch_output(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    state_snapshot_ptr: *const u8,
+    state_snapshot_len: usize,
+    actions_ptr: *const u8,
+    actions_len: usize,
+    limits: ResourceLimits,
+) -> Result<(NxEvalStatus, FfiOutput), String> {
+    begin_eval_stats();
+    let state_snapshot = if state_snapshot_len == 0 {
+        &[][..]
+    } else {
+        unsafe { slice_to_bytes(state_snapshot_ptr, state_snapshot_len) }?
+    };
+    let actions = if actions_len == 0 {
+        Vec::new()
+    } else {
+        let bytes = unsafe { slice_to_bytes(actions_ptr, actions_len) }?;
+        parse_msgpack_actions(bytes)?
+    };
+
+    with_program_artifact(program_artifact_ptr, |program_artifact| {
+        Ok(
             match api_dispatch_component_actions_program_artifact(
                 program_artifact,
                 state_snapshot,
                 &actions,
+                limits,
             ) {
-                ComponentDispatchEvalResult::Ok(result) => Ok((
-                    NxEvalStatus::Ok,
-                    serialize_component_dispatch_payload(output_format, &result)?,
-                )),
-                ComponentDispatchEvalResult::Err(diagnostics) => Ok((
-                    NxEvalStatus::Error,
-                    serialize_diagnostics_payload(output_format, &diagnostics)?,
-                )),
-            }
-        })?;
+                Ok(result) => (NxEvalStatus::Ok, FfiOutput::ComponentDispatch(result)),
+                Err(diagnostics) => (NxEvalStatus::Error, FfiOutput::Diagnostics(diagnostics)),
+            },
+        )
+    })
+}
 
-        Ok(payload)
+/// Computes a compact delta that turns the `previous` component state snapshot into `next`.
+///
+/// On success, `out_buffer` receives the raw delta bytes. On failure, it receives MessagePack
+/// diagnostics.
+#[no_mangle]
+pub extern "C" fn nx_component_snapshot_delta(
+    previous_ptr: *const u8,
+    previous_len: usize,
+    next_ptr: *const u8,
+    next_len: usize,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let previous = unsafe { slice_to_bytes(previous_ptr, previous_len) }?;
+        let next = unsafe { slice_to_bytes(next_ptr, next_len) }?;
+        snapshot_bytes_output(component_snapshot_delta(previous, next))
     });
 
-    finish_output_entry(out_buffer, output_format, result)
+    finish_msgpack_entry(out_buffer, result)
+}
+
+/// Rebuilds the full component state snapshot from the base snapshot a delta was computed
+/// against.
+///
+/// On success, `out_buffer` receives the raw snapshot bytes. On failure, it receives MessagePack
+/// diagnostics.
+#[no_mangle]
+pub extern "C" fn nx_apply_component_snapshot_delta(
+    base_ptr: *const u8,
+    base_len: usize,
+    delta_ptr: *const u8,
+    delta_len: usize,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let base = unsafe { slice_to_bytes(base_ptr, base_len) }?;
+        let delta = unsafe { slice_to_bytes(delta_ptr, delta_len) }?;
+        snapshot_bytes_output(apply_component_snapshot_delta(base, delta))
+    });
+
+    finish_msgpack_entry(out_buffer, result)
+}
+
+fn snapshot_bytes_output(
+    result: Result<Vec<u8>, Vec<NxDiagnostic>>,
+) -> Result<(NxEvalStatus, Vec<u8>), String> {
+    match result {
+        Ok(bytes) => Ok((NxEvalStatus::Ok, bytes)),
+        Err(diagnostics) => {
+            let payload = rmp_serde::to_vec_named(&diagnostics)
+                .map_err(|e| format!("messagepack serialize failed: {e}"))?;
+            Ok((NxEvalStatus::Error, payload))
+        }
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn nx_create_cancellation_handle(
+    out_handle: *mut *mut NxCancellationHandle,
+) -> NxEvalStatus {
+    if out_handle.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let handle = Box::new(CancellationHandleInner {
+        token: CancellationToken::new(),
+    });
+    unsafe {
+        *out_handle = Box::into_raw(handle).cast::<NxCancellationHandle>();
+    }
+    NxEvalStatus::Ok
+}
+
+/// Cancels every running and future call that was passed `handle` in its `NxEvalLimits`.
+///
+/// Safe to call from any thread while those calls run. A cancelled handle stays cancelled; create
+/// a new handle for the next request.
+#[no_mangle]
+pub extern "C" fn nx_cancel(handle: *const NxCancellationHandle) {
+    if handle.is_null() {
+        return;
+    }
+
+    let handle = unsafe { &*handle.cast::<CancellationHandleInner>() };
+    handle.token.cancel();
+}
+
+#[no_mangle]
+pub extern "C" fn nx_free_cancellation_handle(handle: *mut NxCancellationHandle) {
+    if handle.is_null() {
+        return;
+    }
+
+    unsafe {
+        let _ = Box::from_raw(handle.cast::<CancellationHandleInner>());
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn nx_create_output_arena(
+    out_handle: *mut *mut NxOutputArenaHandle,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_output_arena_handle(out_handle) {
+        return status;
+    }
+
+    let handle = Box::new(OutputArenaHandleInner {
+        arena: OutputArena::default(),
+    });
+    unsafe {
+        *out_handle = Box::into_raw(handle).cast::<NxOutputArenaHandle>();
+    }
+    NxEvalStatus::Ok
+}
+
+/// Invalidates every view produced by the arena while keeping its largest chunk for reuse.
+#[no_mangle]
+pub extern "C" fn nx_reset_output_arena(handle: *mut NxOutputArenaHandle) {
+    if handle.is_null() {
+        return;
+    }
+
+    let handle = unsafe { &mut *handle.cast::<OutputArenaHandleInner>() };
+    handle.arena.reset();
+}
+
+#[no_mangle]
+pub extern "C" fn nx_free_output_arena(handle: *mut NxOutputArenaHandle) {
+    if handle.is_null() {
+        return;
+    }
+
+    unsafe {
+        let _ = Box::from_raw(handle.cast::<OutputArenaHandleInner>());
+    }
+}
+
+/// Arena variant of `nx_eval_program_artifact_with_limits`.
+///
+/// The payload is appended to `arena` and described by `out_view`; it stays valid until the arena
+/// is reset or freed. One arena must not be used by multiple threads at the same time.
+#[no_mangle]
+pub extern "C" fn nx_eval_program_artifact_into_arena(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    arena_ptr: *mut NxOutputArenaHandle,
+    out_view: *mut NxBufferView,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_view(out_view) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    if program_artifact_ptr.is_null() || arena_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        eval_program_artifact_output(program_artifact_ptr, parse_eval_limits(limits_ptr))
+    });
+
+    finish_arena_entry(arena_ptr, out_view, output_format, result)
+}
+
+/// Arena variant of `nx_component_init_program_artifact_with_limits`.
+#[no_mangle]
+pub extern "C" fn nx_component_init_program_artifact_into_arena(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    component_name_ptr: *const u8,
+    component_name_len: usize,
+    props_ptr: *const u8,
+    props_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    arena_ptr: *mut NxOutputArenaHandle,
+    out_view: *mut NxBufferView,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_view(out_view) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    if program_artifact_ptr.is_null() || arena_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        component_init_output(
+            program_artifact_ptr,
+            component_name_ptr,
+            component_name_len,
+            props_ptr,
+            props_len,
+            parse_eval_limits(limits_ptr),
+        )
+    });
+
+    finish_arena_entry(arena_ptr, out_view, output_format, result)
+}
+
+/// Arena variant of `nx_component_evaluate_program_artifact_with_limits`.
+#[no_mangle]
+pub extern "C" fn nx_component_evaluate_program_artifact_into_arena(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    component_name_ptr: *const u8,
+    component_name_len: usize,
+    props_ptr: *const u8,
+    props_len: usize,
+    state_ptr: *const u8,
+    state_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    arena_ptr: *mut NxOutputArenaHandle,
+    out_view: *mut NxBufferView,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_view(out_view) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    if program_artifact_ptr.is_null() || arena_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        component_evaluate_output(
+            program_artifact_ptr,
+            component_name_ptr,
+            component_name_len,
+            props_ptr,
+            props_len,
+            state_ptr,
+            state_len,
+            parse_eval_limits(limits_ptr),
+        )
+    });
+
+    finish_arena_entry(arena_ptr, out_view, output_format, result)
+}
+
+/// Arena variant of `nx_component_dispatch_actions_program_artifact_with_limits`.
+#[no_mangle]
+pub extern "C" fn nx_component_dispatch_actions_program_artifact_into_arena(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    state_snapshot_ptr: *const u8,
+    state_snapshot_len: usize,
+    actions_ptr: *const u8,
+    actions_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    arena_ptr: *mut NxOutputArenaHandle,
+    out_view: *mut NxBufferView,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_view(out_view) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    if program_artifact_ptr.is_null() || arena_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        component_dispatch_output(
+            program_artifact_ptr,
+            state_snapshot_ptr,
+            state_snapshot_len,
+            actions_ptr,
+            actions_len,
+            parse_eval_limits(limits_ptr),
+        )
+    });
+
+    finish_arena_entry(arena_ptr, out_view, output_format, result)
+}
+
+/// Streaming variant of `nx_eval_program_artifact_with_limits`.
+///
+/// A successful payload is passed to `write` in chunks as it is encoded, together with
+/// `user_data`, instead of being collected into `out_buffer`; `out_buffer` stays empty. On
+/// `NxEvalStatus_Error`, diagnostics are returned in `out_buffer` and nothing is streamed unless
+/// encoding or `write` failed after earlier chunks were delivered, in which case the host must
+/// discard them.
+#[no_mangle]
+pub extern "C" fn nx_eval_program_artifact_into_callback(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    write: Option<NxWriteCallback>,
+    user_data: *mut c_void,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    let Some(write) = write else {
+        return NxEvalStatus::InvalidArgument;
+    };
+    if program_artifact_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let (status, output) =
+            eval_program_artifact_output(program_artifact_ptr, parse_eval_limits(limits_ptr))?;
+        stream_output(status, output, output_format, write, user_data)
+    });
+
+    finish_output_entry(out_buffer, output_format, result)
+}
+
+/// Streaming variant of `nx_component_init_program_artifact_with_limits`.
+#[no_mangle]
+pub extern "C" fn nx_component_init_program_artifact_into_callback(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    component_name_ptr: *const u8,
+    component_name_len: usize,
+    props_ptr: *const u8,
+    props_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    write: Option<NxWriteCallback>,
+    user_data: *mut c_void,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    let Some(write) = write else {
+        return NxEvalStatus::InvalidArgument;
+    };
+    if program_artifact_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let (status, output) = component_init_output(
+            program_artifact_ptr,
+            component_name_ptr,
+            component_name_len,
+            props_ptr,
+            props_len,
+            parse_eval_limits(limits_ptr),
+        )?;
+        stream_output(status, output, output_format, write, user_data)
+    });
+
+    finish_output_entry(out_buffer, output_format, result)
+}
+
+/// Streaming variant of `nx_component_evaluate_program_artifact_with_limits`.
+#[no_mangle]
+pub extern "C" fn nx_component_evaluate_program_artifact_into_callback(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    component_name_ptr: *const u8,
+    component_name_len: usize,
+    props_ptr: *const u8,
+    props_len: usize,
+    state_ptr: *const u8,
+    state_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    write: Option<NxWriteCallback>,
+    user_data: *mut c_void,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    let Some(write) = write else {
+        return NxEvalStatus::InvalidArgument;
+    };
+    if program_artifact_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let (status, output) = component_evaluate_output(
+            program_artifact_ptr,
+            component_name_ptr,
+            component_name_len,
+            props_ptr,
+            props_len,
+            state_ptr,
+            state_len,
+            parse_eval_limits(limits_ptr),
+        )?;
+        stream_output(status, output, output_format, write, user_data)
+    });
+
+    finish_output_entry(out_buffer, output_format, result)
+}
+
+/// Streaming variant of `nx_component_dispatch_actions_program_artifact_with_limits`.
+#[no_mangle]
+pub extern "C" fn nx_component_dispatch_actions_program_artifact_into_callback(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    state_snapshot_ptr: *const u8,
+    state_snapshot_len: usize,
+    actions_ptr: *const u8,
+    actions_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    write: Option<NxWriteCallback>,
+    user_data: *mut c_void,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    let Some(write) = write else {
+        return NxEvalStatus::InvalidArgument;
+    };
+    if program_artifact_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let (status, output) = component_dispatch_output(
+            program_artifact_ptr,
+            state_snapshot_ptr,
+            state_snapshot_len,
+            actions_ptr,
+            actions_len,
+            parse_eval_limits(limits_ptr),
+        )?;
+        stream_output(status, output, output_format, write, user_data)
+    });
+
+    finish_output_entry(out_buffer, output_format, result)
+}
+
+/// Resolves a named entry component once so repeated init/evaluate calls skip name resolution.
+///
+/// On failure, diagnostics are serialized as MessagePack into `out_buffer` and
+/// `NxEvalStatus_Error` is returned.
+#[no_mangle]
+pub extern "C" fn nx_resolve_component_program_artifact(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    component_name_ptr: *const u8,
+    component_name_len: usize,
+    out_handle: *mut *mut NxComponentHandle,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_component_handle(out_handle) {
+        return status;
+    }
+
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    if program_artifact_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let component_name = unsafe { slice_to_str(component_name_ptr, component_name_len) }?;
+        let handle = unsafe { &*program_artifact_ptr.cast::<ProgramArtifactHandleInner>() };
+
+        match api_resolve_component_program_artifact(&handle.program_artifact, component_name) {
+            ComponentResolveEvalResult::Ok(component) => {
+                let handle = Box::new(ComponentHandleInner {
+                    program_artifact: Arc::clone(&handle.program_artifact),
+                    component,
+                });
+                unsafe {
+                    *out_handle = Box::into_raw(handle).cast::<NxComponentHandle>();
+                }
+                Ok((NxEvalStatus::Ok, Vec::new()))
+            }
+            ComponentResolveEvalResult::Err(diagnostics) => {
+                let payload = rmp_serde::to_vec_named(&diagnostics)
+                    .map_err(|e| format!("messagepack serialize failed: {e}"))?;
+                Ok((NxEvalStatus::Error, payload))
+            }
+        }
+    });
+
+    finish_msgpack_entry(out_buffer, result)
+}
+
+#[no_mangle]
+pub extern "C" fn nx_free_component(handle: *mut NxComponentHandle) {
+    if handle.is_null() {
+        return;
+    }
+
+    unsafe {
+        let _ = Box::from_raw(handle.cast::<ComponentHandleInner>());
+    }
+}
+
+/// Resolved-handle variant of `nx_component_init_program_artifact_with_limits`; `limits` may be
+/// null for the defaults.
+#[no_mangle]
+pub extern "C" fn nx_component_init(
+    component_ptr: *const NxComponentHandle,
+    props_ptr: *const u8,
+    props_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    if component_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let (status, output) = resolved_component_init_output(
+            component_ptr,
+            props_ptr,
+            props_len,
+            parse_eval_limits(limits_ptr),
+        )?;
+        Ok((status, output.to_payload(output_format)?))
+    });
+
+    finish_output_entry(out_buffer, output_format, result)
+}
+
+/// Resolved-handle variant of `nx_component_evaluate_program_artifact_with_limits`; `limits` may
+/// be null for the defaults.
+#[no_mangle]
+pub extern "C" fn nx_component_evaluate(
+    component_ptr: *const NxComponentHandle,
+    props_ptr: *const u8,
+    props_len: usize,
+    state_ptr: *const u8,
+    state_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    if component_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let (status, output) = resolved_component_evaluate_output(
+            component_ptr,
+            props_ptr,
+            props_len,
+            state_ptr,
+            state_len,
+            parse_eval_limits(limits_ptr),
+        )?;
+        Ok((status, output.to_payload(output_format)?))
+    });
+
+    finish_output_entry(out_buffer, output_format, result)
+}
+
+/// Arena variant of `nx_component_evaluate`.
+#[no_mangle]
+pub extern "C" fn nx_component_evaluate_into_arena(
+    component_ptr: *const NxComponentHandle,
+    props_ptr: *const u8,
+    props_len: usize,
+    state_ptr: *const u8,
+    state_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    arena_ptr: *mut NxOutputArenaHandle,
+    out_view: *mut NxBufferView,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_view(out_view) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    if component_ptr.is_null() || arena_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        resolved_component_evaluate_output(
+            component_ptr,
+            props_ptr,
+            props_len,
+            state_ptr,
+            state_len,
+            parse_eval_limits(limits_ptr),
+        )
+    });
+
+    finish_arena_entry(arena_ptr, out_view, output_format, result)
+}
+
+/// Streaming variant of `nx_component_evaluate`.
+#[no_mangle]
+pub extern "C" fn nx_component_evaluate_into_callback(
+    component_ptr: *const NxComponentHandle,
+    props_ptr: *const u8,
+    props_len: usize,
+    state_ptr: *const u8,
+    state_len: usize,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    write: Option<NxWriteCallback>,
+    user_data: *mut c_void,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    let Some(write) = write else {
+        return NxEvalStatus::InvalidArgument;
+    };
+    if component_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let (status, output) = resolved_component_evaluate_output(
+            component_ptr,
+            props_ptr,
+            props_len,
+            state_ptr,
+            state_len,
+            parse_eval_limits(limits_ptr),
+        )?;
+        stream_output(status, output, output_format, write, user_data)
+    });
+
+    finish_output_entry(out_buffer, output_format, result)
+}
+
+/// Creates an empty render cache for `nx_component_evaluate_cached`.
+///
+/// The cache retains at most roughly `capacity_bytes` of cache keys and rendered values and evicts
+/// the least recently used entries once an insertion exceeds that bound. One cache can be shared
+/// by any number of components, programs, and threads. On success `*out_handle` receives a handle
+/// the caller owns and must release with `nx_free_render_cache`; on failure it is set to null.
+#[no_mangle]
+pub extern "C" fn nx_create_render_cache(
+    capacity_bytes: u64,
+    out_handle: *mut *mut NxRenderCacheHandle,
+) -> NxEvalStatus {
+    if out_handle.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+    unsafe {
+        *out_handle = std::ptr::null_mut();
+    }
+
+    let handle = Box::new(RenderCacheHandleInner {
+        cache: ComponentRenderCache::new(usize::try_from(capacity_bytes).unwrap_or(usize::MAX)),
+    });
+    unsafe {
+        *out_handle = Box::into_raw(handle).cast::<NxRenderCacheHandle>();
+    }
+    NxEvalStatus::Ok
+}
+
+/// Memoizes calls to functions declared as the UTF-8 name `name_ptr`/`name_len` in evaluations
+/// that use this cache.
+///
+/// Meant for element functions that many components call with the same arguments. Calls are keyed
+/// by the defining module and the MessagePack encoding of the arguments, and every cache hit still
+/// counts the operations and call depth the call used against the evaluation's limits. Calls
+/// passing or returning action handlers are never memoized. The name stays registered when the
+/// cache is cleared.
+#[no_mangle]
+pub extern "C" fn nx_memoize_render_cache_function(
+    handle: *const NxRenderCacheHandle,
+    name_ptr: *const u8,
+    name_len: usize,
+) -> NxEvalStatus {
+    if handle.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+    let Ok(name) = (unsafe { slice_to_str(name_ptr, name_len) }) else {
+        return NxEvalStatus::InvalidArgument;
+    };
+
+    let handle = unsafe { &*handle.cast::<RenderCacheHandleInner>() };
+    handle.cache.memoize_function(name);
+    NxEvalStatus::Ok
+}
+
+/// Drops every cached rendered value and resets the hit/miss counters.
+#[no_mangle]
+pub extern "C" fn nx_clear_render_cache(handle: *const NxRenderCacheHandle) {
+    if handle.is_null() {
+        return;
+    }
+
+    let handle = unsafe { &*handle.cast::<RenderCacheHandleInner>() };
+    handle.cache.clear();
+}
+
+/// Writes the cache's hit and miss counts, entry count, retained bytes, and capacity to
+/// `out_stats`.
+///
+/// Counters accumulate until `nx_clear_render_cache` resets them.
+#[no_mangle]
+pub extern "C" fn nx_get_render_cache_stats(
+    handle: *const NxRenderCacheHandle,
+    out_stats: *mut NxRenderCacheStats,
+) -> NxEvalStatus {
+    if handle.is_null() || out_stats.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let stats = unsafe { &*handle.cast::<RenderCacheHandleInner>() }
+        .cache
+        .stats();
+    unsafe {
+        *out_stats = NxRenderCacheStats {
+            hits: stats.hits,
+            misses: stats.misses,
+            entries: stats.entries,
+            bytes: stats.bytes,
+            capacity_bytes: stats.capacity_bytes,
+        };
+    }
+    NxEvalStatus::Ok
+}
+
+/// Releases a render cache created by `nx_create_render_cache` together with every cached value.
+///
+/// Passing null is a no-op. The handle must not be used by any thread after this call.
+#[no_mangle]
+pub extern "C" fn nx_free_render_cache(handle: *mut NxRenderCacheHandle) {
+    if handle.is_null() {
+        return;
+    }
+
+    unsafe {
+        let _ = Box::from_raw(handle.cast::<RenderCacheHandleInner>());
+    }
+}
+
+/// Turns evaluation statistics collection on (nonzero) or off (`0`) for every thread.
+///
+/// Collection is off by default and adds two clock reads per evaluation and per encoded payload
+/// while enabled.
+#[no_mangle]
+pub extern "C" fn nx_set_eval_stats_enabled(enabled: u32) {
+    set_eval_stats_enabled(enabled != 0);
+}
+
+/// Reports statistics for the most recent evaluation call made on the calling thread.
+///
+/// Evaluation calls are `nx_eval_source` and the entry points that initialize, evaluate, or
+/// dispatch components. Every counter is zero while collection is disabled.
+#[no_mangle]
+pub extern "C" fn nx_get_eval_stats(out_stats: *mut NxEvalStats) -> NxEvalStatus {
+    if out_stats.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let stats = eval_stats();
+    let encode_time = ENCODE_TIME.with(Cell::get);
+    unsafe {
+        *out_stats = NxEvalStats {
+            evaluations: stats.evaluations,
+            operations: stats.operations,
+            peak_call_depth: stats.peak_call_depth,
+            eval_nanos: duration_nanos(stats.eval_time),
+            encode_nanos: duration_nanos(encode_time),
+        };
+    }
+    NxEvalStatus::Ok
+}
+
+/// Reports the module counts and per-phase timings recorded while building a program artifact.
+///
+/// Per-module phases are summed across analysis workers. Artifacts loaded with
+/// `nx_load_program_artifact` only report `link_nanos`.
+#[no_mangle]
+pub extern "C" fn nx_get_program_artifact_build_stats(
+    program_artifact_ptr: *const NxProgramArtifactHandle,
+    out_stats: *mut NxProgramBuildStats,
+) -> NxEvalStatus {
+    if program_artifact_ptr.is_null() || out_stats.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let stats = unsafe { &*program_artifact_ptr.cast::<ProgramArtifactHandleInner>() }
+        .program_artifact
+        .build_stats;
+    unsafe {
+        *out_stats = NxProgramBuildStats {
+            parsed_modules: stats.parsed_modules,
+            analyzed_modules: stats.analyzed_modules,
+            parse_nanos: duration_nanos(stats.parse),
+            lower_nanos: duration_nanos(stats.lower),
+            analyze_nanos: duration_nanos(stats.analyze),
+            link_nanos: duration_nanos(stats.link),
+        };
+    }
+    NxEvalStatus::Ok
+}
+
+/// Variant of `nx_component_evaluate` that memoizes rendered output in `cache`.
+///
+/// Evaluations of the same component with byte-identical props and state are answered from the
+/// cache without decoding the inputs or rendering. Only successful renders are cached. Cache misses
+/// render under `limits`, which may be null for the defaults.
+#[no_mangle]
+pub extern "C" fn nx_component_evaluate_cached(
+    component_ptr: *const NxComponentHandle,
+    props_ptr: *const u8,
+    props_len: usize,
+    state_ptr: *const u8,
+    state_len: usize,
+    cache_ptr: *const NxRenderCacheHandle,
+    limits_ptr: *const NxEvalLimits,
+    output_format: u32,
+    out_buffer: *mut NxBuffer,
+) -> NxEvalStatus {
+    if let Err(status) = prepare_out_buffer(out_buffer) {
+        return status;
+    }
+
+    let output_format = match parse_output_format(output_format) {
+        Ok(output_format) => output_format,
+        Err(status) => return status,
+    };
+
+    if component_ptr.is_null() || cache_ptr.is_null() {
+        return NxEvalStatus::InvalidArgument;
+    }
+
+    let result = panic::catch_unwind(|| {
+        let props = unsafe { msgpack_component_input(props_ptr, props_len) }?;
+        let state = unsafe { msgpack_component_input(state_ptr, state_len) }?;
+        let cache = &unsafe { &*cache_ptr.cast::<RenderCacheHandleInner>() }.cache;
+
+        begin_eval_stats();
+        let (status, output) = with_component(component_ptr, |program_artifact, component| {
+            Ok(
+                match api_evaluate_resolved_component_program_artifact_cached(
+                    program_artifact,
+                    component,
+                    props,
+                    state,
+                    cache,
+                    parse_eval_limits(limits_ptr),
+                ) {
+                    Ok(result) => (NxEvalStatus::Ok, FfiOutput::Value(result.rendered)),
+                    Err(diagnostics) => (NxEvalStatus::Error, FfiOutput::Diagnostics(diagnostics)),
+                },
+            )
+        })?;
+        Ok((status, output.to_payload(output_format)?))
+    });
+
+    finish_output_entry(out_buffer, output_format, result)
+}
+
+fn resolved_component_init_output(
+    component_ptr: *const NxComponentHandle,
+    props_ptr: *const u8,
+    props_len: usize,
+    limits: ResourceLimits,
+) -> Result<(NxEvalStatus, FfiOutput), String> {
+    begin_eval_stats();
+    let props = unsafe { msgpack_component_input(props_ptr, props_len) }?;
+
+    with_component(component_ptr, |program_artifact, component| {
+        Ok(
+            match api_initialize_resolved_component_program_artifact(
+                program_artifact,
+                component,
+                props,
+                limits,
+            ) {
+                Ok(result) => (NxEvalStatus::Ok, FfiOutput::ComponentInit(result)),
+                Err(diagnostics) => (NxEvalStatus::Error, FfiOutput::Diagnostics(diagnostics)),
+            },
+        )
+    })
+}
+
+fn resolved_component_evaluate_output(
+    component_ptr: *const NxComponentHandle,
+    props_ptr: *const u8,
+    props_len: usize,
+    state_ptr: *const u8,
+    state_len: usize,
+    limits: ResourceLimits,
+) -> Result<(NxEvalStatus, FfiOutput), String> {
+    begin_eval_stats();
+    let props = unsafe { msgpack_component_input(props_ptr, props_len) }?;
+    let state = unsafe { msgpack_component_input(state_ptr, state_len) }?;
+
+    with_component(component_ptr, |program_artifact, component| {
+        Ok(
+            match api_evaluate_resolved_component_program_artifact(
+                program_artifact,
+                component,
+                props,
+                state,
+                limits,
+            ) {
+                Ok(result) => (NxEvalStatus::Ok, FfiOutput::Value(result.rendered)),
+                Err(diagnostics) => (NxEvalStatus::Error, FfiOutput::Diagnostics(diagnostics)),
+            },
+        )
+    })
 }
 
 unsafe fn slice_to_str<'a>(ptr: *const u8, len: usize) -> Result<&'a str, String> {
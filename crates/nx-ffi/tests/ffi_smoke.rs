@@ -5,18 +5,35 @@ use nx_api::{
     ProgramBuildContext,
 };
 use nx_ffi::{
-    nx_build_program_artifact, nx_build_workspace_program_artifact,
-    nx_component_dispatch_actions_program_artifact, nx_component_evaluate_program_artifact,
-    nx_component_init_program_artifact, nx_create_library_registry,
-    nx_create_program_build_context, nx_eval_program_artifact, nx_eval_source, nx_ffi_abi_version,
-    nx_free_buffer, nx_free_library_registry, nx_free_program_artifact,
-    nx_free_program_build_context, nx_load_library_into_registry, nx_validate_workspace, NxBuffer,
-    NxEvalStatus, NxLibraryRegistryHandle, NxOutputFormat, NxProgramArtifactHandle,
-    NxProgramBuildContextHandle, NxWorkspaceModule, NX_FFI_ABI_VERSION,
+    nx_apply_component_snapshot_delta, nx_build_program_artifact,
+    nx_build_workspace_program_artifact, nx_cancel, nx_clear_render_cache,
+    nx_component_dispatch_actions_program_artifact, nx_component_evaluate,
+    nx_component_evaluate_batch_program_artifact, nx_component_evaluate_cached,
+    nx_component_evaluate_program_artifact, nx_component_evaluate_program_artifact_into_arena,
+    nx_component_init, nx_component_init_program_artifact, nx_component_snapshot_delta,
+    nx_create_cancellation_handle, nx_create_library_registry, nx_create_output_arena,
+    nx_create_program_build_context, nx_create_render_cache, nx_eval_program_artifact,
+    nx_eval_program_artifact_into_arena, nx_eval_program_artifact_into_callback,
+    nx_eval_program_artifact_with_limits, nx_eval_source, nx_ffi_abi_version, nx_free_buffer,
+    nx_free_cancellation_handle, nx_free_component, nx_free_library_registry, nx_free_output_arena,
+    nx_free_program_artifact, nx_free_program_build_context, nx_free_render_cache,
+    nx_get_eval_stats, nx_get_program_artifact_build_stats, nx_get_render_cache_stats,
+    nx_load_libraries_into_registry, nx_load_library_into_registry, nx_load_program_artifact,
+    nx_memoize_render_cache_function, nx_rebuild_workspace_program_artifact, nx_reset_output_arena,
+    nx_resolve_component_program_artifact, nx_serialize_program_artifact,
+    nx_set_eval_stats_enabled, nx_set_library_registry_cache_directory,
+    nx_set_library_registry_load_workers, nx_set_program_build_context_analysis_workers,
+    nx_set_program_build_context_entry_closure_pruning, nx_validate_workspace, NxBatchResultEntry,
+    NxBuffer, NxBufferView, NxCancellationHandle, NxComponentEvaluateRequest, NxComponentHandle,
+    NxEvalLimits, NxEvalStats, NxEvalStatus, NxLibraryRegistryHandle, NxLibraryRoot,
+    NxOutputArenaHandle, NxOutputFormat, NxProgramArtifactHandle, NxProgramBuildContextHandle,
+    NxProgramBuildStats, NxRenderCacheHandle, NxRenderCacheStats, NxWorkspaceModule,
+    NX_FFI_ABI_VERSION,
 };
 use nx_interpreter::Interpreter;
 use nx_value::NxValue;
 use serde::Deserialize;
+use std::ffi::c_void;
 use tempfile::TempDir;
 
 fn empty_buffer() -> NxBuffer {
@@ -101,6 +118,29 @@ fn load_library_into_registry(
     (status, copy_and_free_buffer(out))
 }
 
+fn load_libraries_into_registry(
+    registry: *mut NxLibraryRegistryHandle,
+    root_paths: &[String],
+) -> (NxEvalStatus, Vec<u8>) {
+    let roots = root_paths
+        .iter()
+        .map(|root_path| NxLibraryRoot {
+            root_path_ptr: root_path.as_ptr(),
+            root_path_len: root_path.len(),
+        })
+        .collect::<Vec<_>>();
+    let mut out = empty_buffer();
+
+    let status = nx_load_libraries_into_registry(
+        registry as *const NxLibraryRegistryHandle,
+        roots.as_ptr(),
+        roots.len(),
+        &mut out as *mut NxBuffer,
+    );
+
+    (status, copy_and_free_buffer(out))
+}
+
 fn create_program_build_context(
     registry: *mut NxLibraryRegistryHandle,
 ) -> *mut NxProgramBuildContextHandle {
@@ -355,6 +395,101 @@ fn component_evaluate_json_with_program_artifact(
     )
 }
 
+fn component_evaluate_batch_with_program_artifact(
+    program_artifact: *mut NxProgramArtifactHandle,
+    requests: &[(&str, Option<&[u8]>, Option<&[u8]>)],
+    output_format: NxOutputFormat,
+) -> (NxEvalStatus, Vec<(u32, Vec<u8>)>) {
+    let descriptors = requests
+        .iter()
+        .map(|(component_name, props, state)| {
+            let (props_ptr, props_len) = props
+                .map(|bytes| (bytes.as_ptr(), bytes.len()))
+                .unwrap_or((std::ptr::null(), 0));
+            let (state_ptr, state_len) = state
+                .map(|bytes| (bytes.as_ptr(), bytes.len()))
+                .unwrap_or((std::ptr::null(), 0));
+            NxComponentEvaluateRequest {
+                component_name_ptr: component_name.as_ptr(),
+                component_name_len: component_name.len(),
+                props_ptr,
+                props_len,
+                state_ptr,
+                state_len,
+            }
+        })
+        .collect::<Vec<_>>();
+    let mut out = empty_buffer();
+
+    let status = nx_component_evaluate_batch_program_artifact(
+        program_artifact as *const NxProgramArtifactHandle,
+        descriptors.as_ptr(),
+        descriptors.len(),
+        std::ptr::null(),
+        output_format_value(output_format),
+        &mut out as *mut NxBuffer,
+    );
+    let bytes = copy_and_free_buffer(out);
+    if !matches!(status, NxEvalStatus::Ok) {
+        return (status, Vec::new());
+    }
+
+    let entry_size = std::mem::size_of::<NxBatchResultEntry>();
+    let entries = (0..requests.len())
+        .map(|index| {
+            let entry = unsafe {
+                std::ptr::read_unaligned(
+                    bytes[index * entry_size..]
+                        .as_ptr()
+                        .cast::<NxBatchResultEntry>(),
+                )
+            };
+            let start = entry.offset as usize;
+            let end = start + entry.len as usize;
+            (entry.status, bytes[start..end].to_vec())
+        })
+        .collect();
+
+    (status, entries)
+}
+
+fn create_output_arena() -> *mut NxOutputArenaHandle {
+    let mut arena = std::ptr::null_mut();
+    let status = nx_create_output_arena(&mut arena as *mut *mut NxOutputArenaHandle);
+    assert!(matches!(status, NxEvalStatus::Ok));
+    assert!(!arena.is_null());
+    arena
+}
+
+fn eval_into_arena(
+    program_artifact: *mut NxProgramArtifactHandle,
+    arena: *mut NxOutputArenaHandle,
+    output_format: NxOutputFormat,
+) -> (NxEvalStatus, NxBufferView) {
+    let mut view = NxBufferView {
+        ptr: std::ptr::null(),
+        len: 0,
+    };
+
+    let status = nx_eval_program_artifact_into_arena(
+        program_artifact as *const NxProgramArtifactHandle,
+        std::ptr::null(),
+        output_format_value(output_format),
+        arena,
+        &mut view as *mut NxBufferView,
+    );
+
+    (status, view)
+}
+
+fn view_bytes(view: &NxBufferView) -> &[u8] {
+    if view.len == 0 {
+        return &[];
+    }
+
+    unsafe { std::slice::from_raw_parts(view.ptr, view.len) }
+}
+
 fn component_dispatch_msgpack_with_program_artifact(
     program_artifact: *mut NxProgramArtifactHandle,
     state_snapshot: &[u8],
@@ -505,6 +640,122 @@ let root() = { answer() }"#;
     );
 }
 
+#[test]
+fn ffi_library_registry_cache_directory_persists_loaded_libraries() {
+    let temp = TempDir::new().expect("temp dir");
+    let library_root = temp.path().join("question-flow");
+    let cache_root = temp.path().join("cache");
+    std::fs::create_dir_all(&library_root).expect("library root");
+    std::fs::write(
+        library_root.join("QuestionFlow.nx"),
+        r#"export let answer() = { 42 }"#,
+    )
+    .expect("library file");
+
+    let cache_root_text = cache_root.display().to_string();
+    for _ in 0..2 {
+        let registry = create_library_registry();
+        let status = nx_set_library_registry_cache_directory(
+            registry as *const NxLibraryRegistryHandle,
+            cache_root_text.as_ptr(),
+            cache_root_text.len(),
+        );
+        assert!(matches!(status, NxEvalStatus::Ok));
+
+        let (load_status, load_bytes) =
+            load_library_into_registry(registry, &library_root.display().to_string());
+        nx_free_library_registry(registry);
+        assert!(matches!(load_status, NxEvalStatus::Ok));
+        assert!(load_bytes.is_empty());
+    }
+
+    let cached_entries = std::fs::read_dir(&cache_root)
+        .expect("cache directory should exist")
+        .count();
+    assert_eq!(cached_entries, 1);
+
+    let status = nx_set_library_registry_cache_directory(std::ptr::null(), std::ptr::null(), 0);
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+}
+
+#[test]
+fn ffi_program_artifact_image_loads_without_sources() {
+    let temp = TempDir::new().expect("temp dir");
+    let app_root = temp.path().join("app");
+    let library_root = temp.path().join("question-flow");
+    std::fs::create_dir_all(&app_root).expect("app root");
+    std::fs::create_dir_all(&library_root).expect("library root");
+    std::fs::write(
+        library_root.join("QuestionFlow.nx"),
+        r#"export let answer() = { 42 }"#,
+    )
+    .expect("library file");
+
+    let registry = create_library_registry();
+    let (load_status, _) =
+        load_library_into_registry(registry, &library_root.display().to_string());
+    assert!(matches!(load_status, NxEvalStatus::Ok));
+    let build_context = create_program_build_context(registry);
+    let main_path = app_root.join("main.nx");
+    let source = r#"import "../question-flow"
+let root() = { answer() }"#;
+    std::fs::write(&main_path, source).expect("main file");
+
+    let (program, build_status, _) = build_program_artifact_handle(
+        build_context as *const NxProgramBuildContextHandle,
+        source,
+        &main_path.display().to_string(),
+    );
+    nx_free_program_build_context(build_context);
+    nx_free_library_registry(registry);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let mut out = empty_buffer();
+    let status = nx_serialize_program_artifact(
+        program as *const NxProgramArtifactHandle,
+        &mut out as *mut NxBuffer,
+    );
+    nx_free_program_artifact(program);
+    assert!(matches!(status, NxEvalStatus::Ok));
+    let image = copy_and_free_buffer(out);
+    drop(temp);
+
+    let mut loaded: *mut NxProgramArtifactHandle = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let status = nx_load_program_artifact(
+        image.as_ptr(),
+        image.len(),
+        &mut loaded as *mut *mut NxProgramArtifactHandle,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::Ok));
+    assert!(copy_and_free_buffer(out).is_empty());
+    assert!(!loaded.is_null());
+
+    let (eval_status, eval_bytes) = eval_msgpack_with_program_artifact(loaded);
+    nx_free_program_artifact(loaded);
+    assert!(matches!(eval_status, NxEvalStatus::Ok));
+    assert_eq!(
+        NxValue::from_msgpack_slice(&eval_bytes).unwrap(),
+        NxValue::Int(42)
+    );
+
+    let corrupt = &image[..image.len() / 2];
+    let mut rejected: *mut NxProgramArtifactHandle = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let status = nx_load_program_artifact(
+        corrupt.as_ptr(),
+        corrupt.len(),
+        &mut rejected as *mut *mut NxProgramArtifactHandle,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::Error));
+    assert!(rejected.is_null());
+    let diagnostics: Vec<NxDiagnostic> =
+        rmp_serde::from_slice(&copy_and_free_buffer(out)).expect("diagnostics payload");
+    assert_eq!(diagnostics.len(), 1);
+}
+
 #[test]
 fn ffi_eval_program_artifact_returns_json_success_directly() {
     let build_context = create_empty_build_context();
@@ -523,6 +774,66 @@ fn ffi_eval_program_artifact_returns_json_success_directly() {
     assert_eq!(json, "42");
 }
 
+#[test]
+fn ffi_eval_program_artifact_with_limits_stops_on_deadline_and_cancellation() {
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) = build_program_artifact_handle(
+        build_context,
+        "let spin(n:int): int = { if n <= 0 { 0 } else { spin(n - 1) + spin(n - 1) } }\n\
+         let root(): int = { spin(40) }",
+        "spin.nx",
+    );
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let eval_with_limits = |limits: &NxEvalLimits| {
+        let mut out = empty_buffer();
+        let status = nx_eval_program_artifact_with_limits(
+            program,
+            limits as *const NxEvalLimits,
+            output_format_value(NxOutputFormat::MessagePack),
+            &mut out as *mut NxBuffer,
+        );
+        let diagnostics: Vec<NxDiagnostic> =
+            rmp_serde::from_slice(&copy_and_free_buffer(out)).unwrap();
+        (status, diagnostics[0].code.clone())
+    };
+
+    let (status, code) = eval_with_limits(&NxEvalLimits {
+        max_operations: u64::MAX,
+        max_recursion_depth: 0,
+        max_duration_micros: 10_000,
+        cancellation: std::ptr::null(),
+    });
+    assert!(matches!(status, NxEvalStatus::Error));
+    assert_eq!(code.as_deref(), Some("deadline-exceeded"));
+
+    let mut cancellation: *mut NxCancellationHandle = std::ptr::null_mut();
+    assert!(matches!(
+        nx_create_cancellation_handle(&mut cancellation as *mut *mut NxCancellationHandle),
+        NxEvalStatus::Ok
+    ));
+    let limits = NxEvalLimits {
+        max_operations: u64::MAX,
+        max_recursion_depth: 0,
+        max_duration_micros: 0,
+        cancellation,
+    };
+    let (status, code) = std::thread::scope(|scope| {
+        let cancellation = cancellation as usize;
+        scope.spawn(move || {
+            std::thread::sleep(std::time::Duration::from_millis(10));
+            nx_cancel(cancellation as *const NxCancellationHandle);
+        });
+        eval_with_limits(&limits)
+    });
+    nx_free_cancellation_handle(cancellation);
+    nx_free_program_artifact(program);
+
+    assert!(matches!(status, NxEvalStatus::Error));
+    assert_eq!(code.as_deref(), Some("evaluation-cancelled"));
+}
+
 #[test]
 fn ffi_build_program_artifact_reports_missing_library_from_context() {
     let temp = TempDir::new().expect("temp dir");
@@ -590,6 +901,154 @@ fn ffi_validate_workspace_returns_empty_diagnostics_payload_for_valid_workspace(
     assert!(diagnostics.is_empty());
 }
 
+#[test]
+fn ffi_rebuild_workspace_program_artifact_applies_changed_modules() {
+    let (_identities, _sources, descriptors) = workspace_descriptors(&[
+        (
+            b"app/main.nx",
+            br#"import { answer } from "../shared/value.nx"
+let root(): int = { answer }"#,
+        ),
+        (b"shared/value.nx", br#"export let answer: int = 41"#),
+    ]);
+    let build_context = create_empty_build_context();
+    let (previous, status, bytes) =
+        build_workspace_artifact_handle(build_context, &descriptors, "app/main.nx");
+    assert!(matches!(status, NxEvalStatus::Ok), "{bytes:?}");
+
+    let (_identities, _sources, changes) =
+        workspace_descriptors(&[(b"shared/value.nx", br#"export let answer: int = 42"#)]);
+    let mut rebuilt: *mut NxProgramArtifactHandle = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let status = nx_rebuild_workspace_program_artifact(
+        previous,
+        build_context,
+        changes.as_ptr(),
+        changes.len(),
+        &mut rebuilt as *mut *mut NxProgramArtifactHandle,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::Ok));
+    assert!(copy_and_free_buffer(out).is_empty());
+    assert!(!rebuilt.is_null());
+
+    let (status, previous_bytes) = eval_msgpack_with_program_artifact(previous);
+    assert!(matches!(status, NxEvalStatus::Ok));
+    assert_eq!(
+        NxValue::from_msgpack_slice(&previous_bytes).unwrap(),
+        NxValue::Int(41)
+    );
+    let (status, rebuilt_bytes) = eval_msgpack_with_program_artifact(rebuilt);
+    assert!(matches!(status, NxEvalStatus::Ok));
+    assert_eq!(
+        NxValue::from_msgpack_slice(&rebuilt_bytes).unwrap(),
+        NxValue::Int(42)
+    );
+
+    let (_identities, _sources, broken) =
+        workspace_descriptors(&[(b"shared/value.nx", br#"export let answer: int = "text""#)]);
+    let mut failed: *mut NxProgramArtifactHandle = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let status = nx_rebuild_workspace_program_artifact(
+        rebuilt,
+        build_context,
+        broken.as_ptr(),
+        broken.len(),
+        &mut failed as *mut *mut NxProgramArtifactHandle,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::Error));
+    assert!(failed.is_null());
+    let diagnostics: Vec<NxDiagnostic> = rmp_serde::from_slice(&copy_and_free_buffer(out)).unwrap();
+    assert!(!diagnostics.is_empty());
+
+    let mut out = empty_buffer();
+    let status = nx_rebuild_workspace_program_artifact(
+        std::ptr::null(),
+        build_context,
+        changes.as_ptr(),
+        changes.len(),
+        &mut failed as *mut *mut NxProgramArtifactHandle,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+    let _ = copy_and_free_buffer(out);
+
+    nx_free_program_artifact(rebuilt);
+    nx_free_program_artifact(previous);
+    nx_free_program_build_context(build_context);
+}
+
+#[test]
+fn ffi_entry_closure_pruning_skips_unreachable_modules() {
+    let (_identities, _sources, descriptors) = workspace_descriptors(&[
+        (
+            b"app/main.nx",
+            br#"import { answer } from "../shared/value.nx"
+let root(): int = { answer }"#,
+        ),
+        (b"shared/value.nx", br#"export let answer: int = 42"#),
+        (b"tools/broken.nx", br#"let broken(): int = { "text" }"#),
+    ]);
+    let build_context = create_empty_build_context();
+
+    let (program, status, _bytes) =
+        build_workspace_artifact_handle(build_context, &descriptors, "app/main.nx");
+    assert!(matches!(status, NxEvalStatus::Error));
+    assert!(program.is_null());
+
+    let status = nx_set_program_build_context_entry_closure_pruning(build_context, 1);
+    assert!(matches!(status, NxEvalStatus::Ok));
+    let (program, status, bytes) =
+        build_workspace_artifact_handle(build_context, &descriptors, "app/main.nx");
+    assert!(matches!(status, NxEvalStatus::Ok), "{bytes:?}");
+
+    let (status, eval_bytes) = eval_msgpack_with_program_artifact(program);
+    assert!(matches!(status, NxEvalStatus::Ok));
+    assert_eq!(
+        NxValue::from_msgpack_slice(&eval_bytes).unwrap(),
+        NxValue::Int(42)
+    );
+
+    nx_free_program_artifact(program);
+    nx_free_program_build_context(build_context);
+
+    let status = nx_set_program_build_context_entry_closure_pruning(std::ptr::null_mut(), 1);
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+}
+
+#[test]
+fn ffi_program_build_context_analysis_workers_do_not_change_results() {
+    let (_identities, _sources, descriptors) = workspace_descriptors(&[
+        (
+            b"app/main.nx",
+            br#"import { answer } from "../shared/value.nx"
+let root(): int = { answer }"#,
+        ),
+        (b"shared/value.nx", br#"export let answer: int = 42"#),
+        (b"broken.nx", br#"let broken(): int = { "text" }"#),
+    ]);
+
+    let mut payloads = Vec::new();
+    for worker_count in [1, 4] {
+        let build_context = create_empty_build_context();
+        let status = nx_set_program_build_context_analysis_workers(build_context, worker_count);
+        assert!(matches!(status, NxEvalStatus::Ok));
+
+        let (status, bytes) = validate_workspace_handle(build_context, &descriptors);
+        nx_free_program_build_context(build_context);
+        assert!(matches!(status, NxEvalStatus::Ok));
+        payloads.push(bytes);
+    }
+
+    let diagnostics: Vec<NxDiagnostic> = rmp_serde::from_slice(&payloads[0]).unwrap();
+    assert!(!diagnostics.is_empty());
+    assert_eq!(payloads[0], payloads[1]);
+
+    let status = nx_set_program_build_context_analysis_workers(std::ptr::null_mut(), 2);
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+}
+
 #[test]
 fn ffi_validate_workspace_rejects_null_module_array_with_count() {
     let build_context = create_empty_build_context();
@@ -789,45 +1248,121 @@ fn ffi_load_library_into_registry_validates_arguments() {
 }
 
 #[test]
-fn ffi_program_artifact_entry_points_reject_null_handles() {
-    let mut out_handle: *mut NxProgramArtifactHandle = std::ptr::null_mut();
-    let mut out = empty_buffer();
-    let status = nx_build_program_artifact(
-        std::ptr::null(),
-        b"let root() = { 42 }".as_ptr(),
-        "let root() = { 42 }".len(),
-        b"input.nx".as_ptr(),
-        "input.nx".len(),
-        &mut out_handle as *mut *mut NxProgramArtifactHandle,
-        &mut out as *mut NxBuffer,
-    );
-    assert!(matches!(status, NxEvalStatus::InvalidArgument));
-    assert!(out_handle.is_null());
-    let _ = copy_and_free_buffer(out);
+fn ffi_load_libraries_into_registry_loads_every_root() {
+    let temp = TempDir::new().expect("temp dir");
+    let app_root = temp.path().join("app");
+    let core_root = temp.path().join("core");
+    let ui_root = temp.path().join("ui");
+    let forms_root = temp.path().join("forms");
+    for root in [&app_root, &core_root, &ui_root, &forms_root] {
+        std::fs::create_dir_all(root).expect("root dir");
+    }
+    std::fs::write(core_root.join("base.nx"), r#"export let base() = { 40 }"#).expect("core file");
+    std::fs::write(
+        ui_root.join("one.nx"),
+        r#"import "../core"
+export let one() = { base() + 1 }"#,
+    )
+    .expect("ui file");
+    std::fs::write(forms_root.join("one.nx"), r#"export let two() = { 1 }"#).expect("forms file");
 
-    let mut out = empty_buffer();
-    let status = nx_eval_program_artifact(
-        std::ptr::null(),
-        output_format_value(NxOutputFormat::MessagePack),
-        &mut out as *mut NxBuffer,
-    );
+    let registry = create_library_registry();
+    let status =
+        nx_set_library_registry_load_workers(registry as *const NxLibraryRegistryHandle, 2);
+    assert!(matches!(status, NxEvalStatus::Ok));
+    let status = nx_set_library_registry_load_workers(std::ptr::null(), 2);
     assert!(matches!(status, NxEvalStatus::InvalidArgument));
-    let _ = copy_and_free_buffer(out);
-
-    let mut out = empty_buffer();
-    let status = nx_component_init_program_artifact(
-        std::ptr::null(),
-        b"SearchBox".as_ptr(),
-        "SearchBox".len(),
-        std::ptr::null(),
-        0,
-        output_format_value(NxOutputFormat::MessagePack),
-        &mut out as *mut NxBuffer,
+    let (load_status, load_bytes) = load_libraries_into_registry(
+        registry,
+        &[
+            ui_root.display().to_string(),
+            forms_root.display().to_string(),
+        ],
     );
-    assert!(matches!(status, NxEvalStatus::InvalidArgument));
-    let _ = copy_and_free_buffer(out);
+    assert!(matches!(load_status, NxEvalStatus::Ok));
+    assert!(load_bytes.is_empty());
 
-    let mut out = empty_buffer();
+    let build_context = create_program_build_context(registry);
+    let main_path = app_root.join("main.nx");
+    let source = r#"import "../ui"
+import "../forms"
+let root() = { one() + two() }"#;
+    std::fs::write(&main_path, source).expect("main file");
+
+    let (program, build_status, build_bytes) = build_program_artifact_handle(
+        build_context as *const NxProgramBuildContextHandle,
+        source,
+        &main_path.display().to_string(),
+    );
+    assert!(matches!(build_status, NxEvalStatus::Ok), "{build_bytes:?}");
+    nx_free_program_build_context(build_context);
+
+    let (eval_status, eval_bytes) = eval_msgpack_with_program_artifact(program);
+    nx_free_program_artifact(program);
+    assert!(matches!(eval_status, NxEvalStatus::Ok));
+    assert_eq!(
+        NxValue::from_msgpack_slice(&eval_bytes).unwrap(),
+        NxValue::Int(42)
+    );
+
+    let missing = temp.path().join("missing").display().to_string();
+    let (status, bytes) = load_libraries_into_registry(registry, &[missing]);
+    assert!(matches!(status, NxEvalStatus::Error));
+    let diagnostics: Vec<NxDiagnostic> = rmp_serde::from_slice(&bytes).unwrap();
+    assert_eq!(diagnostics[0].code.as_deref(), Some("library-load-error"));
+
+    let mut out = empty_buffer();
+    let status = nx_load_libraries_into_registry(
+        registry as *const NxLibraryRegistryHandle,
+        std::ptr::null(),
+        1,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+    let _ = copy_and_free_buffer(out);
+    nx_free_library_registry(registry);
+}
+
+#[test]
+fn ffi_program_artifact_entry_points_reject_null_handles() {
+    let mut out_handle: *mut NxProgramArtifactHandle = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let status = nx_build_program_artifact(
+        std::ptr::null(),
+        b"let root() = { 42 }".as_ptr(),
+        "let root() = { 42 }".len(),
+        b"input.nx".as_ptr(),
+        "input.nx".len(),
+        &mut out_handle as *mut *mut NxProgramArtifactHandle,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+    assert!(out_handle.is_null());
+    let _ = copy_and_free_buffer(out);
+
+    let mut out = empty_buffer();
+    let status = nx_eval_program_artifact(
+        std::ptr::null(),
+        output_format_value(NxOutputFormat::MessagePack),
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+    let _ = copy_and_free_buffer(out);
+
+    let mut out = empty_buffer();
+    let status = nx_component_init_program_artifact(
+        std::ptr::null(),
+        b"SearchBox".as_ptr(),
+        "SearchBox".len(),
+        std::ptr::null(),
+        0,
+        output_format_value(NxOutputFormat::MessagePack),
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+    let _ = copy_and_free_buffer(out);
+
+    let mut out = empty_buffer();
     let status = nx_component_evaluate_program_artifact(
         std::ptr::null(),
         b"SearchBox".as_ptr(),
@@ -927,6 +1462,79 @@ let root() = { 0 }"#;
     assert!(!init_result.state_snapshot.is_empty());
 }
 
+#[test]
+fn ffi_component_snapshot_delta_rebuilds_next_snapshot() {
+    let source = r#"
+        component <SearchBox placeholder:string = "Find docs" /> = {
+          state { query:string = {placeholder} }
+          <TextInput value={query} placeholder={placeholder} />
+        }
+    "#;
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) =
+        build_program_artifact_handle(build_context, source, "ffi-snapshot-delta.nx");
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let init_snapshot = |placeholder: &str| {
+        let props = NxValue::Record {
+            type_name: None,
+            properties: std::collections::BTreeMap::from([(
+                "placeholder".to_string(),
+                NxValue::String(placeholder.to_string()),
+            )]),
+        };
+        let props_msgpack = props.to_msgpack_vec().unwrap();
+        let (status, payload) = component_init_msgpack_with_program_artifact(
+            program,
+            "SearchBox",
+            Some(&props_msgpack),
+        );
+        assert!(matches!(status, NxEvalStatus::Ok));
+        rmp_serde::from_slice::<ComponentInitResult>(&payload)
+            .unwrap()
+            .state_snapshot
+    };
+    let previous = init_snapshot("Find docs");
+    let next = init_snapshot("Find packages");
+    nx_free_program_artifact(program);
+
+    let mut delta_out = empty_buffer();
+    let delta_status = nx_component_snapshot_delta(
+        previous.as_ptr(),
+        previous.len(),
+        next.as_ptr(),
+        next.len(),
+        &mut delta_out as *mut NxBuffer,
+    );
+    assert!(matches!(delta_status, NxEvalStatus::Ok));
+    let delta = copy_and_free_buffer(delta_out);
+
+    let mut applied_out = empty_buffer();
+    let apply_status = nx_apply_component_snapshot_delta(
+        previous.as_ptr(),
+        previous.len(),
+        delta.as_ptr(),
+        delta.len(),
+        &mut applied_out as *mut NxBuffer,
+    );
+    assert!(matches!(apply_status, NxEvalStatus::Ok));
+    assert_eq!(copy_and_free_buffer(applied_out), next);
+
+    let mut error_out = empty_buffer();
+    let error_status = nx_apply_component_snapshot_delta(
+        next.as_ptr(),
+        next.len(),
+        delta.as_ptr(),
+        delta.len(),
+        &mut error_out as *mut NxBuffer,
+    );
+    assert!(matches!(error_status, NxEvalStatus::Error));
+    let diagnostics: Vec<NxDiagnostic> =
+        rmp_serde::from_slice(&copy_and_free_buffer(error_out)).unwrap();
+    assert!(diagnostics[0].message.contains("different base snapshot"));
+}
+
 #[test]
 fn ffi_component_evaluate_returns_rendered_value_in_msgpack_and_json() {
     let source = r#"
@@ -993,6 +1601,118 @@ fn ffi_component_evaluate_returns_rendered_value_in_msgpack_and_json() {
     assert_eq!(NxValue::from_json_str(&json_payload).unwrap(), rendered);
 }
 
+#[test]
+fn ffi_component_evaluate_batch_writes_offset_table_and_per_entry_payloads() {
+    let source = r#"
+        component <SearchBox placeholder:string = "Find docs" /> = {
+          state { query:string }
+          <TextInput value={query} placeholder={placeholder} />
+        }
+    "#;
+    let state_for = |query: &str| {
+        NxValue::Record {
+            type_name: None,
+            properties: std::collections::BTreeMap::from([(
+                "query".to_string(),
+                NxValue::String(query.to_string()),
+            )]),
+        }
+        .to_msgpack_vec()
+        .unwrap()
+    };
+    let first_state = state_for("first");
+    let second_state = state_for("second");
+
+    let build_context = create_empty_build_context();
+    let (program, build_status, build_bytes) =
+        build_program_artifact_handle(build_context, source, "ffi-component-evaluate-batch.nx");
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+    assert!(build_bytes.is_empty());
+    assert!(!program.is_null());
+
+    let requests = [
+        ("SearchBox", None, Some(first_state.as_slice())),
+        ("SearchBox", None, None),
+        ("SearchBox", None, Some(second_state.as_slice())),
+    ];
+    let (msgpack_status, msgpack_entries) = component_evaluate_batch_with_program_artifact(
+        program,
+        &requests,
+        NxOutputFormat::MessagePack,
+    );
+    let (json_status, json_entries) =
+        component_evaluate_batch_with_program_artifact(program, &requests, NxOutputFormat::Json);
+    let (empty_status, empty_entries) =
+        component_evaluate_batch_with_program_artifact(program, &[], NxOutputFormat::MessagePack);
+    nx_free_program_artifact(program);
+
+    assert!(matches!(msgpack_status, NxEvalStatus::Ok));
+    assert_eq!(msgpack_entries.len(), 3);
+    let rendered_query = |value: NxValue| {
+        let NxValue::Record { properties, .. } = value else {
+            panic!("Expected rendered element record");
+        };
+        properties.get("value").cloned()
+    };
+    assert_eq!(msgpack_entries[0].0, NxEvalStatus::Ok as u32);
+    assert_eq!(
+        rendered_query(NxValue::from_msgpack_slice(&msgpack_entries[0].1).unwrap()),
+        Some(NxValue::String("first".to_string()))
+    );
+    assert_eq!(msgpack_entries[1].0, NxEvalStatus::Error as u32);
+    let diagnostics: Vec<NxDiagnostic> = rmp_serde::from_slice(&msgpack_entries[1].1).unwrap();
+    assert!(diagnostics.iter().any(|diagnostic| diagnostic
+        .message
+        .contains("Missing required component field 'query'")));
+    assert_eq!(msgpack_entries[2].0, NxEvalStatus::Ok as u32);
+    assert_eq!(
+        rendered_query(NxValue::from_msgpack_slice(&msgpack_entries[2].1).unwrap()),
+        Some(NxValue::String("second".to_string()))
+    );
+
+    assert!(matches!(json_status, NxEvalStatus::Ok));
+    assert_eq!(json_entries[0].0, NxEvalStatus::Ok as u32);
+    assert_eq!(
+        NxValue::from_json_str(std::str::from_utf8(&json_entries[0].1).unwrap()).unwrap(),
+        NxValue::from_msgpack_slice(&msgpack_entries[0].1).unwrap()
+    );
+    let diagnostics: Vec<NxDiagnostic> = serde_json::from_slice(&json_entries[1].1).unwrap();
+    assert!(!diagnostics.is_empty());
+
+    assert!(matches!(empty_status, NxEvalStatus::Ok));
+    assert!(empty_entries.is_empty());
+}
+
+#[test]
+fn ffi_component_evaluate_batch_rejects_null_request_array_with_count() {
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) = build_program_artifact_handle(
+        build_context,
+        r#"
+            component <SearchBox /> = {
+              <TextInput />
+            }
+        "#,
+        "ffi-component-evaluate-batch-null.nx",
+    );
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let mut out = empty_buffer();
+    let status = nx_component_evaluate_batch_program_artifact(
+        program as *const NxProgramArtifactHandle,
+        std::ptr::null(),
+        1,
+        std::ptr::null(),
+        output_format_value(NxOutputFormat::MessagePack),
+        &mut out as *mut NxBuffer,
+    );
+    nx_free_program_artifact(program);
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+    assert!(out.ptr.is_null());
+}
+
 #[test]
 fn ffi_component_evaluate_returns_invalid_state_diagnostics() {
     let source = r#"
@@ -1020,6 +1740,35 @@ fn ffi_component_evaluate_returns_invalid_state_diagnostics() {
         .contains("Missing required component field 'query'")));
 }
 
+#[test]
+fn ffi_component_evaluate_rejects_malformed_msgpack_props() {
+    let source = r#"
+        component <SearchBox placeholder:string = "Find docs" /> = {
+          state { query:string }
+          <TextInput value={query} placeholder={placeholder} />
+        }
+    "#;
+
+    let build_context = create_empty_build_context();
+    let (program, build_status, build_bytes) =
+        build_program_artifact_handle(build_context, source, "ffi-component-evaluate-props.nx");
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+    assert!(build_bytes.is_empty());
+    assert!(!program.is_null());
+
+    // A map header announcing one entry with no entry bytes following it.
+    let (status, diagnostics_bytes) =
+        component_evaluate_msgpack_with_program_artifact(program, "SearchBox", Some(&[0x81]), None);
+    nx_free_program_artifact(program);
+    assert!(matches!(status, NxEvalStatus::Error));
+    let diagnostics: Vec<NxDiagnostic> = rmp_serde::from_slice(&diagnostics_bytes).unwrap();
+    assert_eq!(diagnostics[0].code.as_deref(), Some("invalid-input"));
+    assert!(diagnostics[0]
+        .message
+        .starts_with("messagepack decode failed"));
+}
+
 #[test]
 fn ffi_component_evaluate_with_program_artifact_reuses_preloaded_library_component() {
     let temp = TempDir::new().expect("temp dir");
@@ -1504,6 +2253,518 @@ fn ffi_component_init_round_trips_state_snapshot_in_json_with_msgpack_props() {
         .is_empty());
 }
 
+#[test]
+fn ffi_output_arena_keeps_views_valid_until_reset() {
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) =
+        build_program_artifact_handle(build_context, "let root() = { 42 }", "arena.nx");
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let (_, expected_msgpack) = eval_msgpack_with_program_artifact(program);
+    let arena = create_output_arena();
+
+    let (first_status, first_view) = eval_into_arena(program, arena, NxOutputFormat::Json);
+    // Enough writes to force the arena past its first chunk.
+    let views = (0..2048)
+        .map(|_| eval_into_arena(program, arena, NxOutputFormat::MessagePack))
+        .collect::<Vec<_>>();
+
+    assert!(matches!(first_status, NxEvalStatus::Ok));
+    assert_eq!(view_bytes(&first_view), b"42");
+    for (status, view) in &views {
+        assert!(matches!(status, NxEvalStatus::Ok));
+        assert_eq!(view_bytes(view), expected_msgpack.as_slice());
+    }
+
+    nx_reset_output_arena(arena);
+    let (reset_status, reset_view) = eval_into_arena(program, arena, NxOutputFormat::Json);
+    assert!(matches!(reset_status, NxEvalStatus::Ok));
+    assert_eq!(view_bytes(&reset_view), b"42");
+
+    nx_free_output_arena(arena);
+    nx_free_program_artifact(program);
+}
+
+#[test]
+fn ffi_component_evaluate_into_arena_matches_buffer_output() {
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) = build_program_artifact_handle(
+        build_context,
+        r#"
+            component <SearchBox placeholder:string = "Find docs" /> = {
+              <TextInput placeholder={placeholder} />
+            }
+        "#,
+        "ffi-component-evaluate-arena.nx",
+    );
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let arena = create_output_arena();
+    let evaluate = |component_name: &str| {
+        let (buffer_status, buffer_bytes) =
+            component_evaluate_msgpack_with_program_artifact(program, component_name, None, None);
+        let mut view = NxBufferView {
+            ptr: std::ptr::null(),
+            len: 0,
+        };
+        let arena_status = nx_component_evaluate_program_artifact_into_arena(
+            program as *const NxProgramArtifactHandle,
+            component_name.as_ptr(),
+            component_name.len(),
+            std::ptr::null(),
+            0,
+            std::ptr::null(),
+            0,
+            std::ptr::null(),
+            output_format_value(NxOutputFormat::MessagePack),
+            arena,
+            &mut view as *mut NxBufferView,
+        );
+        assert_eq!(view_bytes(&view), buffer_bytes.as_slice());
+        (buffer_status, arena_status)
+    };
+
+    assert!(matches!(
+        evaluate("SearchBox"),
+        (NxEvalStatus::Ok, NxEvalStatus::Ok)
+    ));
+    assert!(matches!(
+        evaluate("MissingBox"),
+        (NxEvalStatus::Error, NxEvalStatus::Error)
+    ));
+
+    nx_free_output_arena(arena);
+    nx_free_program_artifact(program);
+}
+
+#[test]
+fn ffi_eval_into_arena_rejects_null_arena() {
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) =
+        build_program_artifact_handle(build_context, "let root() = { 42 }", "arena-null.nx");
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let (status, view) = eval_into_arena(program, std::ptr::null_mut(), NxOutputFormat::Json);
+    nx_free_program_artifact(program);
+
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+    assert!(view.ptr.is_null());
+    assert_eq!(view.len, 0);
+}
+
+#[test]
+fn ffi_resolved_component_outlives_artifact_and_matches_named_evaluation() {
+    let source = r#"
+        component <SearchBox placeholder:string = "Find docs" /> = {
+          <TextInput placeholder={placeholder} />
+        }
+    "#;
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) =
+        build_program_artifact_handle(build_context, source, "ffi-resolved-component.nx");
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let (named_status, named_bytes) =
+        component_evaluate_msgpack_with_program_artifact(program, "SearchBox", None, None);
+    assert!(matches!(named_status, NxEvalStatus::Ok));
+
+    let component_name = "SearchBox";
+    let mut component = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let resolve_status = nx_resolve_component_program_artifact(
+        program as *const NxProgramArtifactHandle,
+        component_name.as_ptr(),
+        component_name.len(),
+        &mut component as *mut *mut NxComponentHandle,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(resolve_status, NxEvalStatus::Ok));
+    assert!(copy_and_free_buffer(out).is_empty());
+    assert!(!component.is_null());
+    nx_free_program_artifact(program);
+
+    for _ in 0..2 {
+        let mut out = empty_buffer();
+        let status = nx_component_evaluate(
+            component as *const NxComponentHandle,
+            std::ptr::null(),
+            0,
+            std::ptr::null(),
+            0,
+            std::ptr::null(),
+            output_format_value(NxOutputFormat::MessagePack),
+            &mut out as *mut NxBuffer,
+        );
+        assert!(matches!(status, NxEvalStatus::Ok));
+        assert_eq!(copy_and_free_buffer(out), named_bytes);
+    }
+
+    nx_free_component(component);
+}
+
+#[test]
+fn ffi_resolved_cached_and_batch_calls_apply_eval_limits() {
+    let source = r#"
+        let spin(n:int): int = { if n <= 0 { 0 } else { spin(n - 1) + spin(n - 1) } }
+        component <Busy /> = { <Count value={spin(12)} /> }
+    "#;
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) =
+        build_program_artifact_handle(build_context, source, "ffi-limited-component.nx");
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let component_name = "Busy";
+    let mut component = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let resolve_status = nx_resolve_component_program_artifact(
+        program as *const NxProgramArtifactHandle,
+        component_name.as_ptr(),
+        component_name.len(),
+        &mut component as *mut *mut NxComponentHandle,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(resolve_status, NxEvalStatus::Ok));
+    nx_free_buffer(out);
+
+    let limits = NxEvalLimits {
+        max_operations: 100,
+        max_recursion_depth: 0,
+        max_duration_micros: 0,
+        cancellation: std::ptr::null(),
+    };
+    let limit_message = |bytes: &[u8]| {
+        let diagnostics: Vec<NxDiagnostic> = rmp_serde::from_slice(bytes).unwrap();
+        diagnostics[0].message.clone()
+    };
+    let evaluate = |limits_ptr: *const NxEvalLimits| {
+        let mut out = empty_buffer();
+        let status = nx_component_evaluate(
+            component as *const NxComponentHandle,
+            std::ptr::null(),
+            0,
+            std::ptr::null(),
+            0,
+            limits_ptr,
+            output_format_value(NxOutputFormat::MessagePack),
+            &mut out as *mut NxBuffer,
+        );
+        (status, copy_and_free_buffer(out))
+    };
+
+    let (status, _) = evaluate(std::ptr::null());
+    assert!(matches!(status, NxEvalStatus::Ok));
+    let (status, bytes) = evaluate(&limits as *const NxEvalLimits);
+    assert!(matches!(status, NxEvalStatus::Error));
+    assert!(limit_message(&bytes).contains("Operation limit exceeded"));
+
+    let mut out = empty_buffer();
+    let status = nx_component_init(
+        component as *const NxComponentHandle,
+        std::ptr::null(),
+        0,
+        &limits as *const NxEvalLimits,
+        output_format_value(NxOutputFormat::MessagePack),
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::Error));
+    assert!(limit_message(&copy_and_free_buffer(out)).contains("Operation limit exceeded"));
+
+    let mut cache = std::ptr::null_mut();
+    assert!(matches!(
+        nx_create_render_cache(1024 * 1024, &mut cache as *mut *mut NxRenderCacheHandle),
+        NxEvalStatus::Ok
+    ));
+    let mut out = empty_buffer();
+    let status = nx_component_evaluate_cached(
+        component as *const NxComponentHandle,
+        std::ptr::null(),
+        0,
+        std::ptr::null(),
+        0,
+        cache as *const NxRenderCacheHandle,
+        &limits as *const NxEvalLimits,
+        output_format_value(NxOutputFormat::MessagePack),
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::Error));
+    assert!(limit_message(&copy_and_free_buffer(out)).contains("Operation limit exceeded"));
+    nx_free_render_cache(cache);
+    nx_free_component(component);
+
+    let request = NxComponentEvaluateRequest {
+        component_name_ptr: component_name.as_ptr(),
+        component_name_len: component_name.len(),
+        props_ptr: std::ptr::null(),
+        props_len: 0,
+        state_ptr: std::ptr::null(),
+        state_len: 0,
+    };
+    let mut out = empty_buffer();
+    let status = nx_component_evaluate_batch_program_artifact(
+        program as *const NxProgramArtifactHandle,
+        &request as *const NxComponentEvaluateRequest,
+        1,
+        &limits as *const NxEvalLimits,
+        output_format_value(NxOutputFormat::MessagePack),
+        &mut out as *mut NxBuffer,
+    );
+    nx_free_program_artifact(program);
+    assert!(matches!(status, NxEvalStatus::Ok));
+    let bytes = copy_and_free_buffer(out);
+    let entry = unsafe { std::ptr::read_unaligned(bytes.as_ptr().cast::<NxBatchResultEntry>()) };
+    let start = entry.offset as usize;
+    let payload = &bytes[start..start + entry.len as usize];
+    assert_eq!(entry.status, NxEvalStatus::Error as u32);
+    assert!(limit_message(payload).contains("Operation limit exceeded"));
+}
+
+#[test]
+fn ffi_resolve_component_reports_missing_component_diagnostics() {
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) = build_program_artifact_handle(
+        build_context,
+        "component <SearchBox /> = { <TextInput /> }",
+        "ffi-resolved-component-missing.nx",
+    );
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let component_name = "MissingBox";
+    let mut component = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let status = nx_resolve_component_program_artifact(
+        program as *const NxProgramArtifactHandle,
+        component_name.as_ptr(),
+        component_name.len(),
+        &mut component as *mut *mut NxComponentHandle,
+        &mut out as *mut NxBuffer,
+    );
+    nx_free_program_artifact(program);
+
+    assert!(matches!(status, NxEvalStatus::Error));
+    assert!(component.is_null());
+    let diagnostics: Vec<NxDiagnostic> =
+        rmp_serde::from_slice(&copy_and_free_buffer(out)).expect("diagnostics payload");
+    assert!(!diagnostics.is_empty());
+}
+
+#[test]
+fn ffi_component_evaluate_cached_reuses_rendered_output_and_reports_stats() {
+    let source = r#"
+        component <SearchBox placeholder:string = "Find docs" /> = {
+          <TextInput placeholder={placeholder} />
+        }
+    "#;
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) =
+        build_program_artifact_handle(build_context, source, "ffi-render-cache.nx");
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let (named_status, named_bytes) =
+        component_evaluate_msgpack_with_program_artifact(program, "SearchBox", None, None);
+    assert!(matches!(named_status, NxEvalStatus::Ok));
+
+    let component_name = "SearchBox";
+    let mut component = std::ptr::null_mut();
+    let mut out = empty_buffer();
+    let resolve_status = nx_resolve_component_program_artifact(
+        program as *const NxProgramArtifactHandle,
+        component_name.as_ptr(),
+        component_name.len(),
+        &mut component as *mut *mut NxComponentHandle,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(resolve_status, NxEvalStatus::Ok));
+    assert!(copy_and_free_buffer(out).is_empty());
+    nx_free_program_artifact(program);
+
+    let mut cache = std::ptr::null_mut();
+    assert!(matches!(
+        nx_create_render_cache(1024 * 1024, &mut cache as *mut *mut NxRenderCacheHandle),
+        NxEvalStatus::Ok
+    ));
+    assert!(!cache.is_null());
+    let memoized = b"Badge";
+    assert!(matches!(
+        nx_memoize_render_cache_function(cache, memoized.as_ptr(), memoized.len()),
+        NxEvalStatus::Ok
+    ));
+    assert!(matches!(
+        nx_memoize_render_cache_function(std::ptr::null(), memoized.as_ptr(), memoized.len()),
+        NxEvalStatus::InvalidArgument
+    ));
+
+    for _ in 0..3 {
+        let mut out = empty_buffer();
+        let status = nx_component_evaluate_cached(
+            component as *const NxComponentHandle,
+            std::ptr::null(),
+            0,
+            std::ptr::null(),
+            0,
+            cache as *const NxRenderCacheHandle,
+            std::ptr::null(),
+            output_format_value(NxOutputFormat::MessagePack),
+            &mut out as *mut NxBuffer,
+        );
+        assert!(matches!(status, NxEvalStatus::Ok));
+        assert_eq!(copy_and_free_buffer(out), named_bytes);
+    }
+
+    let mut stats = NxRenderCacheStats::default();
+    assert!(matches!(
+        nx_get_render_cache_stats(cache, &mut stats as *mut NxRenderCacheStats),
+        NxEvalStatus::Ok
+    ));
+    assert_eq!((stats.hits, stats.misses, stats.entries), (2, 1, 1));
+    assert_eq!(stats.capacity_bytes, 1024 * 1024);
+    assert!(stats.bytes > 0);
+
+    nx_clear_render_cache(cache);
+    assert!(matches!(
+        nx_get_render_cache_stats(cache, &mut stats as *mut NxRenderCacheStats),
+        NxEvalStatus::Ok
+    ));
+    assert_eq!(
+        (stats.hits, stats.misses, stats.entries, stats.bytes),
+        (0, 0, 0, 0)
+    );
+
+    let mut out = empty_buffer();
+    let status = nx_component_evaluate_cached(
+        component as *const NxComponentHandle,
+        std::ptr::null(),
+        0,
+        std::ptr::null(),
+        0,
+        std::ptr::null(),
+        std::ptr::null(),
+        output_format_value(NxOutputFormat::MessagePack),
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+
+    nx_free_render_cache(cache);
+    nx_free_component(component);
+}
+
+#[test]
+fn ffi_reports_eval_and_build_stats() {
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) = build_program_artifact_handle(
+        build_context,
+        "let double(x:int): int = { x * 2 }\nlet root(): int = { double(21) }",
+        "stats.nx",
+    );
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let mut build_stats = NxProgramBuildStats::default();
+    assert!(matches!(
+        nx_get_program_artifact_build_stats(
+            program as *const NxProgramArtifactHandle,
+            &mut build_stats as *mut NxProgramBuildStats,
+        ),
+        NxEvalStatus::Ok
+    ));
+    assert_eq!(
+        (build_stats.parsed_modules, build_stats.analyzed_modules),
+        (1, 1)
+    );
+
+    nx_set_eval_stats_enabled(1);
+    let (status, json) = eval_json_with_program_artifact(program);
+    let mut stats = NxEvalStats::default();
+    let stats_status = nx_get_eval_stats(&mut stats as *mut NxEvalStats);
+    nx_set_eval_stats_enabled(0);
+    nx_free_program_artifact(program);
+
+    assert!(matches!(status, NxEvalStatus::Ok));
+    assert_eq!(json, "42");
+    assert!(matches!(stats_status, NxEvalStatus::Ok));
+    assert_eq!((stats.evaluations, stats.peak_call_depth), (1, 1));
+    assert!(stats.operations > 0);
+    assert!(matches!(
+        nx_get_eval_stats(std::ptr::null_mut()),
+        NxEvalStatus::InvalidArgument
+    ));
+}
+
+extern "C" fn collect_chunk(user_data: *mut c_void, ptr: *const u8, len: usize) -> i32 {
+    let chunks = unsafe { &mut *user_data.cast::<Vec<Vec<u8>>>() };
+    chunks.push(unsafe { std::slice::from_raw_parts(ptr, len) }.to_vec());
+    0
+}
+
+extern "C" fn reject_chunk(_user_data: *mut c_void, _ptr: *const u8, _len: usize) -> i32 {
+    1
+}
+
+#[test]
+fn ffi_eval_program_artifact_streams_payload_to_callback() {
+    let build_context = create_empty_build_context();
+    let (program, build_status, _) = build_program_artifact_handle(
+        build_context,
+        r#"let root() = { <page title="Report"><row value={1} /><row value={2} /></page> }"#,
+        "report.nx",
+    );
+    nx_free_program_build_context(build_context);
+    assert!(matches!(build_status, NxEvalStatus::Ok));
+
+    let (status, expected) = eval_msgpack_with_program_artifact(program);
+    assert!(matches!(status, NxEvalStatus::Ok));
+
+    let mut chunks: Vec<Vec<u8>> = Vec::new();
+    let mut out = empty_buffer();
+    let status = nx_eval_program_artifact_into_callback(
+        program as *const NxProgramArtifactHandle,
+        std::ptr::null(),
+        output_format_value(NxOutputFormat::MessagePack),
+        Some(collect_chunk),
+        &mut chunks as *mut Vec<Vec<u8>> as *mut c_void,
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::Ok));
+    assert!(copy_and_free_buffer(out).is_empty());
+    assert!(!chunks.is_empty());
+    assert_eq!(chunks.concat(), expected);
+
+    let mut out = empty_buffer();
+    let status = nx_eval_program_artifact_into_callback(
+        program as *const NxProgramArtifactHandle,
+        std::ptr::null(),
+        output_format_value(NxOutputFormat::MessagePack),
+        Some(reject_chunk),
+        std::ptr::null_mut(),
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::Error));
+    let diagnostics: Vec<NxDiagnostic> =
+        rmp_serde::from_slice(&copy_and_free_buffer(out)).expect("diagnostics payload");
+    assert!(diagnostics[0]
+        .message
+        .contains("output callback stopped the stream"));
+
+    let mut out = empty_buffer();
+    let status = nx_eval_program_artifact_into_callback(
+        program as *const NxProgramArtifactHandle,
+        std::ptr::null(),
+        output_format_value(NxOutputFormat::MessagePack),
+        None,
+        std::ptr::null_mut(),
+        &mut out as *mut NxBuffer,
+    );
+    assert!(matches!(status, NxEvalStatus::InvalidArgument));
+
+    nx_free_program_artifact(program);
+}
+
 #[test]
 fn ffi_exposes_abi_version() {
     assert_eq!(nx_ffi_abi_version(), NX_FFI_ABI_VERSION);
@@ -0,0 +1,178 @@
+//! Serde adapters for `la-arena` storage used by lowered modules.
+//!
+//! `la-arena` does not implement serde itself. Arena indices are written as their raw `u32`
+//! values and arenas as the sequence of their values in allocation order, so a deserialized
+//! arena hands out exactly the indices that were serialized.
+//!
+//! Use these modules through `#[serde(with = "...")]` on fields holding arena data.
+
+use la_arena::{Arena, Idx, RawIdx};
+use rustc_hash::FxHashMap;
+use serde::de::{Deserialize, Deserializer, SeqAccess, Visitor};
+use serde::ser::{Serialize, SerializeSeq, Serializer};
+use std::fmt;
+use std::marker::PhantomData;
+
+fn raw<T>(idx: Idx<T>) -> u32 {
+    u32::from(idx.into_raw())
+}
+
+fn from_raw<T>(raw: u32) -> Idx<T> {
+    Idx::from_raw(RawIdx::from(raw))
+}
+
+/// Serializes one `Idx<T>` as its raw index.
+pub mod idx {
+    use super::*;
+
+    pub fn serialize<T, S: Serializer>(idx: &Idx<T>, serializer: S) -> Result<S::Ok, S::Error> {
+        serializer.serialize_u32(raw(*idx))
+    }
+
+    pub fn deserialize<'de, T, D: Deserializer<'de>>(deserializer: D) -> Result<Idx<T>, D::Error> {
+        u32::deserialize(deserializer).map(from_raw)
+    }
+}
+
+/// Serializes one `Option<Idx<T>>` as an optional raw index.
+pub mod option_idx {
+    use super::*;
+
+    pub fn serialize<T, S: Serializer>(
+        idx: &Option<Idx<T>>,
+        serializer: S,
+    ) -> Result<S::Ok, S::Error> {
+        idx.map(raw).serialize(serializer)
+    }
+
+    pub fn deserialize<'de, T, D: Deserializer<'de>>(
+        deserializer: D,
+    ) -> Result<Option<Idx<T>>, D::Error> {
+        Option::<u32>::deserialize(deserializer).map(|raw| raw.map(from_raw))
+    }
+}
+
+/// Serializes one `Vec<Idx<T>>` as a sequence of raw indices.
+pub mod vec_idx {
+    use super::*;
+
+    pub fn serialize<T, S: Serializer>(ids: &[Idx<T>], serializer: S) -> Result<S::Ok, S::Error> {
+        let mut seq = serializer.serialize_seq(Some(ids.len()))?;
+        for id in ids {
+            seq.serialize_element(&raw(*id))?;
+        }
+        seq.end()
+    }
+
+    pub fn deserialize<'de, T, D: Deserializer<'de>>(
+        deserializer: D,
+    ) -> Result<Vec<Idx<T>>, D::Error> {
+        Vec::<u32>::deserialize(deserializer).map(|ids| ids.into_iter().map(from_raw).collect())
+    }
+}
+
+/// Serializes one `FxHashMap<Idx<K>, V>` as a sequence of `(raw index, value)` pairs.
+pub mod idx_map {
+    use super::*;
+
+    pub fn serialize<K, V: Serialize, S: Serializer>(
+        map: &FxHashMap<Idx<K>, V>,
+        serializer: S,
+    ) -> Result<S::Ok, S::Error> {
+        let mut seq = serializer.serialize_seq(Some(map.len()))?;
+        for (id, value) in map {
+            seq.serialize_element(&(raw(*id), value))?;
+        }
+        seq.end()
+    }
+
+    pub fn deserialize<'de, K, V: Deserialize<'de>, D: Deserializer<'de>>(
+        deserializer: D,
+    ) -> Result<FxHashMap<Idx<K>, V>, D::Error> {
+        Vec::<(u32, V)>::deserialize(deserializer).map(|entries| {
+            entries
+                .into_iter()
+                .map(|(id, value)| (from_raw(id), value))
+                .collect()
+        })
+    }
+}
+
+/// Serializes one `Arena<T>` as the sequence of its values in allocation order.
+pub mod arena {
+    use super::*;
+
+    pub fn serialize<T: Serialize, S: Serializer>(
+        arena: &Arena<T>,
+        serializer: S,
+    ) -> Result<S::Ok, S::Error> {
+        let mut seq = serializer.serialize_seq(Some(arena.len()))?;
+        for (_, value) in arena.iter() {
+            seq.serialize_element(value)?;
+        }
+        seq.end()
+    }
+
+    pub fn deserialize<'de, T: Deserialize<'de>, D: Deserializer<'de>>(
+        deserializer: D,
+    ) -> Result<Arena<T>, D::Error> {
+        struct ArenaVisitor<T>(PhantomData<T>);
+
+        impl<'de, T: Deserialize<'de>> Visitor<'de> for ArenaVisitor<T> {
+            type Value = Arena<T>;
+
+            fn expecting(&self, formatter: &mut fmt::Formatter<'_>) -> fmt::Result {
+                formatter.write_str("a sequence of arena values")
+            }
+
+            fn visit_seq<A: SeqAccess<'de>>(self, mut seq: A) -> Result<Arena<T>, A::Error> {
+                let mut arena = Arena::new();
+                while let Some(value) = seq.next_element()? {
+                    arena.alloc(value);
+                }
+                Ok(arena)
+            }
+        }
+
+        deserializer.deserialize_seq(ArenaVisitor(PhantomData))
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use serde::{Deserialize, Serialize};
+
+    #[derive(Debug, PartialEq, Serialize, Deserialize)]
+    struct Holder {
+        #[serde(with = "super::arena")]
+        values: la_arena::Arena<String>,
+        #[serde(with = "super::idx")]
+        first: la_arena::Idx<String>,
+        #[serde(with = "super::option_idx")]
+        second: Option<la_arena::Idx<String>>,
+        #[serde(with = "super::vec_idx")]
+        all: Vec<la_arena::Idx<String>>,
+    }
+
+    #[test]
+    fn arena_round_trip_preserves_indices() {
+        let mut values = la_arena::Arena::new();
+        let first = values.alloc("a".to_string());
+        let second = values.alloc("b".to_string());
+        let holder = Holder {
+            values,
+            first,
+            second: Some(second),
+            all: vec![second, first],
+        };
+
+        let bytes = rmp_serde::to_vec(&holder).expect("serialize holder");
+        let decoded: Holder = rmp_serde::from_slice(&bytes).expect("deserialize holder");
+        assert_eq!(decoded.values[decoded.first], "a");
+        assert_eq!(
+            decoded.second.map(|id| decoded.values[id].as_str()),
+            Some("b")
+        );
+        assert_eq!(decoded.all, vec![second, first]);
+    }
+}
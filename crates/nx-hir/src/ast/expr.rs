@@ -2,10 +2,11 @@
 
 use crate::{ElementId, ExprId, Name};
 use nx_diagnostics::{TextSize, TextSpan};
+use serde::{Deserialize, Serialize};
 use smol_str::SmolStr;
 
 /// Literal value in source code.
-#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub enum Literal {
     /// String literal.
     ///
@@ -37,7 +38,7 @@ pub enum Literal {
 ///
 /// This is needed because f64 doesn't implement Eq/Hash due to NaN != NaN in IEEE 754.
 /// For AST comparison purposes, we treat all NaN values as equivalent.
-#[derive(Debug, Clone, Copy)]
+#[derive(Debug, Clone, Copy, Serialize, Deserialize)]
 pub struct OrderedFloat(pub f64);
 
 impl PartialEq for OrderedFloat {
@@ -64,18 +65,19 @@ impl std::hash::Hash for OrderedFloat {
 }
 
 /// Property assignment inside a record literal.
-#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub struct RecordLiteralProperty {
     /// Property key.
     pub name: Name,
     /// Property value expression.
+    #[serde(with = "crate::arena_serde::idx")]
     pub value: ExprId,
     /// Source span for the property assignment.
     pub span: TextSpan,
 }
 
 /// Binary operator.
-#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub enum BinOp {
     // Arithmetic
     Add, // +
@@ -101,7 +103,7 @@ pub enum BinOp {
 }
 
 /// Unary operator.
-#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub enum UnOp {
     /// Negation: `-`
     Neg,
@@ -110,11 +112,13 @@ pub enum UnOp {
 }
 
 /// One arm of a match-style `if value is { ... }` expression.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct MatchArm {
     /// Patterns accepted by this arm.
+    #[serde(with = "crate::arena_serde::vec_idx")]
     pub patterns: Vec<ExprId>,
     /// Body evaluated when any pattern matches.
+    #[serde(with = "crate::arena_serde::idx")]
     pub body: ExprId,
 }
 
@@ -122,7 +126,7 @@ pub struct MatchArm {
 ///
 /// All expressions are stored in an arena and referenced by `ExprId`.
 /// This enables efficient memory management and supports cyclic references.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub enum Expr {
     /// Literal value.
     ///
@@ -138,8 +142,10 @@ pub enum Expr {
     ///
     /// Example: `a + b`, `x == y`
     BinaryOp {
+        #[serde(with = "crate::arena_serde::idx")]
         lhs: ExprId,
         op: BinOp,
+        #[serde(with = "crate::arena_serde::idx")]
         rhs: ExprId,
         span: TextSpan,
     },
@@ -149,6 +155,7 @@ pub enum Expr {
     /// Example: `-x`, `!flag`
     UnaryOp {
         op: UnOp,
+        #[serde(with = "crate::arena_serde::idx")]
         expr: ExprId,
         span: TextSpan,
     },
@@ -157,7 +164,9 @@ pub enum Expr {
     ///
     /// Example: `foo(1, 2)`, `bar()`
     Call {
+        #[serde(with = "crate::arena_serde::idx")]
         func: ExprId,
+        #[serde(with = "crate::arena_serde::vec_idx")]
         args: Vec<ExprId>,
         span: TextSpan,
     },
@@ -166,8 +175,11 @@ pub enum Expr {
     ///
     /// Example: `if x { y } else { z }`
     If {
+        #[serde(with = "crate::arena_serde::idx")]
         condition: ExprId,
+        #[serde(with = "crate::arena_serde::idx")]
         then_branch: ExprId,
+        #[serde(with = "crate::arena_serde::option_idx")]
         else_branch: Option<ExprId>,
         span: TextSpan,
     },
@@ -176,8 +188,10 @@ pub enum Expr {
     ///
     /// Example: `if state is { LoadState.failed => state.message else => "" }`
     Match {
+        #[serde(with = "crate::arena_serde::idx")]
         scrutinee: ExprId,
         arms: Vec<MatchArm>,
+        #[serde(with = "crate::arena_serde::option_idx")]
         else_branch: Option<ExprId>,
         span: TextSpan,
     },
@@ -190,7 +204,9 @@ pub enum Expr {
     /// Example: `let x = expensive() in x + x`
     Let {
         name: Name,
+        #[serde(with = "crate::arena_serde::idx")]
         value: ExprId,
+        #[serde(with = "crate::arena_serde::idx")]
         body: ExprId,
         span: TextSpan,
     },
@@ -200,6 +216,7 @@ pub enum Expr {
     /// Example: `{ let x = 1; x + 2 }`
     Block {
         stmts: Vec<super::Stmt>,
+        #[serde(with = "crate::arena_serde::option_idx")]
         expr: Option<ExprId>,
         span: TextSpan,
     },
@@ -208,6 +225,7 @@ pub enum Expr {
     ///
     /// Example: `[1, 2, 3]`
     Array {
+        #[serde(with = "crate::arena_serde::vec_idx")]
         elements: Vec<ExprId>,
         span: TextSpan,
     },
@@ -216,7 +234,9 @@ pub enum Expr {
     ///
     /// Example: `arr[0]`, `matrix[i][j]`
     Index {
+        #[serde(with = "crate::arena_serde::idx")]
         base: ExprId,
+        #[serde(with = "crate::arena_serde::idx")]
         index: ExprId,
         span: TextSpan,
     },
@@ -225,6 +245,7 @@ pub enum Expr {
     ///
     /// Example: `obj.field`
     Member {
+        #[serde(with = "crate::arena_serde::idx")]
         base: ExprId,
         member: Name,
         span: TextSpan,
@@ -245,7 +266,11 @@ pub enum Expr {
     /// Element literal expression.
     ///
     /// Example: `<button class="primary" />`
-    Element { element: ElementId, span: TextSpan },
+    Element {
+        #[serde(with = "crate::arena_serde::idx")]
+        element: ElementId,
+        span: TextSpan,
+    },
 
     /// Lazy component action handler callback.
     ///
@@ -259,6 +284,7 @@ pub enum Expr {
         /// Exported action type name expected at invocation time
         action_name: Name,
         /// Handler body expression
+        #[serde(with = "crate::arena_serde::idx")]
         body: ExprId,
         /// Source span
         span: TextSpan,
@@ -274,8 +300,10 @@ pub enum Expr {
         /// Optional index variable
         index: Option<Name>,
         /// Iterable expression
+        #[serde(with = "crate::arena_serde::idx")]
         iterable: ExprId,
         /// Loop body expression
+        #[serde(with = "crate::arena_serde::idx")]
         body: ExprId,
         span: TextSpan,
     },
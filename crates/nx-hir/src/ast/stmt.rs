@@ -3,11 +3,12 @@
 use super::TypeRef;
 use crate::{ExprId, Name};
 use nx_diagnostics::TextSpan;
+use serde::{Deserialize, Serialize};
 
 /// Statement AST node.
 ///
 /// Statements are used within blocks and function bodies.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub enum Stmt {
     /// Let binding (variable declaration).
     ///
@@ -18,6 +19,7 @@ pub enum Stmt {
         /// Optional type annotation (None means inferred)
         ty: Option<TypeRef>,
         /// Initializer expression
+        #[serde(with = "crate::arena_serde::idx")]
         init: ExprId,
         /// Source location
         span: TextSpan,
@@ -26,7 +28,7 @@ pub enum Stmt {
     /// Expression statement.
     ///
     /// Example: `foo();`, `x + 1;`
-    Expr(ExprId, TextSpan),
+    Expr(#[serde(with = "crate::arena_serde::idx")] ExprId, TextSpan),
 }
 
 impl Stmt {
@@ -4,13 +4,14 @@
 //! They are resolved to concrete types during type checking.
 
 use crate::Name;
+use serde::{Deserialize, Serialize};
 
 /// Reference to a type in source code.
 ///
 /// This is the syntactic representation of types before type checking.
 /// During type checking, these are resolved to concrete `Type` values
 /// in the nx-types crate.
-#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub enum TypeRef {
     /// Named type reference (primitive or user-defined).
     ///
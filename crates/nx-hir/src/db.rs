@@ -4,15 +4,57 @@
 //! incremental parsing, lowering, and semantic analysis.
 
 use crate::{lower, LoweredModule, SourceId};
-use nx_syntax::parse_str;
-use std::sync::Arc;
+use nx_syntax::{parse_shared, reparse_str, SyntaxTree, TextEdit};
+use rustc_hash::FxHashMap;
+use std::sync::{Arc, Mutex};
+
+/// Most recent syntax tree of each file, kept alongside the salsa storage.
+///
+/// tree-sitter trees are not `Eq`, so they cannot be salsa query values. Keeping the last tree
+/// per file here lets [`DatabaseImpl::apply_source_edits`] reparse incrementally. Each tree shares
+/// its source allocation with the file's `source_text` input, so the text is stored once and a
+/// tree is current exactly when it points at the input's allocation.
+#[derive(Clone, Default)]
+pub struct SyntaxTreeCache {
+    trees: Arc<Mutex<FxHashMap<SourceId, Arc<SyntaxTree>>>>,
+}
+
+impl SyntaxTreeCache {
+    fn get(&self, file: SourceId, source: &Arc<String>) -> Option<Arc<SyntaxTree>> {
+        let trees = self.trees.lock().expect("syntax tree cache poisoned");
+        trees
+            .get(&file)
+            .filter(|tree| Arc::ptr_eq(tree.shared_source(), source))
+            .cloned()
+    }
+
+    fn insert(&self, file: SourceId, tree: Arc<SyntaxTree>) {
+        self.trees
+            .lock()
+            .expect("syntax tree cache poisoned")
+            .insert(file, tree);
+    }
+
+    fn remove(&self, file: SourceId) {
+        self.trees
+            .lock()
+            .expect("syntax tree cache poisoned")
+            .remove(&file);
+    }
+}
+
+/// Access to the [`SyntaxTreeCache`] of a database.
+pub trait SyntaxTreeStore {
+    /// Returns the syntax tree cache shared by this database and its snapshots.
+    fn syntax_trees(&self) -> &SyntaxTreeCache;
+}
 
 /// The main query group for NX language analysis.
 ///
 /// This defines all the incremental queries that Salsa will manage.
 /// Queries are automatically cached and invalidated when their inputs change.
 #[salsa::query_group(NxDatabaseStorage)]
-pub trait NxDatabase: salsa::Database {
+pub trait NxDatabase: salsa::Database + SyntaxTreeStore {
     /// Input query: Source text for a file.
     ///
     /// This is set manually via `set_source_text()`. When it changes,
@@ -57,20 +99,27 @@ pub trait NxDatabase: salsa::Database {
 ///
 /// This function performs both parsing and lowering in one step, which allows
 /// us to avoid storing the tree-sitter Tree in Salsa's cache (it doesn't implement Eq).
+/// A tree already produced for the current source by an incremental reparse is lowered
+/// directly instead of parsing again.
 fn lower_to_hir(db: &dyn NxDatabase, file: SourceId) -> Arc<LoweredModule> {
     let source = db.source_text(file);
-    let file_name = db.file_name(file);
-
-    // Parse the source
-    let parse_result = parse_str(&source, &file_name);
 
-    if let Some(ref tree) = parse_result.tree {
-        let root = tree.root();
-        let module = lower(root, file);
-        Arc::new(module)
-    } else {
+    let tree = match db.syntax_trees().get(file, &source) {
+        Some(tree) => Some(tree),
+        None => {
+            let file_name = db.file_name(file);
+            let tree = parse_shared(&source, &file_name).tree.map(Arc::new);
+            if let Some(tree) = &tree {
+                db.syntax_trees().insert(file, Arc::clone(tree));
+            }
+            tree
+        }
+    };
+
+    match tree {
+        Some(tree) => Arc::new(lower(tree.root(), file)),
         // If parsing failed, return an empty module
-        Arc::new(LoweredModule::new(file))
+        None => Arc::new(LoweredModule::new(file)),
     }
 }
 
@@ -102,6 +151,53 @@ fn lower_to_hir(db: &dyn NxDatabase, file: SourceId) -> Arc<LoweredModule> {
 #[derive(Default)]
 pub struct DatabaseImpl {
     storage: salsa::Storage<Self>,
+    syntax_trees: SyntaxTreeCache,
+}
+
+impl DatabaseImpl {
+    /// Applies text edits to the current source of a file.
+    ///
+    /// The file is reparsed incrementally from its previous syntax tree, reusing every subtree
+    /// outside the edited ranges, and the edited text becomes the new `source_text` input.
+    /// Files whose previous tree is unavailable are parsed in full. Other files keep their
+    /// cached results.
+    ///
+    /// Returns `false` without changing the file when an edit range is invalid for the text.
+    pub fn apply_source_edits(&mut self, file: SourceId, edits: &[TextEdit]) -> bool {
+        let source = self.source_text(file);
+        let file_name = self.file_name(file);
+        let previous = match self.syntax_trees.get(file, &source) {
+            Some(tree) => tree,
+            None => match parse_shared(&source, &file_name).tree {
+                Some(tree) => Arc::new(tree),
+                None => return false,
+            },
+        };
+
+        let Some(tree) = reparse_str(&previous, edits, &file_name).tree else {
+            return false;
+        };
+        // The input takes the tree's own source allocation, which keeps the cached tree current.
+        let new_source = Arc::clone(tree.shared_source());
+        self.syntax_trees.insert(file, Arc::new(tree));
+        self.set_source_text(file, new_source);
+        true
+    }
+
+    /// Forgets a file that left the workspace.
+    ///
+    /// Salsa inputs cannot be removed, so the file's text becomes empty, which releases its old
+    /// source and lowers to an empty module, and its cached syntax tree is dropped.
+    pub fn remove_file(&mut self, file: SourceId) {
+        self.syntax_trees.remove(file);
+        self.set_source_text(file, Arc::new(String::new()));
+    }
+}
+
+impl SyntaxTreeStore for DatabaseImpl {
+    fn syntax_trees(&self) -> &SyntaxTreeCache {
+        &self.syntax_trees
+    }
 }
 
 impl salsa::Database for DatabaseImpl {}
@@ -110,6 +206,7 @@ impl salsa::ParallelDatabase for DatabaseImpl {
     fn snapshot(&self) -> salsa::Snapshot<Self> {
         salsa::Snapshot::new(DatabaseImpl {
             storage: self.storage.snapshot(),
+            syntax_trees: self.syntax_trees.clone(),
         })
     }
 }
@@ -203,4 +300,74 @@ mod tests {
         // file2 should be cached (unchanged)
         assert!(Arc::ptr_eq(&module2_v1, &module2_v2));
     }
+
+    #[test]
+    fn test_apply_source_edits_reparses_edited_file() {
+        use nx_diagnostics::{TextSize, TextSpan};
+
+        let mut db = DatabaseImpl::default();
+        let file1 = SourceId::new(0);
+        let file2 = SourceId::new(1);
+
+        db.set_source_text(file1, Arc::new("let x = 1\nlet y = 2".to_string()));
+        db.set_file_name(file1, Arc::new("file1.nx".to_string()));
+        db.set_source_text(file2, Arc::new("let z = 3".to_string()));
+        db.set_file_name(file2, Arc::new("file2.nx".to_string()));
+
+        let module1_v1 = db.lower_to_hir(file1);
+        let module2_v1 = db.lower_to_hir(file2);
+
+        let edit = TextEdit::new(TextSpan::new(TextSize::from(8), TextSize::from(9)), "99");
+        assert!(db.apply_source_edits(file1, &[edit]));
+        assert_eq!(db.source_text(file1).as_str(), "let x = 99\nlet y = 2");
+
+        let module1_v2 = db.lower_to_hir(file1);
+        let module2_v2 = db.lower_to_hir(file2);
+        assert!(!Arc::ptr_eq(&module1_v1, &module1_v2));
+        assert!(Arc::ptr_eq(&module2_v1, &module2_v2));
+
+        let mut full = DatabaseImpl::default();
+        full.set_source_text(file1, Arc::new("let x = 99\nlet y = 2".to_string()));
+        full.set_file_name(file1, Arc::new("file1.nx".to_string()));
+        assert_eq!(*module1_v2, *full.lower_to_hir(file1));
+
+        let invalid = TextEdit::new(TextSpan::new(TextSize::from(40), TextSize::from(41)), "");
+        assert!(!db.apply_source_edits(file1, &[invalid]));
+        assert_eq!(db.source_text(file1).as_str(), "let x = 99\nlet y = 2");
+    }
+
+    #[test]
+    fn test_syntax_tree_cache_shares_source_with_input() {
+        use nx_diagnostics::{TextSize, TextSpan};
+
+        let mut db = DatabaseImpl::default();
+        let file = SourceId::new(0);
+        db.set_source_text(file, Arc::new("let x = 1".to_string()));
+        db.set_file_name(file, Arc::new("file.nx".to_string()));
+        db.lower_to_hir(file);
+
+        let source = db.source_text(file);
+        let cached = db
+            .syntax_trees
+            .get(file, &source)
+            .expect("lowering caches the tree");
+        assert!(Arc::ptr_eq(cached.shared_source(), &source));
+        assert!(db
+            .syntax_trees
+            .get(file, &Arc::new("let x = 1".to_string()))
+            .is_none());
+
+        let edit = TextEdit::new(TextSpan::new(TextSize::from(8), TextSize::from(9)), "2");
+        assert!(db.apply_source_edits(file, &[edit]));
+        let edited = db.source_text(file);
+        let cached = db
+            .syntax_trees
+            .get(file, &edited)
+            .expect("edits cache the new tree");
+        assert!(Arc::ptr_eq(cached.shared_source(), &edited));
+
+        db.remove_file(file);
+        assert!(db.syntax_trees.trees.lock().unwrap().is_empty());
+        assert!(db.lower_to_hir(file).items().is_empty());
+    }
 }
@@ -0,0 +1,110 @@
+//! Process-wide string table backing [`Name`](crate::Name).
+//!
+//! Every distinct identifier text that is alive somewhere in the process is stored once, so a name
+//! is a single pointer to its canonical text. Two names are equal exactly when they point at the
+//! same entry, which turns identifier comparisons in lowering, type checking, and the interpreter
+//! into pointer comparisons. Enum members carried by runtime values are names too; record field
+//! keys are not, since records look fields up through their layouts rather than by comparing keys.
+//!
+//! The table only holds entries that some [`Name`](crate::Name) still refers to. Each entry is
+//! reference counted, and entries whose names have all been dropped are swept out once the table
+//! has doubled since the last sweep. Memory therefore tracks the identifiers of the programs,
+//! artifacts, and host values a process is currently holding, rather than every identifier it
+//! has ever seen.
+
+use rustc_hash::FxHashSet;
+use std::sync::{Arc, OnceLock, RwLock};
+
+/// Table size below which no sweep is attempted.
+const MIN_SWEEP_THRESHOLD: usize = 1024;
+
+struct Table {
+    entries: FxHashSet<Arc<str>>,
+    /// Entry count at which the next insertion sweeps out unreferenced entries first.
+    sweep_threshold: usize,
+}
+
+impl Table {
+    /// Drops every entry only the table still refers to.
+    fn sweep(&mut self) {
+        // Entries are only cloned out of the table under its lock, and names are only cloned from
+        // live names, so an entry the table holds alone can never be revived here.
+        self.entries.retain(|entry| Arc::strong_count(entry) > 1);
+        self.sweep_threshold = (self.entries.len() * 2).max(MIN_SWEEP_THRESHOLD);
+    }
+}
+
+fn table() -> &'static RwLock<Table> {
+    static TABLE: OnceLock<RwLock<Table>> = OnceLock::new();
+    TABLE.get_or_init(|| {
+        RwLock::new(Table {
+            entries: FxHashSet::default(),
+            sweep_threshold: MIN_SWEEP_THRESHOLD,
+        })
+    })
+}
+
+/// Returns the canonical copy of `text`, adding it to the table on first use.
+pub(crate) fn intern(text: &str) -> Arc<str> {
+    // Entries are inserted and removed whole, so a poisoned table is still consistent.
+    if let Some(interned) = table()
+        .read()
+        .unwrap_or_else(|poisoned| poisoned.into_inner())
+        .entries
+        .get(text)
+    {
+        return Arc::clone(interned);
+    }
+
+    let mut table = table()
+        .write()
+        .unwrap_or_else(|poisoned| poisoned.into_inner());
+    if let Some(interned) = table.entries.get(text) {
+        return Arc::clone(interned);
+    }
+    if table.entries.len() >= table.sweep_threshold {
+        table.sweep();
+    }
+    let interned: Arc<str> = Arc::from(text);
+    table.entries.insert(Arc::clone(&interned));
+    interned
+}
+
+#[cfg(test)]
+fn contains(text: &str) -> bool {
+    table()
+        .read()
+        .unwrap_or_else(|poisoned| poisoned.into_inner())
+        .entries
+        .contains(text)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn intern_returns_one_canonical_copy_per_text() {
+        let owned = String::from("interner_test_identifier");
+        let first = intern("interner_test_identifier");
+        let second = intern(&owned);
+
+        assert!(Arc::ptr_eq(&first, &second));
+        assert!(!Arc::ptr_eq(&first, &intern("interner_test_other")));
+        assert_eq!(&*first, "interner_test_identifier");
+    }
+
+    #[test]
+    fn sweep_drops_entries_no_name_refers_to() {
+        let kept = intern("interner_test_kept");
+        drop(intern("interner_test_dropped"));
+
+        table()
+            .write()
+            .unwrap_or_else(|poisoned| poisoned.into_inner())
+            .sweep();
+
+        assert!(!contains("interner_test_dropped"));
+        assert!(Arc::ptr_eq(&kept, &intern("interner_test_kept")));
+    }
+}
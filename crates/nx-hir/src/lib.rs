@@ -20,9 +20,11 @@
 //! let module = lower(parse_result.root().unwrap(), parse_result.source_id);
 //! ```
 
+pub mod arena_serde;
 pub mod ast;
 pub mod components;
 pub mod db;
+mod interner;
 pub mod lower;
 pub mod prepared;
 pub mod records;
@@ -31,7 +33,8 @@ pub mod unions;
 
 use la_arena::{Arena, Idx};
 use nx_diagnostics::{Diagnostic, Label, Severity, TextSpan};
-use smol_str::SmolStr;
+use serde::{Deserialize, Deserializer, Serialize, Serializer};
+use std::sync::Arc;
 
 // Re-export lowering function
 pub use lower::lower;
@@ -118,20 +121,64 @@ pub fn lower_source_module(
 
 /// Interned string identifier for names.
 ///
-/// Uses `SmolStr` for efficient storage and cloning of small strings.
-/// Most identifiers in code are short, so this optimizes for the common case.
-#[derive(Debug, Clone, PartialEq, Eq, Hash)]
-pub struct Name(SmolStr);
+/// Each distinct identifier text is stored once per process while any name refers to it, so a
+/// name is one pointer: cloning bumps a reference count and equality and hashing go through the
+/// pointer instead of the text. The iteration order of name-keyed maps therefore depends on where
+/// names were allocated; anything that must be deterministic sorts by [`Name::as_str`] first.
+/// Names serialize as plain strings and are re-interned when deserialized.
+#[derive(Clone)]
+pub struct Name(Arc<str>);
 
 impl Name {
     /// Create a new name from a string slice.
     pub fn new(s: &str) -> Self {
-        Self(SmolStr::new(s))
+        Self(interner::intern(s))
+    }
+
+    /// Create a name for text supplied by the host rather than by program source.
+    ///
+    /// This interns like [`Name::new`]: table entries are released once their last name is
+    /// dropped, so untrusted input only occupies the table for as long as the host keeps the
+    /// values that carry it.
+    pub fn external(s: &str) -> Self {
+        Self::new(s)
     }
 
     /// Get the name as a string slice.
     pub fn as_str(&self) -> &str {
-        self.0.as_str()
+        &self.0
+    }
+}
+
+impl PartialEq for Name {
+    fn eq(&self, other: &Self) -> bool {
+        Arc::ptr_eq(&self.0, &other.0)
+    }
+}
+
+impl Eq for Name {}
+
+impl std::hash::Hash for Name {
+    fn hash<H: std::hash::Hasher>(&self, state: &mut H) {
+        std::ptr::hash(Arc::as_ptr(&self.0).cast::<u8>(), state);
+    }
+}
+
+impl std::fmt::Debug for Name {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_tuple("Name").field(&self.as_str()).finish()
+    }
+}
+
+impl Serialize for Name {
+    fn serialize<S: Serializer>(&self, serializer: S) -> Result<S::Ok, S::Error> {
+        serializer.serialize_str(self.as_str())
+    }
+}
+
+impl<'de> Deserialize<'de> for Name {
+    fn deserialize<D: Deserializer<'de>>(deserializer: D) -> Result<Self, D::Error> {
+        String::deserialize(deserializer).map(Self::from)
     }
 }
 
@@ -143,18 +190,18 @@ impl From<&str> for Name {
 
 impl From<String> for Name {
     fn from(s: String) -> Self {
-        Self(SmolStr::new(s))
+        Self::new(&s)
     }
 }
 
 impl std::fmt::Display for Name {
     fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
-        write!(f, "{}", self.0)
+        write!(f, "{}", self.as_str())
     }
 }
 
 /// Visibility for top-level declarations.
-#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub enum Visibility {
     /// Visible to the declaring file, peer library files, and consumers.
     Export,
@@ -174,7 +221,7 @@ impl Default for Visibility {
 ///
 /// This is used to track which source file AST nodes came from, enabling
 /// proper error reporting and cross-file analysis.
-#[derive(Debug, Copy, Clone, PartialEq, Eq, Hash)]
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub struct SourceId(u32);
 
 impl SourceId {
@@ -190,7 +237,7 @@ impl SourceId {
 }
 
 /// Function parameter with name and type annotation.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct Param {
     /// Parameter name
     pub name: Name,
@@ -220,7 +267,7 @@ impl Param {
 }
 
 /// Function declaration with parameters, return type, and body.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct Function {
     /// Function name
     pub name: Name,
@@ -231,6 +278,7 @@ pub struct Function {
     /// Return type annotation (None means inferred)
     pub return_type: Option<ast::TypeRef>,
     /// Function body expression
+    #[serde(with = "crate::arena_serde::idx")]
     pub body: ExprId,
     /// Source location
     pub span: TextSpan,
@@ -244,7 +292,7 @@ impl Function {
 }
 
 /// Top-level value declaration.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct ValueDef {
     /// Bound name
     pub name: Name,
@@ -253,13 +301,14 @@ pub struct ValueDef {
     /// Optional type annotation
     pub ty: Option<ast::TypeRef>,
     /// Initializer expression
+    #[serde(with = "crate::arena_serde::idx")]
     pub value: ExprId,
     /// Source location
     pub span: TextSpan,
 }
 
 /// Type alias definition.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct TypeAlias {
     /// Alias name
     pub name: Name,
@@ -272,7 +321,7 @@ pub struct TypeAlias {
 }
 
 /// Enum member.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct EnumMember {
     /// Member name
     pub name: Name,
@@ -281,7 +330,7 @@ pub struct EnumMember {
 }
 
 /// Enum definition.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct EnumDef {
     /// Enum name
     pub name: Name,
@@ -294,7 +343,7 @@ pub struct EnumDef {
 }
 
 /// Field declared on one discriminated union case.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct UnionCaseField {
     /// Field name
     pub name: Name,
@@ -303,6 +352,7 @@ pub struct UnionCaseField {
     /// Whether this field receives markup body content for element-style construction.
     pub is_content: bool,
     /// Default value expression, if present.
+    #[serde(with = "crate::arena_serde::option_idx")]
     pub default: Option<ExprId>,
     /// Source span
     pub span: TextSpan,
@@ -339,10 +389,12 @@ impl UnionCaseField {
 }
 
 /// One case in a discriminated union declaration.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct UnionCaseDef {
     /// Case name scoped to the owning union.
     pub name: Name,
+    /// `Union.Case`, the type name of values of this case, interned once at lowering.
+    pub qualified_name: Name,
     /// Case-specific payload fields.
     pub fields: Vec<UnionCaseField>,
     /// Source span
@@ -350,6 +402,11 @@ pub struct UnionCaseDef {
 }
 
 impl UnionCaseDef {
+    /// Builds the qualified `Union.Case` name for a case of `union_name`.
+    pub fn qualify(union_name: &Name, case_name: &Name) -> Name {
+        Name::new(&format!("{}.{}", union_name.as_str(), case_name.as_str()))
+    }
+
     /// Returns true when this case has no payload fields.
     pub fn is_fieldless(&self) -> bool {
         self.fields.is_empty()
@@ -357,7 +414,7 @@ impl UnionCaseDef {
 }
 
 /// Discriminated union definition.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct UnionDef {
     /// Union name
     pub name: Name,
@@ -372,7 +429,7 @@ pub struct UnionDef {
 }
 
 /// Record field definition.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct RecordField {
     /// Field name
     pub name: Name,
@@ -381,6 +438,7 @@ pub struct RecordField {
     /// Whether this field receives markup body content for element-style construction.
     pub is_content: bool,
     /// Default value expression (if present)
+    #[serde(with = "crate::arena_serde::option_idx")]
     pub default: Option<ExprId>,
     /// Source span
     pub span: TextSpan,
@@ -406,11 +464,12 @@ impl RecordField {
 }
 
 /// Reference to an expression together with the lowered module that owns it.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct QualifiedExprRef {
     /// Stable prepared-module identity of the expression owner.
     pub module_identity: String,
     /// Arena-local expression id within the owning module.
+    #[serde(with = "crate::arena_serde::idx")]
     pub expr_id: ExprId,
 }
 
@@ -425,7 +484,7 @@ impl QualifiedExprRef {
 }
 
 /// Effective inherited field metadata used after prepared-module resolution.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct EffectiveField {
     /// Field name
     pub name: Name,
@@ -480,7 +539,7 @@ impl EffectiveField {
 }
 
 /// Distinguishes ordinary records from action records.
-#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Serialize, Deserialize)]
 pub enum RecordKind {
     /// Standard `type Name = { ... }` record declaration.
     Plain,
@@ -489,7 +548,7 @@ pub enum RecordKind {
 }
 
 /// Record type definition.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct RecordDef {
     /// Record name
     pub name: Name,
@@ -525,7 +584,7 @@ impl RecordDef {
 }
 
 /// Distinguishes inline emitted actions from shared emitted action references.
-#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Serialize, Deserialize)]
 pub enum ComponentEmitKind {
     /// `ActionName { ... }` declared inline inside `emits`.
     Inline,
@@ -534,7 +593,7 @@ pub enum ComponentEmitKind {
 }
 
 /// Metadata for a component-emitted action.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct ComponentEmit {
     /// Local emitted action name used for `on<ActionName>` bindings.
     pub name: Name,
@@ -547,7 +606,7 @@ pub struct ComponentEmit {
 }
 
 /// Executable component declaration preserved in HIR.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct Component {
     /// Component name
     pub name: Name,
@@ -566,6 +625,7 @@ pub struct Component {
     /// Declared state fields, including optional default expressions
     pub state: Vec<RecordField>,
     /// Lowered component body expression when this is a concrete NX-bodied component.
+    #[serde(with = "crate::arena_serde::option_idx")]
     pub body: Option<ExprId>,
     /// Source span
     pub span: TextSpan,
@@ -579,20 +639,22 @@ impl Component {
 }
 
 /// Element property (key-value pair).
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct Property {
     /// Property key
     pub key: Name,
     /// Property value expression
+    #[serde(with = "crate::arena_serde::idx")]
     pub value: ExprId,
     /// Source location
     pub span: TextSpan,
 }
 
 /// One arm in a condition-list property fragment.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct PropertyConditionArm {
     /// Boolean condition that activates this arm.
+    #[serde(with = "crate::arena_serde::idx")]
     pub condition: ExprId,
     /// Property entries produced by this arm.
     pub entries: Vec<PropertyEntry>,
@@ -601,9 +663,10 @@ pub struct PropertyConditionArm {
 }
 
 /// One arm in a match-style property fragment.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct PropertyMatchArm {
     /// Patterns accepted by this arm.
+    #[serde(with = "crate::arena_serde::vec_idx")]
     pub patterns: Vec<ExprId>,
     /// Property entries produced by this arm.
     pub entries: Vec<PropertyEntry>,
@@ -612,13 +675,14 @@ pub struct PropertyMatchArm {
 }
 
 /// Ordered entry in an element property list.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub enum PropertyEntry {
     /// Direct key/value property.
     Value(Property),
     /// Simple conditional property fragment.
     If {
         /// Boolean condition that selects the then branch.
+        #[serde(with = "crate::arena_serde::idx")]
         condition: ExprId,
         /// Entries active when the condition is true.
         then_entries: Vec<PropertyEntry>,
@@ -639,6 +703,7 @@ pub enum PropertyEntry {
     /// Match-style property fragment.
     Match {
         /// Scrutinee matched against each arm.
+        #[serde(with = "crate::arena_serde::idx")]
         scrutinee: ExprId,
         /// Ordered match arms.
         arms: Vec<PropertyMatchArm>,
@@ -662,7 +727,7 @@ impl PropertyEntry {
 }
 
 /// NX element (XML-like syntax).
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct Element {
     /// Element tag name
     pub tag: Name,
@@ -674,6 +739,7 @@ pub struct Element {
     /// Ordered property-list entries, including conditional and match fragments.
     pub property_entries: Vec<PropertyEntry>,
     /// Nested body-content expressions in source order
+    #[serde(with = "crate::arena_serde::vec_idx")]
     pub content: Vec<ExprId>,
     /// Closing tag name (must match opening tag)
     pub close_name: Option<Name>,
@@ -689,7 +755,7 @@ impl Element {
 }
 
 /// Top-level item in a module.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub enum Item {
     /// Function declaration
     Function(Function),
@@ -736,7 +802,7 @@ impl Item {
 }
 
 /// Import kind.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub enum ImportKind {
     /// `import "<path>" [as Alias]`
     Wildcard {
@@ -751,7 +817,7 @@ pub enum ImportKind {
 }
 
 /// Individual selective import entry.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct SelectiveImport {
     /// Imported symbol name
     pub name: Name,
@@ -762,7 +828,7 @@ pub struct SelectiveImport {
 }
 
 /// Lowered import statement.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct Import {
     /// Library path from the import statement.
     pub library_path: String,
@@ -784,7 +850,7 @@ pub type ElementId = Idx<Element>;
 /// items (functions, type aliases, enums, records) along with the expression
 /// and element arenas. Top-level elements are represented as implicit 'root'
 /// functions rather than as separate items.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct LoweredModule {
     /// Source file identifier
     pub source_id: SourceId,
@@ -795,8 +861,10 @@ pub struct LoweredModule {
     /// Lowering-time diagnostics
     diagnostics: Vec<LoweringDiagnostic>,
     /// Arena for all expressions
+    #[serde(with = "crate::arena_serde::arena")]
     exprs: Arena<ast::Expr>,
     /// Arena for all elements
+    #[serde(with = "crate::arena_serde::arena")]
     elements: Arena<Element>,
 }
 
@@ -873,6 +941,11 @@ impl LoweredModule {
         &mut self.exprs[id]
     }
 
+    /// Iterate every lowered expression in allocation order.
+    pub fn exprs(&self) -> impl ExactSizeIterator<Item = (ExprId, &ast::Expr)> + '_ {
+        self.exprs.iter()
+    }
+
     /// Get the number of lowered expressions in the arena.
     pub fn expr_count(&self) -> usize {
         self.exprs.len()
@@ -895,7 +968,7 @@ impl LoweredModule {
 }
 
 /// Lowering diagnostic produced while converting syntax to HIR.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct LoweringDiagnostic {
     /// Human-readable message
     pub message: String,
@@ -921,6 +994,40 @@ mod tests {
         assert_eq!(name1, name2);
     }
 
+    #[test]
+    fn test_name_round_trips_through_msgpack_as_interned_string() {
+        let name = Name::new("SearchBox");
+        let bytes = rmp_serde::to_vec(&name).expect("name should encode");
+
+        assert_eq!(
+            rmp_serde::from_slice::<String>(&bytes).expect("name encodes as a string"),
+            "SearchBox"
+        );
+        let decoded = rmp_serde::from_slice::<Name>(&bytes).expect("name should decode");
+        assert_eq!(decoded, name);
+        assert!(std::ptr::eq(decoded.as_str(), name.as_str()));
+    }
+
+    #[test]
+    fn test_external_name_shares_declared_text() {
+        let declared = Name::new("ExternalDeclaredType");
+        let external = Name::external("ExternalDeclaredType");
+        assert_eq!(external, declared);
+        assert!(std::ptr::eq(external.as_str(), declared.as_str()));
+        assert_ne!(Name::external("ExternalUnknownType"), declared);
+    }
+
+    #[test]
+    fn test_name_hash_matches_equality() {
+        let hash = |name: &Name| {
+            let mut hasher = rustc_hash::FxHasher::default();
+            std::hash::Hash::hash(name, &mut hasher);
+            std::hash::Hasher::finish(&hasher)
+        };
+        let name = Name::new("HashedName");
+        assert_eq!(hash(&name), hash(&Name::from(String::from("HashedName"))));
+    }
+
     #[test]
     fn test_source_id() {
         let id1 = SourceId::new(42);
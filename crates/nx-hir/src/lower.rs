@@ -725,11 +725,12 @@ impl LoweringContext {
             }
         }
 
-        let component_names = self
+        let mut component_names = self
             .predeclared_components
             .keys()
             .cloned()
             .collect::<Vec<_>>();
+        component_names.sort_unstable_by(|lhs, rhs| lhs.as_str().cmp(rhs.as_str()));
         let mut stack = Vec::new();
         for name in component_names {
             self.finalize_predeclared_component(&name, &mut stack);
@@ -1509,7 +1510,7 @@ impl LoweringContext {
                 cases
                     .children()
                     .filter(|child| child.kind() == SyntaxKind::UNION_CASE)
-                    .map(|case| self.lower_union_case(case))
+                    .map(|case| self.lower_union_case(&name, case))
                     .collect()
             })
             .unwrap_or_default();
@@ -1525,7 +1526,7 @@ impl LoweringContext {
         }
     }
 
-    fn lower_union_case(&mut self, node: SyntaxNode) -> UnionCaseDef {
+    fn lower_union_case(&mut self, union_name: &Name, node: SyntaxNode) -> UnionCaseDef {
         let name = node
             .child_by_field("name")
             .map(|name| Name::new(name.text()))
@@ -1537,6 +1538,7 @@ impl LoweringContext {
             .collect();
 
         UnionCaseDef {
+            qualified_name: UnionCaseDef::qualify(union_name, &name),
             name,
             fields,
             span: node.span(),
@@ -65,7 +65,7 @@ impl PreparedItemKind {
 }
 
 /// Imported function parameter metadata published through a library interface.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct InterfaceParam {
     pub name: Name,
     pub ty: ast::TypeRef,
@@ -74,7 +74,7 @@ pub struct InterfaceParam {
 }
 
 /// Imported field metadata published through a library interface.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct InterfaceField {
     pub name: Name,
     pub ty: ast::TypeRef,
@@ -84,7 +84,7 @@ pub struct InterfaceField {
 }
 
 /// Imported discriminated union case metadata published through a library interface.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct InterfaceUnionCase {
     pub name: Name,
     pub fields: Vec<InterfaceField>,
@@ -92,14 +92,14 @@ pub struct InterfaceUnionCase {
 }
 
 /// Optional back-reference from imported interface metadata to a raw lowered item.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct ImportedRawRef {
     pub module_identity: String,
     pub definition_id: LocalDefinitionId,
 }
 
 /// Interface-only representation of one published declaration.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub enum InterfaceItemKind {
     Function {
         params: Vec<InterfaceParam>,
@@ -157,7 +157,7 @@ impl InterfaceItemKind {
 }
 
 /// Published interface metadata for one stable top-level definition.
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct InterfaceItem {
     pub module_identity: String,
     pub item_name: String,
@@ -298,7 +298,7 @@ impl PreparedBindings {
 #[derive(Debug, Clone)]
 pub struct PreparedModule {
     module_identity: String,
-    raw_module: LoweredModule,
+    raw_module: Arc<LoweredModule>,
     bindings: PreparedBindings,
     peer_modules: FxHashMap<String, Arc<LoweredModule>>,
     diagnostics: Vec<LoweringDiagnostic>,
@@ -307,6 +307,13 @@ pub struct PreparedModule {
 impl PreparedModule {
     /// Creates a prepared module with local bindings for the raw file-local definitions.
     pub fn new(module_identity: impl Into<String>, raw_module: LoweredModule) -> Self {
+        Self::shared(module_identity, Arc::new(raw_module))
+    }
+
+    /// Creates a prepared module over a raw lowered module that other owners keep sharing.
+    ///
+    /// The module is only copied if [`Self::raw_module_mut`] is later called while it is shared.
+    pub fn shared(module_identity: impl Into<String>, raw_module: Arc<LoweredModule>) -> Self {
         let module_identity = module_identity.into();
         let mut prepared = Self {
             module_identity,
@@ -336,12 +343,12 @@ impl PreparedModule {
 
     /// Returns mutable access to the preserved raw lowered module.
     pub fn raw_module_mut(&mut self) -> &mut LoweredModule {
-        &mut self.raw_module
+        Arc::make_mut(&mut self.raw_module)
     }
 
     /// Consumes the prepared module and returns the preserved raw lowered module.
     pub fn into_raw_module(self) -> LoweredModule {
-        self.raw_module
+        Arc::unwrap_or_clone(self.raw_module)
     }
 
     /// Returns the preserved source id.
@@ -389,9 +396,13 @@ impl PreparedModule {
         self.bindings.map(namespace).get(name)
     }
 
-    /// Returns every visible binding in one namespace.
+    /// Returns every visible binding in one namespace, ordered by visible name.
     pub fn bindings(&self, namespace: PreparedNamespace) -> impl Iterator<Item = &PreparedBinding> {
-        self.bindings.map(namespace).values()
+        // Names hash by address, so map order is not stable from one process to the next.
+        let mut bindings = self.bindings.map(namespace).values().collect::<Vec<_>>();
+        bindings
+            .sort_unstable_by(|lhs, rhs| lhs.visible_name.as_str().cmp(rhs.visible_name.as_str()));
+        bindings.into_iter()
     }
 
     /// Resolves the stable target reached by one prepared binding.
@@ -596,30 +607,34 @@ pub fn interface_enum(item: &InterfaceItem) -> Option<crate::EnumDef> {
 /// Converts imported interface metadata into union-like view when possible.
 pub fn interface_union(item: &InterfaceItem) -> Option<UnionDef> {
     match &item.item {
-        InterfaceItemKind::Union { base, cases, span } => Some(UnionDef {
-            name: Name::new(item.item_name.as_str()),
-            visibility: item.visibility,
-            base: base.clone(),
-            cases: cases
-                .iter()
-                .map(|case| UnionCaseDef {
-                    name: case.name.clone(),
-                    fields: case
-                        .fields
-                        .iter()
-                        .map(|field| UnionCaseField {
-                            name: field.name.clone(),
-                            ty: field.ty.clone(),
-                            is_content: field.is_content,
-                            default: None,
-                            span: field.span,
-                        })
-                        .collect(),
-                    span: case.span,
-                })
-                .collect(),
-            span: *span,
-        }),
+        InterfaceItemKind::Union { base, cases, span } => {
+            let name = Name::new(item.item_name.as_str());
+            Some(UnionDef {
+                name: name.clone(),
+                visibility: item.visibility,
+                base: base.clone(),
+                cases: cases
+                    .iter()
+                    .map(|case| UnionCaseDef {
+                        qualified_name: UnionCaseDef::qualify(&name, &case.name),
+                        name: case.name.clone(),
+                        fields: case
+                            .fields
+                            .iter()
+                            .map(|field| UnionCaseField {
+                                name: field.name.clone(),
+                                ty: field.ty.clone(),
+                                is_content: field.is_content,
+                                default: None,
+                                span: field.span,
+                            })
+                            .collect(),
+                        span: case.span,
+                    })
+                    .collect(),
+                span: *span,
+            })
+        }
         _ => None,
     }
 }
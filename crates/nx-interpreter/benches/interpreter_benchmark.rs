@@ -0,0 +1,108 @@
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use nx_hir::{lower, LoweredModule, SourceId};
+use nx_interpreter::{Interpreter, ResourceLimits, Value};
+use nx_syntax::parse_str;
+
+/// Expression workloads modeled on `examples/nx/expressions.nx`, `loops.nx`, and
+/// `conditionals.nx`, sized so one iteration exercises the evaluator rather than call setup.
+const EXPRESSIONS_SOURCE: &str = r#"
+    let fib(n:int): int = { if n <= 1 { n } else { fib(n - 1) + fib(n - 2) } }
+
+    let score(a:int, b:int): int = { if a > b { a * 2 + b } else { b * 3 - a } }
+
+    let <scores items:object /> = {
+        for item, index in items { score(item, index) }
+    }
+
+    let <rows items:object /> = {
+        for item, index in items {
+            <row index={index} value={item * 2} wide={item > 10 && index > 2}>
+                {if item > 10 { "big" } else { "small" }}
+            </row>
+        }
+    }
+"#;
+
+fn lower_module(source: &str) -> LoweredModule {
+    let parse_result = parse_str(source, "benchmark.nx");
+    assert!(
+        parse_result.errors.is_empty(),
+        "Benchmark source should parse, got {:?}",
+        parse_result.errors
+    );
+    lower(
+        parse_result
+            .root()
+            .expect("Benchmark source should have a root"),
+        SourceId::new(0),
+    )
+}
+
+fn int_array(len: usize) -> Value {
+    Value::Array(
+        (0..len as i64)
+            .map(|value| Value::Int(value % 20))
+            .collect::<Vec<_>>()
+            .into(),
+    )
+}
+
+fn unbounded_limits() -> ResourceLimits {
+    ResourceLimits {
+        max_operations: usize::MAX,
+        max_recursion_depth: 10_000,
+        ..ResourceLimits::default()
+    }
+}
+
+fn recursion_benchmark(c: &mut Criterion) {
+    let module = lower_module(EXPRESSIONS_SOURCE);
+    let interpreter = Interpreter::new();
+    let mut group = c.benchmark_group("interpreter_recursion");
+
+    for n in [10, 15, 20].iter() {
+        group.bench_with_input(BenchmarkId::new("fib", n), n, |b, n| {
+            b.iter(|| {
+                let result = interpreter.execute_function_with_limits(
+                    &module,
+                    "fib",
+                    vec![Value::Int(black_box(*n))],
+                    unbounded_limits(),
+                );
+                black_box(result)
+            });
+        });
+    }
+
+    group.finish();
+}
+
+fn loop_benchmark(c: &mut Criterion) {
+    let module = lower_module(EXPRESSIONS_SOURCE);
+    let interpreter = Interpreter::new();
+
+    for function_name in ["scores", "rows"] {
+        let mut group = c.benchmark_group(format!("interpreter_loop_{function_name}"));
+
+        for len in [10, 100, 1000].iter() {
+            let items = int_array(*len);
+            group.throughput(Throughput::Elements(*len as u64));
+            group.bench_with_input(BenchmarkId::new("items", len), &items, |b, items| {
+                b.iter(|| {
+                    let result = interpreter.execute_function_with_limits(
+                        &module,
+                        function_name,
+                        vec![black_box(items.clone())],
+                        unbounded_limits(),
+                    );
+                    black_box(result)
+                });
+            });
+        }
+
+        group.finish();
+    }
+}
+
+criterion_group!(benches, recursion_benchmark, loop_benchmark);
+criterion_main!(benches);
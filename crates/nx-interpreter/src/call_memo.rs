@@ -0,0 +1,49 @@
+//! Host-provided memoization of function calls made during evaluation.
+
+use crate::context::CallUsage;
+use crate::resolved_program::RuntimeModuleId;
+use crate::value::Value;
+
+/// Function a memoized call invokes.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct CallTarget<'a> {
+    /// Runtime module that defines the function
+    pub module: RuntimeModuleId,
+    /// Declared name of the function
+    pub function: &'a str,
+}
+
+/// Result of a memoized call together with the work it did.
+#[derive(Debug, Clone, PartialEq)]
+pub struct MemoizedCall {
+    /// Value the call returned
+    pub value: Value,
+    /// Work the call counted against the limits of the evaluation that ran it
+    pub usage: CallUsage,
+}
+
+/// Memo of function results an [`Interpreter`](crate::Interpreter) consults while evaluating.
+///
+/// Install one for a group of evaluations with
+/// [`Interpreter::with_call_memo`](crate::Interpreter::with_call_memo). The memo decides which
+/// functions it memoizes and how their arguments are keyed; returning `None` from
+/// [`key`](Self::key) evaluates the call normally. Only calls in interpreters bound to a resolved
+/// program are memoized, and the memo must not share results between different programs. A hit
+/// is charged against the running evaluation's limits with the [`CallUsage`] recorded when the
+/// call ran, so memoization never lets an evaluation do more work than its limits allow.
+pub trait CallMemo: Send + Sync {
+    /// Returns the key for calling `target` with `args`, or `None` when the call is not memoized.
+    fn key(&self, target: CallTarget<'_>, args: &[Value]) -> Option<Vec<u8>>;
+
+    /// Returns the memoized result for `key`, if any.
+    fn get(&self, target: CallTarget<'_>, key: &[u8]) -> Option<MemoizedCall>;
+
+    /// Offers the result of a call that just succeeded for memoization under `key`.
+    fn insert(&self, target: CallTarget<'_>, key: &[u8], call: &MemoizedCall);
+}
+
+impl std::fmt::Debug for dyn CallMemo {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.write_str("CallMemo")
+    }
+}
@@ -0,0 +1,199 @@
+//! Closure compilation of operator expressions.
+//!
+//! Much of the evaluation time in NX code goes to small expression trees built from literals,
+//! variables, binary and unary operators, `if`, and blocks without statements, such as guards,
+//! arithmetic on properties, and conditional labels. [`compile_module`] turns every outermost tree
+//! made only of those forms into nested closures once per program. The interpreter then runs the
+//! closures instead of matching each HIR node and fetching its operands from the module arena
+//! again on every evaluation.
+//!
+//! A compiled tree behaves exactly like the tree-walking evaluator it replaces. Every node charges
+//! one operation against the limits before it runs, and operators and conditions go through the
+//! same `eval` functions, so results, errors, short-circuiting, and resource accounting do not
+//! change. Expressions of any other form, and trees that contain one, are left to the tree-walking
+//! evaluator, which still runs the compiled trees nested inside them.
+
+use crate::context::ExecutionContext;
+use crate::error::RuntimeError;
+use crate::eval;
+use crate::value::Value;
+use nx_hir::{ast, ExprId, LoweredModule};
+use rustc_hash::{FxHashMap, FxHashSet};
+
+type CompiledFn = dyn Fn(&mut ExecutionContext) -> Result<Value, RuntimeError> + Send + Sync;
+
+/// One expression tree compiled to a closure over the execution context.
+pub(crate) struct CompiledExpr(Box<CompiledFn>);
+
+impl CompiledExpr {
+    /// Evaluates the compiled expression in `ctx`.
+    pub(crate) fn evaluate(&self, ctx: &mut ExecutionContext) -> Result<Value, RuntimeError> {
+        (self.0)(ctx)
+    }
+}
+
+impl std::fmt::Debug for CompiledExpr {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.write_str("CompiledExpr")
+    }
+}
+
+/// Returns whether `expr` has a form the interpreter may find compiled.
+pub(crate) fn is_compiled_form(expr: &ast::Expr) -> bool {
+    match expr {
+        ast::Expr::BinaryOp { .. } | ast::Expr::UnaryOp { .. } | ast::Expr::If { .. } => true,
+        ast::Expr::Block { stmts, .. } => stmts.is_empty(),
+        _ => false,
+    }
+}
+
+/// Compiles every operator tree in `module` that is not nested inside another one.
+pub(crate) fn compile_module(module: &LoweredModule) -> FxHashMap<ExprId, CompiledExpr> {
+    let mut memo = FxHashMap::default();
+    let compilable = module
+        .exprs()
+        .filter(|(_, expr)| is_compiled_form(expr))
+        .map(|(expr_id, _)| expr_id)
+        .filter(|expr_id| is_compilable(module, *expr_id, &mut memo))
+        .collect::<Vec<_>>();
+
+    // Only compiled forms have operands, so every operand of a compilable tree other than a leaf
+    // is itself in `compilable`, and its nested operands are reached through it.
+    let nested = compilable
+        .iter()
+        .flat_map(|expr_id| operands(module.expr(*expr_id)))
+        .collect::<FxHashSet<_>>();
+
+    compilable
+        .into_iter()
+        .filter(|expr_id| !nested.contains(expr_id))
+        .map(|expr_id| (expr_id, CompiledExpr(compile(module, expr_id))))
+        .collect()
+}
+
+fn is_compilable(
+    module: &LoweredModule,
+    expr_id: ExprId,
+    memo: &mut FxHashMap<ExprId, bool>,
+) -> bool {
+    if let Some(is_compilable) = memo.get(&expr_id) {
+        return *is_compilable;
+    }
+
+    let expr = module.expr(expr_id);
+    let is_compilable = match expr {
+        ast::Expr::Literal(_) | ast::Expr::Ident(_) => true,
+        _ if is_compiled_form(expr) => operands(expr)
+            .into_iter()
+            .all(|operand| is_compilable(module, operand, memo)),
+        _ => false,
+    };
+    memo.insert(expr_id, is_compilable);
+    is_compilable
+}
+
+/// Returns the operand expressions of a compiled form, in evaluation order.
+fn operands(expr: &ast::Expr) -> Vec<ExprId> {
+    match expr {
+        ast::Expr::BinaryOp { lhs, rhs, .. } => vec![*lhs, *rhs],
+        ast::Expr::UnaryOp { expr, .. } => vec![*expr],
+        ast::Expr::If {
+            condition,
+            then_branch,
+            else_branch,
+            ..
+        } => [Some(*condition), Some(*then_branch), *else_branch]
+            .into_iter()
+            .flatten()
+            .collect(),
+        ast::Expr::Block { expr, .. } => expr.iter().copied().collect(),
+        _ => Vec::new(),
+    }
+}
+
+fn compile(module: &LoweredModule, expr_id: ExprId) -> Box<CompiledFn> {
+    match module.expr(expr_id) {
+        ast::Expr::Literal(literal) => {
+            let value = eval::literal_value(literal);
+            Box::new(move |ctx: &mut ExecutionContext| {
+                ctx.check_operation_limit()?;
+                Ok(value.clone())
+            })
+        }
+        ast::Expr::Ident(name) => {
+            let name = name.clone();
+            Box::new(move |ctx: &mut ExecutionContext| {
+                ctx.check_operation_limit()?;
+                ctx.lookup_variable(name.as_str())
+            })
+        }
+        ast::Expr::BinaryOp { lhs, op, rhs, .. } => {
+            let op = *op;
+            let lhs = compile(module, *lhs);
+            let rhs = compile(module, *rhs);
+            match op {
+                ast::BinOp::And | ast::BinOp::Or => Box::new(move |ctx: &mut ExecutionContext| {
+                    ctx.check_operation_limit()?;
+                    let lhs_bool = eval::logical::eval_short_circuit_operand(op, lhs(ctx)?)?;
+                    if lhs_bool == (op == ast::BinOp::Or) {
+                        return Ok(Value::Boolean(lhs_bool));
+                    }
+                    eval::logical::eval_short_circuit_operand(op, rhs(ctx)?).map(Value::Boolean)
+                }),
+                _ => Box::new(move |ctx: &mut ExecutionContext| {
+                    ctx.check_operation_limit()?;
+                    let lhs_val = lhs(ctx)?;
+                    let rhs_val = rhs(ctx)?;
+                    eval::eval_binary_op(lhs_val, op, rhs_val)
+                }),
+            }
+        }
+        ast::Expr::UnaryOp { op, expr, .. } => {
+            let operand = compile(module, *expr);
+            match *op {
+                ast::UnOp::Not => Box::new(move |ctx: &mut ExecutionContext| {
+                    ctx.check_operation_limit()?;
+                    eval::logical::eval_logical_unary(ast::UnOp::Not, operand(ctx)?)
+                }),
+                ast::UnOp::Neg => Box::new(move |ctx: &mut ExecutionContext| {
+                    ctx.check_operation_limit()?;
+                    eval::arithmetic::eval_negation(operand(ctx)?)
+                }),
+            }
+        }
+        ast::Expr::If {
+            condition,
+            then_branch,
+            else_branch,
+            ..
+        } => {
+            let condition = compile(module, *condition);
+            let then_branch = compile(module, *then_branch);
+            let else_branch = else_branch.map(|else_expr| compile(module, else_expr));
+            Box::new(move |ctx: &mut ExecutionContext| {
+                ctx.check_operation_limit()?;
+                if eval::control::eval_condition(condition(ctx)?)? {
+                    then_branch(ctx)
+                } else if let Some(else_branch) = &else_branch {
+                    else_branch(ctx)
+                } else {
+                    Ok(Value::Null)
+                }
+            })
+        }
+        ast::Expr::Block { expr, .. } => {
+            let final_expr = expr.map(|expr_id| compile(module, expr_id));
+            Box::new(move |ctx: &mut ExecutionContext| {
+                ctx.check_operation_limit()?;
+                ctx.push_scope();
+                let result = match &final_expr {
+                    Some(final_expr) => final_expr(ctx)?,
+                    None => Value::Null,
+                };
+                ctx.pop_scope();
+                Ok(result)
+            })
+        }
+        _ => unreachable!("only compilable expressions are compiled"),
+    }
+}
@@ -4,6 +4,28 @@ use crate::error::{CallFrame, RuntimeError, RuntimeErrorKind};
 use crate::value::Value;
 use rustc_hash::FxHashMap;
 use smol_str::SmolStr;
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::Arc;
+use std::time::{Duration, Instant};
+
+/// Number of operations between checks of the wall-clock deadline and the cancellation token.
+///
+/// Reading the clock on every operation would dominate cheap expressions, so both are polled
+/// together at this interval. An interrupted evaluation therefore stops within this many
+/// operations of the deadline passing or the token being cancelled.
+pub const INTERRUPT_CHECK_INTERVAL: usize = 1024;
+
+/// Work one call did, measured by [`ExecutionContext::measure_call_usage`].
+///
+/// Memoized calls keep their usage so a later hit can be charged with
+/// [`ExecutionContext::charge_call_usage`] as if the call had run again.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct CallUsage {
+    /// Operations the call counted against [`ResourceLimits::max_operations`]
+    pub operations: usize,
+    /// Deepest call stack the call reached, relative to the stack it started on
+    pub call_depth: usize,
+}
 
 /// Resource limits for execution
 ///
@@ -14,17 +36,22 @@ use smol_str::SmolStr;
 /// # Default Values
 /// - `max_operations`: 1,000,000 (prevents infinite loops)
 /// - `max_recursion_depth`: 1,000 (prevents stack overflow)
+/// - `max_duration`: none
+/// - `cancellation`: none
 ///
 /// # Examples
 /// ```
-/// use nx_interpreter::ResourceLimits;
+/// use nx_interpreter::{CancellationToken, ResourceLimits};
+/// use std::time::Duration;
 ///
 /// let strict_limits = ResourceLimits {
 ///     max_operations: 10_000,
 ///     max_recursion_depth: 100,
+///     max_duration: Some(Duration::from_millis(50)),
+///     cancellation: Some(CancellationToken::new()),
 /// };
 /// ```
-#[derive(Debug, Clone, Copy)]
+#[derive(Debug, Clone)]
 pub struct ResourceLimits {
     /// Maximum number of operations allowed per execution
     ///
@@ -35,6 +62,15 @@ pub struct ResourceLimits {
     ///
     /// Each function call increments depth. Prevents stack overflow.
     pub max_recursion_depth: usize,
+
+    /// Maximum wall-clock time allowed per execution
+    ///
+    /// The deadline starts when the execution context is created or reset. Bounds tail latency
+    /// for expensive operations that stay under the operation limit.
+    pub max_duration: Option<Duration>,
+
+    /// Token the host can cancel from another thread to stop the execution
+    pub cancellation: Option<CancellationToken>,
 }
 
 impl Default for ResourceLimits {
@@ -42,11 +78,41 @@ impl Default for ResourceLimits {
         Self {
             max_operations: 1_000_000,
             max_recursion_depth: 1000,
+            max_duration: None,
+            cancellation: None,
         }
     }
 }
 
-/// Variable scope for local variables
+/// Shared flag a host sets to stop the evaluations it was passed to.
+///
+/// Clones share the same flag, so the host keeps one clone and hands another to an evaluation
+/// through [`ResourceLimits::cancellation`]. Cancellation is cooperative: a running evaluation
+/// observes it within [`INTERRUPT_CHECK_INTERVAL`] operations and fails with
+/// [`RuntimeErrorKind::Cancelled`]. A cancelled token stays cancelled.
+#[derive(Debug, Clone, Default)]
+pub struct CancellationToken(Arc<AtomicBool>);
+
+impl CancellationToken {
+    /// Create a token that has not been cancelled
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Cancel every evaluation using this token or one of its clones
+    pub fn cancel(&self) {
+        self.0.store(true, Ordering::Relaxed);
+    }
+
+    /// Returns whether [`cancel`](Self::cancel) has been called on this token or a clone
+    pub fn is_cancelled(&self) -> bool {
+        self.0.load(Ordering::Relaxed)
+    }
+}
+
+/// Variable scope for module-level bindings
+///
+/// Top-level values can be numerous, so the root scope stays hash-indexed.
 #[derive(Debug, Clone)]
 struct Scope {
     variables: FxHashMap<SmolStr, Value>,
@@ -77,6 +143,13 @@ impl Scope {
     }
 }
 
+/// One local binding stored in the flat frame array
+#[derive(Debug, Clone)]
+struct LocalBinding {
+    name: SmolStr,
+    value: Value,
+}
+
 /// Execution context maintaining runtime state
 ///
 /// Manages the runtime state during expression evaluation, including:
@@ -85,18 +158,31 @@ impl Scope {
 /// - Operation counting (for infinite loop protection)
 /// - Resource limits enforcement
 ///
+/// Nested scopes share one flat binding array; each scope is a start offset into it. Local
+/// scopes hold only a handful of bindings, so a reverse scan over contiguous memory beats one
+/// hash lookup per scope, and pushing or popping a scope never allocates once the array has
+/// grown.
+///
 /// The context is passed through all evaluation functions and tracks
 /// state changes during execution.
 #[derive(Debug)]
 pub struct ExecutionContext {
-    /// Stack of scopes (innermost scope is last)
-    scopes: Vec<Scope>,
+    /// Root scope for module-level bindings
+    globals: Scope,
+    /// Local bindings for every nested scope, innermost last
+    locals: Vec<LocalBinding>,
+    /// Start offset in `locals` for each nested scope (innermost scope is last)
+    scope_starts: Vec<usize>,
     /// Call stack for function calls
     call_stack: Vec<CallFrame>,
     /// Operation counter
     operation_count: usize,
+    /// Deepest call stack reached so far
+    peak_call_depth: usize,
     /// Resource limits
     limits: ResourceLimits,
+    /// Instant after which execution fails, derived from `limits.max_duration`
+    deadline: Option<Instant>,
 }
 
 impl ExecutionContext {
@@ -108,29 +194,58 @@ impl ExecutionContext {
     /// Create a new execution context with custom limits
     pub fn with_limits(limits: ResourceLimits) -> Self {
         Self {
-            scopes: vec![Scope::new()],
+            globals: Scope::new(),
+            locals: Vec::new(),
+            scope_starts: Vec::new(),
             call_stack: Vec::new(),
             operation_count: 0,
+            peak_call_depth: 0,
+            deadline: deadline_for(&limits),
             limits,
         }
     }
 
+    /// Clear all runtime state and apply new limits, keeping allocated capacity for reuse.
+    ///
+    /// A reset context behaves like one freshly created with [`with_limits`](Self::with_limits),
+    /// but later evaluations can reuse its binding and call-stack storage.
+    pub fn reset(&mut self, limits: ResourceLimits) {
+        self.globals.variables.clear();
+        self.locals.clear();
+        self.scope_starts.clear();
+        self.call_stack.clear();
+        self.operation_count = 0;
+        self.peak_call_depth = 0;
+        self.deadline = deadline_for(&limits);
+        self.limits = limits;
+    }
+
     /// Push a new scope onto the scope stack
     pub fn push_scope(&mut self) {
-        self.scopes.push(Scope::new());
+        self.scope_starts.push(self.locals.len());
     }
 
     /// Pop the current scope from the scope stack
     pub fn pop_scope(&mut self) {
-        if self.scopes.len() > 1 {
-            self.scopes.pop();
+        if let Some(start) = self.scope_starts.pop() {
+            self.locals.truncate(start);
         }
     }
 
     /// Define a variable in the current scope
     pub fn define_variable(&mut self, name: SmolStr, value: Value) {
-        if let Some(scope) = self.scopes.last_mut() {
-            scope.define(name, value);
+        let Some(&start) = self.scope_starts.last() else {
+            self.globals.define(name, value);
+            return;
+        };
+
+        if let Some(binding) = self.locals[start..]
+            .iter_mut()
+            .find(|binding| binding.name == name)
+        {
+            binding.value = value;
+        } else {
+            self.locals.push(LocalBinding { name, value });
         }
     }
 
@@ -147,48 +262,64 @@ impl ExecutionContext {
 
     /// Try to get a variable without raising an error.
     pub fn try_lookup_variable(&self, name: &str) -> Option<Value> {
-        for scope in self.scopes.iter().rev() {
-            if let Some(value) = scope.lookup(name) {
-                return Some(value.clone());
-            }
-        }
-        None
+        self.lookup_variable_ref(name).cloned()
+    }
+
+    /// Borrow a variable without cloning it.
+    pub fn lookup_variable_ref(&self, name: &str) -> Option<&Value> {
+        self.locals
+            .iter()
+            .rev()
+            .find(|binding| binding.name == name)
+            .map(|binding| &binding.value)
+            .or_else(|| self.globals.lookup(name))
     }
 
     /// Snapshot all currently visible variables with lexical shadowing preserved.
     pub fn snapshot_visible_variables(&self) -> FxHashMap<SmolStr, Value> {
-        let mut variables = FxHashMap::default();
-        for scope in &self.scopes {
-            for (name, value) in &scope.variables {
-                variables.insert(name.clone(), value.clone());
-            }
+        let mut variables = self.globals.variables.clone();
+        for binding in &self.locals {
+            variables.insert(binding.name.clone(), binding.value.clone());
         }
         variables
     }
 
-    /// Fork one isolated execution context that keeps limits and accounting but starts with
-    /// a fresh variable scope.
+    /// Fork one isolated execution context that keeps limits, deadline, and accounting but starts
+    /// with a fresh variable scope.
     pub fn fork_isolated(&self) -> Self {
         Self {
-            scopes: vec![Scope::new()],
+            globals: Scope::new(),
+            locals: Vec::new(),
+            scope_starts: Vec::new(),
             call_stack: self.call_stack.clone(),
             operation_count: self.operation_count,
-            limits: self.limits,
+            peak_call_depth: self.peak_call_depth,
+            limits: self.limits.clone(),
+            deadline: self.deadline,
         }
     }
 
     /// Synchronize operation accounting from another context that branched from this one.
     pub fn sync_usage_from(&mut self, other: &Self) {
         self.operation_count = other.operation_count;
+        self.peak_call_depth = self.peak_call_depth.max(other.peak_call_depth);
     }
 
     /// Update a variable in the scope stack
     pub fn update_variable(&mut self, name: &str, value: Value) -> Result<(), RuntimeError> {
         // Search from innermost to outermost scope
-        for scope in self.scopes.iter_mut().rev() {
-            if scope.update(name, value.clone()) {
-                return Ok(());
-            }
+        if let Some(binding) = self
+            .locals
+            .iter_mut()
+            .rev()
+            .find(|binding| binding.name == name)
+        {
+            binding.value = value;
+            return Ok(());
+        }
+
+        if self.globals.update(name, value) {
+            return Ok(());
         }
 
         Err(RuntimeError::new(RuntimeErrorKind::UndefinedVariable {
@@ -205,6 +336,7 @@ impl ExecutionContext {
             .with_call_stack(self.call_stack.clone()));
         }
         self.call_stack.push(frame);
+        self.peak_call_depth = self.peak_call_depth.max(self.call_stack.len());
         Ok(())
     }
 
@@ -219,6 +351,9 @@ impl ExecutionContext {
     }
 
     /// Increment the operation counter and check limits
+    ///
+    /// Every [`INTERRUPT_CHECK_INTERVAL`] operations this also checks the deadline and the
+    /// cancellation token.
     pub fn check_operation_limit(&mut self) -> Result<(), RuntimeError> {
         self.operation_count += 1;
         if self.operation_count > self.limits.max_operations {
@@ -227,6 +362,75 @@ impl ExecutionContext {
             })
             .with_call_stack(self.call_stack.clone()));
         }
+        if self.operation_count % INTERRUPT_CHECK_INTERVAL == 0 {
+            self.check_interrupts()?;
+        }
+        Ok(())
+    }
+
+    /// Fail if the host cancelled this execution or its deadline has passed
+    #[cold]
+    pub fn check_interrupts(&self) -> Result<(), RuntimeError> {
+        let kind = if self
+            .limits
+            .cancellation
+            .as_ref()
+            .is_some_and(CancellationToken::is_cancelled)
+        {
+            RuntimeErrorKind::Cancelled
+        } else if let (Some(deadline), Some(limit)) = (self.deadline, self.limits.max_duration) {
+            if Instant::now() < deadline {
+                return Ok(());
+            }
+            RuntimeErrorKind::DeadlineExceeded { limit }
+        } else {
+            return Ok(());
+        };
+        Err(RuntimeError::new(kind).with_call_stack(self.call_stack.clone()))
+    }
+
+    /// Runs `f` on this context and returns its result together with the work it did.
+    pub fn measure_call_usage<T>(&mut self, f: impl FnOnce(&mut Self) -> T) -> (T, CallUsage) {
+        let start_operations = self.operation_count;
+        let start_depth = self.call_stack.len();
+        let outer_peak = std::mem::replace(&mut self.peak_call_depth, start_depth);
+        let result = f(self);
+        let usage = CallUsage {
+            operations: self.operation_count - start_operations,
+            call_depth: self.peak_call_depth - start_depth,
+        };
+        self.peak_call_depth = self.peak_call_depth.max(outer_peak);
+        (result, usage)
+    }
+
+    /// Counts `usage` against the limits as if the measured call had run again here.
+    ///
+    /// Fails like the call itself would have when the current stack plus its depth exceeds the
+    /// recursion limit or its operations exceed the operation limit. The deadline and the
+    /// cancellation token are checked when the charge crosses an interrupt check interval.
+    pub fn charge_call_usage(&mut self, usage: CallUsage) -> Result<(), RuntimeError> {
+        let depth = self.call_stack.len() + usage.call_depth;
+        if depth > self.limits.max_recursion_depth {
+            return Err(RuntimeError::new(RuntimeErrorKind::StackOverflow {
+                depth: self.limits.max_recursion_depth,
+            })
+            .with_call_stack(self.call_stack.clone()));
+        }
+        self.peak_call_depth = self.peak_call_depth.max(depth);
+
+        let start_operations = self.operation_count;
+        self.operation_count = self.operation_count.saturating_add(usage.operations);
+        if self.operation_count > self.limits.max_operations {
+            return Err(RuntimeError::new(RuntimeErrorKind::OperationLimitExceeded {
+                limit: self.limits.max_operations,
+            })
+            .with_call_stack(self.call_stack.clone()));
+        }
+        if self.operation_count / INTERRUPT_CHECK_INTERVAL
+            != start_operations / INTERRUPT_CHECK_INTERVAL
+        {
+            self.check_interrupts()?;
+        }
         Ok(())
     }
 
@@ -239,6 +443,11 @@ impl ExecutionContext {
     pub fn call_stack_depth(&self) -> usize {
         self.call_stack.len()
     }
+
+    /// Get the deepest call stack depth reached since creation or the last reset
+    pub fn peak_call_depth(&self) -> usize {
+        self.peak_call_depth
+    }
 }
 
 impl Default for ExecutionContext {
@@ -247,6 +456,12 @@ impl Default for ExecutionContext {
     }
 }
 
+fn deadline_for(limits: &ResourceLimits) -> Option<Instant> {
+    limits
+        .max_duration
+        .and_then(|duration| Instant::now().checked_add(duration))
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -293,6 +508,7 @@ mod tests {
         let mut ctx = ExecutionContext::with_limits(ResourceLimits {
             max_operations: 5,
             max_recursion_depth: 10,
+            ..ResourceLimits::default()
         });
 
         for _ in 0..5 {
@@ -301,6 +517,70 @@ mod tests {
         assert!(ctx.check_operation_limit().is_err());
     }
 
+    #[test]
+    fn test_cancellation_stops_at_next_interrupt_check() {
+        let token = CancellationToken::new();
+        let mut ctx = ExecutionContext::with_limits(ResourceLimits {
+            cancellation: Some(token.clone()),
+            ..ResourceLimits::default()
+        });
+
+        for _ in 0..INTERRUPT_CHECK_INTERVAL {
+            ctx.check_operation_limit().unwrap();
+        }
+        token.cancel();
+        for _ in 1..INTERRUPT_CHECK_INTERVAL {
+            ctx.check_operation_limit().unwrap();
+        }
+        let error = ctx.check_operation_limit().unwrap_err();
+        assert_eq!(error.kind(), &RuntimeErrorKind::Cancelled);
+    }
+
+    #[test]
+    fn test_expired_deadline_fails_interrupt_check() {
+        let ctx = ExecutionContext::with_limits(ResourceLimits {
+            max_duration: Some(Duration::ZERO),
+            ..ResourceLimits::default()
+        });
+
+        let error = ctx.check_interrupts().unwrap_err();
+        assert_eq!(
+            error.kind(),
+            &RuntimeErrorKind::DeadlineExceeded {
+                limit: Duration::ZERO
+            }
+        );
+        assert!(ExecutionContext::new().check_interrupts().is_ok());
+    }
+
+    #[test]
+    fn test_redefinition_in_same_scope_overwrites_binding() {
+        let mut ctx = ExecutionContext::new();
+        ctx.push_scope();
+        ctx.define_variable(SmolStr::new("x"), Value::Int(1));
+        ctx.define_variable(SmolStr::new("x"), Value::Int(2));
+        assert_eq!(ctx.lookup_variable("x").unwrap(), Value::Int(2));
+
+        ctx.pop_scope();
+        assert!(ctx.lookup_variable("x").is_err());
+    }
+
+    #[test]
+    fn test_snapshot_preserves_shadowing() {
+        let mut ctx = ExecutionContext::new();
+        ctx.define_variable(SmolStr::new("x"), Value::Int(1));
+        ctx.define_variable(SmolStr::new("y"), Value::Int(10));
+        ctx.push_scope();
+        ctx.define_variable(SmolStr::new("x"), Value::Int(2));
+        ctx.push_scope();
+        ctx.define_variable(SmolStr::new("z"), Value::Int(3));
+
+        let snapshot = ctx.snapshot_visible_variables();
+        assert_eq!(snapshot.get("x"), Some(&Value::Int(2)));
+        assert_eq!(snapshot.get("y"), Some(&Value::Int(10)));
+        assert_eq!(snapshot.get("z"), Some(&Value::Int(3)));
+    }
+
     #[test]
     fn test_variable_update() {
         let mut ctx = ExecutionContext::new();
@@ -308,4 +588,100 @@ mod tests {
         assert!(ctx.update_variable("x", Value::Int(2)).is_ok());
         assert_eq!(ctx.lookup_variable("x").unwrap(), Value::Int(2));
     }
+
+    #[test]
+    fn test_reset_clears_state_and_applies_new_limits() {
+        let mut ctx = ExecutionContext::new();
+        ctx.define_variable(SmolStr::new("x"), Value::Int(1));
+        ctx.push_scope();
+        ctx.define_variable(SmolStr::new("y"), Value::Int(2));
+        ctx.check_operation_limit().unwrap();
+
+        ctx.reset(ResourceLimits {
+            max_operations: 1,
+            max_recursion_depth: 10,
+            ..ResourceLimits::default()
+        });
+
+        assert!(ctx.lookup_variable("x").is_err());
+        assert!(ctx.lookup_variable("y").is_err());
+        assert_eq!(ctx.operation_count(), 0);
+        assert_eq!(ctx.call_stack_depth(), 0);
+        assert_eq!(ctx.peak_call_depth(), 0);
+        ctx.define_variable(SmolStr::new("z"), Value::Int(3));
+        assert_eq!(ctx.lookup_variable("z").unwrap(), Value::Int(3));
+        assert!(ctx.check_operation_limit().is_ok());
+        assert!(ctx.check_operation_limit().is_err());
+    }
+
+    #[test]
+    fn test_peak_call_depth_survives_pops() {
+        let mut ctx = ExecutionContext::new();
+        for name in ["a", "b", "c"] {
+            ctx.push_call_frame(CallFrame::new(SmolStr::new(name), None))
+                .unwrap();
+        }
+        ctx.pop_call_frame();
+        ctx.pop_call_frame();
+
+        assert_eq!(ctx.call_stack_depth(), 1);
+        assert_eq!(ctx.peak_call_depth(), 3);
+
+        let mut merged = ExecutionContext::new();
+        merged.sync_usage_from(&ctx);
+        assert_eq!(merged.peak_call_depth(), 3);
+    }
+
+    #[test]
+    fn test_charged_call_usage_counts_like_the_measured_call() {
+        let mut ctx = ExecutionContext::with_limits(ResourceLimits {
+            max_operations: 10,
+            max_recursion_depth: 3,
+            ..ResourceLimits::default()
+        });
+        for name in ["outer", "peak"] {
+            ctx.push_call_frame(CallFrame::new(SmolStr::new(name), None))
+                .unwrap();
+        }
+        ctx.pop_call_frame();
+
+        let ((), usage) = ctx.measure_call_usage(|ctx| {
+            ctx.push_call_frame(CallFrame::new(SmolStr::new("call"), None))
+                .unwrap();
+            ctx.check_operation_limit().unwrap();
+            ctx.check_operation_limit().unwrap();
+            ctx.pop_call_frame();
+        });
+        assert_eq!(
+            usage,
+            CallUsage {
+                operations: 2,
+                call_depth: 1,
+            }
+        );
+        assert_eq!(ctx.peak_call_depth(), 2);
+
+        for _ in 0..4 {
+            ctx.charge_call_usage(usage).unwrap();
+        }
+        assert_eq!(ctx.operation_count(), 10);
+        assert!(matches!(
+            ctx.charge_call_usage(usage).unwrap_err().kind(),
+            RuntimeErrorKind::OperationLimitExceeded { limit: 10 }
+        ));
+
+        let mut deep = ExecutionContext::with_limits(ResourceLimits {
+            max_recursion_depth: 3,
+            ..ResourceLimits::default()
+        });
+        for name in ["a", "b", "c"] {
+            deep.push_call_frame(CallFrame::new(SmolStr::new(name), None))
+                .unwrap();
+        }
+        assert!(deep.charge_call_usage(CallUsage::default()).is_ok());
+        assert!(matches!(
+            deep.charge_call_usage(usage).unwrap_err().kind(),
+            RuntimeErrorKind::StackOverflow { depth: 3 }
+        ));
+    }
 }
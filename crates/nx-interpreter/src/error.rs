@@ -3,6 +3,7 @@
 use ariadne::{sources, Color, Label, Report, ReportKind};
 use smol_str::SmolStr;
 use std::fmt;
+use std::time::Duration;
 use text_size::TextRange;
 
 /// Runtime error kinds that can occur during interpretation
@@ -66,6 +67,16 @@ pub enum RuntimeErrorKind {
     /// Triggered when recursion depth exceeds the configured limit
     StackOverflow { depth: usize },
 
+    /// Wall-clock deadline exceeded
+    ///
+    /// Triggered when execution runs longer than the configured maximum duration
+    DeadlineExceeded { limit: Duration },
+
+    /// Execution cancelled by the host
+    ///
+    /// Triggered when the cancellation token passed with the resource limits is cancelled
+    Cancelled,
+
     /// Enum type referenced at runtime could not be found
     EnumNotFound { name: SmolStr },
 
@@ -164,6 +175,14 @@ impl fmt::Display for RuntimeErrorKind {
             RuntimeErrorKind::StackOverflow { depth } => {
                 write!(f, "Stack overflow: recursion depth {} exceeded", depth)
             }
+            RuntimeErrorKind::DeadlineExceeded { limit } => {
+                write!(
+                    f,
+                    "Deadline exceeded: execution ran longer than {:?}",
+                    limit
+                )
+            }
+            RuntimeErrorKind::Cancelled => write!(f, "Execution cancelled by the host"),
             RuntimeErrorKind::EnumNotFound { name } => {
                 write!(f, "Enum not found: {}", name)
             }
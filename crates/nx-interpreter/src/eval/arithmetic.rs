@@ -33,6 +33,21 @@ pub fn eval_arithmetic_op(lhs: Value, op: BinOp, rhs: Value) -> Result<Value, Ru
     }
 }
 
+/// Evaluate arithmetic negation
+pub fn eval_negation(operand: Value) -> Result<Value, RuntimeError> {
+    match operand {
+        Value::Int32(n) => Ok(Value::Int32(-n)),
+        Value::Int(n) => Ok(Value::Int(-n)),
+        Value::Float32(f) => Ok(Value::Float32(-f)),
+        Value::Float(f) => Ok(Value::Float(-f)),
+        v => Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
+            expected: "number".to_string(),
+            actual: v.type_name().to_string(),
+            operation: "negation".to_string(),
+        })),
+    }
+}
+
 fn eval_add(lhs: Value, rhs: Value) -> Result<Value, RuntimeError> {
     match (lhs, rhs) {
         // Same-width integer ops
@@ -1,3 +1,16 @@
 //! Control flow operations (conditionals, loops)
 
-// Placeholder module - will be implemented in Phase 5 and 6
+use crate::error::{RuntimeError, RuntimeErrorKind};
+use crate::value::Value;
+
+/// Check the value of an `if` condition and return its truth value
+pub fn eval_condition(condition: Value) -> Result<bool, RuntimeError> {
+    match condition {
+        Value::Boolean(b) => Ok(b),
+        v => Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
+            expected: "bool".to_string(),
+            actual: v.type_name().to_string(),
+            operation: "if condition".to_string(),
+        })),
+    }
+}
@@ -46,6 +46,23 @@ pub fn eval_logical_op(lhs: Value, op: BinOp, rhs: Value) -> Result<Value, Runti
     }
 }
 
+/// Check one operand of a short-circuiting `&&` or `||` and return its truth value
+pub fn eval_short_circuit_operand(op: BinOp, operand: Value) -> Result<bool, RuntimeError> {
+    match operand {
+        Value::Boolean(b) => Ok(b),
+        v => Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
+            expected: "bool".to_string(),
+            actual: v.type_name().to_string(),
+            operation: if op == BinOp::Or {
+                "logical or"
+            } else {
+                "logical and"
+            }
+            .to_string(),
+        })),
+    }
+}
+
 /// Evaluate a logical unary operation (T038)
 pub fn eval_logical_unary(op: UnOp, operand: Value) -> Result<Value, RuntimeError> {
     match op {
@@ -4,3 +4,31 @@ pub mod arithmetic;
 pub mod control;
 pub mod functions;
 pub mod logical;
+
+use crate::error::RuntimeError;
+use crate::value::Value;
+use nx_hir::ast::{self, BinOp};
+
+/// Convert a literal to the value it evaluates to
+pub fn literal_value(lit: &ast::Literal) -> Value {
+    match lit {
+        ast::Literal::Int(n) => Value::Int(*n),
+        ast::Literal::Float(f) => Value::Float(f.0),
+        ast::Literal::String(s) => Value::String(s.clone()),
+        ast::Literal::Boolean(b) => Value::Boolean(*b),
+        ast::Literal::Null => Value::Null,
+    }
+}
+
+/// Evaluate a binary operation on operands that have both been evaluated
+pub fn eval_binary_op(lhs: Value, op: BinOp, rhs: Value) -> Result<Value, RuntimeError> {
+    match op {
+        BinOp::Add | BinOp::Sub | BinOp::Mul | BinOp::Div | BinOp::Mod | BinOp::Concat => {
+            arithmetic::eval_arithmetic_op(lhs, op, rhs)
+        }
+        BinOp::Eq | BinOp::Ne | BinOp::Lt | BinOp::Le | BinOp::Gt | BinOp::Ge => {
+            logical::eval_comparison_op(lhs, op, rhs)
+        }
+        BinOp::And | BinOp::Or => logical::eval_logical_op(lhs, op, rhs),
+    }
+}
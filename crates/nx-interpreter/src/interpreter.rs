@@ -1,16 +1,25 @@
 //! Core interpreter implementation for executing NX HIR.
 
+use crate::call_memo::{CallMemo, CallTarget, MemoizedCall};
+use crate::compiled::CompiledExpr;
 use crate::context::{ExecutionContext, ResourceLimits};
 use crate::error::{RuntimeError, RuntimeErrorKind};
-use crate::resolved_program::{ResolvedItemKind, ResolvedProgram, RuntimeModuleId};
+use crate::record::{RecordFields, RecordLayout};
+use crate::resolved_program::{
+    ModuleQualifiedItemRef, ResolvedItemKind, ResolvedProgram, RuntimeModuleId,
+};
+use crate::snapshot::{
+    decode_snapshot, encode_snapshot, invalid_snapshot, ComponentSnapshotSchema, SerializedValue,
+    SnapshotDocument,
+};
+use crate::static_fold::static_element_roots;
 use crate::value::Value;
 use la_arena::RawIdx;
 use nx_hir::{
     ast, effective_component_contract, effective_component_contract_for_name,
     effective_record_shape_for_name, resolve_record_definition as resolve_hir_record_definition,
-    EffectiveField, ElementId, ExprId, Function, Item, LoweredModule, Name, PreparedBinding,
-    PreparedBindingOrigin, PreparedBindingTarget, PreparedItemKind, PreparedModule, PropertyEntry,
-    RecordKind, UnionCaseDef, UnionCaseField, UnionDef,
+    EffectiveField, ElementId, ExprId, Function, Item, LoweredModule, Name, PreparedModule,
+    PropertyEntry, RecordKind, UnionCaseDef, UnionCaseField, UnionDef,
 };
 use nx_types::{
     common_supertype, is_object_type, resolve_type_ref_with, resolve_type_ref_with_seen,
@@ -18,19 +27,125 @@ use nx_types::{
 };
 use rustc_hash::FxHashMap;
 use rustc_hash::FxHashSet;
-use serde::{Deserialize, Serialize};
 use smol_str::SmolStr;
-use std::cell::RefCell;
+use std::cell::{Cell, RefCell};
 use std::collections::BTreeMap;
 use std::sync::Arc;
+use std::time::Instant;
+
+/// Most distinct field layouts an [`Interpreter`] caches for one record type name.
+const MAX_RECORD_LAYOUTS_PER_TYPE: usize = 8;
 
-const COMPONENT_SNAPSHOT_VERSION: u32 = 1;
+/// Most member access sites an [`Interpreter`] remembers field offsets for before starting over.
+const MAX_MEMBER_ACCESS_SITES: usize = 4096;
+
+/// One member access expression, identified by the address of its module and its expression id.
+type MemberAccessSite = (usize, ExprId);
+
+/// Dense layout for records built from one declared field list.
+///
+/// Declared fields map to fixed value slots, so construction writes each field straight to its
+/// slot instead of collecting the fields by name first.
+#[derive(Debug)]
+struct DeclaredRecordLayout {
+    /// Declared field names, in declaration order.
+    field_names: Box<[Name]>,
+    layout: Arc<RecordLayout>,
+    /// Layout offset of each declared field, in declaration order.
+    offsets: Box<[usize]>,
+}
+
+impl DeclaredRecordLayout {
+    /// Iterates the first `count` declared fields together with their values in `values`.
+    fn declared_fields<'a>(
+        &'a self,
+        values: &'a [Value],
+        count: usize,
+    ) -> impl Iterator<Item = (&'a str, &'a Value)> + 'a {
+        self.field_names[..count]
+            .iter()
+            .zip(&self.offsets[..count])
+            .map(move |(name, offset)| (name.as_str(), &values[*offset]))
+    }
+}
 
 /// Tree-walking interpreter for NX HIR
+///
+/// An interpreter is cheap to keep around: it caches prepared modules, record layouts, and one
+/// execution context between calls, and resets that context instead of reallocating it. While a
+/// [`CallMemo`] is installed with [`Interpreter::with_call_memo`], function calls it memoizes are
+/// answered from it. It is not
+/// `Sync`, so threads evaluating the same program should each use their own interpreter bound to a
+/// shared `Arc<ResolvedProgram>`.
 #[derive(Debug)]
 pub struct Interpreter {
-    program: Option<ResolvedProgram>,
+    program: Option<Arc<ResolvedProgram>>,
     runtime_prepared_cache: RefCell<FxHashMap<RuntimeModuleId, Arc<PreparedModule>>>,
+    record_layouts: RefCell<FxHashMap<Name, Vec<Arc<RecordLayout>>>>,
+    declared_record_layouts: RefCell<FxHashMap<Name, Vec<Arc<DeclaredRecordLayout>>>>,
+    member_offsets: RefCell<FxHashMap<MemberAccessSite, (Arc<RecordLayout>, usize)>>,
+    spare_context: RefCell<Option<ExecutionContext>>,
+    evaluation_stats: Cell<EvaluationStats>,
+    call_memo: RefCell<Option<Arc<dyn CallMemo>>>,
+}
+
+/// Work counters an [`Interpreter`] accumulates across its top-level calls.
+///
+/// A top-level call is one function execution, component initialization or evaluation, or action
+/// handler invocation. Read and clear the counters with
+/// [`Interpreter::take_evaluation_stats`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct EvaluationStats {
+    /// Top-level calls that ran, whether they succeeded or failed
+    pub evaluations: u64,
+    /// Operations counted against [`ResourceLimits::max_operations`], summed across calls
+    pub operations: u64,
+    /// Deepest call stack reached by any call
+    pub peak_call_depth: u64,
+}
+
+/// Execution context borrowed from an interpreter for one top-level call.
+///
+/// Dropping it clears the context, releasing the values it holds, and hands it back for reuse by
+/// the next call.
+struct PooledContext<'a> {
+    interpreter: &'a Interpreter,
+    ctx: Option<ExecutionContext>,
+}
+
+impl std::ops::Deref for PooledContext<'_> {
+    type Target = ExecutionContext;
+
+    fn deref(&self) -> &ExecutionContext {
+        self.ctx
+            .as_ref()
+            .expect("pooled context is present until drop")
+    }
+}
+
+impl std::ops::DerefMut for PooledContext<'_> {
+    fn deref_mut(&mut self) -> &mut ExecutionContext {
+        self.ctx
+            .as_mut()
+            .expect("pooled context is present until drop")
+    }
+}
+
+impl Drop for PooledContext<'_> {
+    fn drop(&mut self) {
+        if let Some(mut ctx) = self.ctx.take() {
+            let mut stats = self.interpreter.evaluation_stats.get();
+            stats.evaluations += 1;
+            stats.operations += ctx.operation_count() as u64;
+            stats.peak_call_depth = stats.peak_call_depth.max(ctx.peak_call_depth() as u64);
+            self.interpreter.evaluation_stats.set(stats);
+            ctx.reset(ResourceLimits::default());
+            let mut spare = self.interpreter.spare_context.borrow_mut();
+            if spare.is_none() {
+                *spare = Some(ctx);
+            }
+        }
+    }
 }
 
 /// Result of component initialization.
@@ -58,44 +173,6 @@ pub struct ComponentDispatchResult {
     pub state_snapshot: Vec<u8>,
 }
 
-#[derive(Debug, Clone, PartialEq, Serialize, Deserialize)]
-struct SerializedComponentSnapshot {
-    version: u32,
-    program_fingerprint: Option<u64>,
-    component_module_id: u32,
-    component: String,
-    props: BTreeMap<String, SerializedValue>,
-    state: BTreeMap<String, SerializedValue>,
-}
-
-#[derive(Debug, Clone, PartialEq, Serialize, Deserialize)]
-enum SerializedValue {
-    Int32(i32),
-    Int(i64),
-    Float32(f32),
-    Float(f64),
-    String(String),
-    Boolean(bool),
-    Null,
-    Array(Vec<SerializedValue>),
-    EnumValue {
-        type_name: String,
-        member: String,
-    },
-    Record {
-        type_name: String,
-        fields: BTreeMap<String, SerializedValue>,
-    },
-    ActionHandler {
-        module_id: u32,
-        component: String,
-        emit: String,
-        action_name: String,
-        body: u32,
-        captured: BTreeMap<String, SerializedValue>,
-    },
-}
-
 #[derive(Debug, Clone, PartialEq)]
 struct DecodedComponentSnapshot {
     component_module_id: RuntimeModuleId,
@@ -110,14 +187,75 @@ impl Interpreter {
         Self {
             program: None,
             runtime_prepared_cache: RefCell::new(FxHashMap::default()),
+            record_layouts: RefCell::new(FxHashMap::default()),
+            declared_record_layouts: RefCell::new(FxHashMap::default()),
+            member_offsets: RefCell::new(FxHashMap::default()),
+            spare_context: RefCell::new(None),
+            evaluation_stats: Cell::new(EvaluationStats::default()),
+            call_memo: RefCell::new(None),
         }
     }
 
     /// Create a new interpreter bound to a resolved program.
-    pub fn from_resolved_program(program: ResolvedProgram) -> Self {
+    ///
+    /// Pass an `Arc<ResolvedProgram>` to bind several interpreters to one program without
+    /// copying it.
+    pub fn from_resolved_program(program: impl Into<Arc<ResolvedProgram>>) -> Self {
         Self {
-            program: Some(program),
+            program: Some(program.into()),
             runtime_prepared_cache: RefCell::new(FxHashMap::default()),
+            record_layouts: RefCell::new(FxHashMap::default()),
+            declared_record_layouts: RefCell::new(FxHashMap::default()),
+            member_offsets: RefCell::new(FxHashMap::default()),
+            spare_context: RefCell::new(None),
+            evaluation_stats: Cell::new(EvaluationStats::default()),
+            call_memo: RefCell::new(None),
+        }
+    }
+
+    /// Returns the resolved program this interpreter is bound to, if any.
+    pub fn resolved_program(&self) -> Option<&Arc<ResolvedProgram>> {
+        self.program.as_ref()
+    }
+
+    /// Returns the work counters accumulated since creation or the previous call, and clears them.
+    pub fn take_evaluation_stats(&self) -> EvaluationStats {
+        self.evaluation_stats.take()
+    }
+
+    /// Runs `f` with `memo` answering the function calls it memoizes, then restores the memo that
+    /// was installed before, if any.
+    pub fn with_call_memo<T>(&self, memo: Arc<dyn CallMemo>, f: impl FnOnce(&Self) -> T) -> T {
+        struct RestoreCallMemo<'a> {
+            interpreter: &'a Interpreter,
+            previous: Option<Arc<dyn CallMemo>>,
+        }
+
+        impl Drop for RestoreCallMemo<'_> {
+            fn drop(&mut self) {
+                *self.interpreter.call_memo.borrow_mut() = self.previous.take();
+            }
+        }
+
+        let _restore = RestoreCallMemo {
+            interpreter: self,
+            previous: self.call_memo.replace(Some(memo)),
+        };
+        f(self)
+    }
+
+    /// Takes the cached execution context, reset to `limits`, or creates one when none is idle.
+    fn pooled_context(&self, limits: ResourceLimits) -> PooledContext<'_> {
+        let ctx = match self.spare_context.borrow_mut().take() {
+            Some(mut ctx) => {
+                ctx.reset(limits);
+                ctx
+            }
+            None => ExecutionContext::with_limits(limits),
+        };
+        PooledContext {
+            interpreter: self,
+            ctx: Some(ctx),
         }
     }
 
@@ -330,6 +468,26 @@ impl Interpreter {
         self.execute_function_with_limits(module.lowered_module.as_ref(), target_name, args, limits)
     }
 
+    /// Resolve a component entrypoint once so repeated calls can skip the name lookup.
+    pub fn resolve_entry_component(
+        &self,
+        component_name: &str,
+    ) -> Result<ModuleQualifiedItemRef, RuntimeError> {
+        let program = self.program.as_ref().ok_or_else(|| {
+            RuntimeError::new(RuntimeErrorKind::ComponentNotFound {
+                name: SmolStr::new(component_name),
+            })
+        })?;
+        let entry = program.entry_component(component_name).ok_or_else(|| {
+            RuntimeError::new(RuntimeErrorKind::ComponentNotFound {
+                name: SmolStr::new(component_name),
+            })
+        })?;
+        self.resolved_component_target(component_name, entry)?;
+
+        Ok(entry.clone())
+    }
+
     /// Initialize a resolved-program component entrypoint.
     pub fn initialize_resolved_component(
         &self,
@@ -350,43 +508,24 @@ impl Interpreter {
         props: Value,
         limits: ResourceLimits,
     ) -> Result<ComponentInitResult, RuntimeError> {
-        let program = self.program.as_ref().ok_or_else(|| {
-            RuntimeError::new(RuntimeErrorKind::ComponentNotFound {
-                name: SmolStr::new(component_name),
-            })
-        })?;
-        let entry = program.entry_component(component_name).ok_or_else(|| {
-            RuntimeError::new(RuntimeErrorKind::ComponentNotFound {
-                name: SmolStr::new(component_name),
-            })
-        })?;
-        let module = program.module(entry.module_id).ok_or_else(|| {
-            RuntimeError::new(RuntimeErrorKind::ComponentNotFound {
-                name: SmolStr::new(component_name),
-            })
-        })?;
-        let item = module
-            .lowered_module
-            .item_by_definition(entry.definition_id)
-            .ok_or_else(|| {
-                RuntimeError::new(RuntimeErrorKind::ComponentNotFound {
-                    name: SmolStr::new(component_name),
-                })
-            })?;
-        let target_name = match item {
-            Item::Component(component) => component.name.as_str(),
-            _ => component_name,
-        };
+        let entry = self.resolve_entry_component(component_name)?;
+        self.initialize_resolved_component_entry_with_limits(component_name, &entry, props, limits)
+    }
 
-        self.initialize_component_with_limits(
-            module.lowered_module.as_ref(),
-            target_name,
-            props,
-            limits,
-        )
+    /// Initialize a component entrypoint previously returned by
+    /// [`resolve_entry_component`](Self::resolve_entry_component).
+    pub fn initialize_resolved_component_entry_with_limits(
+        &self,
+        component_name: &str,
+        entry: &ModuleQualifiedItemRef,
+        props: Value,
+        limits: ResourceLimits,
+    ) -> Result<ComponentInitResult, RuntimeError> {
+        let (module, component) = self.resolved_component_target(component_name, entry)?;
+        self.initialize_component_item_with_limits(module, component, props, limits)
     }
 
-    /// Evaluate a resolved-program component entrypoint from explicit props and state.
+    /// Evaluate a resolved-program component entrypoint.
     pub fn evaluate_resolved_component(
         &self,
         component_name: &str,
@@ -409,41 +548,52 @@ impl Interpreter {
         state: Value,
         limits: ResourceLimits,
     ) -> Result<ComponentEvaluateResult, RuntimeError> {
-        let program = self.program.as_ref().ok_or_else(|| {
-            RuntimeError::new(RuntimeErrorKind::ComponentNotFound {
-                name: SmolStr::new(component_name),
-            })
-        })?;
-        let entry = program.entry_component(component_name).ok_or_else(|| {
-            RuntimeError::new(RuntimeErrorKind::ComponentNotFound {
-                name: SmolStr::new(component_name),
-            })
-        })?;
-        let module = program.module(entry.module_id).ok_or_else(|| {
+        let entry = self.resolve_entry_component(component_name)?;
+        self.evaluate_resolved_component_entry_with_limits(
+            component_name,
+            &entry,
+            props,
+            state,
+            limits,
+        )
+    }
+
+    /// Evaluate a component entrypoint previously returned by
+    /// [`resolve_entry_component`](Self::resolve_entry_component).
+    pub fn evaluate_resolved_component_entry_with_limits(
+        &self,
+        component_name: &str,
+        entry: &ModuleQualifiedItemRef,
+        props: Value,
+        state: Value,
+        limits: ResourceLimits,
+    ) -> Result<ComponentEvaluateResult, RuntimeError> {
+        let (module, component) = self.resolved_component_target(component_name, entry)?;
+        self.evaluate_component_item_with_limits(module, component, props, state, limits)
+    }
+
+    fn resolved_component_target<'a>(
+        &'a self,
+        component_name: &str,
+        entry: &ModuleQualifiedItemRef,
+    ) -> Result<(&'a LoweredModule, &'a nx_hir::Component), RuntimeError> {
+        let not_found = || {
             RuntimeError::new(RuntimeErrorKind::ComponentNotFound {
                 name: SmolStr::new(component_name),
             })
-        })?;
-        let item = module
-            .lowered_module
-            .item_by_definition(entry.definition_id)
-            .ok_or_else(|| {
-                RuntimeError::new(RuntimeErrorKind::ComponentNotFound {
-                    name: SmolStr::new(component_name),
-                })
-            })?;
-        let target_name = match item {
-            Item::Component(component) => component.name.as_str(),
-            _ => component_name,
         };
+        let program = self.program.as_ref().ok_or_else(not_found)?;
+        let module = program
+            .module(entry.module_id)
+            .ok_or_else(not_found)?
+            .lowered_module
+            .as_ref();
 
-        self.evaluate_component_with_limits(
-            module.lowered_module.as_ref(),
-            target_name,
-            props,
-            state,
-            limits,
-        )
+        match module.item_by_definition(entry.definition_id) {
+            Some(Item::Component(component)) => Ok((module, component)),
+            Some(_) => Ok((module, self.find_component(module, component_name)?)),
+            None => Err(not_found()),
+        }
     }
 
     /// Dispatch actions against a resolved-program snapshot.
@@ -494,13 +644,9 @@ impl Interpreter {
     }
 
     fn current_module_id(&self, module: &LoweredModule) -> Option<RuntimeModuleId> {
-        self.program.as_ref().and_then(|program| {
-            program
-                .modules()
-                .iter()
-                .find(|candidate| std::ptr::eq(candidate.lowered_module.as_ref(), module))
-                .map(|candidate| candidate.id)
-        })
+        self.program
+            .as_ref()
+            .and_then(|program| program.module_id_of(module))
     }
 
     fn require_current_module_id(
@@ -566,72 +712,30 @@ impl Interpreter {
     }
 
     fn runtime_prepared_module(&self, module: &LoweredModule) -> Arc<PreparedModule> {
-        let module_identity = self
-            .program
-            .as_ref()
-            .and_then(|program| {
-                self.current_module_id(module).and_then(|module_id| {
-                    program
-                        .module(module_id)
-                        .map(|resolved_module| resolved_module.prepared_module_identity())
-                })
-            })
-            .unwrap_or_else(|| "<runtime>".to_string());
-
-        let Some(program) = self.program.as_ref() else {
-            return Arc::new(PreparedModule::standalone(module_identity, module.clone()));
-        };
-        let Some(module_id) = self.current_module_id(module) else {
-            return Arc::new(PreparedModule::standalone(module_identity, module.clone()));
+        let resolved = self.program.as_ref().and_then(|program| {
+            self.current_module_id(module)
+                .and_then(|module_id| program.module(module_id))
+                .map(|resolved_module| (program, resolved_module))
+        });
+        let Some((program, resolved_module)) = resolved else {
+            return Arc::new(PreparedModule::standalone("<runtime>", module.clone()));
         };
 
-        if let Some(prepared) = self.runtime_prepared_cache.borrow().get(&module_id) {
+        if let Some(prepared) = program.prelinked_module(resolved_module.id) {
             return Arc::clone(prepared);
-        };
-
-        let mut prepared = PreparedModule::standalone(module_identity, module.clone());
-        let Some(visible_items) = program.imported_items(module_id) else {
-            let prepared = Arc::new(prepared);
-            self.runtime_prepared_cache
-                .borrow_mut()
-                .insert(module_id, Arc::clone(&prepared));
-            return prepared;
-        };
-
-        for (visible_name, item_ref) in visible_items {
-            let Some(target_module) = program.module(item_ref.module_id) else {
-                continue;
-            };
-            let Some(kind) = runtime_prepared_item_kind(item_ref.kind) else {
-                continue;
-            };
-            let target_module_identity = target_module.prepared_module_identity();
-
-            prepared.add_peer_module(
-                target_module_identity.clone(),
-                target_module.lowered_module.clone(),
-            );
-
-            for namespace in kind.namespaces() {
-                prepared.insert_binding(PreparedBinding {
-                    visible_name: Name::new(visible_name),
-                    namespace: *namespace,
-                    kind,
-                    origin: PreparedBindingOrigin::Peer {
-                        module_identity: target_module_identity.clone(),
-                    },
-                    target: PreparedBindingTarget::Peer {
-                        module_identity: target_module_identity.clone(),
-                        definition_id: item_ref.definition_id,
-                    },
-                });
-            }
         }
+        if let Some(prepared) = self
+            .runtime_prepared_cache
+            .borrow()
+            .get(&resolved_module.id)
+        {
+            return Arc::clone(prepared);
+        };
 
-        let prepared = Arc::new(prepared);
+        let prepared = Arc::new(program.prepare_runtime_module(resolved_module));
         self.runtime_prepared_cache
             .borrow_mut()
-            .insert(module_id, Arc::clone(&prepared));
+            .insert(resolved_module.id, Arc::clone(&prepared));
         prepared
     }
 
@@ -685,8 +789,9 @@ impl Interpreter {
     /// # Example
     /// ```ignore
     /// let limits = ResourceLimits {
-    ///     recursion_limit: 100,
-    ///     operation_limit: 10_000,
+    ///     max_operations: 10_000,
+    ///     max_recursion_depth: 100,
+    ///     ..ResourceLimits::default()
     /// };
     /// let result = interpreter.execute_function_with_limits(
     ///     &module,
@@ -717,7 +822,7 @@ impl Interpreter {
         }
 
         // T011: Create execution context
-        let mut ctx = ExecutionContext::with_limits(limits);
+        let mut ctx = self.pooled_context(limits);
         self.bind_top_level_values(module, &mut ctx)?;
 
         let coerced_args =
@@ -772,9 +877,9 @@ impl Interpreter {
         let action =
             self.validate_handler_input(handler_module, action, action_name, component, emit)?;
 
-        let mut ctx = ExecutionContext::with_limits(limits);
+        let mut ctx = self.pooled_context(limits);
         self.bind_top_level_values(handler_module, &mut ctx)?;
-        for (name, value) in captured {
+        for (name, value) in captured.iter() {
             ctx.define_variable(name.clone(), value.clone());
         }
         ctx.define_variable(SmolStr::new("action"), action);
@@ -792,9 +897,19 @@ impl Interpreter {
         limits: ResourceLimits,
     ) -> Result<ComponentInitResult, RuntimeError> {
         let component = self.find_component(module, component_name)?;
+        self.initialize_component_item_with_limits(module, component, props, limits)
+    }
+
+    fn initialize_component_item_with_limits(
+        &self,
+        module: &LoweredModule,
+        component: &nx_hir::Component,
+        props: Value,
+        limits: ResourceLimits,
+    ) -> Result<ComponentInitResult, RuntimeError> {
         let contract = self.effective_component_contract(module, component);
         self.ensure_concrete_component(&contract, "component initialization")?;
-        let mut ctx = ExecutionContext::with_limits(limits);
+        let mut ctx = self.pooled_context(limits);
         self.bind_top_level_values(module, &mut ctx)?;
         let normalized_props =
             self.normalize_component_props(module, &mut ctx, component, &contract, props)?;
@@ -803,7 +918,7 @@ impl Interpreter {
                 FxHashMap::default(),
                 Value::Record {
                     type_name: component.name.clone(),
-                    fields: normalized_props.clone(),
+                    fields: self.record_fields(&component.name, normalized_props.clone()),
                 },
             )
         } else {
@@ -831,6 +946,7 @@ impl Interpreter {
         let state_snapshot = self.encode_component_snapshot(
             component_module_id,
             &component.name,
+            &ComponentSnapshotSchema::new(&contract, component),
             &normalized_props,
             &normalized_state,
         )?;
@@ -852,10 +968,21 @@ impl Interpreter {
         limits: ResourceLimits,
     ) -> Result<ComponentEvaluateResult, RuntimeError> {
         let component = self.find_component(module, component_name)?;
+        self.evaluate_component_item_with_limits(module, component, props, state, limits)
+    }
+
+    fn evaluate_component_item_with_limits(
+        &self,
+        module: &LoweredModule,
+        component: &nx_hir::Component,
+        props: Value,
+        state: Value,
+        limits: ResourceLimits,
+    ) -> Result<ComponentEvaluateResult, RuntimeError> {
         let contract = self.effective_component_contract(module, component);
         self.ensure_concrete_component(&contract, "component evaluation")?;
 
-        let mut ctx = ExecutionContext::with_limits(limits);
+        let mut ctx = self.pooled_context(limits);
         self.bind_top_level_values(module, &mut ctx)?;
         let normalized_props =
             self.normalize_component_props(module, &mut ctx, component, &contract, props)?;
@@ -865,7 +992,7 @@ impl Interpreter {
             return Ok(ComponentEvaluateResult {
                 rendered: Value::Record {
                     type_name: component.name.clone(),
-                    fields: normalized_props,
+                    fields: self.record_fields(&component.name, normalized_props),
                 },
             });
         }
@@ -884,6 +1011,9 @@ impl Interpreter {
     }
 
     /// Dispatch a batch of actions against an opaque component state snapshot with custom limits.
+    ///
+    /// Each handler runs in its own execution context, but `limits.max_duration` bounds the whole
+    /// batch: later handlers only get the time earlier ones left over.
     pub fn dispatch_component_actions_with_limits(
         &self,
         module: &LoweredModule,
@@ -891,12 +1021,15 @@ impl Interpreter {
         actions: Vec<Value>,
         limits: ResourceLimits,
     ) -> Result<ComponentDispatchResult, RuntimeError> {
-        let decoded_snapshot = self.decode_component_snapshot(module, state_snapshot)?;
-        let component_module = self.module_for_id(module, decoded_snapshot.component_module_id)?;
-        let component =
-            self.find_component(component_module, decoded_snapshot.component.as_str())?;
+        let document = self.read_component_snapshot(state_snapshot)?;
+        let component_module_id = RuntimeModuleId::new(document.component_module_id);
+        let component_module = self.module_for_id(module, component_module_id)?;
+        let component = self.find_component(component_module, document.component.as_str())?;
         let contract = self.effective_component_contract(component_module, component);
+        let schema = ComponentSnapshotSchema::new(&contract, component);
+        let decoded_snapshot = self.resolve_component_snapshot(module, document, &schema)?;
         let mut effects = Vec::new();
+        let started = Instant::now();
 
         for action in actions {
             let emit = self.validate_component_action(&contract, &action)?;
@@ -905,11 +1038,17 @@ impl Interpreter {
             if let Some(handler) = decoded_snapshot.props.get(handler_name.as_str()) {
                 match handler {
                     Value::ActionHandler { .. } => {
+                        let handler_limits = ResourceLimits {
+                            max_duration: limits
+                                .max_duration
+                                .map(|budget| budget.saturating_sub(started.elapsed())),
+                            ..limits.clone()
+                        };
                         effects.extend(self.invoke_action_handler_with_limits(
                             component_module,
                             handler,
                             action,
-                            limits,
+                            handler_limits,
                         )?);
                     }
                     _ => {
@@ -929,6 +1068,7 @@ impl Interpreter {
         let next_state_snapshot = self.encode_component_snapshot(
             decoded_snapshot.component_module_id,
             &decoded_snapshot.component,
+            &schema,
             &decoded_snapshot.props,
             &decoded_snapshot.state,
         )?;
@@ -1056,7 +1196,7 @@ impl Interpreter {
         current_module: &LoweredModule,
         ctx: &mut ExecutionContext,
         field: &EffectiveField,
-        visible_fields: &FxHashMap<SmolStr, Value>,
+        visible_fields: impl Iterator<Item = (&str, &Value)>,
         operation: &str,
     ) -> Result<Value, RuntimeError> {
         let Some(default_expr) = field.default.as_ref() else {
@@ -1071,7 +1211,7 @@ impl Interpreter {
         let mut default_ctx = ctx.fork_isolated();
         self.bind_top_level_values(owner_module, &mut default_ctx)?;
         for (name, value) in visible_fields {
-            default_ctx.define_variable(name.clone(), value.clone());
+            default_ctx.define_variable(SmolStr::new(name), value.clone());
         }
         let result = self.eval_expr(owner_module, &mut default_ctx, default_expr.expr_id);
         ctx.sync_usage_from(&default_ctx);
@@ -1102,7 +1242,7 @@ impl Interpreter {
     ) -> Result<FxHashMap<SmolStr, Value>, RuntimeError> {
         match value {
             Value::Null => Ok(FxHashMap::default()),
-            Value::Record { fields, .. } => Ok(fields),
+            Value::Record { fields, .. } => Ok(fields.into_map()),
             other => Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
                 expected: "record".to_string(),
                 actual: other.type_name().to_string(),
@@ -1157,7 +1297,9 @@ impl Interpreter {
                     module,
                     ctx,
                     field,
-                    visible_fields,
+                    visible_fields
+                        .iter()
+                        .map(|(name, value)| (name.as_str(), value)),
                     &format!(
                         "component {} '{}.{}' default evaluation",
                         phase,
@@ -1418,85 +1560,65 @@ impl Interpreter {
         &self,
         component_module_id: RuntimeModuleId,
         component_name: &Name,
+        schema: &ComponentSnapshotSchema<'_>,
         props: &FxHashMap<SmolStr, Value>,
         state: &FxHashMap<SmolStr, Value>,
     ) -> Result<Vec<u8>, RuntimeError> {
-        let snapshot = SerializedComponentSnapshot {
-            version: COMPONENT_SNAPSHOT_VERSION,
+        let document = SnapshotDocument {
             program_fingerprint: self.program.as_ref().map(|program| program.fingerprint),
             component_module_id: component_module_id.as_u32(),
             component: component_name.as_str().to_string(),
             props: props
                 .iter()
-                .map(|(name, value)| (name.to_string(), Self::serialize_runtime_value(value)))
+                .map(|(name, value)| (schema.props.key(name), Self::serialize_runtime_value(value)))
                 .collect(),
             state: state
                 .iter()
-                .map(|(name, value)| (name.to_string(), Self::serialize_runtime_value(value)))
+                .map(|(name, value)| (schema.state.key(name), Self::serialize_runtime_value(value)))
                 .collect(),
         };
 
-        rmp_serde::to_vec_named(&snapshot).map_err(|e| {
-            RuntimeError::new(RuntimeErrorKind::InvalidComponentStateSnapshot {
-                reason: format!("snapshot serialization failed: {e}"),
-            })
-        })
+        Ok(encode_snapshot(&document))
     }
 
-    fn decode_component_snapshot(
-        &self,
-        module: &LoweredModule,
-        bytes: &[u8],
-    ) -> Result<DecodedComponentSnapshot, RuntimeError> {
-        let snapshot: SerializedComponentSnapshot = rmp_serde::from_slice(bytes).map_err(|e| {
-            RuntimeError::new(RuntimeErrorKind::InvalidComponentStateSnapshot {
-                reason: format!("snapshot deserialization failed: {e}"),
-            })
-        })?;
-
-        if snapshot.version != COMPONENT_SNAPSHOT_VERSION {
-            return Err(RuntimeError::new(
-                RuntimeErrorKind::InvalidComponentStateSnapshot {
-                    reason: format!(
-                        "unsupported snapshot version {}, expected {}",
-                        snapshot.version, COMPONENT_SNAPSHOT_VERSION
-                    ),
-                },
-            ));
-        }
+    /// Decodes a snapshot image and checks that it belongs to this interpreter's program.
+    fn read_component_snapshot(&self, bytes: &[u8]) -> Result<SnapshotDocument, RuntimeError> {
+        let snapshot = decode_snapshot(bytes)?;
 
         match self.program.as_ref() {
             Some(program) => {
                 if snapshot.program_fingerprint != Some(program.fingerprint) {
-                    return Err(RuntimeError::new(
-                        RuntimeErrorKind::InvalidComponentStateSnapshot {
-                            reason: format!(
-                                "snapshot fingerprint {:?} does not match program fingerprint {}",
-                                snapshot.program_fingerprint, program.fingerprint
-                            ),
-                        },
-                    ));
+                    return Err(invalid_snapshot(format!(
+                        "snapshot fingerprint {:?} does not match program fingerprint {}",
+                        snapshot.program_fingerprint, program.fingerprint
+                    )));
                 }
             }
             None if snapshot.program_fingerprint.is_some() => {
-                return Err(RuntimeError::new(
-                    RuntimeErrorKind::InvalidComponentStateSnapshot {
-                        reason: format!(
-                            "snapshot fingerprint {:?} requires a resolved program runtime",
-                            snapshot.program_fingerprint
-                        ),
-                    },
-                ));
+                return Err(invalid_snapshot(format!(
+                    "snapshot fingerprint {:?} requires a resolved program runtime",
+                    snapshot.program_fingerprint
+                )));
             }
             None => {}
         }
 
+        Ok(snapshot)
+    }
+
+    /// Resolves schema-indexed snapshot entries back into named runtime values.
+    fn resolve_component_snapshot(
+        &self,
+        module: &LoweredModule,
+        snapshot: SnapshotDocument,
+        schema: &ComponentSnapshotSchema<'_>,
+    ) -> Result<DecodedComponentSnapshot, RuntimeError> {
         let props = snapshot
             .props
             .into_iter()
-            .map(|(name, value)| {
+            .map(|(key, value)| {
                 Ok((
-                    SmolStr::new(name.as_str()),
+                    SmolStr::new(schema.props.name(&key)?),
                     self.deserialize_runtime_value(module, value)?,
                 ))
             })
@@ -1504,9 +1626,9 @@ impl Interpreter {
         let state = snapshot
             .state
             .into_iter()
-            .map(|(name, value)| {
+            .map(|(key, value)| {
                 Ok((
-                    SmolStr::new(name.as_str()),
+                    SmolStr::new(schema.state.name(&key)?),
                     self.deserialize_runtime_value(module, value)?,
                 ))
             })
@@ -1514,12 +1636,27 @@ impl Interpreter {
 
         Ok(DecodedComponentSnapshot {
             component_module_id: RuntimeModuleId::new(snapshot.component_module_id),
-            component: Name::new(&snapshot.component),
+            component: Name::external(&snapshot.component),
             props,
             state,
         })
     }
 
+    #[cfg(test)]
+    fn decode_component_snapshot(
+        &self,
+        module: &LoweredModule,
+        bytes: &[u8],
+    ) -> Result<DecodedComponentSnapshot, RuntimeError> {
+        let snapshot = self.read_component_snapshot(bytes)?;
+        let component_module =
+            self.module_for_id(module, RuntimeModuleId::new(snapshot.component_module_id))?;
+        let component = self.find_component(component_module, snapshot.component.as_str())?;
+        let contract = self.effective_component_contract(component_module, component);
+        let schema = ComponentSnapshotSchema::new(&contract, component);
+        self.resolve_component_snapshot(module, snapshot, &schema)
+    }
+
     fn serialize_runtime_value(value: &Value) -> SerializedValue {
         match value {
             Value::Int32(value) => SerializedValue::Int32(*value),
@@ -1581,23 +1718,16 @@ impl Interpreter {
                 values
                     .into_iter()
                     .map(|value| self.deserialize_runtime_value(module, value))
-                    .collect::<Result<Vec<_>, _>>()?,
+                    .collect::<Result<Vec<_>, _>>()?
+                    .into(),
             )),
             SerializedValue::EnumValue { type_name, member } => Ok(Value::EnumValue {
-                type_name: Name::new(&type_name),
-                member: SmolStr::new(member.as_str()),
+                type_name: Name::external(&type_name),
+                member: Name::external(&member),
             }),
             SerializedValue::Record { type_name, fields } => Ok(Value::Record {
-                type_name: Name::new(&type_name),
-                fields: fields
-                    .into_iter()
-                    .map(|(name, value)| {
-                        Ok((
-                            SmolStr::new(name.as_str()),
-                            self.deserialize_runtime_value(module, value)?,
-                        ))
-                    })
-                    .collect::<Result<FxHashMap<_, _>, RuntimeError>>()?,
+                type_name: Name::external(&type_name),
+                fields: self.deserialize_runtime_fields(module, fields)?,
             }),
             SerializedValue::ActionHandler {
                 module_id,
@@ -1627,24 +1757,33 @@ impl Interpreter {
 
                 Ok(Value::ActionHandler {
                     module_id: handler_module_id,
-                    component: Name::new(&component),
-                    emit: Name::new(&emit),
-                    action_name: Name::new(&action_name),
+                    component: Name::external(&component),
+                    emit: Name::external(&emit),
+                    action_name: Name::external(&action_name),
                     body: ExprId::from_raw(RawIdx::from_u32(body)),
-                    captured: captured
-                        .into_iter()
-                        .map(|(name, value)| {
-                            Ok((
-                                SmolStr::new(name.as_str()),
-                                self.deserialize_runtime_value(module, value)?,
-                            ))
-                        })
-                        .collect::<Result<FxHashMap<_, _>, RuntimeError>>()?,
+                    captured: self.deserialize_runtime_fields(module, captured)?,
                 })
             }
         }
     }
 
+    fn deserialize_runtime_fields(
+        &self,
+        module: &LoweredModule,
+        fields: BTreeMap<String, SerializedValue>,
+    ) -> Result<RecordFields, RuntimeError> {
+        let fields = fields
+            .into_iter()
+            .map(|(name, value)| {
+                Ok((
+                    SmolStr::new(name.as_str()),
+                    self.deserialize_runtime_value(module, value)?,
+                ))
+            })
+            .collect::<Result<FxHashMap<_, _>, RuntimeError>>()?;
+        Ok(RecordFields::from(fields))
+    }
+
     /// Evaluate an expression (T013 - skeleton)
     fn eval_expr(
         &self,
@@ -1652,10 +1791,17 @@ impl Interpreter {
         ctx: &mut ExecutionContext,
         expr_id: ExprId,
     ) -> Result<Value, RuntimeError> {
+        let expr = module.expr(expr_id);
+        // A compiled tree charges its own operations, starting with this expression.
+        if crate::compiled::is_compiled_form(expr) {
+            if let Some(compiled) = self.compiled_expr(module, expr_id) {
+                return compiled.evaluate(ctx);
+            }
+        }
+
         // Check operation limit
         ctx.check_operation_limit()?;
 
-        let expr = module.expr(expr_id);
         match expr {
             ast::Expr::Literal(lit) => self.eval_literal(lit),
             ast::Expr::Ident(name) => self.eval_ident(ctx, name),
@@ -1694,7 +1840,7 @@ impl Interpreter {
                 for elem_expr in elements {
                     values.push(self.eval_expr(module, ctx, *elem_expr)?);
                 }
-                Ok(Value::Array(values))
+                Ok(Value::Array(values.into()))
             }
             ast::Expr::ActionHandler {
                 component,
@@ -1703,11 +1849,16 @@ impl Interpreter {
                 body,
                 ..
             } => self.eval_action_handler_expr(module, ctx, component, emit, action_name, *body),
-            ast::Expr::Element { element, .. } => self.eval_element_expr(module, ctx, *element),
+            ast::Expr::Element { element, .. } => match self.folded_element(module, expr_id) {
+                Some(value) => Ok(value),
+                None => self.eval_element_expr(module, ctx, *element),
+            },
             ast::Expr::RecordLiteral {
                 record, properties, ..
             } => self.eval_record_literal(module, ctx, record, properties),
-            ast::Expr::Member { base, member, .. } => self.eval_member(module, ctx, *base, member),
+            ast::Expr::Member { base, member, .. } => {
+                self.eval_member(module, ctx, expr_id, *base, member)
+            }
             _ => {
                 // Other expression types not yet implemented
                 Ok(Value::Null)
@@ -1717,14 +1868,7 @@ impl Interpreter {
 
     /// Evaluate a literal expression (T015 - placeholder)
     fn eval_literal(&self, lit: &ast::Literal) -> Result<Value, RuntimeError> {
-        let value = match lit {
-            ast::Literal::Int(n) => Value::Int(*n),
-            ast::Literal::Float(f) => Value::Float(f.0),
-            ast::Literal::String(s) => Value::String(s.clone()),
-            ast::Literal::Boolean(b) => Value::Boolean(*b),
-            ast::Literal::Null => Value::Null,
-        };
-        Ok(value)
+        Ok(crate::eval::literal_value(lit))
     }
 
     fn eval_action_handler_expr(
@@ -1746,7 +1890,7 @@ impl Interpreter {
             emit: emit.clone(),
             action_name: action_name.clone(),
             body,
-            captured,
+            captured: RecordFields::from(captured),
         })
     }
 
@@ -1810,81 +1954,22 @@ impl Interpreter {
         op: ast::BinOp,
         rhs: ExprId,
     ) -> Result<Value, RuntimeError> {
-        // Handle short-circuit operators specially - don't evaluate rhs eagerly
-        match op {
-            ast::BinOp::And => {
-                let lhs_val = self.eval_expr(module, ctx, lhs)?;
-                match lhs_val {
-                    Value::Boolean(false) => Ok(Value::Boolean(false)),
-                    Value::Boolean(true) => {
-                        let rhs_val = self.eval_expr(module, ctx, rhs)?;
-                        match rhs_val {
-                            Value::Boolean(b) => Ok(Value::Boolean(b)),
-                            v => Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
-                                expected: "bool".to_string(),
-                                actual: v.type_name().to_string(),
-                                operation: "logical and".to_string(),
-                            })),
-                        }
-                    }
-                    v => Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
-                        expected: "bool".to_string(),
-                        actual: v.type_name().to_string(),
-                        operation: "logical and".to_string(),
-                    })),
-                }
-            }
-            ast::BinOp::Or => {
+        // Handle short-circuit operators specially - don't evaluate rhs eagerly
+        match op {
+            ast::BinOp::And | ast::BinOp::Or => {
                 let lhs_val = self.eval_expr(module, ctx, lhs)?;
-                match lhs_val {
-                    Value::Boolean(true) => Ok(Value::Boolean(true)),
-                    Value::Boolean(false) => {
-                        let rhs_val = self.eval_expr(module, ctx, rhs)?;
-                        match rhs_val {
-                            Value::Boolean(b) => Ok(Value::Boolean(b)),
-                            v => Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
-                                expected: "bool".to_string(),
-                                actual: v.type_name().to_string(),
-                                operation: "logical or".to_string(),
-                            })),
-                        }
-                    }
-                    v => Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
-                        expected: "bool".to_string(),
-                        actual: v.type_name().to_string(),
-                        operation: "logical or".to_string(),
-                    })),
+                let lhs_bool = crate::eval::logical::eval_short_circuit_operand(op, lhs_val)?;
+                if lhs_bool == (op == ast::BinOp::Or) {
+                    return Ok(Value::Boolean(lhs_bool));
                 }
+                let rhs_val = self.eval_expr(module, ctx, rhs)?;
+                crate::eval::logical::eval_short_circuit_operand(op, rhs_val).map(Value::Boolean)
             }
             // All other operators evaluate both sides eagerly
             _ => {
                 let lhs_val = self.eval_expr(module, ctx, lhs)?;
                 let rhs_val = self.eval_expr(module, ctx, rhs)?;
-
-                match op {
-                    // Arithmetic operators
-                    ast::BinOp::Add
-                    | ast::BinOp::Sub
-                    | ast::BinOp::Mul
-                    | ast::BinOp::Div
-                    | ast::BinOp::Mod
-                    | ast::BinOp::Concat => {
-                        crate::eval::arithmetic::eval_arithmetic_op(lhs_val, op, rhs_val)
-                    }
-
-                    // Comparison operators (T036)
-                    ast::BinOp::Eq
-                    | ast::BinOp::Ne
-                    | ast::BinOp::Lt
-                    | ast::BinOp::Le
-                    | ast::BinOp::Gt
-                    | ast::BinOp::Ge => {
-                        crate::eval::logical::eval_comparison_op(lhs_val, op, rhs_val)
-                    }
-
-                    // And/Or already handled above
-                    ast::BinOp::And | ast::BinOp::Or => unreachable!(),
-                }
+                crate::eval::eval_binary_op(lhs_val, op, rhs_val)
             }
         }
     }
@@ -1901,20 +1986,7 @@ impl Interpreter {
 
         match op {
             ast::UnOp::Not => crate::eval::logical::eval_logical_unary(op, operand),
-            ast::UnOp::Neg => {
-                // Arithmetic negation
-                match operand {
-                    Value::Int32(n) => Ok(Value::Int32(-n)),
-                    Value::Int(n) => Ok(Value::Int(-n)),
-                    Value::Float32(f) => Ok(Value::Float32(-f)),
-                    Value::Float(f) => Ok(Value::Float(-f)),
-                    v => Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
-                        expected: "number".to_string(),
-                        actual: v.type_name().to_string(),
-                        operation: "negation".to_string(),
-                    })),
-                }
-            }
+            ast::UnOp::Neg => crate::eval::arithmetic::eval_negation(operand),
         }
     }
 
@@ -1927,20 +1999,9 @@ impl Interpreter {
         then_branch: ExprId,
         else_branch: Option<ExprId>,
     ) -> Result<Value, RuntimeError> {
-        // Evaluate condition
+        // Evaluate condition, which must be a bool
         let condition_value = self.eval_expr(module, ctx, condition)?;
-
-        // Condition must be a bool
-        let condition_bool = match condition_value {
-            Value::Boolean(b) => b,
-            v => {
-                return Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
-                    expected: "bool".to_string(),
-                    actual: v.type_name().to_string(),
-                    operation: "if condition".to_string(),
-                }))
-            }
-        };
+        let condition_bool = crate::eval::control::eval_condition(condition_value)?;
 
         // Execute appropriate branch
         if condition_bool {
@@ -1985,13 +2046,12 @@ impl Interpreter {
         pattern: ExprId,
     ) -> Result<Value, RuntimeError> {
         if let Some(qualified_name) = self.flattened_expr_name(module, pattern) {
-            if self
-                .resolve_union_case_definition(module, qualified_name.as_str())
-                .is_some()
+            if let Some((_, _, case)) =
+                self.resolve_union_case_definition(module, qualified_name.as_str())
             {
                 return Ok(Value::Record {
-                    type_name: Name::new(&qualified_name),
-                    fields: FxHashMap::default(),
+                    type_name: union_case_type_name(case, &qualified_name),
+                    fields: RecordFields::default(),
                 });
             }
         }
@@ -2074,7 +2134,7 @@ impl Interpreter {
         }
 
         match self.resolve_item(module, func_name.as_str()) {
-            Some((target_module, Item::Function(function))) => self.eval_function_call(
+            Some((target_module, Item::Function(function))) => self.eval_memoized_function_call(
                 target_module,
                 ctx,
                 func_name.as_str(),
@@ -2164,6 +2224,49 @@ impl Interpreter {
         result
     }
 
+    /// Calls `function` like [`Self::eval_function_call`], answering from the installed
+    /// [`CallMemo`] when it memoizes the call and charging a hit's recorded usage to `ctx`.
+    fn eval_memoized_function_call(
+        &self,
+        module: &LoweredModule,
+        ctx: &mut ExecutionContext,
+        func_name: &str,
+        function: &Function,
+        arg_values: Vec<Value>,
+    ) -> Result<Value, RuntimeError> {
+        let memo = self.call_memo.borrow();
+        let memoized = memo.as_deref().and_then(|memo| {
+            let target = CallTarget {
+                module: self.current_module_id(module)?,
+                function: function.name.as_str(),
+            };
+            let key = memo.key(target, &arg_values)?;
+            Some((memo, target, key))
+        });
+        let Some((memo, target, key)) = memoized else {
+            return self.eval_function_call(module, ctx, func_name, function, arg_values);
+        };
+
+        if let Some(call) = memo.get(target, &key) {
+            ctx.charge_call_usage(call.usage)?;
+            return Ok(call.value);
+        }
+
+        let (result, usage) = ctx.measure_call_usage(|ctx| {
+            self.eval_function_call(module, ctx, func_name, function, arg_values)
+        });
+        let value = result?;
+        memo.insert(
+            target,
+            &key,
+            &MemoizedCall {
+                value: value.clone(),
+                usage,
+            },
+        );
+        Ok(value)
+    }
+
     fn eval_record_constructor_call(
         &self,
         module: &LoweredModule,
@@ -2192,6 +2295,52 @@ impl Interpreter {
         self.build_record_value_from_shape(module, ctx, record_shape, overrides, None)
     }
 
+    /// Returns the value [`ResolvedProgram::fold_static_elements`] rendered for an element
+    /// expression, if any.
+    fn folded_element(&self, module: &LoweredModule, expr_id: ExprId) -> Option<Value> {
+        let program = self.program.as_ref()?;
+        if !program.has_folded_elements() {
+            return None;
+        }
+        program
+            .folded_element(self.current_module_id(module)?, expr_id)
+            .cloned()
+    }
+
+    fn compiled_expr(&self, module: &LoweredModule, expr_id: ExprId) -> Option<&CompiledExpr> {
+        let program = self.program.as_ref()?;
+        if !program.has_compiled_exprs() {
+            return None;
+        }
+        program.compiled_expr(self.current_module_id(module)?, expr_id)
+    }
+
+    /// Renders every static element root in the bound program, skipping ones that fail.
+    pub(crate) fn render_static_elements(
+        &self,
+    ) -> FxHashMap<RuntimeModuleId, FxHashMap<ExprId, Value>> {
+        let Some(program) = self.program.as_ref() else {
+            return FxHashMap::default();
+        };
+
+        let mut folded = FxHashMap::default();
+        for module in program.modules() {
+            let lowered_module = module.lowered_module.as_ref();
+            let mut values = FxHashMap::default();
+            let is_markup_tag = |tag: &str| self.resolve_item(lowered_module, tag).is_none();
+            for expr_id in static_element_roots(lowered_module, &is_markup_tag) {
+                let mut ctx = self.pooled_context(ResourceLimits::default());
+                if let Ok(value) = self.eval_expr(lowered_module, &mut ctx, expr_id) {
+                    values.insert(expr_id, value);
+                }
+            }
+            if !values.is_empty() {
+                folded.insert(module.id, values);
+            }
+        }
+        folded
+    }
+
     fn eval_element_expr(
         &self,
         module: &LoweredModule,
@@ -2231,7 +2380,7 @@ impl Interpreter {
                 ctx,
                 union_def,
                 case,
-                Name::new(tag_name),
+                element.tag.clone(),
                 fields,
                 normalized_content,
             );
@@ -2286,7 +2435,13 @@ impl Interpreter {
                 }));
             }
 
-            return self.eval_function_call(target_module, ctx, tag_name, function, arg_values);
+            return self.eval_memoized_function_call(
+                target_module,
+                ctx,
+                tag_name,
+                function,
+                arg_values,
+            );
         }
 
         if let Some((target_module, Item::Component(component))) =
@@ -2317,7 +2472,7 @@ impl Interpreter {
                 &contract,
                 Value::Record {
                     type_name: component.name.clone(),
-                    fields,
+                    fields: self.record_fields(&component.name, fields),
                 },
             );
             ctx.pop_scope();
@@ -2325,7 +2480,7 @@ impl Interpreter {
 
             return Ok(Value::Record {
                 type_name: component.name.clone(),
-                fields: normalized_props,
+                fields: self.record_fields(&component.name, normalized_props),
             });
         }
 
@@ -2354,7 +2509,7 @@ impl Interpreter {
 
         Ok(Value::Record {
             type_name: element.tag.clone(),
-            fields,
+            fields: self.record_fields(&element.tag, fields),
         })
     }
 
@@ -2505,7 +2660,7 @@ impl Interpreter {
             match value {
                 // Content arrays represent sibling body-content results from multi-item braces and
                 // element-producing control flow, so splice them into the parent content list.
-                Value::Array(items) => values.extend(items),
+                Value::Array(items) => values.extend(Arc::unwrap_or_clone(items)),
                 other => values.push(other),
             }
         }
@@ -2516,7 +2671,7 @@ impl Interpreter {
         match content_values.len() {
             0 => None,
             1 => content_values.into_iter().next(),
-            _ => Some(Value::Array(content_values)),
+            _ => Some(Value::Array(content_values.into())),
         }
     }
 
@@ -2570,7 +2725,7 @@ impl Interpreter {
             return match value {
                 Value::Array(values) => {
                     let mut coerced = Vec::with_capacity(values.len());
-                    for item in values {
+                    for item in Arc::unwrap_or_clone(values) {
                         coerced.push(self.coerce_value_to_resolved_type(
                             module,
                             item,
@@ -2578,14 +2733,17 @@ impl Interpreter {
                             operation,
                         )?);
                     }
-                    Ok(Value::Array(coerced))
+                    Ok(Value::Array(coerced.into()))
                 }
-                other => Ok(Value::Array(vec![self.coerce_value_to_resolved_type(
-                    module,
-                    other,
-                    expected_item,
-                    operation,
-                )?])),
+                other => Ok(Value::Array(
+                    vec![self.coerce_value_to_resolved_type(
+                        module,
+                        other,
+                        expected_item,
+                        operation,
+                    )?]
+                    .into(),
+                )),
             };
         }
 
@@ -2593,15 +2751,15 @@ impl Interpreter {
         // target type is an enum, resolve the string against the enum's member set and lift it
         // into Value::EnumValue; unknown members surface through the standard TypeMismatch path.
         if let (Value::String(member), Type::Named(expected_name)) = (&value, expected) {
-            if let Some(enum_def) = self.resolve_enum_definition(module, expected_name) {
-                if enum_def
+            if let Some(enum_def) = self.resolve_enum_definition(module, expected_name.as_str()) {
+                if let Some(enum_member) = enum_def
                     .members
                     .iter()
-                    .any(|m| m.name.as_str() == member.as_str())
+                    .find(|m| m.name.as_str() == member.as_str())
                 {
                     return Ok(Value::EnumValue {
                         type_name: enum_def.name.clone(),
-                        member: member.clone(),
+                        member: enum_member.name.clone(),
                     });
                 }
                 return Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
@@ -2737,9 +2895,11 @@ impl Interpreter {
         &self,
         module: &LoweredModule,
         ctx: &mut ExecutionContext,
+        expr_id: ExprId,
         base_expr: ExprId,
         member: &Name,
     ) -> Result<Value, RuntimeError> {
+        let site = (module as *const LoweredModule as usize, expr_id);
         if let Some(mut qualified_name) = self.flattened_expr_name(module, base_expr) {
             qualified_name.push('.');
             qualified_name.push_str(member.as_str());
@@ -2750,8 +2910,8 @@ impl Interpreter {
 
         if let ast::Expr::Ident(base_name) = module.expr(base_expr) {
             // Prefer runtime value if variable exists
-            if let Some(var_value) = ctx.try_lookup_variable(base_name.as_str()) {
-                return self.project_member(var_value, member, Some(base_name.as_str()));
+            if let Some(var_value) = ctx.lookup_variable_ref(base_name.as_str()) {
+                return self.project_member(site, var_value, member, Some(base_name.as_str()));
             }
 
             let qualified_case_name = format!("{}.{}", base_name.as_str(), member.as_str());
@@ -2763,21 +2923,17 @@ impl Interpreter {
                     ctx,
                     union_def,
                     case,
-                    Name::new(&qualified_case_name),
+                    union_case_type_name(case, &qualified_case_name),
                     FxHashMap::default(),
                     None,
                 );
             }
 
-            if let Some(enum_def) = self.resolve_enum_definition(module, base_name) {
-                if enum_def
-                    .members
-                    .iter()
-                    .any(|m| m.name.as_str() == member.as_str())
-                {
+            if let Some(enum_def) = self.resolve_enum_definition(module, base_name.as_str()) {
+                if enum_def.members.iter().any(|m| m.name == *member) {
                     return Ok(Value::EnumValue {
                         type_name: enum_def.name.clone(),
-                        member: SmolStr::new(member.as_str()),
+                        member: member.clone(),
                     });
                 } else {
                     return Err(RuntimeError::new(RuntimeErrorKind::EnumMemberNotFound {
@@ -2793,16 +2949,11 @@ impl Interpreter {
         }
 
         if let Some(base_name) = self.flattened_expr_name(module, base_expr) {
-            let base_name = Name::new(&base_name);
             if let Some(enum_def) = self.resolve_enum_definition(module, &base_name) {
-                if enum_def
-                    .members
-                    .iter()
-                    .any(|m| m.name.as_str() == member.as_str())
-                {
+                if enum_def.members.iter().any(|m| m.name == *member) {
                     return Ok(Value::EnumValue {
                         type_name: enum_def.name.clone(),
-                        member: SmolStr::new(member.as_str()),
+                        member: member.clone(),
                     });
                 }
 
@@ -2814,18 +2965,19 @@ impl Interpreter {
         }
 
         let base_value = self.eval_expr(module, ctx, base_expr)?;
-        self.project_member(base_value, member, None)
+        self.project_member(site, &base_value, member, None)
     }
 
     fn project_member(
         &self,
-        base_value: Value,
+        site: MemberAccessSite,
+        base_value: &Value,
         member: &Name,
         record_label: Option<&str>,
     ) -> Result<Value, RuntimeError> {
         match base_value {
             Value::Record { fields, .. } => {
-                if let Some(value) = fields.get(member.as_str()) {
+                if let Some(value) = self.member_field(site, fields, member) {
                     Ok(value.clone())
                 } else {
                     let name = record_label.unwrap_or("record");
@@ -2848,6 +3000,31 @@ impl Interpreter {
         }
     }
 
+    /// Looks up the field a member access site reads, resolving its offset once per layout.
+    ///
+    /// Each site remembers the layout it last read and the field's offset in it, so repeated
+    /// accesses to records of the same type skip the name lookup.
+    fn member_field<'a>(
+        &self,
+        site: MemberAccessSite,
+        fields: &'a RecordFields,
+        member: &Name,
+    ) -> Option<&'a Value> {
+        let mut offsets = self.member_offsets.borrow_mut();
+        if let Some((layout, offset)) = offsets.get(&site) {
+            if Arc::ptr_eq(layout, fields.layout()) {
+                return Some(&fields.values()[*offset]);
+            }
+        }
+
+        let offset = fields.layout().field_offset(member.as_str())?;
+        if offsets.len() >= MAX_MEMBER_ACCESS_SITES && !offsets.contains_key(&site) {
+            offsets.clear();
+        }
+        offsets.insert(site, (Arc::clone(fields.layout()), offset));
+        Some(&fields.values()[offset])
+    }
+
     /// Instantiate a record value from its definition, applying default values.
     pub fn instantiate_record_defaults(
         &self,
@@ -2855,7 +3032,12 @@ impl Interpreter {
         record_name: &str,
     ) -> Result<Value, RuntimeError> {
         let mut ctx = ExecutionContext::new();
-        self.build_record_value(module, &mut ctx, record_name, FxHashMap::default())
+        self.build_record_value(
+            module,
+            &mut ctx,
+            &Name::external(record_name),
+            FxHashMap::default(),
+        )
     }
 
     /// Evaluate a for loop expression
@@ -2908,13 +3090,13 @@ impl Interpreter {
         }
 
         // Return array of results
-        Ok(Value::Array(results))
+        Ok(Value::Array(results.into()))
     }
 
     fn resolve_enum_definition<'a>(
         &'a self,
         module: &'a LoweredModule,
-        name: &Name,
+        name: &str,
     ) -> Option<&'a nx_hir::EnumDef> {
         self.resolve_enum_definition_inner(module, name, &mut FxHashSet::default())
     }
@@ -2953,19 +3135,19 @@ impl Interpreter {
     fn resolve_enum_definition_inner<'a>(
         &'a self,
         module: &'a LoweredModule,
-        name: &Name,
+        name: &str,
         seen: &mut FxHashSet<SmolStr>,
     ) -> Option<&'a nx_hir::EnumDef> {
-        let key = SmolStr::new(name.as_str());
+        let key = SmolStr::new(name);
         if !seen.insert(key.clone()) {
             return None;
         }
 
-        let result = match self.resolve_item(module, name.as_str()) {
+        let result = match self.resolve_item(module, name) {
             Some((_, nx_hir::Item::Enum(enum_def))) => Some(enum_def),
             Some((target_module, nx_hir::Item::TypeAlias(alias))) => match &alias.ty {
                 ast::TypeRef::Name(target) => {
-                    self.resolve_enum_definition_inner(target_module, target, seen)
+                    self.resolve_enum_definition_inner(target_module, target.as_str(), seen)
                 }
                 _ => None,
             },
@@ -3245,7 +3427,7 @@ impl Interpreter {
             Value::Record { type_name, fields } => self.construct_external_record_value(
                 module,
                 &type_name,
-                fields,
+                fields.into_map(),
                 expected_action_name,
                 &operation,
             ),
@@ -3282,11 +3464,11 @@ impl Interpreter {
                     }));
                 }
 
-                for value in &values {
+                for value in values.iter() {
                     self.ensure_action_result_value(module, value, component, emit)?;
                 }
 
-                Ok(values)
+                Ok(Arc::unwrap_or_clone(values))
             }
             other => Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
                 expected: "action or action array".to_string(),
@@ -3341,18 +3523,6 @@ impl Interpreter {
     }
 }
 
-fn runtime_prepared_item_kind(kind: ResolvedItemKind) -> Option<PreparedItemKind> {
-    match kind {
-        ResolvedItemKind::Function => Some(PreparedItemKind::Function),
-        ResolvedItemKind::Value => Some(PreparedItemKind::Value),
-        ResolvedItemKind::Component => Some(PreparedItemKind::Component),
-        ResolvedItemKind::TypeAlias => Some(PreparedItemKind::TypeAlias),
-        ResolvedItemKind::Enum => Some(PreparedItemKind::Enum),
-        ResolvedItemKind::Union => Some(PreparedItemKind::Union),
-        ResolvedItemKind::Record => Some(PreparedItemKind::Record),
-    }
-}
-
 impl Interpreter {
     fn eval_record_literal(
         &self,
@@ -3367,7 +3537,7 @@ impl Interpreter {
             overrides.insert(SmolStr::new(property.name.as_str()), value);
         }
 
-        self.build_record_value(module, ctx, record.as_str(), overrides)
+        self.build_record_value(module, ctx, record, overrides)
     }
 
     fn build_union_case_value(
@@ -3405,51 +3575,59 @@ impl Interpreter {
             "union case construction",
         )?;
 
-        let mut materialized = FxHashMap::default();
-
-        if let Some(base_shape) = base_shape {
-            for field in &base_shape.fields {
-                let value = if let Some(value) = overrides.remove(field.name.as_str()) {
-                    value
-                } else if field.default.is_some() {
-                    self.eval_effective_field_default(
-                        module,
-                        ctx,
-                        field,
-                        &materialized,
-                        &format!("union case field '{}.{}'", discriminator, field.name),
-                    )?
-                } else if matches!(&field.ty, ast::TypeRef::Nullable(_)) {
-                    Value::Null
-                } else if !field.is_required {
-                    return Err(self.unavailable_effective_field_default_error(
-                        &field.name,
-                        &format!("union case field '{}.{}'", discriminator, field.name),
-                    ));
-                } else {
-                    return Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
-                        expected: format!("union case field '{}.{}'", discriminator, field.name),
-                        actual: "missing".to_string(),
-                        operation: "union case construction".to_string(),
-                    }));
-                };
+        let base_fields = base_shape
+            .as_ref()
+            .map_or(&[][..], |shape| shape.fields.as_slice());
+        let declared = self.declared_record_layout(
+            &discriminator,
+            base_fields
+                .iter()
+                .map(|field| &field.name)
+                .chain(case.fields.iter().map(|field| &field.name)),
+        );
+        let mut values = vec![Value::Null; declared.layout.len()];
 
-                let owner_module = self.owner_module_for_effective_field(
+        for (index, field) in base_fields.iter().enumerate() {
+            let value = if let Some(value) = overrides.remove(field.name.as_str()) {
+                value
+            } else if field.default.is_some() {
+                self.eval_effective_field_default(
                     module,
+                    ctx,
                     field,
+                    declared.declared_fields(&values, index),
                     &format!("union case field '{}.{}'", discriminator, field.name),
-                )?;
-                let value = self.coerce_value_to_type(
-                    owner_module,
-                    value,
-                    &field.ty,
+                )?
+            } else if matches!(&field.ty, ast::TypeRef::Nullable(_)) {
+                Value::Null
+            } else if !field.is_required {
+                return Err(self.unavailable_effective_field_default_error(
+                    &field.name,
                     &format!("union case field '{}.{}'", discriminator, field.name),
-                )?;
-                materialized.insert(SmolStr::new(field.name.as_str()), value);
-            }
+                ));
+            } else {
+                return Err(RuntimeError::new(RuntimeErrorKind::TypeMismatch {
+                    expected: format!("union case field '{}.{}'", discriminator, field.name),
+                    actual: "missing".to_string(),
+                    operation: "union case construction".to_string(),
+                }));
+            };
+
+            let owner_module = self.owner_module_for_effective_field(
+                module,
+                field,
+                &format!("union case field '{}.{}'", discriminator, field.name),
+            )?;
+            let value = self.coerce_value_to_type(
+                owner_module,
+                value,
+                &field.ty,
+                &format!("union case field '{}.{}'", discriminator, field.name),
+            )?;
+            values[declared.offsets[index]] = value;
         }
 
-        for field in &case.fields {
+        for (index, field) in (base_fields.len()..).zip(&case.fields) {
             let value = if let Some(value) = overrides.remove(field.name.as_str()) {
                 value
             } else if field.default.is_some() {
@@ -3457,7 +3635,7 @@ impl Interpreter {
                     module,
                     ctx,
                     field,
-                    &materialized,
+                    declared.declared_fields(&values, index),
                     &format!("union case field '{}.{}'", discriminator, field.name),
                 )?
             } else if matches!(&field.ty, ast::TypeRef::Nullable(_)) {
@@ -3476,7 +3654,7 @@ impl Interpreter {
                 &field.ty,
                 &format!("union case field '{}.{}'", discriminator, field.name),
             )?;
-            materialized.insert(SmolStr::new(field.name.as_str()), value);
+            values[declared.offsets[index]] = value;
         }
 
         if let Some(unknown) = overrides.keys().next() {
@@ -3487,9 +3665,10 @@ impl Interpreter {
             }));
         }
 
+        let fields = RecordFields::with_layout(Arc::clone(&declared.layout), values);
         Ok(Value::Record {
             type_name: discriminator,
-            fields: materialized,
+            fields,
         })
     }
 
@@ -3498,7 +3677,7 @@ impl Interpreter {
         module: &LoweredModule,
         ctx: &mut ExecutionContext,
         field: &UnionCaseField,
-        visible_fields: &FxHashMap<SmolStr, Value>,
+        visible_fields: impl Iterator<Item = (&str, &Value)>,
         operation: &str,
     ) -> Result<Value, RuntimeError> {
         let Some(default_expr) = field.default else {
@@ -3508,7 +3687,7 @@ impl Interpreter {
         let mut default_ctx = ctx.fork_isolated();
         self.bind_top_level_values(module, &mut default_ctx)?;
         for (name, value) in visible_fields {
-            default_ctx.define_variable(name.clone(), value.clone());
+            default_ctx.define_variable(SmolStr::new(name), value.clone());
         }
         let result = self.eval_expr(module, &mut default_ctx, default_expr);
         ctx.sync_usage_from(&default_ctx);
@@ -3519,13 +3698,120 @@ impl Interpreter {
         &self,
         module: &LoweredModule,
         ctx: &mut ExecutionContext,
-        record_name: &str,
+        record_name: &Name,
         overrides: FxHashMap<SmolStr, Value>,
     ) -> Result<Value, RuntimeError> {
-        let record_shape = self.effective_record_shape(module, &Name::new(record_name))?;
+        let record_shape = self.effective_record_shape(module, record_name)?;
         self.build_record_value_from_shape(module, ctx, record_shape, overrides, None)
     }
 
+    /// Pack the fields of a record of a program-declared type into dense storage.
+    ///
+    /// Layouts are cached per type name, so records of the same type reuse one name table without
+    /// re-sorting their field names. Each type keeps at most [`MAX_RECORD_LAYOUTS_PER_TYPE`]
+    /// layouts; records whose field set misses the cache get an uncached layout. Field sets that
+    /// do not belong to a declared type, such as host snapshots, go through
+    /// [`RecordFields::from`] instead and are never cached. Records built from a declared field
+    /// list go through [`Self::declared_record_layout`] and skip the field map entirely.
+    fn record_fields(
+        &self,
+        type_name: &Name,
+        mut fields: FxHashMap<SmolStr, Value>,
+    ) -> RecordFields {
+        let layout = {
+            let mut layouts = self.record_layouts.borrow_mut();
+            let cached = layouts.entry(type_name.clone()).or_default();
+            let existing = cached.iter().find(|layout| {
+                layout.len() == fields.len()
+                    && layout
+                        .field_names()
+                        .iter()
+                        .all(|name| fields.contains_key(name))
+            });
+            match existing {
+                Some(layout) => Arc::clone(layout),
+                None => {
+                    let layout = Arc::new(RecordLayout::new(fields.keys().cloned()));
+                    if cached.len() < MAX_RECORD_LAYOUTS_PER_TYPE {
+                        cached.push(Arc::clone(&layout));
+                    }
+                    layout
+                }
+            }
+        };
+        let values = layout
+            .field_names()
+            .iter()
+            .map(|name| fields.remove(name).unwrap_or(Value::Null))
+            .collect();
+        RecordFields::with_layout(layout, values)
+    }
+
+    /// Returns the dense layout for records of `type_name` built from `field_names` in order.
+    ///
+    /// Declared layouts are cached per type name and matched by comparing interned field names,
+    /// so constructing a record of a known shape neither hashes nor sorts its field names. The
+    /// underlying [`RecordLayout`] comes from the same per-type cache [`Self::record_fields`]
+    /// uses, so records of one type share a layout however they were built.
+    fn declared_record_layout<'n>(
+        &self,
+        type_name: &Name,
+        field_names: impl Iterator<Item = &'n Name> + Clone,
+    ) -> Arc<DeclaredRecordLayout> {
+        if let Some(declared) = self
+            .declared_record_layouts
+            .borrow()
+            .get(type_name)
+            .and_then(|cached| {
+                cached
+                    .iter()
+                    .find(|declared| declared.field_names.iter().eq(field_names.clone()))
+            })
+        {
+            return Arc::clone(declared);
+        }
+
+        let field_names = field_names.cloned().collect::<Box<[Name]>>();
+        let layout = self.shared_record_layout(
+            type_name,
+            RecordLayout::new(field_names.iter().map(|name| SmolStr::new(name.as_str()))),
+        );
+        let offsets = field_names
+            .iter()
+            .map(|name| {
+                layout
+                    .field_offset(name.as_str())
+                    .expect("declared record layouts hold every declared field")
+            })
+            .collect();
+        let declared = Arc::new(DeclaredRecordLayout {
+            field_names,
+            layout,
+            offsets,
+        });
+
+        let mut cached = self.declared_record_layouts.borrow_mut();
+        let cached = cached.entry(type_name.clone()).or_default();
+        if cached.len() < MAX_RECORD_LAYOUTS_PER_TYPE {
+            cached.push(Arc::clone(&declared));
+        }
+        declared
+    }
+
+    /// Returns the cached layout of `type_name` equal to `layout`, caching `layout` when absent.
+    fn shared_record_layout(&self, type_name: &Name, layout: RecordLayout) -> Arc<RecordLayout> {
+        let mut layouts = self.record_layouts.borrow_mut();
+        let cached = layouts.entry(type_name.clone()).or_default();
+        if let Some(existing) = cached.iter().find(|existing| existing.as_ref() == &layout) {
+            return Arc::clone(existing);
+        }
+        let layout = Arc::new(layout);
+        if cached.len() < MAX_RECORD_LAYOUTS_PER_TYPE {
+            cached.push(Arc::clone(&layout));
+        }
+        layout
+    }
+
     fn build_record_value_from_shape(
         &self,
         module: &LoweredModule,
@@ -3557,8 +3843,12 @@ impl Interpreter {
             }
         }
 
-        let mut materialized = FxHashMap::default();
-        for prop in &record_shape.fields {
+        let declared = self.declared_record_layout(
+            &record_def.name,
+            record_shape.fields.iter().map(|field| &field.name),
+        );
+        let mut values = vec![Value::Null; declared.layout.len()];
+        for (index, prop) in record_shape.fields.iter().enumerate() {
             let value = if let Some(value) = overrides.remove(prop.name.as_str()) {
                 value
             } else if prop.default.is_some() {
@@ -3566,7 +3856,7 @@ impl Interpreter {
                     module,
                     ctx,
                     prop,
-                    &materialized,
+                    declared.declared_fields(&values, index),
                     &format!(
                         "record field '{}.{}' default evaluation",
                         record_def.name, prop.name
@@ -3603,12 +3893,13 @@ impl Interpreter {
                 &prop.ty,
                 &format!("record field '{}'", prop.name.as_str()),
             )?;
-            materialized.insert(SmolStr::new(prop.name.as_str()), value);
+            values[declared.offsets[index]] = value;
         }
 
+        let fields = RecordFields::with_layout(Arc::clone(&declared.layout), values);
         Ok(Value::Record {
             type_name: record_shape.record.name,
-            fields: materialized,
+            fields,
         })
     }
 }
@@ -3619,6 +3910,18 @@ impl Default for Interpreter {
     }
 }
 
+/// The type name of a union case value written as `written` in source.
+///
+/// That is the case's qualified name interned at lowering, unless the union was reached through
+/// an import qualifier and the written form differs.
+fn union_case_type_name(case: &UnionCaseDef, written: &str) -> Name {
+    if case.qualified_name.as_str() == written {
+        case.qualified_name.clone()
+    } else {
+        Name::new(written)
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -3805,7 +4108,7 @@ mod tests {
                 "SearchBox",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect_err("Expected bare interpreter to reject snapshot creation");
@@ -3870,7 +4173,7 @@ mod tests {
                 handler,
                 Value::Record {
                     type_name: Name::new("SearchSubmitted"),
-                    fields: input_fields,
+                    fields: input_fields.into(),
                 },
             )
             .expect("Expected shared action handler invocation to succeed");
@@ -3943,7 +4246,7 @@ mod tests {
                 handler,
                 Value::Record {
                     type_name: Name::new("SearchSubmitted"),
-                    fields: input_fields,
+                    fields: input_fields.into(),
                 },
             )
             .expect("Expected shared action handler invocation to succeed");
@@ -4032,7 +4335,7 @@ mod tests {
                 &handler,
                 Value::Record {
                     type_name: Name::new("SearchSubmitted"),
-                    fields: input_fields,
+                    fields: input_fields.into(),
                 },
             )
             .expect("Expected handler invocation to use captured snapshot");
@@ -4083,6 +4386,104 @@ mod tests {
         );
     }
 
+    #[test]
+    fn test_record_layouts_are_shared_per_type_and_capped() {
+        let interpreter = Interpreter::new();
+        let user = Name::new("User");
+        let fields = |names: &[&str]| {
+            names
+                .iter()
+                .map(|name| (SmolStr::new(*name), Value::Null))
+                .collect::<FxHashMap<_, _>>()
+        };
+
+        let first = interpreter.record_fields(&user, fields(&["name", "age"]));
+        let second = interpreter.record_fields(&user, fields(&["age", "name"]));
+        assert!(Arc::ptr_eq(first.layout(), second.layout()));
+
+        for index in 0..MAX_RECORD_LAYOUTS_PER_TYPE * 2 {
+            let record =
+                interpreter.record_fields(&user, fields(&[format!("field{index}").as_str()]));
+            assert_eq!(record.len(), 1);
+        }
+        assert_eq!(
+            interpreter.record_layouts.borrow()[&user].len(),
+            MAX_RECORD_LAYOUTS_PER_TYPE
+        );
+    }
+
+    #[test]
+    fn test_declared_records_share_layouts_and_member_offsets() {
+        let source = r#"
+            type User = { name:string age:int = 36 label:string? }
+            let make(name:string) = { <User name={name} /> }
+            let age(user:User) = { user.age }
+        "#;
+
+        let (module, interpreter) = lower_module_runtime(source);
+        let make = |name: &str| {
+            interpreter
+                .execute_function(
+                    module.as_ref(),
+                    "make",
+                    vec![Value::String(SmolStr::new(name))],
+                )
+                .expect("Expected record construction to succeed")
+        };
+        let (ada, grace) = (make("Ada"), make("Grace"));
+        let (
+            Value::Record {
+                fields: ada_fields, ..
+            },
+            Value::Record {
+                fields: grace_fields,
+                ..
+            },
+        ) = (&ada, &grace)
+        else {
+            panic!("Expected user records, got {:?} and {:?}", ada, grace);
+        };
+        assert!(Arc::ptr_eq(ada_fields.layout(), grace_fields.layout()));
+        assert_eq!(
+            ada_fields.get("name"),
+            Some(&Value::String(SmolStr::new("Ada")))
+        );
+        assert_eq!(ada_fields.get("age"), Some(&Value::Int(36)));
+        assert_eq!(ada_fields.get("label"), Some(&Value::Null));
+
+        for user in [ada.clone(), grace, ada] {
+            let age = interpreter
+                .execute_function(module.as_ref(), "age", vec![user])
+                .expect("Expected member access to succeed");
+            assert_eq!(age, Value::Int(36));
+        }
+        assert_eq!(interpreter.member_offsets.borrow().len(), 1);
+    }
+
+    #[test]
+    fn test_restored_snapshot_records_do_not_grow_record_layouts() {
+        // Pooled interpreters restore arbitrary host snapshots; their record shapes must not
+        // accumulate in the per-type layout cache.
+        let (module, interpreter) = lower_module_runtime("let root() = { 1 }");
+        for index in 0..64 {
+            let value = SerializedValue::Record {
+                type_name: format!("Snapshot{index}"),
+                fields: BTreeMap::from([(format!("field{index}"), SerializedValue::Int(index))]),
+            };
+            let Value::Record { fields, .. } = interpreter
+                .deserialize_runtime_value(module.as_ref(), value)
+                .expect("restore snapshot record")
+            else {
+                panic!("Expected a restored record");
+            };
+            assert_eq!(
+                fields.get(&format!("field{index}")),
+                Some(&Value::Int(index))
+            );
+        }
+        assert!(interpreter.record_layouts.borrow().is_empty());
+    }
+
     #[test]
     fn test_runtime_prepared_module_is_cached_per_runtime_module() {
         let source = r#"
@@ -4125,7 +4526,7 @@ mod tests {
                 handler,
                 Value::Record {
                     type_name: Name::new("SearchSubmitted"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect("Expected handler input defaults to be normalized");
@@ -4171,7 +4572,7 @@ mod tests {
                 handler,
                 Value::Record {
                     type_name: Name::new("SearchBox.ValueChanged"),
-                    fields: input_fields,
+                    fields: input_fields.into(),
                 },
             )
             .expect("Expected inherited action defaults to be normalized");
@@ -4213,7 +4614,7 @@ mod tests {
                 handler,
                 Value::Record {
                     type_name: Name::new("SearchSubmitted"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect_err("Expected missing required action field to fail before body evaluation");
@@ -4258,7 +4659,7 @@ mod tests {
                 handler,
                 Value::Record {
                     type_name: Name::new("SearchBox.ValueChanged"),
-                    fields: input_fields,
+                    fields: input_fields.into(),
                 },
             )
             .expect_err("Expected missing inherited action field to fail");
@@ -4316,7 +4717,7 @@ mod tests {
                 &handler,
                 Value::Record {
                     type_name: Name::new("SearchBox.ValueChanged"),
-                    fields: input_fields,
+                    fields: input_fields.into(),
                 },
             )
             .expect("Expected inline action handler invocation to succeed");
@@ -4370,10 +4771,10 @@ mod tests {
         let wrong_handler = extract_handler(&wrong_render_result, "onSearchSubmitted");
 
         let mut empty_input_fields = FxHashMap::default();
-        empty_input_fields.insert(SmolStr::new("queries"), Value::Array(vec![]));
+        empty_input_fields.insert(SmolStr::new("queries"), Value::Array(vec![].into()));
         let empty_action_input = Value::Record {
             type_name: Name::new("SearchSubmitted"),
-            fields: empty_input_fields,
+            fields: empty_input_fields.into(),
         };
 
         let empty_error = interpreter
@@ -4388,11 +4789,11 @@ mod tests {
         let mut wrong_input_fields = FxHashMap::default();
         wrong_input_fields.insert(
             SmolStr::new("queries"),
-            Value::Array(vec![Value::String(SmolStr::new("docs"))]),
+            Value::Array(vec![Value::String(SmolStr::new("docs"))].into()),
         );
         let wrong_action_input = Value::Record {
             type_name: Name::new("SearchSubmitted"),
-            fields: wrong_input_fields,
+            fields: wrong_input_fields.into(),
         };
 
         let wrong_error = interpreter
@@ -4436,7 +4837,7 @@ mod tests {
                 handler,
                 Value::Record {
                     type_name: Name::new("ValueChanged"),
-                    fields: input_fields,
+                    fields: input_fields.into(),
                 },
             )
             .expect_err("Expected wrong action type name to fail");
@@ -4478,7 +4879,7 @@ mod tests {
                 handler,
                 Value::Record {
                     type_name: Name::new("SearchSubmitted"),
-                    fields: input_fields,
+                    fields: input_fields.into(),
                 },
             )
             .expect_err("Expected non-action record handler result to fail");
@@ -4509,7 +4910,7 @@ mod tests {
                 "SearchBox",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect("Expected component initialization to succeed");
@@ -4557,7 +4958,7 @@ mod tests {
                 "Button",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: props,
+                    fields: props.into(),
                 },
             )
             .expect("Expected stateless component initialization to succeed");
@@ -4587,7 +4988,8 @@ mod tests {
             fields: FxHashMap::from_iter([(
                 SmolStr::new("query"),
                 Value::String(SmolStr::new("docs")),
-            )]),
+            )])
+            .into(),
         };
         let evaluated = interpreter
             .evaluate_component(
@@ -4595,7 +4997,7 @@ mod tests {
                 "SearchBox",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
                 state,
             )
@@ -4629,11 +5031,12 @@ mod tests {
                     fields: FxHashMap::from_iter([(
                         SmolStr::new("text"),
                         Value::String(SmolStr::new("Save")),
-                    )]),
+                    )])
+                    .into(),
                 },
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect("Expected stateless component evaluation to succeed");
@@ -4662,14 +5065,15 @@ mod tests {
         let (module, interpreter) = lower_module_runtime(source);
         let props = Value::Record {
             type_name: Name::new("object"),
-            fields: FxHashMap::default(),
+            fields: RecordFields::default(),
         };
         let state = Value::Record {
             type_name: Name::new("object"),
             fields: FxHashMap::from_iter([
                 (SmolStr::new("query"), Value::String(SmolStr::new("docs"))),
                 (SmolStr::new("theme"), Value::String(SmolStr::new("dark"))),
-            ]),
+            ])
+            .into(),
         };
 
         let evaluated = interpreter
@@ -4679,7 +5083,7 @@ mod tests {
             extract_record_field(&evaluated.rendered, "theme"),
             &Value::EnumValue {
                 type_name: Name::new("ThemeMode"),
-                member: SmolStr::new("dark"),
+                member: Name::new("dark"),
             }
         );
         assert_eq!(
@@ -4697,7 +5101,8 @@ mod tests {
                     fields: FxHashMap::from_iter([(
                         SmolStr::new("theme"),
                         Value::String(SmolStr::new("dark")),
-                    )]),
+                    )])
+                    .into(),
                 },
             )
             .expect_err("Expected missing required state field to fail");
@@ -4724,7 +5129,8 @@ mod tests {
                             SmolStr::new("extra"),
                             Value::String(SmolStr::new("ignored")),
                         ),
-                    ]),
+                    ])
+                    .into(),
                 },
             )
             .expect_err("Expected unknown state field to fail");
@@ -4746,7 +5152,8 @@ mod tests {
                             SmolStr::new("theme"),
                             Value::String(SmolStr::new("sparkly")),
                         ),
-                    ]),
+                    ])
+                    .into(),
                 },
             )
             .expect_err("Expected unknown enum state value to fail");
@@ -4770,11 +5177,11 @@ mod tests {
                 "SearchBase",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect_err("Expected abstract component evaluation to fail");
@@ -4810,7 +5217,7 @@ mod tests {
                 props,
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect("Expected component evaluation with handler prop to succeed");
@@ -4834,7 +5241,7 @@ mod tests {
                 "SearchBase",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect_err("Expected abstract component initialization to fail");
@@ -4888,7 +5295,7 @@ mod tests {
                 "SearchBox",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect("Expected external component initialization to succeed");
@@ -4924,7 +5331,7 @@ mod tests {
                 "SearchBox",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect("Expected external component initialization with declared state to succeed");
@@ -4965,7 +5372,7 @@ mod tests {
         let (module, interpreter) = lower_module_runtime(source);
         let props = Value::Record {
             type_name: Name::new("object"),
-            fields: FxHashMap::default(),
+            fields: RecordFields::default(),
         };
         let evaluated = interpreter
             .evaluate_component(
@@ -4977,7 +5384,8 @@ mod tests {
                     fields: FxHashMap::from_iter([
                         (SmolStr::new("query"), Value::String(SmolStr::new("docs"))),
                         (SmolStr::new("theme"), Value::String(SmolStr::new("dark"))),
-                    ]),
+                    ])
+                    .into(),
                 },
             )
             .expect("Expected external component evaluation to succeed");
@@ -5013,7 +5421,8 @@ mod tests {
                     fields: FxHashMap::from_iter([(
                         SmolStr::new("theme"),
                         Value::String(SmolStr::new("dark")),
-                    )]),
+                    )])
+                    .into(),
                 },
             )
             .expect_err("Expected external component evaluation to validate required state");
@@ -5040,7 +5449,8 @@ mod tests {
                             SmolStr::new("extra"),
                             Value::String(SmolStr::new("ignored")),
                         ),
-                    ]),
+                    ])
+                    .into(),
                 },
             )
             .expect_err("Expected external component evaluation to reject unknown state");
@@ -5071,7 +5481,8 @@ mod tests {
                             SmolStr::new("theme"),
                             Value::String(SmolStr::new("sparkly")),
                         ),
-                    ]),
+                    ])
+                    .into(),
                 },
             )
             .expect_err("Expected external component evaluation to reject invalid enum state");
@@ -5179,7 +5590,8 @@ mod tests {
                     fields: FxHashMap::from_iter([(
                         SmolStr::new("query"),
                         Value::String(SmolStr::new("docs")),
-                    )]),
+                    )])
+                    .into(),
                 },
             )
             .expect_err("Expected declared external state to remain a non-prop");
@@ -5218,7 +5630,8 @@ mod tests {
                     type_name: Name::new("SearchRequested"),
                     fields: [(SmolStr::new("query"), Value::String(SmolStr::new("docs")))]
                         .into_iter()
-                        .collect(),
+                        .collect::<FxHashMap<_, _>>()
+                        .into(),
                 }],
             )
             .expect("Expected external component dispatch to succeed");
@@ -5229,7 +5642,8 @@ mod tests {
                 type_name: Name::new("DoSearch"),
                 fields: [(SmolStr::new("query"), Value::String(SmolStr::new("docs")),)]
                     .into_iter()
-                    .collect(),
+                    .collect::<FxHashMap<_, _>>()
+                    .into(),
             }]
         );
 
@@ -5255,7 +5669,7 @@ mod tests {
                 "SearchBox",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect_err("Expected missing required state field to fail");
@@ -5288,7 +5702,7 @@ mod tests {
                 "SearchBox",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect("Expected initialization to succeed");
@@ -5299,10 +5713,16 @@ mod tests {
             SmolStr::new("query"),
             Value::String(SmolStr::new("persisted")),
         );
+        let component = interpreter
+            .find_component(module.as_ref(), "SearchBox")
+            .expect("Expected component to resolve");
+        let contract = interpreter.effective_component_contract(module.as_ref(), component);
+        let schema = ComponentSnapshotSchema::new(&contract, component);
         let mutated_snapshot = interpreter
             .encode_component_snapshot(
                 snapshot.component_module_id,
                 &snapshot.component,
+                &schema,
                 &snapshot.props,
                 &snapshot.state,
             )
@@ -5321,6 +5741,75 @@ mod tests {
         );
     }
 
+    #[test]
+    fn test_component_snapshot_delta_rebuilds_next_snapshot() {
+        let source = r#"
+            component <SearchBox placeholder:string = "Find docs" /> = {
+              state {
+                query:string = {placeholder}
+                preview:string = {placeholder}
+              }
+              <TextInput value={query} placeholder={placeholder} />
+            }
+        "#;
+
+        let (module, interpreter) = lower_module_runtime(source);
+        let init = interpreter
+            .initialize_component(
+                module.as_ref(),
+                "SearchBox",
+                Value::Record {
+                    type_name: Name::new("object"),
+                    fields: RecordFields::default(),
+                },
+            )
+            .expect("Expected initialization to succeed");
+        assert!(!init
+            .state_snapshot
+            .windows("placeholder".len())
+            .any(|window| window == b"placeholder"));
+
+        let component = interpreter
+            .find_component(module.as_ref(), "SearchBox")
+            .expect("Expected component to resolve");
+        let contract = interpreter.effective_component_contract(module.as_ref(), component);
+        let schema = ComponentSnapshotSchema::new(&contract, component);
+        let mut snapshot = interpreter
+            .decode_component_snapshot(module.as_ref(), &init.state_snapshot)
+            .expect("Expected snapshot to decode");
+        snapshot
+            .state
+            .insert(SmolStr::new("query"), Value::String(SmolStr::new("nx")));
+        let next = interpreter
+            .encode_component_snapshot(
+                snapshot.component_module_id,
+                &snapshot.component,
+                &schema,
+                &snapshot.props,
+                &snapshot.state,
+            )
+            .expect("Expected snapshot to encode");
+
+        let delta = crate::snapshot::component_snapshot_delta(&init.state_snapshot, &next)
+            .expect("Expected delta to compute");
+        assert!(delta.len() < next.len());
+        let rebuilt = crate::snapshot::apply_component_snapshot_delta(&init.state_snapshot, &delta)
+            .expect("Expected delta to apply");
+        assert_eq!(rebuilt, next);
+
+        let decoded = interpreter
+            .decode_component_snapshot(module.as_ref(), &rebuilt)
+            .expect("Expected rebuilt snapshot to decode");
+        assert_eq!(
+            decoded.state.get("query"),
+            Some(&Value::String(SmolStr::new("nx")))
+        );
+        assert_eq!(
+            decoded.state.get("preview"),
+            Some(&Value::String(SmolStr::new("Find docs")))
+        );
+    }
+
     #[test]
     fn test_dispatch_component_actions_orders_host_actions_and_handler_effects() {
         let source = r#"
@@ -5363,14 +5852,16 @@ mod tests {
                         fields: FxHashMap::from_iter([(
                             SmolStr::new("searchString"),
                             Value::String(SmolStr::new("docs")),
-                        )]),
+                        )])
+                        .into(),
                     },
                     Value::Record {
                         type_name: Name::new("SearchBox.ValueChanged"),
                         fields: FxHashMap::from_iter([(
                             SmolStr::new("value"),
                             Value::String(SmolStr::new("docs")),
-                        )]),
+                        )])
+                        .into(),
                     },
                 ],
             )
@@ -5401,7 +5892,8 @@ mod tests {
                     fields: FxHashMap::from_iter([(
                         SmolStr::new("searchString"),
                         Value::String(SmolStr::new("docs")),
-                    )]),
+                    )])
+                    .into(),
                 }],
             )
             .expect("Expected dispatch without handlers to succeed");
@@ -5426,7 +5918,7 @@ mod tests {
                 "SearchBox",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect("Expected component initialization to succeed");
@@ -5440,7 +5932,8 @@ mod tests {
                     fields: FxHashMap::from_iter([(
                         SmolStr::new("value"),
                         Value::String(SmolStr::new("docs")),
-                    )]),
+                    )])
+                    .into(),
                 }],
             )
             .expect_err("Expected undeclared action type to fail");
@@ -5469,7 +5962,7 @@ mod tests {
                 "SearchBox",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect("Expected component initialization to succeed");
@@ -5528,7 +6021,7 @@ mod tests {
                 "SearchBox",
                 Value::Record {
                     type_name: Name::new("object"),
-                    fields: FxHashMap::default(),
+                    fields: RecordFields::default(),
                 },
             )
             .expect("Expected component initialization to succeed");
@@ -5,24 +5,35 @@
 //! arithmetic, logical, and control flow operations with comprehensive error
 //! reporting and resource limits for safe execution.
 
+mod call_memo;
+mod compiled;
 mod context;
 mod error;
 mod interpreter;
+mod record;
 mod resolved_program;
+mod snapshot;
+mod static_fold;
 mod value;
 
 pub mod eval;
 
-pub use context::{ExecutionContext, ResourceLimits};
+pub use call_memo::{CallMemo, CallTarget, MemoizedCall};
+pub use context::{
+    CallUsage, CancellationToken, ExecutionContext, ResourceLimits, INTERRUPT_CHECK_INTERVAL,
+};
 pub use error::{RuntimeError, RuntimeErrorKind};
 pub use interpreter::{
-    ComponentDispatchResult, ComponentEvaluateResult, ComponentInitResult, Interpreter,
+    ComponentDispatchResult, ComponentEvaluateResult, ComponentInitResult, EvaluationStats,
+    Interpreter,
 };
+pub use record::{RecordFields, RecordLayout};
 pub use resolved_program::{
     ModuleQualifiedExprRef, ModuleQualifiedItemRef, ResolvedItemKind, ResolvedModule,
     ResolvedModuleSource, ResolvedProgram, RuntimeModuleId,
 };
-pub use value::Value;
+pub use snapshot::{apply_component_snapshot_delta, component_snapshot_delta};
+pub use value::{ArrayElements, Value};
 
 #[cfg(test)]
 mod tests {
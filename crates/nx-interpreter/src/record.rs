@@ -0,0 +1,308 @@
+//! Shape-based storage for runtime record fields.
+
+use crate::value::Value;
+use rustc_hash::FxHashMap;
+use smol_str::SmolStr;
+use std::fmt;
+use std::ops::Index;
+use std::sync::Arc;
+
+/// Field layout shared by every record value with the same field set.
+///
+/// Field names are kept sorted, so a field's offset is its position in the name table and two
+/// layouts describe the same shape exactly when their name tables are equal.
+#[derive(Debug, Clone, PartialEq, Eq, Hash, Default)]
+pub struct RecordLayout {
+    field_names: Box<[SmolStr]>,
+}
+
+impl RecordLayout {
+    /// Creates a layout from field names, sorting them and dropping duplicates.
+    pub fn new(field_names: impl IntoIterator<Item = SmolStr>) -> Self {
+        let mut field_names = field_names.into_iter().collect::<Vec<_>>();
+        field_names.sort_unstable();
+        field_names.dedup();
+        Self {
+            field_names: field_names.into_boxed_slice(),
+        }
+    }
+
+    /// Returns the sorted field names in offset order.
+    pub fn field_names(&self) -> &[SmolStr] {
+        &self.field_names
+    }
+
+    /// Returns the offset of a field within record values that use this layout.
+    pub fn field_offset(&self, name: &str) -> Option<usize> {
+        self.field_names
+            .binary_search_by(|field_name| field_name.as_str().cmp(name))
+            .ok()
+    }
+
+    /// Returns the number of fields in this layout.
+    pub fn len(&self) -> usize {
+        self.field_names.len()
+    }
+
+    /// Returns whether this layout has no fields.
+    pub fn is_empty(&self) -> bool {
+        self.field_names.is_empty()
+    }
+}
+
+/// Record field storage: a shared [`RecordLayout`] plus one dense value slot per field.
+///
+/// Cloning only bumps two reference counts. Writers copy the value slots on write, and adding or
+/// removing a field switches the record to a new, unshared layout.
+#[derive(Clone, Default)]
+pub struct RecordFields {
+    layout: Arc<RecordLayout>,
+    values: Arc<Vec<Value>>,
+}
+
+impl RecordFields {
+    /// Creates empty record fields.
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Creates record fields from a layout and values stored in the layout's offset order.
+    ///
+    /// # Panics
+    ///
+    /// Panics when `values` does not contain exactly one value per layout field.
+    pub fn with_layout(layout: Arc<RecordLayout>, values: Vec<Value>) -> Self {
+        assert_eq!(
+            layout.len(),
+            values.len(),
+            "record values must match the layout field count"
+        );
+        Self {
+            layout,
+            values: Arc::new(values),
+        }
+    }
+
+    /// Returns the shared layout of these fields.
+    pub fn layout(&self) -> &Arc<RecordLayout> {
+        &self.layout
+    }
+
+    /// Returns the field values in layout offset order.
+    pub fn values(&self) -> &[Value] {
+        &self.values
+    }
+
+    /// Returns the number of fields.
+    pub fn len(&self) -> usize {
+        self.values.len()
+    }
+
+    /// Returns whether there are no fields.
+    pub fn is_empty(&self) -> bool {
+        self.values.is_empty()
+    }
+
+    /// Looks up one field value by name.
+    pub fn get(&self, name: &str) -> Option<&Value> {
+        self.layout
+            .field_offset(name)
+            .map(|offset| &self.values[offset])
+    }
+
+    /// Returns whether a field with the supplied name exists.
+    pub fn contains_key(&self, name: &str) -> bool {
+        self.layout.field_offset(name).is_some()
+    }
+
+    /// Iterates fields in layout order, which is sorted by field name.
+    pub fn iter(&self) -> impl ExactSizeIterator<Item = (&SmolStr, &Value)> + '_ {
+        self.layout.field_names.iter().zip(self.values.iter())
+    }
+
+    /// Iterates field names in layout order.
+    pub fn keys(&self) -> impl ExactSizeIterator<Item = &SmolStr> + '_ {
+        self.layout.field_names.iter()
+    }
+
+    /// Sets one field, returning the previous value when the field already existed.
+    ///
+    /// Adding a field splices the new name and value into copies of the sorted layout and value
+    /// slots at the field's offset, so the rest of the layout is not re-sorted.
+    pub fn insert(&mut self, name: SmolStr, value: Value) -> Option<Value> {
+        let offset = match self
+            .layout
+            .field_names
+            .binary_search_by(|field_name| field_name.as_str().cmp(name.as_str()))
+        {
+            Ok(offset) => {
+                return Some(std::mem::replace(
+                    &mut Arc::make_mut(&mut self.values)[offset],
+                    value,
+                ));
+            }
+            Err(offset) => offset,
+        };
+
+        let mut field_names = Vec::with_capacity(self.len() + 1);
+        field_names.extend_from_slice(&self.layout.field_names[..offset]);
+        field_names.push(name);
+        field_names.extend_from_slice(&self.layout.field_names[offset..]);
+        let mut values = Arc::unwrap_or_clone(std::mem::take(&mut self.values));
+        values.insert(offset, value);
+
+        self.layout = Arc::new(RecordLayout {
+            field_names: field_names.into_boxed_slice(),
+        });
+        self.values = Arc::new(values);
+        None
+    }
+
+    /// Removes one field, returning its value when it existed.
+    pub fn remove(&mut self, name: &str) -> Option<Value> {
+        let offset = self.layout.field_offset(name)?;
+        let mut field_names = self.layout.field_names.to_vec();
+        field_names.remove(offset);
+        let mut values = Arc::unwrap_or_clone(std::mem::take(&mut self.values));
+        let removed = values.remove(offset);
+
+        self.layout = Arc::new(RecordLayout {
+            field_names: field_names.into_boxed_slice(),
+        });
+        self.values = Arc::new(values);
+        Some(removed)
+    }
+
+    /// Converts these fields into an owned map, copying the values only while they are shared.
+    pub fn into_map(self) -> FxHashMap<SmolStr, Value> {
+        let values = Arc::unwrap_or_clone(self.values);
+        self.layout
+            .field_names
+            .iter()
+            .cloned()
+            .zip(values)
+            .collect()
+    }
+}
+
+impl From<FxHashMap<SmolStr, Value>> for RecordFields {
+    fn from(fields: FxHashMap<SmolStr, Value>) -> Self {
+        fields.into_iter().collect()
+    }
+}
+
+impl FromIterator<(SmolStr, Value)> for RecordFields {
+    fn from_iter<I: IntoIterator<Item = (SmolStr, Value)>>(iter: I) -> Self {
+        let mut entries = iter.into_iter().collect::<Vec<_>>();
+        // A stable sort keeps duplicate names in input order; later entries win, matching map
+        // insertion semantics.
+        entries.sort_by(|(left, _), (right, _)| left.cmp(right));
+        entries.reverse();
+        entries.dedup_by(|(left, _), (right, _)| left == right);
+        entries.reverse();
+
+        let (field_names, values): (Vec<_>, Vec<_>) = entries.into_iter().unzip();
+        Self {
+            layout: Arc::new(RecordLayout {
+                field_names: field_names.into_boxed_slice(),
+            }),
+            values: Arc::new(values),
+        }
+    }
+}
+
+impl<'a> IntoIterator for &'a RecordFields {
+    type Item = (&'a SmolStr, &'a Value);
+    type IntoIter = std::iter::Zip<std::slice::Iter<'a, SmolStr>, std::slice::Iter<'a, Value>>;
+
+    fn into_iter(self) -> Self::IntoIter {
+        self.layout.field_names.iter().zip(self.values.iter())
+    }
+}
+
+impl Index<&str> for RecordFields {
+    type Output = Value;
+
+    fn index(&self, name: &str) -> &Value {
+        self.get(name)
+            .unwrap_or_else(|| panic!("record field '{}' not found", name))
+    }
+}
+
+impl PartialEq for RecordFields {
+    fn eq(&self, other: &Self) -> bool {
+        (Arc::ptr_eq(&self.layout, &other.layout) || self.layout == other.layout)
+            && self.values == other.values
+    }
+}
+
+impl fmt::Debug for RecordFields {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_map().entries(self.iter()).finish()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn sample_fields() -> RecordFields {
+        let mut fields = FxHashMap::default();
+        fields.insert(SmolStr::new("name"), Value::String(SmolStr::new("Ada")));
+        fields.insert(SmolStr::new("age"), Value::Int(42));
+        fields.into()
+    }
+
+    #[test]
+    fn test_fields_are_stored_in_sorted_layout_order() {
+        let fields = sample_fields();
+        assert_eq!(
+            fields.layout().field_names(),
+            &[SmolStr::new("age"), SmolStr::new("name")]
+        );
+        assert_eq!(fields.layout().field_offset("name"), Some(1));
+        assert_eq!(fields.get("age"), Some(&Value::Int(42)));
+        assert_eq!(fields.get("missing"), None);
+    }
+
+    #[test]
+    fn test_equality_ignores_construction_order() {
+        let reversed = [
+            (SmolStr::new("age"), Value::Int(42)),
+            (SmolStr::new("name"), Value::String(SmolStr::new("Ada"))),
+        ]
+        .into_iter()
+        .collect::<RecordFields>();
+        assert_eq!(sample_fields(), reversed);
+    }
+
+    #[test]
+    fn test_insert_copies_shared_values_on_write() {
+        let original = sample_fields();
+        let mut updated = original.clone();
+        updated.insert(SmolStr::new("age"), Value::Int(43));
+        assert!(Arc::ptr_eq(original.layout(), updated.layout()));
+        assert_eq!(original.get("age"), Some(&Value::Int(42)));
+        assert_eq!(updated.get("age"), Some(&Value::Int(43)));
+
+        updated.insert(SmolStr::new("email"), Value::Null);
+        assert_eq!(updated.len(), 3);
+        assert_eq!(original.len(), 2);
+        assert_eq!(
+            updated.layout().field_names(),
+            &[
+                SmolStr::new("age"),
+                SmolStr::new("email"),
+                SmolStr::new("name")
+            ]
+        );
+        assert_eq!(updated.get("name"), original.get("name"));
+        assert_eq!(updated.remove("email"), Some(Value::Null));
+        assert!(!updated.contains_key("email"));
+        assert_eq!(
+            updated.layout().field_names(),
+            original.layout().field_names()
+        );
+        assert_eq!(updated.get("age"), Some(&Value::Int(43)));
+    }
+}
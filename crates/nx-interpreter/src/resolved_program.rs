@@ -1,4 +1,10 @@
-use nx_hir::{LocalDefinitionId, LoweredModule};
+use crate::compiled::{compile_module, CompiledExpr};
+use crate::interpreter::Interpreter;
+use crate::value::Value;
+use nx_hir::{
+    ExprId, LocalDefinitionId, LoweredModule, Name, PreparedBinding, PreparedBindingOrigin,
+    PreparedBindingTarget, PreparedItemKind, PreparedModule,
+};
 use rustc_hash::FxHashMap;
 use serde::{Deserialize, Serialize};
 use std::path::{Path, PathBuf};
@@ -106,6 +112,8 @@ pub struct ResolvedProgram {
     pub fingerprint: u64,
     root_modules: Vec<RuntimeModuleId>,
     modules: Vec<ResolvedModule>,
+    /// Module ids keyed by the address of their shared lowered module.
+    module_ids_by_address: FxHashMap<usize, RuntimeModuleId>,
     source_provider_modules: FxHashMap<String, RuntimeModuleId>,
     prepared_modules: FxHashMap<String, RuntimeModuleId>,
     local_items: FxHashMap<RuntimeModuleId, FxHashMap<String, ModuleQualifiedItemRef>>,
@@ -114,8 +122,17 @@ pub struct ResolvedProgram {
     pub entry_records: FxHashMap<String, ModuleQualifiedItemRef>,
     pub entry_enums: FxHashMap<String, ModuleQualifiedItemRef>,
     pub imports: FxHashMap<RuntimeModuleId, FxHashMap<String, ModuleQualifiedItemRef>>,
+    prelinked_modules: Option<Arc<FxHashMap<RuntimeModuleId, Arc<PreparedModule>>>>,
+    folded_elements: Option<Arc<FoldedElements>>,
+    compiled_exprs: Option<Arc<CompiledExprs>>,
 }
 
+/// Pre-rendered values of static element expressions, keyed by module and expression.
+type FoldedElements = FxHashMap<RuntimeModuleId, FxHashMap<ExprId, Value>>;
+
+/// Closure-compiled operator trees, keyed by module and root expression.
+type CompiledExprs = FxHashMap<RuntimeModuleId, FxHashMap<ExprId, CompiledExpr>>;
+
 impl ResolvedProgram {
     /// Creates a resolved program from its precomputed modules and lookup tables.
     pub fn new(
@@ -128,6 +145,7 @@ impl ResolvedProgram {
         entry_enums: FxHashMap<String, ModuleQualifiedItemRef>,
         imports: FxHashMap<RuntimeModuleId, FxHashMap<String, ModuleQualifiedItemRef>>,
     ) -> Self {
+        let module_ids_by_address = build_module_ids_by_address(&modules);
         let source_provider_modules = build_source_provider_modules(&modules);
         let prepared_modules = build_prepared_modules(&modules);
         let local_items = build_local_items(&modules);
@@ -135,6 +153,7 @@ impl ResolvedProgram {
             fingerprint,
             root_modules,
             modules,
+            module_ids_by_address,
             source_provider_modules,
             prepared_modules,
             local_items,
@@ -143,6 +162,9 @@ impl ResolvedProgram {
             entry_records,
             entry_enums,
             imports,
+            prelinked_modules: None,
+            folded_elements: None,
+            compiled_exprs: None,
         }
     }
 
@@ -183,7 +205,20 @@ impl ResolvedProgram {
 
     /// Returns the resolved module for a module identifier, if present.
     pub fn module(&self, module_id: RuntimeModuleId) -> Option<&ResolvedModule> {
-        self.modules.iter().find(|module| module.id == module_id)
+        // Module ids are normally assigned densely in module order, so try direct indexing first.
+        self.modules
+            .get(module_id.as_u32() as usize)
+            .filter(|module| module.id == module_id)
+            .or_else(|| self.modules.iter().find(|module| module.id == module_id))
+    }
+
+    /// Returns the identifier of the preserved module whose lowered module is `module` itself.
+    ///
+    /// Matches by identity, not by value, so only references into this program's modules resolve.
+    pub fn module_id_of(&self, module: &LoweredModule) -> Option<RuntimeModuleId> {
+        self.module_ids_by_address
+            .get(&module_address(module))
+            .copied()
     }
 
     /// Returns the source-provider module identifier with the supplied logical identity.
@@ -240,6 +275,156 @@ impl ResolvedProgram {
             .and_then(|items| items.get(visible_name))
     }
 
+    /// Builds the runtime prepared module for every preserved module ahead of evaluation.
+    ///
+    /// Interpreters bound to a prelinked program use these modules directly instead of
+    /// re-cloning each lowered module and rebuilding its import bindings on first use. Clones of
+    /// a prelinked program share the prepared modules.
+    pub fn prelink_modules(&mut self) {
+        let prelinked = self
+            .modules
+            .iter()
+            .map(|module| (module.id, Arc::new(self.prepare_runtime_module(module))))
+            .collect();
+        self.prelinked_modules = Some(Arc::new(prelinked));
+    }
+
+    /// Returns whether [`Self::prelink_modules`] has run for this program.
+    pub fn is_prelinked(&self) -> bool {
+        self.prelinked_modules.is_some()
+    }
+
+    /// Returns the prelinked prepared module for one module identifier, if present.
+    pub fn prelinked_module(&self, module_id: RuntimeModuleId) -> Option<&Arc<PreparedModule>> {
+        self.prelinked_modules
+            .as_ref()
+            .and_then(|modules| modules.get(&module_id))
+    }
+
+    /// Renders every static element subtree once so evaluations reuse the value.
+    ///
+    /// A static element is plain markup: its tag names no function, component, or type, it has
+    /// only unconditional properties, and it is built purely from literals, operators, and other
+    /// static elements. It produces the same value on every render, and rendering it runs no
+    /// program code, so folding cannot spend unbounded work at build time.
+    /// Interpreters bound to a folded program return a clone of the pre-rendered value, which
+    /// shares its field and array storage, instead of rebuilding the record tree. Elements that
+    /// fail to render are left to report their error at runtime. Run this after
+    /// [`Self::prelink_modules`] so the folding pass evaluates against the prelinked modules.
+    pub fn fold_static_elements(&mut self) {
+        self.folded_elements = None;
+        let folded = Interpreter::from_resolved_program(self.clone()).render_static_elements();
+        self.folded_elements = (!folded.is_empty()).then(|| Arc::new(folded));
+    }
+
+    /// Returns the number of static element expressions rendered by
+    /// [`Self::fold_static_elements`].
+    pub fn folded_element_count(&self) -> usize {
+        self.folded_elements
+            .as_ref()
+            .map_or(0, |folded| folded.values().map(FxHashMap::len).sum())
+    }
+
+    /// Returns whether [`Self::fold_static_elements`] rendered any element in this program.
+    pub(crate) fn has_folded_elements(&self) -> bool {
+        self.folded_elements.is_some()
+    }
+
+    /// Returns the pre-rendered value of one static element expression, if it was folded.
+    pub(crate) fn folded_element(
+        &self,
+        module_id: RuntimeModuleId,
+        expr_id: ExprId,
+    ) -> Option<&Value> {
+        self.folded_elements
+            .as_ref()?
+            .get(&module_id)?
+            .get(&expr_id)
+    }
+
+    /// Compiles every operator tree in the program to closures so evaluations skip re-walking it.
+    ///
+    /// An operator tree is an expression built only from literals, variables, binary and unary
+    /// operators, `if`, and blocks without statements. Interpreters bound to a compiled program run
+    /// the outermost such trees as closures; calls, elements, loops, and every other form are still
+    /// evaluated by walking the lowered module. Compiled trees charge the same operations and raise
+    /// the same errors as walking them would. Clones of a compiled program share the closures.
+    pub fn compile_expressions(&mut self) {
+        let compiled = self
+            .modules
+            .iter()
+            .map(|module| (module.id, compile_module(&module.lowered_module)))
+            .filter(|(_, exprs)| !exprs.is_empty())
+            .collect::<CompiledExprs>();
+        self.compiled_exprs = (!compiled.is_empty()).then(|| Arc::new(compiled));
+    }
+
+    /// Returns the number of operator trees compiled by [`Self::compile_expressions`].
+    pub fn compiled_expr_count(&self) -> usize {
+        self.compiled_exprs
+            .as_ref()
+            .map_or(0, |compiled| compiled.values().map(FxHashMap::len).sum())
+    }
+
+    /// Returns whether [`Self::compile_expressions`] compiled any expression in this program.
+    pub(crate) fn has_compiled_exprs(&self) -> bool {
+        self.compiled_exprs.is_some()
+    }
+
+    /// Returns the compiled closure for one operator tree root, if it was compiled.
+    pub(crate) fn compiled_expr(
+        &self,
+        module_id: RuntimeModuleId,
+        expr_id: ExprId,
+    ) -> Option<&CompiledExpr> {
+        self.compiled_exprs.as_ref()?.get(&module_id)?.get(&expr_id)
+    }
+
+    /// Builds the prepared module the interpreter uses to resolve names visible from one module.
+    ///
+    /// The result holds the module's local bindings plus one peer binding per imported item.
+    pub fn prepare_runtime_module(&self, module: &ResolvedModule) -> PreparedModule {
+        let mut prepared = PreparedModule::shared(
+            module.prepared_module_identity(),
+            Arc::clone(&module.lowered_module),
+        );
+        let Some(visible_items) = self.imported_items(module.id) else {
+            return prepared;
+        };
+
+        for (visible_name, item_ref) in visible_items {
+            let Some(target_module) = self.module(item_ref.module_id) else {
+                continue;
+            };
+            let Some(kind) = prepared_item_kind(item_ref.kind) else {
+                continue;
+            };
+            let target_module_identity = target_module.prepared_module_identity();
+
+            prepared.add_peer_module(
+                target_module_identity.clone(),
+                target_module.lowered_module.clone(),
+            );
+
+            for namespace in kind.namespaces() {
+                prepared.insert_binding(PreparedBinding {
+                    visible_name: Name::new(visible_name),
+                    namespace: *namespace,
+                    kind,
+                    origin: PreparedBindingOrigin::Peer {
+                        module_identity: target_module_identity.clone(),
+                    },
+                    target: PreparedBindingTarget::Peer {
+                        module_identity: target_module_identity.clone(),
+                        definition_id: item_ref.definition_id,
+                    },
+                });
+            }
+        }
+
+        prepared
+    }
+
     /// Returns every imported or peer-visible item prepared for one module.
     pub fn imported_items(
         &self,
@@ -249,6 +434,20 @@ impl ResolvedProgram {
     }
 }
 
+fn module_address(module: &LoweredModule) -> usize {
+    module as *const LoweredModule as usize
+}
+
+fn build_module_ids_by_address(modules: &[ResolvedModule]) -> FxHashMap<usize, RuntimeModuleId> {
+    let mut module_ids = FxHashMap::default();
+    for module in modules {
+        module_ids
+            .entry(module_address(module.lowered_module.as_ref()))
+            .or_insert(module.id);
+    }
+    module_ids
+}
+
 fn build_source_provider_modules(modules: &[ResolvedModule]) -> FxHashMap<String, RuntimeModuleId> {
     let mut source_provider_modules = FxHashMap::default();
 
@@ -297,6 +496,18 @@ fn build_local_items(
     local_items
 }
 
+fn prepared_item_kind(kind: ResolvedItemKind) -> Option<PreparedItemKind> {
+    match kind {
+        ResolvedItemKind::Function => Some(PreparedItemKind::Function),
+        ResolvedItemKind::Value => Some(PreparedItemKind::Value),
+        ResolvedItemKind::Component => Some(PreparedItemKind::Component),
+        ResolvedItemKind::TypeAlias => Some(PreparedItemKind::TypeAlias),
+        ResolvedItemKind::Enum => Some(PreparedItemKind::Enum),
+        ResolvedItemKind::Union => Some(PreparedItemKind::Union),
+        ResolvedItemKind::Record => Some(PreparedItemKind::Record),
+    }
+}
+
 fn resolved_item_kind(item: &nx_hir::Item) -> ResolvedItemKind {
     match item {
         nx_hir::Item::Function(_) => ResolvedItemKind::Function,
@@ -0,0 +1,811 @@
+//! Compact binary encoding for component state snapshots.
+//!
+//! A snapshot image starts with the `NXSS` magic and a varint format version, followed by the
+//! optional program fingerprint, the owning module id, and the component name. Names that repeat
+//! inside values (record and enum type names, field names, handler names) are written once into a
+//! string table and referenced by index. Top-level props and state entries are keyed by their
+//! position in the component's declared props and state lists, so declared fields cost one byte
+//! instead of their name; entries outside the schema fall back to a string-table reference.
+//!
+//! A delta image (`NXSD`) records the props and state entries that differ from a base snapshot
+//! together with the XXH3-64 digest of that base image, so deltas stay valid across processes,
+//! platforms, and Rust versions. Hosts that keep the previous snapshot can exchange deltas and
+//! rebuild the full snapshot with [`apply_component_snapshot_delta`]. Deltas are computed on the
+//! encoded entries and need no program. Delta images carry their own format version, which changes
+//! whenever the digest algorithm does.
+
+use crate::error::{RuntimeError, RuntimeErrorKind};
+use nx_hir::{Component, EffectiveComponentContract};
+use rustc_hash::FxHashMap;
+use std::collections::BTreeMap;
+use xxhash_rust::xxh3::xxh3_64;
+
+pub(crate) const COMPONENT_SNAPSHOT_VERSION: u32 = 2;
+/// Delta format version. Version 3 digests the base image with XXH3-64; earlier deltas used the
+/// process-local standard library hasher and are rejected.
+const COMPONENT_SNAPSHOT_DELTA_VERSION: u32 = 3;
+
+const SNAPSHOT_MAGIC: &[u8; 4] = b"NXSS";
+const DELTA_MAGIC: &[u8; 4] = b"NXSD";
+const FLAG_PROGRAM_FINGERPRINT: u8 = 1;
+/// Nesting limit for decoded values, so corrupt input cannot exhaust the stack.
+const MAX_VALUE_DEPTH: usize = 256;
+
+const TAG_NULL: u8 = 0;
+const TAG_FALSE: u8 = 1;
+const TAG_TRUE: u8 = 2;
+const TAG_INT32: u8 = 3;
+const TAG_INT: u8 = 4;
+const TAG_FLOAT32: u8 = 5;
+const TAG_FLOAT: u8 = 6;
+const TAG_STRING: u8 = 7;
+const TAG_ARRAY: u8 = 8;
+const TAG_ENUM: u8 = 9;
+const TAG_RECORD: u8 = 10;
+const TAG_ACTION_HANDLER: u8 = 11;
+
+const CHANGE_REMOVED: u8 = 0;
+const CHANGE_SET: u8 = 1;
+
+/// Host-independent form of one snapshotted runtime value.
+#[derive(Debug, Clone, PartialEq)]
+pub(crate) enum SerializedValue {
+    Int32(i32),
+    Int(i64),
+    Float32(f32),
+    Float(f64),
+    String(String),
+    Boolean(bool),
+    Null,
+    Array(Vec<SerializedValue>),
+    EnumValue {
+        type_name: String,
+        member: String,
+    },
+    Record {
+        type_name: String,
+        fields: BTreeMap<String, SerializedValue>,
+    },
+    ActionHandler {
+        module_id: u32,
+        component: String,
+        emit: String,
+        action_name: String,
+        body: u32,
+        captured: BTreeMap<String, SerializedValue>,
+    },
+}
+
+/// Key of one top-level props or state entry.
+#[derive(Debug, Clone, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub(crate) enum SnapshotKey {
+    /// Position in the component's declared field list.
+    Field(u32),
+    /// Field that is not part of the declared schema.
+    Named(String),
+}
+
+/// Decoded snapshot image before field keys are resolved against a component schema.
+#[derive(Debug, Clone, PartialEq)]
+pub(crate) struct SnapshotDocument {
+    pub program_fingerprint: Option<u64>,
+    pub component_module_id: u32,
+    pub component: String,
+    pub props: BTreeMap<SnapshotKey, SerializedValue>,
+    pub state: BTreeMap<SnapshotKey, SerializedValue>,
+}
+
+/// Declared field order used to key snapshot entries by position.
+#[derive(Debug, Default)]
+pub(crate) struct FieldSchema<'a> {
+    fields: Vec<&'a str>,
+    positions: FxHashMap<&'a str, u32>,
+}
+
+impl<'a> FieldSchema<'a> {
+    pub fn new(fields: impl IntoIterator<Item = &'a str>) -> Self {
+        let mut schema = Self::default();
+        for field in fields {
+            if schema.positions.contains_key(field) {
+                continue;
+            }
+            let position = u32::try_from(schema.fields.len()).unwrap_or(u32::MAX);
+            schema.positions.insert(field, position);
+            schema.fields.push(field);
+        }
+        schema
+    }
+
+    pub fn key(&self, name: &str) -> SnapshotKey {
+        match self.positions.get(name) {
+            Some(position) => SnapshotKey::Field(*position),
+            None => SnapshotKey::Named(name.to_string()),
+        }
+    }
+
+    pub fn name<'k>(&self, key: &'k SnapshotKey) -> Result<&'k str, RuntimeError>
+    where
+        'a: 'k,
+    {
+        match key {
+            SnapshotKey::Field(position) => usize::try_from(*position)
+                .ok()
+                .and_then(|position| self.fields.get(position).copied())
+                .ok_or_else(|| {
+                    invalid_snapshot(format!(
+                        "field index {position} is outside the component schema"
+                    ))
+                }),
+            SnapshotKey::Named(name) => Ok(name.as_str()),
+        }
+    }
+}
+
+/// Field schemas of one component: its effective props followed by its own state fields.
+#[derive(Debug)]
+pub(crate) struct ComponentSnapshotSchema<'a> {
+    pub props: FieldSchema<'a>,
+    pub state: FieldSchema<'a>,
+}
+
+impl<'a> ComponentSnapshotSchema<'a> {
+    pub fn new(contract: &'a EffectiveComponentContract, component: &'a Component) -> Self {
+        Self {
+            props: FieldSchema::new(contract.props.iter().map(|field| field.name.as_str())),
+            state: FieldSchema::new(component.state.iter().map(|field| field.name.as_str())),
+        }
+    }
+}
+
+pub(crate) fn invalid_snapshot(reason: impl Into<String>) -> RuntimeError {
+    RuntimeError::new(RuntimeErrorKind::InvalidComponentStateSnapshot {
+        reason: reason.into(),
+    })
+}
+
+/// Encodes a snapshot document into its canonical image.
+pub(crate) fn encode_snapshot(document: &SnapshotDocument) -> Vec<u8> {
+    let mut body = Encoder::default();
+    body.write_entries(&document.props);
+    body.write_entries(&document.state);
+
+    let mut bytes = Vec::with_capacity(body.bytes.len() + 32);
+    bytes.extend_from_slice(SNAPSHOT_MAGIC);
+    write_varint(&mut bytes, u64::from(COMPONENT_SNAPSHOT_VERSION));
+    write_header(&mut bytes, document);
+    body.finish_into(&mut bytes);
+    bytes
+}
+
+/// Decodes a snapshot image, checking its magic and format version.
+pub(crate) fn decode_snapshot(bytes: &[u8]) -> Result<SnapshotDocument, RuntimeError> {
+    let mut decoder = Decoder::new(bytes);
+    decoder.read_preamble(SNAPSHOT_MAGIC, COMPONENT_SNAPSHOT_VERSION, "snapshot")?;
+    let mut document = decoder.read_header()?;
+    decoder.read_string_table()?;
+    document.props = decoder.read_entries()?;
+    document.state = decoder.read_entries()?;
+    decoder.finish()?;
+    Ok(document)
+}
+
+/// Computes a delta that turns the `previous` snapshot image into the `next` one.
+///
+/// The delta carries the header of `next` and only the props and state entries that were added,
+/// changed, or removed. Both images must be snapshot images produced by this runtime.
+pub fn component_snapshot_delta(previous: &[u8], next: &[u8]) -> Result<Vec<u8>, RuntimeError> {
+    let base = decode_snapshot(previous)?;
+    let target = decode_snapshot(next)?;
+
+    let mut body = Encoder::default();
+    body.write_changes(&base.props, &target.props);
+    body.write_changes(&base.state, &target.state);
+
+    let mut bytes = Vec::with_capacity(body.bytes.len() + 40);
+    bytes.extend_from_slice(DELTA_MAGIC);
+    write_varint(&mut bytes, u64::from(COMPONENT_SNAPSHOT_DELTA_VERSION));
+    bytes.extend_from_slice(&snapshot_digest(previous).to_le_bytes());
+    write_header(&mut bytes, &target);
+    body.finish_into(&mut bytes);
+    Ok(bytes)
+}
+
+/// Applies a delta from [`component_snapshot_delta`] to the snapshot image it was computed
+/// against and returns the resulting full snapshot image.
+///
+/// The delta is rejected when `base` is not the snapshot it was computed from.
+pub fn apply_component_snapshot_delta(base: &[u8], delta: &[u8]) -> Result<Vec<u8>, RuntimeError> {
+    let mut document = decode_snapshot(base)?;
+
+    let mut decoder = Decoder::new(delta);
+    decoder.read_preamble(
+        DELTA_MAGIC,
+        COMPONENT_SNAPSHOT_DELTA_VERSION,
+        "snapshot delta",
+    )?;
+    let base_digest = decoder.read_u64()?;
+    if base_digest != snapshot_digest(base) {
+        return Err(invalid_snapshot(
+            "snapshot delta was computed against a different base snapshot",
+        ));
+    }
+
+    let header = decoder.read_header()?;
+    decoder.read_string_table()?;
+    decoder.apply_changes(&mut document.props)?;
+    decoder.apply_changes(&mut document.state)?;
+    decoder.finish()?;
+
+    document.program_fingerprint = header.program_fingerprint;
+    document.component_module_id = header.component_module_id;
+    document.component = header.component;
+    Ok(encode_snapshot(&document))
+}
+
+/// Digest of a base snapshot image recorded in deltas computed against it.
+fn snapshot_digest(bytes: &[u8]) -> u64 {
+    xxh3_64(bytes)
+}
+
+fn write_header(bytes: &mut Vec<u8>, document: &SnapshotDocument) {
+    match document.program_fingerprint {
+        Some(fingerprint) => {
+            bytes.push(FLAG_PROGRAM_FINGERPRINT);
+            bytes.extend_from_slice(&fingerprint.to_le_bytes());
+        }
+        None => bytes.push(0),
+    }
+    write_varint(bytes, u64::from(document.component_module_id));
+    write_str(bytes, &document.component);
+}
+
+fn write_varint(bytes: &mut Vec<u8>, mut value: u64) {
+    while value >= 0x80 {
+        bytes.push((value as u8) | 0x80);
+        value >>= 7;
+    }
+    bytes.push(value as u8);
+}
+
+fn write_len(bytes: &mut Vec<u8>, len: usize) {
+    write_varint(bytes, len as u64);
+}
+
+fn write_str(bytes: &mut Vec<u8>, value: &str) {
+    write_len(bytes, value.len());
+    bytes.extend_from_slice(value.as_bytes());
+}
+
+fn zigzag(value: i64) -> u64 {
+    ((value << 1) ^ (value >> 63)) as u64
+}
+
+fn unzigzag(value: u64) -> i64 {
+    ((value >> 1) as i64) ^ -((value & 1) as i64)
+}
+
+/// Writes entry and value bodies while collecting the string table that precedes them.
+#[derive(Default)]
+struct Encoder<'a> {
+    bytes: Vec<u8>,
+    strings: Vec<&'a str>,
+    string_indices: FxHashMap<&'a str, u32>,
+}
+
+impl<'a> Encoder<'a> {
+    fn finish_into(self, bytes: &mut Vec<u8>) {
+        write_len(bytes, self.strings.len());
+        for string in &self.strings {
+            write_str(bytes, string);
+        }
+        bytes.extend_from_slice(&self.bytes);
+    }
+
+    fn write_name(&mut self, name: &'a str) {
+        let next_index = self.strings.len() as u32;
+        let index = *self.string_indices.entry(name).or_insert_with(|| {
+            self.strings.push(name);
+            next_index
+        });
+        write_varint(&mut self.bytes, u64::from(index));
+    }
+
+    fn write_key(&mut self, key: &'a SnapshotKey) {
+        match key {
+            SnapshotKey::Field(position) => {
+                write_varint(&mut self.bytes, u64::from(*position) + 1);
+            }
+            SnapshotKey::Named(name) => {
+                self.bytes.push(0);
+                self.write_name(name);
+            }
+        }
+    }
+
+    fn write_entries(&mut self, entries: &'a BTreeMap<SnapshotKey, SerializedValue>) {
+        write_len(&mut self.bytes, entries.len());
+        for (key, value) in entries {
+            self.write_key(key);
+            self.write_value(value);
+        }
+    }
+
+    fn write_changes(
+        &mut self,
+        previous: &'a BTreeMap<SnapshotKey, SerializedValue>,
+        next: &'a BTreeMap<SnapshotKey, SerializedValue>,
+    ) {
+        let removed = previous
+            .keys()
+            .filter(|key| !next.contains_key(*key))
+            .collect::<Vec<_>>();
+        let updated = next
+            .iter()
+            .filter(|(key, value)| previous.get(*key) != Some(*value))
+            .collect::<Vec<_>>();
+
+        write_len(&mut self.bytes, removed.len() + updated.len());
+        for key in removed {
+            self.write_key(key);
+            self.bytes.push(CHANGE_REMOVED);
+        }
+        for (key, value) in updated {
+            self.write_key(key);
+            self.bytes.push(CHANGE_SET);
+            self.write_value(value);
+        }
+    }
+
+    fn write_fields(&mut self, fields: &'a BTreeMap<String, SerializedValue>) {
+        write_len(&mut self.bytes, fields.len());
+        for (name, value) in fields {
+            self.write_name(name);
+            self.write_value(value);
+        }
+    }
+
+    fn write_value(&mut self, value: &'a SerializedValue) {
+        match value {
+            SerializedValue::Null => self.bytes.push(TAG_NULL),
+            SerializedValue::Boolean(false) => self.bytes.push(TAG_FALSE),
+            SerializedValue::Boolean(true) => self.bytes.push(TAG_TRUE),
+            SerializedValue::Int32(value) => {
+                self.bytes.push(TAG_INT32);
+                write_varint(&mut self.bytes, zigzag(i64::from(*value)));
+            }
+            SerializedValue::Int(value) => {
+                self.bytes.push(TAG_INT);
+                write_varint(&mut self.bytes, zigzag(*value));
+            }
+            SerializedValue::Float32(value) => {
+                self.bytes.push(TAG_FLOAT32);
+                self.bytes.extend_from_slice(&value.to_le_bytes());
+            }
+            SerializedValue::Float(value) => {
+                self.bytes.push(TAG_FLOAT);
+                self.bytes.extend_from_slice(&value.to_le_bytes());
+            }
+            SerializedValue::String(value) => {
+                self.bytes.push(TAG_STRING);
+                write_str(&mut self.bytes, value);
+            }
+            SerializedValue::Array(values) => {
+                self.bytes.push(TAG_ARRAY);
+                write_len(&mut self.bytes, values.len());
+                for value in values {
+                    self.write_value(value);
+                }
+            }
+            SerializedValue::EnumValue { type_name, member } => {
+                self.bytes.push(TAG_ENUM);
+                self.write_name(type_name);
+                self.write_name(member);
+            }
+            SerializedValue::Record { type_name, fields } => {
+                self.bytes.push(TAG_RECORD);
+                self.write_name(type_name);
+                self.write_fields(fields);
+            }
+            SerializedValue::ActionHandler {
+                module_id,
+                component,
+                emit,
+                action_name,
+                body,
+                captured,
+            } => {
+                self.bytes.push(TAG_ACTION_HANDLER);
+                write_varint(&mut self.bytes, u64::from(*module_id));
+                self.write_name(component);
+                self.write_name(emit);
+                self.write_name(action_name);
+                write_varint(&mut self.bytes, u64::from(*body));
+                self.write_fields(captured);
+            }
+        }
+    }
+}
+
+struct Decoder<'a> {
+    bytes: &'a [u8],
+    position: usize,
+    strings: Vec<&'a str>,
+}
+
+impl<'a> Decoder<'a> {
+    fn new(bytes: &'a [u8]) -> Self {
+        Self {
+            bytes,
+            position: 0,
+            strings: Vec::new(),
+        }
+    }
+
+    fn truncated() -> RuntimeError {
+        invalid_snapshot("snapshot image is truncated")
+    }
+
+    fn read_bytes(&mut self, len: usize) -> Result<&'a [u8], RuntimeError> {
+        let end = self
+            .position
+            .checked_add(len)
+            .filter(|end| *end <= self.bytes.len())
+            .ok_or_else(Self::truncated)?;
+        let bytes = &self.bytes[self.position..end];
+        self.position = end;
+        Ok(bytes)
+    }
+
+    fn read_u8(&mut self) -> Result<u8, RuntimeError> {
+        Ok(self.read_bytes(1)?[0])
+    }
+
+    fn read_u64(&mut self) -> Result<u64, RuntimeError> {
+        let bytes = self.read_bytes(8)?;
+        Ok(u64::from_le_bytes(bytes.try_into().expect("eight bytes")))
+    }
+
+    fn read_varint(&mut self) -> Result<u64, RuntimeError> {
+        let mut value = 0u64;
+        for shift in (0..64).step_by(7) {
+            let byte = self.read_u8()?;
+            value |= u64::from(byte & 0x7f) << shift;
+            if byte & 0x80 == 0 {
+                return Ok(value);
+            }
+        }
+        Err(invalid_snapshot("snapshot varint is too long"))
+    }
+
+    fn read_u32(&mut self) -> Result<u32, RuntimeError> {
+        u32::try_from(self.read_varint()?)
+            .map_err(|_| invalid_snapshot("snapshot integer does not fit in 32 bits"))
+    }
+
+    fn read_len(&mut self) -> Result<usize, RuntimeError> {
+        let len = usize::try_from(self.read_varint()?).map_err(|_| Self::truncated())?;
+        // Every counted item takes at least one byte, which bounds preallocation on bad input.
+        if len > self.bytes.len() - self.position {
+            return Err(Self::truncated());
+        }
+        Ok(len)
+    }
+
+    fn read_str(&mut self) -> Result<&'a str, RuntimeError> {
+        let len = self.read_len()?;
+        std::str::from_utf8(self.read_bytes(len)?)
+            .map_err(|_| invalid_snapshot("snapshot string is not valid UTF-8"))
+    }
+
+    fn read_name(&mut self) -> Result<String, RuntimeError> {
+        let index = self.read_varint()?;
+        usize::try_from(index)
+            .ok()
+            .and_then(|index| self.strings.get(index))
+            .map(|name| name.to_string())
+            .ok_or_else(|| invalid_snapshot(format!("string table index {index} is out of range")))
+    }
+
+    fn read_preamble(
+        &mut self,
+        magic: &[u8; 4],
+        expected_version: u32,
+        kind: &str,
+    ) -> Result<(), RuntimeError> {
+        if self.bytes.get(..magic.len()) != Some(magic.as_slice()) {
+            return Err(invalid_snapshot(format!("input is not a component {kind}")));
+        }
+        self.position = magic.len();
+
+        let version = self.read_varint()?;
+        if version != u64::from(expected_version) {
+            return Err(invalid_snapshot(format!(
+                "unsupported {kind} version {version}, expected {expected_version}"
+            )));
+        }
+        Ok(())
+    }
+
+    fn read_header(&mut self) -> Result<SnapshotDocument, RuntimeError> {
+        let program_fingerprint = match self.read_u8()? {
+            0 => None,
+            FLAG_PROGRAM_FINGERPRINT => Some(self.read_u64()?),
+            flags => {
+                return Err(invalid_snapshot(format!(
+                    "unknown snapshot flags {flags:#x}"
+                )))
+            }
+        };
+        Ok(SnapshotDocument {
+            program_fingerprint,
+            component_module_id: self.read_u32()?,
+            component: self.read_str()?.to_string(),
+            props: BTreeMap::new(),
+            state: BTreeMap::new(),
+        })
+    }
+
+    fn read_string_table(&mut self) -> Result<(), RuntimeError> {
+        let len = self.read_len()?;
+        let strings = (0..len)
+            .map(|_| self.read_str())
+            .collect::<Result<Vec<_>, _>>()?;
+        self.strings = strings;
+        Ok(())
+    }
+
+    fn read_key(&mut self) -> Result<SnapshotKey, RuntimeError> {
+        match self.read_varint()? {
+            0 => Ok(SnapshotKey::Named(self.read_name()?)),
+            position => u32::try_from(position - 1)
+                .map(SnapshotKey::Field)
+                .map_err(|_| invalid_snapshot("snapshot field index does not fit in 32 bits")),
+        }
+    }
+
+    fn read_entries(&mut self) -> Result<BTreeMap<SnapshotKey, SerializedValue>, RuntimeError> {
+        let len = self.read_len()?;
+        let mut entries = BTreeMap::new();
+        for _ in 0..len {
+            let key = self.read_key()?;
+            let value = self.read_value(0)?;
+            entries.insert(key, value);
+        }
+        Ok(entries)
+    }
+
+    fn apply_changes(
+        &mut self,
+        entries: &mut BTreeMap<SnapshotKey, SerializedValue>,
+    ) -> Result<(), RuntimeError> {
+        let len = self.read_len()?;
+        for _ in 0..len {
+            let key = self.read_key()?;
+            match self.read_u8()? {
+                CHANGE_REMOVED => {
+                    entries.remove(&key);
+                }
+                CHANGE_SET => {
+                    let value = self.read_value(0)?;
+                    entries.insert(key, value);
+                }
+                other => {
+                    return Err(invalid_snapshot(format!(
+                        "unknown snapshot delta change {other}"
+                    )))
+                }
+            }
+        }
+        Ok(())
+    }
+
+    fn read_fields(
+        &mut self,
+        depth: usize,
+    ) -> Result<BTreeMap<String, SerializedValue>, RuntimeError> {
+        let len = self.read_len()?;
+        let mut fields = BTreeMap::new();
+        for _ in 0..len {
+            let name = self.read_name()?;
+            let value = self.read_value(depth + 1)?;
+            fields.insert(name, value);
+        }
+        Ok(fields)
+    }
+
+    fn read_value(&mut self, depth: usize) -> Result<SerializedValue, RuntimeError> {
+        if depth > MAX_VALUE_DEPTH {
+            return Err(invalid_snapshot("snapshot value nesting is too deep"));
+        }
+
+        match self.read_u8()? {
+            TAG_NULL => Ok(SerializedValue::Null),
+            TAG_FALSE => Ok(SerializedValue::Boolean(false)),
+            TAG_TRUE => Ok(SerializedValue::Boolean(true)),
+            TAG_INT32 => i32::try_from(unzigzag(self.read_varint()?))
+                .map(SerializedValue::Int32)
+                .map_err(|_| invalid_snapshot("snapshot int32 value is out of range")),
+            TAG_INT => Ok(SerializedValue::Int(unzigzag(self.read_varint()?))),
+            TAG_FLOAT32 => {
+                let bytes = self.read_bytes(4)?;
+                Ok(SerializedValue::Float32(f32::from_le_bytes(
+                    bytes.try_into().expect("four bytes"),
+                )))
+            }
+            TAG_FLOAT => Ok(SerializedValue::Float(f64::from_bits(self.read_u64()?))),
+            TAG_STRING => Ok(SerializedValue::String(self.read_str()?.to_string())),
+            TAG_ARRAY => {
+                let len = self.read_len()?;
+                let values = (0..len)
+                    .map(|_| self.read_value(depth + 1))
+                    .collect::<Result<Vec<_>, _>>()?;
+                Ok(SerializedValue::Array(values))
+            }
+            TAG_ENUM => Ok(SerializedValue::EnumValue {
+                type_name: self.read_name()?,
+                member: self.read_name()?,
+            }),
+            TAG_RECORD => Ok(SerializedValue::Record {
+                type_name: self.read_name()?,
+                fields: self.read_fields(depth)?,
+            }),
+            TAG_ACTION_HANDLER => Ok(SerializedValue::ActionHandler {
+                module_id: self.read_u32()?,
+                component: self.read_name()?,
+                emit: self.read_name()?,
+                action_name: self.read_name()?,
+                body: self.read_u32()?,
+                captured: self.read_fields(depth)?,
+            }),
+            tag => Err(invalid_snapshot(format!(
+                "unknown snapshot value tag {tag}"
+            ))),
+        }
+    }
+
+    fn finish(&self) -> Result<(), RuntimeError> {
+        if self.position != self.bytes.len() {
+            return Err(invalid_snapshot("snapshot image has trailing bytes"));
+        }
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn sample_document(count: i32) -> SnapshotDocument {
+        let schema = FieldSchema::new(["title", "onSave"]);
+        let mut props = BTreeMap::new();
+        props.insert(
+            schema.key("title"),
+            SerializedValue::String("Query text".to_string()),
+        );
+        props.insert(
+            schema.key("onSave"),
+            SerializedValue::ActionHandler {
+                module_id: 0,
+                component: "SearchBox".to_string(),
+                emit: "Save".to_string(),
+                action_name: "SearchBox.Save".to_string(),
+                body: 3,
+                captured: BTreeMap::new(),
+            },
+        );
+        props.insert(schema.key("extra"), SerializedValue::Null);
+
+        let mut fields = BTreeMap::new();
+        fields.insert("count".to_string(), SerializedValue::Int32(count));
+        fields.insert("ratio".to_string(), SerializedValue::Float(0.5));
+        let mut state = BTreeMap::new();
+        state.insert(
+            SnapshotKey::Field(0),
+            SerializedValue::Array(vec![
+                SerializedValue::Record {
+                    type_name: "Item".to_string(),
+                    fields: fields.clone(),
+                },
+                SerializedValue::Record {
+                    type_name: "Item".to_string(),
+                    fields,
+                },
+            ]),
+        );
+        state.insert(
+            SnapshotKey::Field(1),
+            SerializedValue::EnumValue {
+                type_name: "Mode".to_string(),
+                member: "Edit".to_string(),
+            },
+        );
+
+        SnapshotDocument {
+            program_fingerprint: Some(0xDEAD_BEEF),
+            component_module_id: 2,
+            component: "SearchBox".to_string(),
+            props,
+            state,
+        }
+    }
+
+    #[test]
+    fn snapshot_round_trips_and_interns_repeated_names() {
+        let document = sample_document(-7);
+        let bytes = encode_snapshot(&document);
+
+        assert_eq!(decode_snapshot(&bytes).expect("decode snapshot"), document);
+        let item_occurrences = bytes.windows(4).filter(|window| *window == b"Item").count();
+        assert_eq!(item_occurrences, 1);
+        assert!(!bytes.windows(5).any(|window| window == b"title"));
+    }
+
+    #[test]
+    fn snapshot_decode_rejects_corrupt_images() {
+        let bytes = encode_snapshot(&sample_document(1));
+
+        assert!(decode_snapshot(b"nope").is_err());
+        assert!(decode_snapshot(&bytes[..bytes.len() - 1]).is_err());
+
+        let mut trailing = bytes.clone();
+        trailing.push(0);
+        assert!(decode_snapshot(&trailing).is_err());
+
+        let mut wrong_version = bytes;
+        wrong_version[4] = (COMPONENT_SNAPSHOT_VERSION + 1) as u8;
+        let error = decode_snapshot(&wrong_version).expect_err("version mismatch");
+        assert!(error.to_string().contains("unsupported snapshot version"));
+    }
+
+    #[test]
+    fn snapshot_delta_carries_only_changed_entries() {
+        let previous = encode_snapshot(&sample_document(1));
+        let mut next_document = sample_document(2);
+        next_document
+            .props
+            .remove(&SnapshotKey::Named("extra".to_string()));
+        let next = encode_snapshot(&next_document);
+
+        let delta = component_snapshot_delta(&previous, &next).expect("compute delta");
+        assert!(!delta.windows(5).any(|window| window == b"Query"));
+        assert_eq!(
+            apply_component_snapshot_delta(&previous, &delta).expect("apply delta"),
+            next
+        );
+
+        let unchanged = component_snapshot_delta(&next, &next).expect("empty delta");
+        assert_eq!(
+            apply_component_snapshot_delta(&next, &unchanged).expect("apply empty delta"),
+            next
+        );
+
+        let error = apply_component_snapshot_delta(&next, &delta)
+            .expect_err("delta must match its base snapshot");
+        assert!(error.to_string().contains("different base snapshot"));
+
+        let mut old_format = delta.clone();
+        old_format[4] = 2;
+        let error = apply_component_snapshot_delta(&previous, &old_format)
+            .expect_err("deltas from older digest formats must be rejected");
+        assert!(error
+            .to_string()
+            .contains("unsupported snapshot delta version 2"));
+    }
+
+    #[test]
+    fn snapshot_digest_is_stable_xxh3() {
+        // Deltas cross process and platform boundaries, so the digest must never depend on a
+        // per-process or per-toolchain hasher.
+        assert_eq!(snapshot_digest(b""), 0x2d06_8005_38d3_94c2);
+        assert_eq!(snapshot_digest(b"NXSS"), 0x8af4_a1e7_17e4_2916);
+    }
+
+    #[test]
+    fn field_schema_keys_declared_fields_by_position() {
+        let schema = FieldSchema::new(["a", "b", "a"]);
+        assert_eq!(schema.key("b"), SnapshotKey::Field(1));
+        assert_eq!(schema.key("c"), SnapshotKey::Named("c".to_string()));
+        assert_eq!(schema.name(&SnapshotKey::Field(0)).unwrap(), "a");
+        assert!(schema.name(&SnapshotKey::Field(2)).is_err());
+    }
+}
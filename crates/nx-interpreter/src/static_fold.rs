@@ -0,0 +1,167 @@
+//! Detection of static markup that can be rendered once at build time.
+//!
+//! An element is static when it is plain markup, meaning its tag does not name a function,
+//! component, or type, all of its properties are unconditional, and every property value and
+//! content expression is itself static: a literal, an array or operator over static operands, or
+//! another static element. Nothing in such a subtree reads a variable or calls into program code,
+//! so it renders to the same value on every evaluation and folding it runs no user code at build
+//! time. [`ResolvedProgram::fold_static_elements`] renders each outermost
+//! static element once, and the interpreter hands out clones of that value, which share their
+//! field and array storage, instead of rebuilding the record tree.
+//!
+//! Folded elements are kept as values, not as pre-encoded output bytes. A folded element is
+//! usually one child of a larger rendered tree, and `nx_api::NxValueView` streams that tree
+//! through a generic serde `Serializer` so a single walk serves both MessagePack and JSON. Serde
+//! has no way to splice already-encoded bytes into an arbitrary serializer. The value form is
+//! needed regardless, because folded elements also flow into member access, comparisons, and
+//! host conversions like any other value.
+//!
+//! [`ResolvedProgram::fold_static_elements`]: crate::ResolvedProgram::fold_static_elements
+
+use nx_hir::{ast, ExprId, LoweredModule, PropertyEntry};
+use rustc_hash::{FxHashMap, FxHashSet};
+
+/// Returns the static element expressions in `module` that are not nested inside another static
+/// element, in allocation order.
+///
+/// `is_markup_tag` reports whether an element tag is plain markup rather than a name that resolves
+/// to a program item.
+pub(crate) fn static_element_roots(
+    module: &LoweredModule,
+    is_markup_tag: &dyn Fn(&str) -> bool,
+) -> Vec<ExprId> {
+    let mut memo = FxHashMap::default();
+    let static_elements = module
+        .exprs()
+        .filter(|(_, expr)| matches!(expr, ast::Expr::Element { .. }))
+        .map(|(expr_id, _)| expr_id)
+        .filter(|expr_id| is_static_expr(module, is_markup_tag, *expr_id, &mut memo))
+        .collect::<Vec<_>>();
+
+    let mut nested = FxHashSet::default();
+    let mut pending = static_elements
+        .iter()
+        .flat_map(|expr_id| static_operands(module, *expr_id))
+        .collect::<Vec<_>>();
+    while let Some(expr_id) = pending.pop() {
+        if nested.insert(expr_id) {
+            pending.extend(static_operands(module, expr_id));
+        }
+    }
+
+    static_elements
+        .into_iter()
+        .filter(|expr_id| !nested.contains(expr_id))
+        .collect()
+}
+
+fn is_static_expr(
+    module: &LoweredModule,
+    is_markup_tag: &dyn Fn(&str) -> bool,
+    expr_id: ExprId,
+    memo: &mut FxHashMap<ExprId, bool>,
+) -> bool {
+    if let Some(is_static) = memo.get(&expr_id) {
+        return *is_static;
+    }
+
+    let is_static = match module.expr(expr_id) {
+        ast::Expr::Literal(_) => true,
+        ast::Expr::Element { element, .. } => {
+            let element = module.element(*element);
+            is_markup_tag(element.tag.as_str())
+                && element
+                    .property_entries()
+                    .iter()
+                    .all(|entry| matches!(entry, PropertyEntry::Value(_)))
+                && static_operands(module, expr_id)
+                    .into_iter()
+                    .all(|operand| is_static_expr(module, is_markup_tag, operand, memo))
+        }
+        ast::Expr::Array { .. } | ast::Expr::BinaryOp { .. } | ast::Expr::UnaryOp { .. } => {
+            static_operands(module, expr_id)
+                .into_iter()
+                .all(|operand| is_static_expr(module, is_markup_tag, operand, memo))
+        }
+        _ => false,
+    };
+    memo.insert(expr_id, is_static);
+    is_static
+}
+
+/// Returns the sub-expressions of an expression kind that can be static.
+fn static_operands(module: &LoweredModule, expr_id: ExprId) -> Vec<ExprId> {
+    match module.expr(expr_id) {
+        ast::Expr::Element { element, .. } => {
+            let element = module.element(*element);
+            element
+                .property_entries()
+                .iter()
+                .filter_map(|entry| match entry {
+                    PropertyEntry::Value(property) => Some(property.value),
+                    _ => None,
+                })
+                .chain(element.content.iter().copied())
+                .collect()
+        }
+        ast::Expr::Array { elements, .. } => elements.clone(),
+        ast::Expr::BinaryOp { lhs, rhs, .. } => vec![*lhs, *rhs],
+        ast::Expr::UnaryOp { expr, .. } => vec![*expr],
+        _ => Vec::new(),
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use nx_hir::lower_source_module;
+
+    fn element_tags(module: &LoweredModule, roots: &[ExprId]) -> Vec<String> {
+        roots
+            .iter()
+            .map(|expr_id| match module.expr(*expr_id) {
+                ast::Expr::Element { element, .. } => {
+                    module.element(*element).tag.as_str().to_string()
+                }
+                other => panic!("Expected an element root, got {other:?}"),
+            })
+            .collect()
+    }
+
+    #[test]
+    fn static_element_roots_skip_nested_and_dynamic_markup() {
+        let module = lower_source_module(
+            r#"
+                let header() = { <header><h1 level={1 + 1} /><span:>Docs</span></header> }
+                let greeting(name:string) = { <p><b:>Hello</b>{name}</p> }
+            "#,
+            "static-fold.nx",
+        )
+        .expect("Expected module to lower");
+
+        let mut tags = element_tags(&module, &static_element_roots(&module, &|_| true));
+        tags.sort();
+
+        assert_eq!(tags, vec!["b", "header"]);
+    }
+
+    #[test]
+    fn static_element_roots_skip_markup_that_calls_program_items() {
+        let module = lower_source_module(
+            r#"
+                let <Badge /> = { <em:>New</em> }
+                let header() = { <header><Badge /><span:>Docs</span></header> }
+            "#,
+            "static-fold-calls.nx",
+        )
+        .expect("Expected module to lower");
+
+        let mut tags = element_tags(
+            &module,
+            &static_element_roots(&module, &|tag| tag != "Badge"),
+        );
+        tags.sort();
+
+        assert_eq!(tags, vec!["em", "span"]);
+    }
+}
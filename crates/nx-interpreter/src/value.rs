@@ -1,9 +1,16 @@
 //! Runtime value representation for the NX interpreter.
 
+use crate::record::RecordFields;
 use crate::RuntimeModuleId;
 use nx_hir::Name;
-use rustc_hash::FxHashMap;
 use smol_str::SmolStr;
+use std::sync::Arc;
+
+/// Shared storage for array elements.
+///
+/// Cloning a value only bumps a reference count. Code that needs owned elements goes through
+/// [`Arc::unwrap_or_clone`] or [`Arc::make_mut`], which copy only while the storage is shared.
+pub type ArrayElements = Arc<Vec<Value>>;
 
 /// Runtime value types supported by the NX interpreter
 ///
@@ -22,7 +29,7 @@ use smol_str::SmolStr;
 /// let string_val = Value::String(SmolStr::new("hello"));
 /// let bool_val = Value::Boolean(true);
 /// let null_val = Value::Null;
-/// let array_val = Value::Array(vec![Value::Int(1), Value::Int(2)]);
+/// let array_val = Value::Array(vec![Value::Int(1), Value::Int(2)].into());
 /// ```
 #[derive(Debug, Clone, PartialEq)]
 pub enum Value {
@@ -60,7 +67,7 @@ pub enum Value {
     /// Array of values
     ///
     /// Represents a collection of values, used for iteration and collections
-    Array(Vec<Value>),
+    Array(ArrayElements),
 
     /// Enum value
     ///
@@ -69,7 +76,7 @@ pub enum Value {
         /// Enum type name
         type_name: Name,
         /// Member name
-        member: SmolStr,
+        member: Name,
     },
 
     /// Record value (always typed).
@@ -79,7 +86,7 @@ pub enum Value {
         /// The record/element type name (e.g., "User", "Button").
         type_name: Name,
         /// Field values.
-        fields: FxHashMap<SmolStr, Value>,
+        fields: RecordFields,
     },
 
     /// Lazy component action handler callback with captured lexical values.
@@ -95,7 +102,7 @@ pub enum Value {
         /// Lowered handler body expression
         body: nx_hir::ExprId,
         /// Captured lexical variables from the handler definition site
-        captured: FxHashMap<SmolStr, Value>,
+        captured: RecordFields,
     },
 }
 
@@ -203,6 +210,7 @@ impl std::fmt::Display for Value {
 #[cfg(test)]
 mod tests {
     use super::*;
+    use rustc_hash::FxHashMap;
 
     #[test]
     fn test_value_types() {
@@ -245,7 +253,7 @@ mod tests {
         assert_eq!(
             Value::EnumValue {
                 type_name: Name::new("Status"),
-                member: SmolStr::new("active")
+                member: Name::new("active")
             }
             .to_string(),
             "Status.active"
@@ -256,13 +264,43 @@ mod tests {
         fields.insert(SmolStr::new("age"), Value::Int(42));
         let display = Value::Record {
             type_name: Name::new("result"),
-            fields,
+            fields: fields.into(),
         }
         .to_string();
         assert!(display.contains("age: 42"));
         assert!(display.contains("name: Ada"));
     }
 
+    #[test]
+    fn test_compound_clones_share_storage() {
+        let array = Value::Array(vec![Value::Int(1), Value::Int(2)].into());
+        let copy = array.clone();
+        let (Value::Array(original), Value::Array(copied)) = (&array, &copy) else {
+            panic!("Expected array values");
+        };
+        assert!(Arc::ptr_eq(original, copied));
+
+        let mut fields = FxHashMap::default();
+        fields.insert(SmolStr::new("name"), Value::String(SmolStr::new("Ada")));
+        let record = Value::Record {
+            type_name: Name::new("User"),
+            fields: fields.into(),
+        };
+        let Value::Record { mut fields, .. } = record.clone() else {
+            panic!("Expected record value");
+        };
+        fields.insert(SmolStr::new("age"), Value::Int(42));
+
+        let Value::Record {
+            fields: original, ..
+        } = &record
+        else {
+            panic!("Expected record value");
+        };
+        assert_eq!(original.len(), 1);
+        assert_eq!(fields.len(), 2);
+    }
+
     #[test]
     fn test_type_names() {
         assert_eq!(Value::Int32(42).type_name(), "i32");
@@ -275,7 +313,7 @@ mod tests {
         assert_eq!(
             Value::Record {
                 type_name: Name::new("result"),
-                fields: FxHashMap::default(),
+                fields: RecordFields::default(),
             }
             .type_name(),
             "record"
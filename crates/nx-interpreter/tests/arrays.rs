@@ -43,7 +43,7 @@ fn test_array_literal_integers() {
     let result = execute_function(source, "arr", vec![]).unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)])
+        Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)].into())
     );
 }
 
@@ -55,7 +55,7 @@ fn test_array_literal_single_element() {
     "#;
 
     let result = execute_function(source, "arr", vec![]).unwrap_or_else(|e| panic!("{}", e));
-    assert_eq!(result, Value::Array(vec![Value::Int(42)]));
+    assert_eq!(result, Value::Array(vec![Value::Int(42)].into()));
 }
 
 #[test]
@@ -68,10 +68,13 @@ fn test_array_literal_strings() {
     let result = execute_function(source, "arr", vec![]).unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![
-            Value::String(SmolStr::new("hello")),
-            Value::String(SmolStr::new("world"))
-        ])
+        Value::Array(
+            vec![
+                Value::String(SmolStr::new("hello")),
+                Value::String(SmolStr::new("world"))
+            ]
+            .into()
+        )
     );
 }
 
@@ -85,11 +88,14 @@ fn test_array_literal_booleans() {
     let result = execute_function(source, "arr", vec![]).unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![
-            Value::Boolean(true),
-            Value::Boolean(false),
-            Value::Boolean(true)
-        ])
+        Value::Array(
+            vec![
+                Value::Boolean(true),
+                Value::Boolean(false),
+                Value::Boolean(true)
+            ]
+            .into()
+        )
     );
 }
 
@@ -129,7 +135,7 @@ fn test_empty_array() {
     "#;
 
     let result = execute_function(source, "arr", vec![]).unwrap_or_else(|e| panic!("{}", e));
-    assert_eq!(result, Value::Array(vec![]));
+    assert_eq!(result, Value::Array(vec![].into()));
 }
 
 // ============================================================================
@@ -146,10 +152,13 @@ fn test_nested_array_simple() {
     let result = execute_function(source, "arr", vec![]).unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![
-            Value::Array(vec![Value::Int(1), Value::Int(2)]),
-            Value::Array(vec![Value::Int(3), Value::Int(4)])
-        ])
+        Value::Array(
+            vec![
+                Value::Array(vec![Value::Int(1), Value::Int(2)].into()),
+                Value::Array(vec![Value::Int(3), Value::Int(4)].into())
+            ]
+            .into()
+        )
     );
 }
 
@@ -163,11 +172,14 @@ fn test_nested_array_mixed_sizes() {
     let result = execute_function(source, "arr", vec![]).unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![
-            Value::Array(vec![Value::Int(1)]),
-            Value::Array(vec![Value::Int(2), Value::Int(3)]),
-            Value::Array(vec![Value::Int(4), Value::Int(5), Value::Int(6)])
-        ])
+        Value::Array(
+            vec![
+                Value::Array(vec![Value::Int(1)].into()),
+                Value::Array(vec![Value::Int(2), Value::Int(3)].into()),
+                Value::Array(vec![Value::Int(4), Value::Int(5), Value::Int(6)].into())
+            ]
+            .into()
+        )
     );
 }
 
@@ -181,7 +193,12 @@ fn test_deeply_nested_array() {
     let result = execute_function(source, "arr", vec![]).unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![Value::Array(vec![Value::Array(vec![Value::Int(1)])])])
+        Value::Array(
+            vec![Value::Array(
+                vec![Value::Array(vec![Value::Int(1)].into())].into()
+            )]
+            .into()
+        )
     );
 }
 
@@ -200,7 +217,7 @@ fn test_array_with_expressions() {
         .unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(3), Value::Int(5), Value::Int(8)])
+        Value::Array(vec![Value::Int(3), Value::Int(5), Value::Int(8)].into())
     );
 }
 
@@ -216,7 +233,7 @@ fn test_array_with_function_calls() {
         execute_function(source, "arr", vec![Value::Int(2)]).unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(2), Value::Int(4), Value::Int(8)])
+        Value::Array(vec![Value::Int(2), Value::Int(4), Value::Int(8)].into())
     );
 }
 
@@ -232,12 +249,12 @@ fn test_array_as_argument() {
         }
     "#;
 
-    let arr = Value::Array(vec![Value::Int(10), Value::Int(20), Value::Int(30)]);
+    let arr = Value::Array(vec![Value::Int(10), Value::Int(20), Value::Int(30)].into());
     let result = execute_function(source, "first", vec![arr]).unwrap_or_else(|e| panic!("{}", e));
     // For loop returns an array of results
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(10), Value::Int(20), Value::Int(30)])
+        Value::Array(vec![Value::Int(10), Value::Int(20), Value::Int(30)].into())
     );
 }
 
@@ -249,20 +266,26 @@ fn test_array_of_strings_as_argument() {
         }
     "#;
 
-    let arr = Value::Array(vec![
-        Value::String(SmolStr::new("a")),
-        Value::String(SmolStr::new("b")),
-        Value::String(SmolStr::new("c")),
-    ]);
+    let arr = Value::Array(
+        vec![
+            Value::String(SmolStr::new("a")),
+            Value::String(SmolStr::new("b")),
+            Value::String(SmolStr::new("c")),
+        ]
+        .into(),
+    );
     let result =
         execute_function(source, "identity", vec![arr]).unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![
-            Value::String(SmolStr::new("a")),
-            Value::String(SmolStr::new("b")),
-            Value::String(SmolStr::new("c"))
-        ])
+        Value::Array(
+            vec![
+                Value::String(SmolStr::new("a")),
+                Value::String(SmolStr::new("b")),
+                Value::String(SmolStr::new("c"))
+            ]
+            .into()
+        )
     );
 }
 
@@ -284,23 +307,29 @@ fn test_array_of_records() {
     let mut user2 = FxHashMap::default();
     user2.insert(SmolStr::new("name"), Value::String(SmolStr::new("Bob")));
 
-    let users = Value::Array(vec![
-        Value::Record {
-            type_name: nx_hir::Name::new("User"),
-            fields: user1,
-        },
-        Value::Record {
-            type_name: nx_hir::Name::new("User"),
-            fields: user2,
-        },
-    ]);
+    let users = Value::Array(
+        vec![
+            Value::Record {
+                type_name: nx_hir::Name::new("User"),
+                fields: user1.into(),
+            },
+            Value::Record {
+                type_name: nx_hir::Name::new("User"),
+                fields: user2.into(),
+            },
+        ]
+        .into(),
+    );
     let result = execute_function(source, "names", vec![users]).unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![
-            Value::String(SmolStr::new("Alice")),
-            Value::String(SmolStr::new("Bob"))
-        ])
+        Value::Array(
+            vec![
+                Value::String(SmolStr::new("Alice")),
+                Value::String(SmolStr::new("Bob"))
+            ]
+            .into()
+        )
     );
 }
 
@@ -316,11 +345,11 @@ fn test_transform_array() {
         }
     "#;
 
-    let arr = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)]);
+    let arr = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)].into());
     let result = execute_function(source, "doubled", vec![arr]).unwrap_or_else(|e| panic!("{}", e));
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(2), Value::Int(4), Value::Int(6)])
+        Value::Array(vec![Value::Int(2), Value::Int(4), Value::Int(6)].into())
     );
 }
 
@@ -163,7 +163,7 @@ fn test_property_fragment_match_selects_matching_arm() {
         "view",
         vec![Value::Record {
             type_name: nx_hir::Name::new("LoadState.failed"),
-            fields,
+            fields: fields.into(),
         }],
     )
     .unwrap_or_else(|e| panic!("{}", e));
@@ -487,7 +487,7 @@ fn test_undefined_record_field() {
         "age",
         vec![Value::Record {
             type_name: nx_hir::Name::new("Person"),
-            fields: person,
+            fields: person.into(),
         }],
     );
     // Should error because 'age' field doesn't exist
@@ -497,7 +497,7 @@ fn test_undefined_record_field() {
 /// Test empty record
 #[test]
 fn test_empty_record() {
-    use rustc_hash::FxHashMap;
+    use nx_interpreter::RecordFields;
 
     let source = r#"
         let <identity r:object /> = { r }
@@ -505,7 +505,7 @@ fn test_empty_record() {
 
     let empty_record = Value::Record {
         type_name: nx_hir::Name::new("object"),
-        fields: FxHashMap::default(),
+        fields: RecordFields::default(),
     };
     let result = execute_function(source, "identity", vec![empty_record])
         .unwrap_or_else(|e| panic!("{}", e));
@@ -6,8 +6,9 @@
 use nx_diagnostics::{TextSize, TextSpan};
 use nx_hir::ast::{BinOp, Expr, Literal};
 use nx_hir::{lower, Function, Item, LoweredModule, Name, Param, SourceId};
-use nx_interpreter::{Interpreter, RuntimeErrorKind, Value};
+use nx_interpreter::{CancellationToken, Interpreter, ResourceLimits, RuntimeErrorKind, Value};
 use nx_syntax::parse_str;
+use std::time::Duration;
 
 /// Helper to create a text span
 fn span(start: u32, end: u32) -> TextSpan {
@@ -200,3 +201,56 @@ fn test_enum_not_found_runtime_error() {
         other => panic!("Expected EnumNotFound, got {:?}", other),
     }
 }
+
+/// Doubles its work at every level, so `spin(40)` runs far past any test deadline.
+const RUNAWAY_SOURCE: &str =
+    "let spin(n:int): int = { if n <= 0 { 0 } else { spin(n - 1) + spin(n - 1) } }";
+
+fn unbounded_operations() -> ResourceLimits {
+    ResourceLimits {
+        max_operations: usize::MAX,
+        ..ResourceLimits::default()
+    }
+}
+
+#[test]
+fn test_deadline_exceeded_stops_runaway_evaluation() {
+    let module = module_from_source(RUNAWAY_SOURCE);
+    let interpreter = Interpreter::new();
+    let limits = ResourceLimits {
+        max_duration: Some(Duration::from_millis(20)),
+        ..unbounded_operations()
+    };
+
+    let err = interpreter
+        .execute_function_with_limits(&module, "spin", vec![Value::Int(40)], limits)
+        .expect_err("Runaway evaluation should hit its deadline");
+
+    assert_eq!(
+        err.kind(),
+        &RuntimeErrorKind::DeadlineExceeded {
+            limit: Duration::from_millis(20)
+        }
+    );
+}
+
+#[test]
+fn test_cancelled_token_stops_evaluation_from_another_thread() {
+    let module = module_from_source(RUNAWAY_SOURCE);
+    let token = CancellationToken::new();
+    let limits = ResourceLimits {
+        cancellation: Some(token.clone()),
+        ..unbounded_operations()
+    };
+
+    let canceller = std::thread::spawn(move || {
+        std::thread::sleep(Duration::from_millis(10));
+        token.cancel();
+    });
+    let err = Interpreter::new()
+        .execute_function_with_limits(&module, "spin", vec![Value::Int(40)], limits)
+        .expect_err("Cancelled evaluation should fail");
+    canceller.join().expect("canceller thread should finish");
+
+    assert_eq!(err.kind(), &RuntimeErrorKind::Cancelled);
+}
@@ -78,14 +78,14 @@ fn test_for_loop_simple() {
 
     // Test with array [1, 2, 3]
     let interpreter = Interpreter::new();
-    let input = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)]);
+    let input = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)].into());
     let result = interpreter
         .execute_function(&module, "double_all", vec![input])
         .unwrap();
 
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(2), Value::Int(4), Value::Int(6)])
+        Value::Array(vec![Value::Int(2), Value::Int(4), Value::Int(6)].into())
     );
 }
 
@@ -135,14 +135,14 @@ fn test_for_loop_with_index() {
 
     // Test: [10, 20, 30] -> [10+0, 20+1, 30+2] = [10, 21, 32]
     let interpreter = Interpreter::new();
-    let input = Value::Array(vec![Value::Int(10), Value::Int(20), Value::Int(30)]);
+    let input = Value::Array(vec![Value::Int(10), Value::Int(20), Value::Int(30)].into());
     let result = interpreter
         .execute_function(&module, "add_index", vec![input])
         .unwrap();
 
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(10), Value::Int(21), Value::Int(32)])
+        Value::Array(vec![Value::Int(10), Value::Int(21), Value::Int(32)].into())
     );
 }
 
@@ -186,14 +186,14 @@ fn test_nested_for_loops() {
     module.add_item(Item::Function(func));
 
     let interpreter = Interpreter::new();
-    let input = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)]);
+    let input = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)].into());
     let result = interpreter
         .execute_function(&module, "identity", vec![input])
         .unwrap();
 
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)])
+        Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)].into())
     );
 }
 
@@ -232,12 +232,12 @@ fn test_for_loop_empty_array() {
 
     // Test with empty array
     let interpreter = Interpreter::new();
-    let input = Value::Array(vec![]);
+    let input = Value::Array(vec![].into());
     let result = interpreter
         .execute_function(&module, "process", vec![input])
         .unwrap();
 
-    assert_eq!(result, Value::Array(vec![]));
+    assert_eq!(result, Value::Array(vec![].into()));
 }
 
 /// T051: Test for loop with type error (non-array iterable)
@@ -298,21 +298,27 @@ fn test_for_loop_string_array() {
         }
     "#;
 
-    let input = Value::Array(vec![
-        Value::String(SmolStr::new("hello")),
-        Value::String(SmolStr::new("world")),
-        Value::String(SmolStr::new("!")),
-    ]);
+    let input = Value::Array(
+        vec![
+            Value::String(SmolStr::new("hello")),
+            Value::String(SmolStr::new("world")),
+            Value::String(SmolStr::new("!")),
+        ]
+        .into(),
+    );
     let result =
         execute_function(source, "process", vec![input]).unwrap_or_else(|e| panic!("{}", e));
 
     assert_eq!(
         result,
-        Value::Array(vec![
-            Value::String(SmolStr::new("hello")),
-            Value::String(SmolStr::new("world")),
-            Value::String(SmolStr::new("!")),
-        ])
+        Value::Array(
+            vec![
+                Value::String(SmolStr::new("hello")),
+                Value::String(SmolStr::new("world")),
+                Value::String(SmolStr::new("!")),
+            ]
+            .into()
+        )
     );
 }
 
@@ -334,24 +340,30 @@ fn test_for_loop_record_array() {
     person2.insert(SmolStr::new("name"), Value::String(SmolStr::new("Bob")));
     person2.insert(SmolStr::new("age"), Value::Int(25));
 
-    let input = Value::Array(vec![
-        Value::Record {
-            type_name: nx_hir::Name::new("Person"),
-            fields: person1,
-        },
-        Value::Record {
-            type_name: nx_hir::Name::new("Person"),
-            fields: person2,
-        },
-    ]);
+    let input = Value::Array(
+        vec![
+            Value::Record {
+                type_name: nx_hir::Name::new("Person"),
+                fields: person1.into(),
+            },
+            Value::Record {
+                type_name: nx_hir::Name::new("Person"),
+                fields: person2.into(),
+            },
+        ]
+        .into(),
+    );
     let result = execute_function(source, "names", vec![input]).unwrap_or_else(|e| panic!("{}", e));
 
     assert_eq!(
         result,
-        Value::Array(vec![
-            Value::String(SmolStr::new("Alice")),
-            Value::String(SmolStr::new("Bob")),
-        ])
+        Value::Array(
+            vec![
+                Value::String(SmolStr::new("Alice")),
+                Value::String(SmolStr::new("Bob")),
+            ]
+            .into()
+        )
     );
 }
 
@@ -400,14 +412,14 @@ fn test_for_loop_index_arithmetic() {
 
     // Input: [10, 20, 30] -> indices [0, 1, 2] * 2 = [0, 2, 4]
     let interpreter = Interpreter::new();
-    let input = Value::Array(vec![Value::Int(10), Value::Int(20), Value::Int(30)]);
+    let input = Value::Array(vec![Value::Int(10), Value::Int(20), Value::Int(30)].into());
     let result = interpreter
         .execute_function(&module, "index_times_two", vec![input])
         .unwrap();
 
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(0), Value::Int(2), Value::Int(4)])
+        Value::Array(vec![Value::Int(0), Value::Int(2), Value::Int(4)].into())
     );
 }
 
@@ -420,14 +432,14 @@ fn test_for_loop_item_plus_index() {
         }
     "#;
 
-    let input = Value::Array(vec![Value::Int(100), Value::Int(200), Value::Int(300)]);
+    let input = Value::Array(vec![Value::Int(100), Value::Int(200), Value::Int(300)].into());
     let result =
         execute_function(source, "add_index", vec![input]).unwrap_or_else(|e| panic!("{}", e));
 
     // 100+0=100, 200+1=201, 300+2=302
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(100), Value::Int(201), Value::Int(302)])
+        Value::Array(vec![Value::Int(100), Value::Int(201), Value::Int(302)].into())
     );
 }
 
@@ -440,13 +452,13 @@ fn test_for_loop_multiply() {
         }
     "#;
 
-    let input = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(5)]);
+    let input = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(5)].into());
     let result =
         execute_function(source, "triple", vec![input]).unwrap_or_else(|e| panic!("{}", e));
 
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(3), Value::Int(6), Value::Int(15)])
+        Value::Array(vec![Value::Int(3), Value::Int(6), Value::Int(15)].into())
     );
 }
 
@@ -459,13 +471,13 @@ fn test_for_loop_subtract() {
         }
     "#;
 
-    let input = Value::Array(vec![Value::Int(10), Value::Int(5), Value::Int(1)]);
+    let input = Value::Array(vec![Value::Int(10), Value::Int(5), Value::Int(1)].into());
     let result =
         execute_function(source, "decrement", vec![input]).unwrap_or_else(|e| panic!("{}", e));
 
     assert_eq!(
         result,
-        Value::Array(vec![Value::Int(9), Value::Int(4), Value::Int(0)])
+        Value::Array(vec![Value::Int(9), Value::Int(4), Value::Int(0)].into())
     );
 }
 
@@ -478,21 +490,27 @@ fn test_for_loop_boolean_array() {
         }
     "#;
 
-    let input = Value::Array(vec![
-        Value::Boolean(true),
-        Value::Boolean(false),
-        Value::Boolean(true),
-    ]);
+    let input = Value::Array(
+        vec![
+            Value::Boolean(true),
+            Value::Boolean(false),
+            Value::Boolean(true),
+        ]
+        .into(),
+    );
     let result =
         execute_function(source, "identity", vec![input]).unwrap_or_else(|e| panic!("{}", e));
 
     assert_eq!(
         result,
-        Value::Array(vec![
-            Value::Boolean(true),
-            Value::Boolean(false),
-            Value::Boolean(true),
-        ])
+        Value::Array(
+            vec![
+                Value::Boolean(true),
+                Value::Boolean(false),
+                Value::Boolean(true),
+            ]
+            .into()
+        )
     );
 }
 
@@ -540,11 +558,7 @@ fn test_for_loop_float_array() {
     module.add_item(Item::Function(func));
 
     let interpreter = Interpreter::new();
-    let input = Value::Array(vec![
-        Value::Float(1.5),
-        Value::Float(2.5),
-        Value::Float(3.5),
-    ]);
+    let input = Value::Array(vec![Value::Float(1.5), Value::Float(2.5), Value::Float(3.5)].into());
     let result = interpreter
         .execute_function(&module, "double_floats", vec![input])
         .unwrap();
@@ -574,11 +588,11 @@ fn test_for_loop_single_element() {
         }
     "#;
 
-    let input = Value::Array(vec![Value::Int(42)]);
+    let input = Value::Array(vec![Value::Int(42)].into());
     let result =
         execute_function(source, "double", vec![input]).unwrap_or_else(|e| panic!("{}", e));
 
-    assert_eq!(result, Value::Array(vec![Value::Int(84)]));
+    assert_eq!(result, Value::Array(vec![Value::Int(84)].into()));
 }
 
 /// Test for loop preserves order
@@ -590,24 +604,30 @@ fn test_for_loop_preserves_order() {
         }
     "#;
 
-    let input = Value::Array(vec![
-        Value::Int(5),
-        Value::Int(3),
-        Value::Int(8),
-        Value::Int(1),
-        Value::Int(9),
-    ]);
-    let result =
-        execute_function(source, "identity", vec![input]).unwrap_or_else(|e| panic!("{}", e));
-
-    assert_eq!(
-        result,
-        Value::Array(vec![
+    let input = Value::Array(
+        vec![
             Value::Int(5),
             Value::Int(3),
             Value::Int(8),
             Value::Int(1),
             Value::Int(9),
-        ])
+        ]
+        .into(),
+    );
+    let result =
+        execute_function(source, "identity", vec![input]).unwrap_or_else(|e| panic!("{}", e));
+
+    assert_eq!(
+        result,
+        Value::Array(
+            vec![
+                Value::Int(5),
+                Value::Int(3),
+                Value::Int(8),
+                Value::Int(1),
+                Value::Int(9),
+            ]
+            .into()
+        )
     );
 }
@@ -256,6 +256,7 @@ fn test_recursion_depth_limit() {
     let limits = ResourceLimits {
         max_operations: 1_000_000,
         max_recursion_depth: 10,
+        ..ResourceLimits::default()
     };
 
     let result =
@@ -335,6 +336,7 @@ fn test_deep_recursion_within_limit() {
     let limits = ResourceLimits {
         max_operations: 1_000_000,
         max_recursion_depth: 100,
+        ..ResourceLimits::default()
     };
 
     // Test with 50 (within limit)
@@ -352,3 +354,32 @@ fn test_deep_recursion_within_limit() {
     );
     assert!(result.is_err());
 }
+
+/// Test that an interpreter reports the work and call depth of its calls
+#[test]
+fn test_evaluation_stats_track_operations_and_peak_depth() {
+    let module = nx_hir::lower_source_module(
+        "let fact(n:int): int = { if n <= 1 { 1 } else { n * fact(n - 1) } }",
+        "fact.nx",
+    )
+    .expect("Expected factorial module to lower");
+    let interpreter = Interpreter::new();
+
+    let shallow = interpreter
+        .execute_function(&module, "fact", vec![Value::Int(2)])
+        .unwrap();
+    let deep = interpreter
+        .execute_function(&module, "fact", vec![Value::Int(5)])
+        .unwrap();
+    assert_eq!((shallow, deep), (Value::Int(2), Value::Int(120)));
+
+    // The entry call runs without a frame of its own, so fact(5) nests four recursive frames.
+    let stats = interpreter.take_evaluation_stats();
+    assert_eq!(stats.evaluations, 2);
+    assert_eq!(stats.peak_call_depth, 4);
+    assert!(stats.operations > 0);
+    assert_eq!(
+        interpreter.take_evaluation_stats(),
+        nx_interpreter::EvaluationStats::default()
+    );
+}
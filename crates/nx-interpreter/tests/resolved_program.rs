@@ -1,7 +1,8 @@
 use nx_hir::{lower_source_module, LoweredModule, Name};
 use nx_interpreter::{
-    Interpreter, ModuleQualifiedItemRef, ResolvedItemKind, ResolvedModule, ResolvedModuleSource,
-    ResolvedProgram, RuntimeErrorKind, RuntimeModuleId, Value,
+    Interpreter, ModuleQualifiedItemRef, RecordFields, ResolvedItemKind, ResolvedModule,
+    ResolvedModuleSource, ResolvedProgram, ResourceLimits, RuntimeErrorKind, RuntimeModuleId,
+    Value,
 };
 use rustc_hash::FxHashMap;
 use smol_str::SmolStr;
@@ -66,7 +67,7 @@ fn item_ref(
 fn empty_record() -> Value {
     Value::Record {
         type_name: Name::new("object"),
-        fields: FxHashMap::default(),
+        fields: RecordFields::default(),
     }
 }
 
@@ -266,7 +267,7 @@ fn resolved_program_executes_cross_module_entries_and_module_qualified_handlers(
             handler,
             Value::Record {
                 type_name: Name::new("SearchSubmitted"),
-                fields: action_fields,
+                fields: action_fields.into(),
             },
         )
         .expect("Expected imported action handler to round-trip");
@@ -288,6 +289,202 @@ fn resolved_program_executes_cross_module_entries_and_module_qualified_handlers(
     }
 }
 
+#[test]
+fn prelinked_resolved_program_matches_lazily_prepared_program() {
+    let (lazy_program, _, _) = build_resolved_program(0xCAFE_BABE);
+    let mut prelinked_program = lazy_program.clone();
+    prelinked_program.prelink_modules();
+    assert!(!lazy_program.is_prelinked());
+    assert!(prelinked_program.is_prelinked());
+    for module in prelinked_program.modules() {
+        assert!(prelinked_program.prelinked_module(module.id).is_some());
+    }
+
+    let lazy = Interpreter::from_resolved_program(lazy_program);
+    let prelinked = Interpreter::from_resolved_program(prelinked_program);
+    assert_eq!(
+        prelinked
+            .execute_resolved_program_function("root", vec![])
+            .expect("Expected prelinked root evaluation to succeed"),
+        lazy.execute_resolved_program_function("root", vec![])
+            .expect("Expected lazy root evaluation to succeed")
+    );
+    assert_eq!(
+        prelinked
+            .initialize_resolved_component("LibrarySearchBox", empty_record())
+            .expect("Expected prelinked component initialization to succeed")
+            .rendered,
+        lazy.initialize_resolved_component("LibrarySearchBox", empty_record())
+            .expect("Expected lazy component initialization to succeed")
+            .rendered
+    );
+}
+
+#[test]
+fn folded_static_elements_render_like_unfolded_program() {
+    let module = Arc::new(
+        lower_source_module(
+            r#"
+                let footer() = { <footer><a href="/docs" rank={2 * 21}>Docs</a><hr /></footer> }
+                let root(name:string) = { <page>{footer()}<p>{name}</p></page> }
+            "#,
+            "static-markup.nx",
+        )
+        .expect("Expected static markup module to lower"),
+    );
+    let mut unfolded_program = ResolvedProgram::single_root_module(7, "static-markup.nx", module);
+    unfolded_program.prelink_modules();
+    let mut folded_program = unfolded_program.clone();
+    folded_program.fold_static_elements();
+    assert_eq!(unfolded_program.folded_element_count(), 0);
+    assert_eq!(folded_program.folded_element_count(), 1);
+
+    let args = || vec![Value::String(SmolStr::new("Ada"))];
+    let unfolded = Interpreter::from_resolved_program(unfolded_program);
+    let folded = Interpreter::from_resolved_program(folded_program);
+    let expected = unfolded
+        .execute_resolved_program_function("root", args())
+        .expect("Expected unfolded root evaluation to succeed");
+    let first = folded
+        .execute_resolved_program_function("root", args())
+        .expect("Expected folded root evaluation to succeed");
+    let second = folded
+        .execute_resolved_program_function("root", args())
+        .expect("Expected repeated folded root evaluation to succeed");
+    assert_eq!(first, expected);
+    assert_eq!(second, expected);
+
+    let footer_fields = |value: &Value| match value {
+        Value::Record { fields, .. } => match fields.get("content") {
+            Some(Value::Array(content)) => match &content[0] {
+                Value::Record { fields, .. } => fields.clone(),
+                other => panic!("Expected footer record, got {:?}", other),
+            },
+            other => panic!("Expected page content array, got {:?}", other),
+        },
+        other => panic!("Expected page record, got {:?}", other),
+    };
+    assert!(Arc::ptr_eq(
+        footer_fields(&first).layout(),
+        footer_fields(&second).layout()
+    ));
+}
+
+#[test]
+fn compiled_expressions_evaluate_like_tree_walking() {
+    let module = Arc::new(
+        lower_source_module(
+            r#"
+                let clamp(x:int, lo:int, hi:int): int = { if x < lo { lo } else { if x > hi { hi } else { x } } }
+                let bonus(score:int, strict:bool) = { if strict && !(score > 40 || score == 3) { 1 } else { -"penalty" } }
+                let root(score:int, strict:bool) = { clamp(score * 2 - 7, 0, 100) + -score + bonus(score, strict) }
+            "#,
+            "compiled.nx",
+        )
+        .expect("Expected operator module to lower"),
+    );
+    let mut walked_program = ResolvedProgram::single_root_module(7, "compiled.nx", module);
+    walked_program.prelink_modules();
+    let mut compiled_program = walked_program.clone();
+    compiled_program.compile_expressions();
+    assert_eq!(walked_program.compiled_expr_count(), 0);
+    assert!(compiled_program.compiled_expr_count() >= 2);
+
+    let walked = Interpreter::from_resolved_program(walked_program);
+    let compiled = Interpreter::from_resolved_program(compiled_program);
+    let run = |interpreter: &Interpreter, score: i64, strict: bool, max_operations: usize| {
+        interpreter
+            .execute_resolved_program_function_with_limits(
+                "root",
+                vec![Value::Int(score), Value::Boolean(strict)],
+                ResourceLimits {
+                    max_operations,
+                    ..ResourceLimits::default()
+                },
+            )
+            .map_err(|error| error.kind().clone())
+    };
+
+    for (score, strict) in [(3, true), (20, true), (70, true), (20, false)] {
+        assert_eq!(
+            run(&compiled, score, strict, usize::MAX),
+            run(&walked, score, strict, usize::MAX)
+        );
+        for max_operations in 0..64 {
+            assert_eq!(
+                run(&compiled, score, strict, max_operations),
+                run(&walked, score, strict, max_operations),
+                "score {score}, strict {strict}, max_operations {max_operations}"
+            );
+        }
+    }
+    assert!(matches!(
+        run(&compiled, 20, false, usize::MAX),
+        Err(RuntimeErrorKind::TypeMismatch { .. })
+    ));
+    assert_eq!(run(&compiled, 20, true, usize::MAX), Ok(Value::Int(14)));
+}
+
+#[test]
+fn folding_skips_static_markup_that_calls_element_functions() {
+    let module = Arc::new(
+        lower_source_module(
+            r#"
+                let <Spin depth:int /> = { if depth > 0 { <Spin depth={depth - 1} /> } else { <b:>done</b> } }
+                let root() = { <page><Spin depth={3} /><hr /></page> }
+            "#,
+            "static-calls.nx",
+        )
+        .expect("Expected static call module to lower"),
+    );
+    let mut unfolded_program = ResolvedProgram::single_root_module(8, "static-calls.nx", module);
+    unfolded_program.prelink_modules();
+    let mut folded_program = unfolded_program.clone();
+    folded_program.fold_static_elements();
+
+    // Only `<b>` and `<hr />` are plain markup; `<page>` contains a call to `Spin`.
+    assert_eq!(folded_program.folded_element_count(), 2);
+    assert_eq!(
+        Interpreter::from_resolved_program(folded_program)
+            .execute_resolved_program_function("root", vec![])
+            .expect("Expected folded root evaluation to succeed"),
+        Interpreter::from_resolved_program(unfolded_program)
+            .execute_resolved_program_function("root", vec![])
+            .expect("Expected unfolded root evaluation to succeed")
+    );
+}
+
+#[test]
+fn shared_resolved_program_evaluates_on_several_threads() {
+    let (program, _, _) = build_resolved_program(0xCAFE_BABE);
+    let program = Arc::new(program);
+
+    let results = std::thread::scope(|scope| {
+        let handles = (0..4)
+            .map(|_| {
+                let program = Arc::clone(&program);
+                scope.spawn(move || {
+                    let interpreter = Interpreter::from_resolved_program(program);
+                    (0..3)
+                        .map(|_| {
+                            interpreter
+                                .execute_resolved_program_function("root", vec![])
+                                .expect("Expected shared root evaluation to succeed")
+                        })
+                        .collect::<Vec<_>>()
+                })
+            })
+            .collect::<Vec<_>>();
+        handles
+            .into_iter()
+            .flat_map(|handle| handle.join().expect("worker thread panicked"))
+            .collect::<Vec<_>>()
+    });
+
+    assert_eq!(results, vec![Value::Int(42); 12]);
+    assert_eq!(Arc::strong_count(&program), 1);
+}
+
 #[test]
 fn resolved_program_component_snapshots_accept_matching_program_and_reject_mismatches() {
     let (program, root_module, _) = build_resolved_program(0xCAFE_BABE);
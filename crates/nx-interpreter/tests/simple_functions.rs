@@ -4,7 +4,7 @@
 
 use nx_diagnostics::render_diagnostics_cli;
 use nx_hir::{lower, SourceId};
-use nx_interpreter::{Interpreter, Value};
+use nx_interpreter::{Interpreter, RecordFields, Value};
 use nx_syntax::parse_str;
 use rustc_hash::FxHashMap;
 use smol_str::SmolStr;
@@ -210,7 +210,7 @@ fn test_union_match_compares_case_discriminator() {
     );
     let failed = Value::Record {
         type_name: nx_hir::Name::new("LoadState.failed"),
-        fields,
+        fields: fields.into(),
     };
 
     let result = execute_function(source, "view", vec![failed])
@@ -218,6 +218,65 @@ fn test_union_match_compares_case_discriminator() {
     assert_eq!(result, Value::String(SmolStr::new("Offline")));
 }
 
+#[test]
+fn test_union_case_values_reuse_lowered_discriminators() {
+    let source = r#"
+        type LoadState = | idle | failed { message:string }
+        let make(): LoadState = { <LoadState.failed message="Offline" /> }
+        let view(state: LoadState): string = {
+            if state is {
+                LoadState.idle => "idle"
+                LoadState.failed => state.message
+            }
+        }
+    "#;
+    let parse_result = parse_str(source, "test.nx");
+    let module = lower(
+        parse_result.root().expect("Failed to get root"),
+        SourceId::new(0),
+    );
+    let failed_case = module
+        .items()
+        .iter()
+        .find_map(|item| match item {
+            nx_hir::Item::Union(union_def) => union_def
+                .cases
+                .iter()
+                .find(|case| case.name.as_str() == "failed"),
+            _ => None,
+        })
+        .expect("LoadState.failed should be lowered");
+    assert_eq!(failed_case.qualified_name.as_str(), "LoadState.failed");
+
+    let interpreter = Interpreter::new();
+    let Value::Record { type_name, .. } = interpreter
+        .execute_function(&module, "make", vec![])
+        .expect("make should run")
+    else {
+        panic!("Expected union case record value");
+    };
+    assert!(std::ptr::eq(
+        type_name.as_str(),
+        failed_case.qualified_name.as_str()
+    ));
+
+    let mut fields = FxHashMap::default();
+    fields.insert(
+        SmolStr::new("message"),
+        Value::String(SmolStr::new("Offline")),
+    );
+    let host_failed = Value::Record {
+        type_name: nx_hir::Name::external("LoadState.failed"),
+        fields: fields.into(),
+    };
+    assert_eq!(
+        interpreter
+            .execute_function(&module, "view", vec![host_failed])
+            .expect("view should run"),
+        Value::String(SmolStr::new("Offline"))
+    );
+}
+
 // ============================================================================
 // Error Handling Tests
 // ============================================================================
@@ -311,7 +370,7 @@ fn test_enum_member_return() {
         result,
         Value::EnumValue {
             type_name: nx_hir::Name::new("Direction"),
-            member: SmolStr::new("north")
+            member: nx_hir::Name::new("north")
         }
     );
 }
@@ -328,7 +387,7 @@ fn test_enum_comparison() {
         "isNorth",
         vec![Value::EnumValue {
             type_name: nx_hir::Name::new("Direction"),
-            member: SmolStr::new("north"),
+            member: nx_hir::Name::new("north"),
         }],
     )
     .unwrap_or_else(|err| panic!("{}", err));
@@ -355,7 +414,7 @@ fn test_record_field_access() {
         "getName",
         vec![Value::Record {
             type_name: nx_hir::Name::new("User"),
-            fields: record,
+            fields: record.into(),
         }],
     )
     .unwrap_or_else(|err| {
@@ -392,7 +451,7 @@ fn test_derived_record_argument_satisfies_abstract_ancestor_parameter() {
         "consume",
         vec![Value::Record {
             type_name: nx_hir::Name::new("User"),
-            fields: record,
+            fields: record.into(),
         }],
     )
     .unwrap_or_else(|err| panic!("derived record argument failed:\n{}", err));
@@ -449,7 +508,7 @@ fn test_record_missing_field_errors() {
         "missing",
         vec![Value::Record {
             type_name: nx_hir::Name::new("User"),
-            fields: record,
+            fields: record.into(),
         }],
     );
     assert!(result.is_err());
@@ -474,7 +533,7 @@ fn test_host_supplied_record_defaults_are_not_applied_during_argument_coercion()
         "echo",
         vec![Value::Record {
             type_name: nx_hir::Name::new("User"),
-            fields: record,
+            fields: record.into(),
         }],
     )
     .unwrap_or_else(|err| panic!("host-supplied record should pass through:\n{}", err));
@@ -501,7 +560,7 @@ fn test_host_supplied_nullable_record_field_remains_absent() {
         "getEmail",
         vec![Value::Record {
             type_name: nx_hir::Name::new("User"),
-            fields: FxHashMap::default(),
+            fields: RecordFields::default(),
         }],
     );
 
@@ -529,7 +588,7 @@ fn test_host_supplied_record_missing_required_field_does_not_fail_before_body()
         "noop",
         vec![Value::Record {
             type_name: nx_hir::Name::new("User"),
-            fields: record,
+            fields: record.into(),
         }],
     );
     assert_eq!(result, Ok(Value::Int(0)));
@@ -793,7 +852,7 @@ fn test_nested_record_access() {
         SmolStr::new("address"),
         Value::Record {
             type_name: nx_hir::Name::new("Address"),
-            fields: addr,
+            fields: addr.into(),
         },
     );
 
@@ -802,7 +861,7 @@ fn test_nested_record_access() {
         "city",
         vec![Value::Record {
             type_name: nx_hir::Name::new("User"),
-            fields: user,
+            fields: user.into(),
         }],
     )
     .unwrap_or_else(|err| panic!("Nested record access failed: {}", err));
@@ -899,7 +958,7 @@ fn test_external_record_argument_does_not_evaluate_definition_defaults() {
         "echo",
         vec![Value::Record {
             type_name: nx_hir::Name::new("Config"),
-            fields: FxHashMap::default(),
+            fields: RecordFields::default(),
         }],
     )
     .unwrap_or_else(|err| panic!("External record argument should pass through:\n{}", err));
@@ -971,16 +1030,19 @@ fn test_element_call_passes_content_to_paren_function() {
     let result = execute_function(source, "root", vec![])
         .unwrap_or_else(|err| panic!("Element call with content failed:\n{}", err));
 
-    let expected = Value::Array(vec![
-        Value::Record {
-            type_name: nx_hir::Name::new("div"),
-            fields: FxHashMap::default(),
-        },
-        Value::Record {
-            type_name: nx_hir::Name::new("span"),
-            fields: FxHashMap::default(),
-        },
-    ]);
+    let expected = Value::Array(
+        vec![
+            Value::Record {
+                type_name: nx_hir::Name::new("div"),
+                fields: RecordFields::default(),
+            },
+            Value::Record {
+                type_name: nx_hir::Name::new("span"),
+                fields: RecordFields::default(),
+            },
+        ]
+        .into(),
+    );
 
     assert_eq!(result, expected);
 }
@@ -1025,16 +1087,19 @@ fn test_element_call_content_is_injected_for_element_defined_function() {
     let result = execute_function(source, "root", vec![])
         .unwrap_or_else(|err| panic!("Element call with content failed:\n{}", err));
 
-    let expected = Value::Array(vec![
-        Value::Record {
-            type_name: nx_hir::Name::new("div"),
-            fields: FxHashMap::default(),
-        },
-        Value::Record {
-            type_name: nx_hir::Name::new("span"),
-            fields: FxHashMap::default(),
-        },
-    ]);
+    let expected = Value::Array(
+        vec![
+            Value::Record {
+                type_name: nx_hir::Name::new("div"),
+                fields: RecordFields::default(),
+            },
+            Value::Record {
+                type_name: nx_hir::Name::new("span"),
+                fields: RecordFields::default(),
+            },
+        ]
+        .into(),
+    );
 
     assert_eq!(result, expected);
 }
@@ -1053,7 +1118,7 @@ fn test_element_call_single_child_coerces_to_scalar_content_parameter() {
         result,
         Value::Record {
             type_name: nx_hir::Name::new("div"),
-            fields: FxHashMap::default(),
+            fields: RecordFields::default(),
         }
     );
 }
@@ -1085,7 +1150,7 @@ fn test_element_call_scalar_value_child_coerces_to_list_content_parameter() {
         )
     });
 
-    assert_eq!(result, Value::Array(vec![Value::Int(1)]));
+    assert_eq!(result, Value::Array(vec![Value::Int(1)].into()));
 }
 
 #[test]
@@ -1131,16 +1196,19 @@ fn test_element_call_braced_child_list_flattens_content_array() {
     let result = execute_function(source, "root", vec![])
         .unwrap_or_else(|err| panic!("Element call with braced child list failed:\n{}", err));
 
-    let expected = Value::Array(vec![
-        Value::Record {
-            type_name: nx_hir::Name::new("div"),
-            fields: FxHashMap::default(),
-        },
-        Value::Record {
-            type_name: nx_hir::Name::new("span"),
-            fields: FxHashMap::default(),
-        },
-    ]);
+    let expected = Value::Array(
+        vec![
+            Value::Record {
+                type_name: nx_hir::Name::new("div"),
+                fields: RecordFields::default(),
+            },
+            Value::Record {
+                type_name: nx_hir::Name::new("span"),
+                fields: RecordFields::default(),
+            },
+        ]
+        .into(),
+    );
 
     assert_eq!(result, expected);
 }
@@ -1156,20 +1224,26 @@ fn test_element_call_conditional_content_expression_preserves_selected_element()
         .unwrap_or_else(|err| panic!("Element call with conditional content failed:\n{}", err));
     assert_eq!(
         true_result,
-        Value::Array(vec![Value::Record {
-            type_name: nx_hir::Name::new("A"),
-            fields: FxHashMap::default(),
-        }])
+        Value::Array(
+            vec![Value::Record {
+                type_name: nx_hir::Name::new("A"),
+                fields: RecordFields::default(),
+            }]
+            .into()
+        )
     );
 
     let false_result = execute_function(source, "root", vec![Value::Boolean(false)])
         .unwrap_or_else(|err| panic!("Element call with conditional content failed:\n{}", err));
     assert_eq!(
         false_result,
-        Value::Array(vec![Value::Record {
-            type_name: nx_hir::Name::new("B"),
-            fields: FxHashMap::default(),
-        }])
+        Value::Array(
+            vec![Value::Record {
+                type_name: nx_hir::Name::new("B"),
+                fields: RecordFields::default(),
+            }]
+            .into()
+        )
     );
 }
 
@@ -1180,24 +1254,27 @@ fn test_element_call_for_content_expression_flattens_element_results() {
         let root(items: object[]): object[] = { <collect>for item in items { <Row /> }</collect> }
     "#;
 
-    let items = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)]);
+    let items = Value::Array(vec![Value::Int(1), Value::Int(2), Value::Int(3)].into());
     let result = execute_function(source, "root", vec![items])
         .unwrap_or_else(|err| panic!("Element call with for content failed:\n{}", err));
 
-    let expected = Value::Array(vec![
-        Value::Record {
-            type_name: nx_hir::Name::new("Row"),
-            fields: FxHashMap::default(),
-        },
-        Value::Record {
-            type_name: nx_hir::Name::new("Row"),
-            fields: FxHashMap::default(),
-        },
-        Value::Record {
-            type_name: nx_hir::Name::new("Row"),
-            fields: FxHashMap::default(),
-        },
-    ]);
+    let expected = Value::Array(
+        vec![
+            Value::Record {
+                type_name: nx_hir::Name::new("Row"),
+                fields: RecordFields::default(),
+            },
+            Value::Record {
+                type_name: nx_hir::Name::new("Row"),
+                fields: RecordFields::default(),
+            },
+            Value::Record {
+                type_name: nx_hir::Name::new("Row"),
+                fields: RecordFields::default(),
+            },
+        ]
+        .into(),
+    );
 
     assert_eq!(result, expected);
 }
@@ -1211,16 +1288,19 @@ fn test_multi_value_element_brace_list_returns_array_runtime() {
     let result = execute_function(source, "root", vec![])
         .unwrap_or_else(|err| panic!("Element-valued brace list failed at runtime:\n{}", err));
 
-    let expected = Value::Array(vec![
-        Value::Record {
-            type_name: nx_hir::Name::new("div"),
-            fields: FxHashMap::default(),
-        },
-        Value::Record {
-            type_name: nx_hir::Name::new("span"),
-            fields: FxHashMap::default(),
-        },
-    ]);
+    let expected = Value::Array(
+        vec![
+            Value::Record {
+                type_name: nx_hir::Name::new("div"),
+                fields: RecordFields::default(),
+            },
+            Value::Record {
+                type_name: nx_hir::Name::new("span"),
+                fields: RecordFields::default(),
+            },
+        ]
+        .into(),
+    );
 
     assert_eq!(result, expected);
 }
@@ -1234,7 +1314,7 @@ fn test_scalar_brace_return_is_wrapped_for_list_annotation_runtime() {
     let result = execute_function(source, "values", vec![])
         .unwrap_or_else(|err| panic!("Scalar-to-list return coercion failed:\n{}", err));
 
-    assert_eq!(result, Value::Array(vec![Value::Int(1)]));
+    assert_eq!(result, Value::Array(vec![Value::Int(1)].into()));
 }
 
 #[test]
@@ -1361,16 +1441,19 @@ fn test_element_call_body_populates_record_content_field() {
     let result = execute_function(source, "root", vec![])
         .unwrap_or_else(|err| panic!("Record content injection failed:\n{}", err));
 
-    let expected = Value::Array(vec![
-        Value::Record {
-            type_name: nx_hir::Name::new("div"),
-            fields: FxHashMap::default(),
-        },
-        Value::Record {
-            type_name: nx_hir::Name::new("span"),
-            fields: FxHashMap::default(),
-        },
-    ]);
+    let expected = Value::Array(
+        vec![
+            Value::Record {
+                type_name: nx_hir::Name::new("div"),
+                fields: RecordFields::default(),
+            },
+            Value::Record {
+                type_name: nx_hir::Name::new("span"),
+                fields: RecordFields::default(),
+            },
+        ]
+        .into(),
+    );
 
     assert_eq!(result, expected);
 }
@@ -1404,7 +1487,7 @@ fn test_component_invocation_binds_body_to_declared_content_prop() {
         result,
         Value::Record {
             type_name: nx_hir::Name::new("Badge"),
-            fields: FxHashMap::default(),
+            fields: RecordFields::default(),
         }
     );
 }
@@ -24,6 +24,24 @@ fn generate_nx_source(lines: usize) -> String {
     source
 }
 
+fn generate_text_heavy_source(paragraphs: usize) -> String {
+    const PROSE: &str = "NX templates often carry long runs of prose between their markup, \
+        with only the occasional interpolated value or entity such as &amp; breaking the text up. \
+        Sentences like this one are consumed by the text chunk scanner. ";
+
+    let mut source = String::from("let root() = <article>\n");
+    for i in 0..paragraphs {
+        source.push_str("  <p>");
+        for _ in 0..4 {
+            source.push_str(PROSE);
+        }
+        source.push_str(&format!("Paragraph {{{}}} ends here.</p>\n", i));
+    }
+    source.push_str("</article>\n");
+
+    source
+}
+
 fn parse_benchmark(c: &mut Criterion) {
     let mut group = c.benchmark_group("parse");
 
@@ -43,5 +61,28 @@ fn parse_benchmark(c: &mut Criterion) {
     group.finish();
 }
 
-criterion_group!(benches, parse_benchmark);
+fn parse_text_benchmark(c: &mut Criterion) {
+    let mut group = c.benchmark_group("parse_text");
+
+    for paragraphs in [10, 100, 1000].iter() {
+        let source = generate_text_heavy_source(*paragraphs);
+        let bytes = source.len();
+
+        group.throughput(Throughput::Bytes(bytes as u64));
+        group.bench_with_input(
+            BenchmarkId::new("paragraphs", paragraphs),
+            &source,
+            |b, source| {
+                b.iter(|| {
+                    let result = parse_str(black_box(source), black_box("benchmark.nx"));
+                    black_box(result)
+                });
+            },
+        );
+    }
+
+    group.finish();
+}
+
+criterion_group!(benches, parse_benchmark, parse_text_benchmark);
 criterion_main!(benches);
@@ -10,6 +10,9 @@ fn main() {
 
     cc::Build::new()
         .include(&src_dir)
+        // Allocate through tree-sitter's configurable allocator (`ts_set_allocator`) instead of
+        // plain malloc, so the grammar follows whatever allocator the host installs.
+        .define("TREE_SITTER_REUSE_ALLOCATOR", None)
         .file(src_dir.join("parser.c"))
         .file(src_dir.join("scanner.c"))
         .compile("tree-sitter-nx");
@@ -0,0 +1,132 @@
+//! Routing of tree-sitter allocations through the Rust global allocator.
+//!
+//! tree-sitter allocates parse stacks, subtrees, and trees through `ts_malloc` and friends, which
+//! default to the C heap. Hosts that install a faster `#[global_allocator]` can route those
+//! allocations through it with [`use_global_allocator_for_tree_sitter`]. The grammar is compiled
+//! with `TREE_SITTER_REUSE_ALLOCATOR`, so the external scanner follows the same allocator.
+
+use std::alloc::{self, Layout};
+use std::ffi::c_void;
+use std::ptr;
+
+/// Bytes reserved in front of every allocation to record its size.
+///
+/// C callers free and reallocate without passing a size, so the size is kept in a header. The
+/// header is 16 bytes so returned pointers keep the alignment `malloc` guarantees.
+const HEADER_SIZE: usize = 16;
+
+/// Routes every tree-sitter allocation through the Rust global allocator.
+///
+/// # Safety
+///
+/// Must be called before any tree-sitter parser, tree, or query exists in the process, and at
+/// most once. Memory allocated by the previous allocator would otherwise be released through
+/// this one.
+pub unsafe fn use_global_allocator_for_tree_sitter() {
+    unsafe {
+        tree_sitter::set_allocator(
+            Some(ts_malloc),
+            Some(ts_calloc),
+            Some(ts_realloc),
+            Some(ts_free),
+        );
+    }
+}
+
+fn layout_for(size: usize) -> Layout {
+    size.checked_add(HEADER_SIZE)
+        .and_then(|total| Layout::from_size_align(total, HEADER_SIZE).ok())
+        .unwrap_or_else(|| panic!("tree-sitter allocation of {size} bytes is too large"))
+}
+
+unsafe fn allocate(size: usize, zeroed: bool) -> *mut c_void {
+    let layout = layout_for(size);
+    let base = unsafe {
+        if zeroed {
+            alloc::alloc_zeroed(layout)
+        } else {
+            alloc::alloc(layout)
+        }
+    };
+    if base.is_null() {
+        // tree-sitter aborts on allocation failure with its default allocator as well.
+        alloc::handle_alloc_error(layout);
+    }
+
+    unsafe {
+        base.cast::<usize>().write(size);
+        base.add(HEADER_SIZE).cast()
+    }
+}
+
+unsafe fn base_and_size(ptr: *mut c_void) -> (*mut u8, usize) {
+    let base = unsafe { ptr.cast::<u8>().sub(HEADER_SIZE) };
+    (base, unsafe { base.cast::<usize>().read() })
+}
+
+unsafe extern "C" fn ts_malloc(size: usize) -> *mut c_void {
+    unsafe { allocate(size, false) }
+}
+
+unsafe extern "C" fn ts_calloc(count: usize, size: usize) -> *mut c_void {
+    let total = count
+        .checked_mul(size)
+        .unwrap_or_else(|| panic!("tree-sitter allocation of {count} x {size} bytes overflows"));
+    unsafe { allocate(total, true) }
+}
+
+unsafe extern "C" fn ts_realloc(ptr: *mut c_void, size: usize) -> *mut c_void {
+    if ptr.is_null() {
+        return unsafe { ts_malloc(size) };
+    }
+
+    let (base, old_size) = unsafe { base_and_size(ptr) };
+    let new_layout = layout_for(size);
+    let base = unsafe { alloc::realloc(base, layout_for(old_size), new_layout.size()) };
+    if base.is_null() {
+        alloc::handle_alloc_error(new_layout);
+    }
+
+    unsafe {
+        base.cast::<usize>().write(size);
+        base.add(HEADER_SIZE).cast()
+    }
+}
+
+unsafe extern "C" fn ts_free(ptr: *mut c_void) {
+    if ptr.is_null() {
+        return;
+    }
+
+    let (base, size) = unsafe { base_and_size(ptr) };
+    unsafe { alloc::dealloc(base, layout_for(size)) };
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn allocations_round_trip_through_realloc_and_free() {
+        unsafe {
+            let ptr = ts_malloc(8).cast::<u8>();
+            assert_eq!(ptr as usize % HEADER_SIZE, 0);
+            ptr::copy_nonoverlapping(b"nx-parse".as_ptr(), ptr, 8);
+
+            let grown = ts_realloc(ptr.cast(), 4096).cast::<u8>();
+            assert_eq!(std::slice::from_raw_parts(grown, 8), b"nx-parse");
+            ts_free(grown.cast());
+
+            let zeroed = ts_calloc(4, 16).cast::<u8>();
+            assert!(std::slice::from_raw_parts(zeroed, 64)
+                .iter()
+                .all(|&byte| byte == 0));
+            ts_free(zeroed.cast());
+
+            ts_free(ptr::null_mut());
+            let fresh = ts_realloc(ptr::null_mut(), 0);
+            assert!(!fresh.is_null());
+            ts_free(fresh);
+        }
+    }
+}
@@ -3,11 +3,13 @@
 //! This crate provides tree-sitter-based parsing for the NX language,
 //! with typed wrappers and a high-level API for parsing files.
 
+mod alloc;
 mod ast;
 mod syntax_kind;
 mod syntax_node;
 mod validation;
 
+pub use alloc::use_global_allocator_for_tree_sitter;
 pub use ast::{
     AstNode, ComponentDef, Element, FunctionDef, RecordDef, SyntaxNodeExt, TypeDef, UnionDef,
 };
@@ -16,12 +18,13 @@ pub use syntax_node::SyntaxNode;
 pub use validation::validate;
 
 use nx_diagnostics::{Diagnostic, Severity};
+use std::cell::RefCell;
 use std::fs;
 use std::io;
 use std::path::Path;
 use std::sync::Arc;
 use text_size::TextRange;
-use tree_sitter::{Language, Parser, Tree};
+use tree_sitter::{InputEdit, Language, Parser, Point, Tree};
 
 extern "C" {
     fn tree_sitter_nx() -> Language;
@@ -47,6 +50,23 @@ pub fn parser() -> Parser {
     parser
 }
 
+thread_local! {
+    /// Parser reused by every parse on this thread.
+    static THREAD_PARSER: RefCell<Option<Parser>> = const { RefCell::new(None) };
+}
+
+/// Runs `f` with this thread's pooled NX parser, creating it on first use.
+///
+/// Reusing one parser per thread avoids rebuilding the parser and its internal stacks and
+/// buffers for every file.
+fn with_thread_parser<R>(f: impl FnOnce(&mut Parser) -> R) -> R {
+    THREAD_PARSER.with(|slot| match slot.try_borrow_mut() {
+        Ok(mut slot) => f(slot.get_or_insert_with(parser)),
+        // Only reachable if a parse re-enters itself; fall back to a private parser.
+        Err(_) => f(&mut parser()),
+    })
+}
+
 /// Unique identifier for a source file.
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
 pub struct SourceId(u32);
@@ -64,6 +84,9 @@ impl SourceId {
 }
 
 /// An immutable syntax tree from tree-sitter.
+///
+/// Cloning is cheap: tree-sitter trees are reference counted and the source text is shared.
+#[derive(Clone)]
 pub struct SyntaxTree {
     tree: Tree,
     source: Arc<String>,
@@ -72,10 +95,10 @@ pub struct SyntaxTree {
 
 impl SyntaxTree {
     /// Creates a new syntax tree.
-    fn new(tree: Tree, source: String, source_id: SourceId) -> Self {
+    fn new(tree: Tree, source: Arc<String>, source_id: SourceId) -> Self {
         Self {
             tree,
-            source: Arc::new(source),
+            source,
             source_id,
         }
     }
@@ -97,6 +120,11 @@ impl SyntaxTree {
         &self.source
     }
 
+    /// Returns the shared source text, which callers can hold without copying it.
+    pub fn shared_source(&self) -> &Arc<String> {
+        &self.source
+    }
+
     /// Finds the node at the given byte offset.
     pub fn node_at(&self, offset: usize) -> Option<SyntaxNode<'_>> {
         let node = self
@@ -128,6 +156,28 @@ pub enum Error {
     Parse(String),
 }
 
+/// One replacement of a byte range in source text.
+///
+/// The range is a byte range of the text as it stands when the edit is applied, so a sequence of
+/// edits is applied in order, each against the result of the previous one.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct TextEdit {
+    /// Byte range being replaced.
+    pub range: TextRange,
+    /// Replacement text.
+    pub new_text: String,
+}
+
+impl TextEdit {
+    /// Creates an edit that replaces `range` with `new_text`.
+    pub fn new(range: TextRange, new_text: impl Into<String>) -> Self {
+        Self {
+            range,
+            new_text: new_text.into(),
+        }
+    }
+}
+
 /// Result of parsing NX source code.
 pub struct ParseResult {
     /// The parsed syntax tree (None if fatal parse error)
@@ -170,27 +220,129 @@ impl ParseResult {
 /// assert!(result.tree.is_some());
 /// ```
 pub fn parse_str(source: &str, file_name: &str) -> ParseResult {
+    if let Some(rejected) = reject_source(source, file_name) {
+        return rejected;
+    }
+
+    parse_source(Arc::new(source.to_string()), file_name, None)
+}
+
+/// Parses shared NX source text without copying it.
+///
+/// The resulting tree holds `source` itself, so [`SyntaxTree::shared_source`] returns a pointer
+/// to the same allocation. Callers that keep the text elsewhere, such as an incremental database,
+/// can then tell whether a tree belongs to their current text by pointer.
+pub fn parse_shared(source: &Arc<String>, file_name: &str) -> ParseResult {
+    if let Some(rejected) = reject_source(source, file_name) {
+        return rejected;
+    }
+
+    parse_source(Arc::clone(source), file_name, None)
+}
+
+/// Returns the result for source text that is too large or not UTF-8, or `None` to parse it.
+fn reject_source(source: &str, file_name: &str) -> Option<ParseResult> {
     if let Some(diagnostic) = validate_source_size(source.len(), file_name) {
-        return ParseResult {
+        return Some(ParseResult {
             tree: None,
             errors: vec![diagnostic],
             source_id: SourceId::new(0),
-        };
+        });
     }
 
     // Validate UTF-8
     if !source.is_utf8() {
-        return ParseResult {
+        return Some(ParseResult {
             tree: None,
             errors: vec![Diagnostic::error("invalid-utf8")
                 .with_message("Source file contains invalid UTF-8")
                 .build()],
             source_id: SourceId::new(0),
+        });
+    }
+
+    None
+}
+
+/// Reparses the source of a previous syntax tree after applying text edits.
+///
+/// The edits are applied to the previous source in order and reported to tree-sitter, which
+/// reuses every subtree outside the edited ranges instead of parsing the whole file again. The
+/// result matches what [`parse_str`] returns for the edited source.
+///
+/// An edit whose range falls outside the text or splits a UTF-8 character produces an
+/// `invalid-edit` error and no tree.
+///
+/// # Examples
+///
+/// ```
+/// use nx_syntax::{parse_str, reparse_str, TextEdit};
+/// use text_size::{TextRange, TextSize};
+///
+/// let previous = parse_str("let x = 42", "example.nx").tree.unwrap();
+/// let edit = TextEdit::new(TextRange::new(TextSize::from(8), TextSize::from(10)), "7");
+/// let result = reparse_str(&previous, &[edit], "example.nx");
+///
+/// assert_eq!(result.tree.unwrap().source(), "let x = 7");
+/// ```
+pub fn reparse_str(previous: &SyntaxTree, edits: &[TextEdit], file_name: &str) -> ParseResult {
+    let mut tree = previous.tree.clone();
+    let mut source = previous.source().to_string();
+
+    for edit in edits {
+        let start = usize::from(edit.range.start());
+        let old_end = usize::from(edit.range.end());
+        if !source.is_char_boundary(start) || !source.is_char_boundary(old_end) {
+            return ParseResult {
+                tree: None,
+                errors: vec![Diagnostic::error("invalid-edit")
+                    .with_message(format!(
+                        "Edit range {start}..{old_end} does not fall on character boundaries of the {} byte source",
+                        source.len()
+                    ))
+                    .build()],
+                source_id: SourceId::new(0),
+            };
+        }
+
+        let new_end = start + edit.new_text.len();
+        let start_position = point_at(&source, start);
+        let old_end_position = point_at(&source, old_end);
+        source.replace_range(start..old_end, &edit.new_text);
+        tree.edit(&InputEdit {
+            start_byte: start,
+            old_end_byte: old_end,
+            new_end_byte: new_end,
+            start_position,
+            old_end_position,
+            new_end_position: point_at(&source, new_end),
+        });
+    }
+
+    if let Some(diagnostic) = validate_source_size(source.len(), file_name) {
+        return ParseResult {
+            tree: None,
+            errors: vec![diagnostic],
+            source_id: SourceId::new(0),
         };
     }
 
-    let mut parser = parser();
-    let tree = parser.parse(source, None);
+    parse_source(Arc::new(source), file_name, Some(&tree))
+}
+
+/// Returns the tree-sitter row/column position of a byte offset.
+fn point_at(source: &str, offset: usize) -> Point {
+    let before = &source.as_bytes()[..offset];
+    let row = before.iter().filter(|&&byte| byte == b'\n').count();
+    let column = before
+        .iter()
+        .rposition(|&byte| byte == b'\n')
+        .map_or(offset, |newline| offset - newline - 1);
+    Point::new(row, column)
+}
+
+fn parse_source(source: Arc<String>, file_name: &str, old_tree: Option<&Tree>) -> ParseResult {
+    let tree = with_thread_parser(|parser| parser.parse(source.as_str(), old_tree));
 
     let source_id = SourceId::new(
         file_name
@@ -202,10 +354,10 @@ pub fn parse_str(source: &str, file_name: &str) -> ParseResult {
     match tree {
         Some(tree) => {
             // Collect parse errors from the tree with enhanced messages
-            let mut errors = validation::collect_enhanced_errors(&tree, source, file_name);
+            let mut errors = validation::collect_enhanced_errors(&tree, &source, file_name);
 
             // Create the syntax tree
-            let syntax_tree = SyntaxTree::new(tree, source.to_string(), source_id);
+            let syntax_tree = SyntaxTree::new(tree, source, source_id);
 
             // Run post-parse validation (e.g., tag matching)
             let validation_errors = validation::validate(&syntax_tree, file_name);
@@ -320,6 +472,16 @@ mod tests {
         assert!(parser.language().is_some());
     }
 
+    #[test]
+    fn test_thread_parser_is_reused_across_parses() {
+        let first = parse_str("let x = 1", "first.nx");
+        let second = parse_str("let <Button /> = <button />", "second.nx");
+
+        assert!(first.is_ok());
+        assert!(second.is_ok());
+        THREAD_PARSER.with(|slot| assert!(slot.borrow().is_some()));
+    }
+
     #[test]
     fn test_parse_str_simple() {
         let source = "let <Button text: string /> = <button>{text}</button>";
@@ -406,6 +568,58 @@ mod tests {
         assert!(diagnostic.message().contains("too-large.nx"));
     }
 
+    fn sexp(result: &ParseResult) -> String {
+        result
+            .tree
+            .as_ref()
+            .expect("Expected a syntax tree")
+            .tree
+            .root_node()
+            .to_sexp()
+    }
+
+    fn edit(start: u32, end: u32, new_text: &str) -> TextEdit {
+        TextEdit::new(
+            TextRange::new(start.into(), end.into()),
+            new_text.to_string(),
+        )
+    }
+
+    #[test]
+    fn test_reparse_str_matches_fresh_parse() {
+        let source = "let a = 1\nlet <Button text: string /> = <button>{text}</button>\nlet b = 2";
+        let previous = parse_str(source, "test.nx").tree.unwrap();
+
+        let expected =
+            "let a = 1\nlet <Button label: string /> = <button>{label}</button>\nlet b = 20";
+        let result = reparse_str(
+            &previous,
+            &[
+                edit(72, 73, "20"),
+                edit(49, 53, "label"),
+                edit(22, 26, "label"),
+            ],
+            "test.nx",
+        );
+
+        assert_eq!(result.tree.as_ref().unwrap().source(), expected);
+        assert!(result.is_ok());
+        assert_eq!(sexp(&result), sexp(&parse_str(expected, "test.nx")));
+    }
+
+    #[test]
+    fn test_reparse_str_reports_edit_errors() {
+        let previous = parse_str("let x = 42", "test.nx").tree.unwrap();
+
+        let result = reparse_str(&previous, &[edit(8, 10, "")], "test.nx");
+        assert!(result.has_errors());
+        assert_eq!(result.tree.unwrap().source(), "let x = ");
+
+        let result = reparse_str(&previous, &[edit(8, 11, "1")], "test.nx");
+        assert!(result.tree.is_none());
+        assert_eq!(result.errors[0].code(), Some("invalid-edit"));
+    }
+
     #[test]
     fn test_tree_sitter_error_nodes() {
         // Test if tree-sitter is really producing ERROR nodes ANYWHERE
@@ -53,6 +53,26 @@ void tree_sitter_nx_external_scanner_deserialize(void *payload, const char *buff
   (void)length;  // unused
 }
 
+/**
+ * ASCII characters that may end or interrupt a text chunk.
+ *
+ * Every other code point, including all non-ASCII ones, is ordinary text that
+ * the text chunk loop consumes without further checks.
+ */
+static const bool TEXT_DELIMITERS[128] = {
+  [0] = true,
+  ['<'] = true,
+  ['{'] = true,
+  ['}'] = true,
+  ['\\'] = true,
+  ['&'] = true,
+  ['@'] = true,
+};
+
+static inline bool is_plain_text(int32_t c) {
+  return c >= 128 || (c > 0 && !TEXT_DELIMITERS[c]);
+}
+
 /**
  * Check if we're at the start of an HTML/XML entity.
  * Entities: &name; or &#digits; or &#xhex;
@@ -235,6 +255,18 @@ bool tree_sitter_nx_external_scanner_scan(void *payload, TSLexer *lexer, const b
 
   // Consume characters until we hit a delimiter
   while (lexer->lookahead != 0) {
+    // Fast path: consume a whole run of ordinary text and mark the token end
+    // once for the run instead of after every character. Long prose in markup
+    // is almost entirely made of such runs.
+    if (is_plain_text(lexer->lookahead)) {
+      do {
+        lexer->advance(lexer, false);
+      } while (is_plain_text(lexer->lookahead));
+      lexer->mark_end(lexer);
+      has_content = true;
+      continue;
+    }
+
     // Stop at element start delimiter. Do NOT stop on '>' because it
     // can legitimately appear in text (e.g., in comparisons like `a > b`).
     if (lexer->lookahead == '<') {
@@ -302,6 +302,22 @@ fn test_parse_regular_element_mixed_content_preserves_text_runs() {
     );
 }
 
+#[test]
+fn test_parse_long_text_run_stops_only_at_delimiters() {
+    let prose = "Plain prose with a > b, tom & jerry, and caf\u{e9} au lait. ".repeat(50);
+    let source = format!("let root() = <p>{prose}&amp; more \\{{ literal</p>");
+    let result = parse_str(&source, "text-run.nx");
+
+    assert!(result.is_ok(), "Long text content should parse");
+    let root = result.root().expect("Should have root node");
+    assert_eq!(count_kind(&root, SyntaxKind::ENTITY), 1);
+    assert_eq!(count_kind(&root, SyntaxKind::ESCAPED_LBRACE), 1);
+
+    let first_chunk =
+        find_first_kind(&root, SyntaxKind::TEXT_CHUNK).expect("Should have a text chunk");
+    assert_eq!(first_chunk.text(), prose);
+}
+
 #[test]
 fn test_parse_element_function_with_return_type() {
     let source = r#"let <Button text:string />: Element = <button>{text}</button>"#;
@@ -0,0 +1,359 @@
+//! Equivalence tests for the external text scanner in `src/scanner.c`.
+//!
+//! The scanner is driven through a mock `TSLexer` and compared against a Rust port of the text
+//! chunk loop as it was before the plain-text fast path, which marked the token end after every
+//! character. Both must agree on every generated input and valid-symbol combination.
+
+// Links the compiled grammar and scanner into this test binary.
+extern crate nx_syntax;
+
+use std::ffi::c_void;
+
+const TEXT_CHUNK: usize = 0;
+const EMBED_TEXT_CHUNK: usize = 1;
+const ENTITY: usize = 2;
+const ESCAPED_LBRACE: usize = 3;
+const ESCAPED_RBRACE: usize = 4;
+const ESCAPED_AT: usize = 5;
+
+/// Mirror of `TSLexer` from `src/tree_sitter/parser.h`.
+#[repr(C)]
+#[derive(Clone, Copy)]
+struct TSLexer {
+    lookahead: i32,
+    result_symbol: u16,
+    advance: unsafe extern "C" fn(*mut TSLexer, bool),
+    mark_end: unsafe extern "C" fn(*mut TSLexer),
+    get_column: unsafe extern "C" fn(*mut TSLexer) -> u32,
+    is_at_included_range_start: unsafe extern "C" fn(*const TSLexer) -> bool,
+    eof: unsafe extern "C" fn(*const TSLexer) -> bool,
+    log: *const c_void,
+}
+
+extern "C" {
+    fn tree_sitter_nx_external_scanner_scan(
+        payload: *mut c_void,
+        lexer: *mut TSLexer,
+        valid_symbols: *const bool,
+    ) -> bool;
+}
+
+/// A lexer over a code point buffer. Like tree-sitter's own lexer, its position lives outside
+/// the `TSLexer` struct, so a scanner that copies and restores the struct only restores
+/// `lookahead`.
+#[repr(C)]
+struct MockLexer {
+    lexer: TSLexer,
+    input: Vec<i32>,
+    position: usize,
+    marked_end: Option<usize>,
+}
+
+unsafe extern "C" fn mock_advance(lexer: *mut TSLexer, _skip: bool) {
+    let mock = &mut *lexer.cast::<MockLexer>();
+    if mock.position < mock.input.len() {
+        mock.position += 1;
+    }
+    mock.lexer.lookahead = mock.input.get(mock.position).copied().unwrap_or(0);
+}
+
+unsafe extern "C" fn mock_mark_end(lexer: *mut TSLexer) {
+    let mock = &mut *lexer.cast::<MockLexer>();
+    mock.marked_end = Some(mock.position);
+}
+
+unsafe extern "C" fn mock_get_column(lexer: *mut TSLexer) -> u32 {
+    (*lexer.cast::<MockLexer>()).position as u32
+}
+
+unsafe extern "C" fn mock_is_at_included_range_start(_lexer: *const TSLexer) -> bool {
+    false
+}
+
+unsafe extern "C" fn mock_eof(lexer: *const TSLexer) -> bool {
+    let mock = &*lexer.cast::<MockLexer>();
+    mock.position >= mock.input.len()
+}
+
+impl MockLexer {
+    fn new(input: &[char]) -> Box<Self> {
+        let input = input.iter().map(|&ch| ch as i32).collect::<Vec<_>>();
+        Box::new(Self {
+            lexer: TSLexer {
+                lookahead: input.first().copied().unwrap_or(0),
+                result_symbol: u16::MAX,
+                advance: mock_advance,
+                mark_end: mock_mark_end,
+                get_column: mock_get_column,
+                is_at_included_range_start: mock_is_at_included_range_start,
+                eof: mock_eof,
+                log: std::ptr::null(),
+            },
+            input,
+            position: 0,
+            marked_end: None,
+        })
+    }
+
+    fn lexer_ptr(&mut self) -> *mut TSLexer {
+        (self as *mut Self).cast::<TSLexer>()
+    }
+
+    /// The scan result, the emitted symbol, and the token end tree-sitter would use.
+    fn outcome(&self, matched: bool) -> (bool, Option<u16>, usize) {
+        (
+            matched,
+            matched.then_some(self.lexer.result_symbol),
+            self.marked_end.unwrap_or(self.position),
+        )
+    }
+}
+
+unsafe fn lookahead(lexer: *mut TSLexer) -> i32 {
+    (*lexer).lookahead
+}
+
+unsafe fn advance(lexer: *mut TSLexer) {
+    ((*lexer).advance)(lexer, false)
+}
+
+unsafe fn mark_end(lexer: *mut TSLexer) {
+    ((*lexer).mark_end)(lexer)
+}
+
+unsafe fn emit(lexer: *mut TSLexer, symbol: usize) -> bool {
+    (*lexer).result_symbol = symbol as u16;
+    true
+}
+
+fn is(code_point: i32, ch: char) -> bool {
+    code_point == ch as i32
+}
+
+fn is_digit(code_point: i32) -> bool {
+    (b'0' as i32..=b'9' as i32).contains(&code_point)
+}
+
+fn is_alpha(code_point: i32) -> bool {
+    (b'a' as i32..=b'z' as i32).contains(&code_point)
+        || (b'A' as i32..=b'Z' as i32).contains(&code_point)
+}
+
+fn is_hex(code_point: i32) -> bool {
+    is_digit(code_point)
+        || (b'a' as i32..=b'f' as i32).contains(&code_point)
+        || (b'A' as i32..=b'F' as i32).contains(&code_point)
+}
+
+unsafe fn reference_is_entity_start(lexer: *mut TSLexer) -> bool {
+    if !is(lookahead(lexer), '&') {
+        return false;
+    }
+    advance(lexer);
+    if is(lookahead(lexer), '#') {
+        advance(lexer);
+        if is(lookahead(lexer), 'x') || is(lookahead(lexer), 'X') {
+            advance(lexer);
+            return is_hex(lookahead(lexer));
+        }
+        return is_digit(lookahead(lexer));
+    }
+    is_alpha(lookahead(lexer))
+}
+
+unsafe fn reference_scan_entity(lexer: *mut TSLexer) -> bool {
+    if !is(lookahead(lexer), '&') {
+        return false;
+    }
+    advance(lexer);
+    if is(lookahead(lexer), '#') {
+        advance(lexer);
+        if is(lookahead(lexer), 'x') || is(lookahead(lexer), 'X') {
+            advance(lexer);
+            if !is_hex(lookahead(lexer)) {
+                return false;
+            }
+            while is_hex(lookahead(lexer)) {
+                advance(lexer);
+            }
+        } else {
+            if !is_digit(lookahead(lexer)) {
+                return false;
+            }
+            while is_digit(lookahead(lexer)) {
+                advance(lexer);
+            }
+        }
+    } else {
+        if !is_alpha(lookahead(lexer)) {
+            return false;
+        }
+        while is_alpha(lookahead(lexer)) || is_digit(lookahead(lexer)) {
+            advance(lexer);
+        }
+    }
+
+    if is(lookahead(lexer), ';') {
+        advance(lexer);
+        return true;
+    }
+    false
+}
+
+/// `tree_sitter_nx_external_scanner_scan` without the plain-text fast path.
+unsafe fn reference_scan(lexer: *mut TSLexer, valid: &[bool; 6]) -> bool {
+    let allow_any_chunk = valid[TEXT_CHUNK] || valid[EMBED_TEXT_CHUNK];
+    let chunk_kind = if valid[EMBED_TEXT_CHUNK] {
+        EMBED_TEXT_CHUNK
+    } else {
+        TEXT_CHUNK
+    };
+    let embed_mode = chunk_kind == EMBED_TEXT_CHUNK;
+
+    if is(lookahead(lexer), '\\') {
+        advance(lexer);
+        if is(lookahead(lexer), '{') {
+            if valid[ESCAPED_LBRACE] {
+                advance(lexer);
+                mark_end(lexer);
+                return emit(lexer, ESCAPED_LBRACE);
+            }
+            return false;
+        }
+        if is(lookahead(lexer), '}') {
+            if valid[ESCAPED_RBRACE] {
+                advance(lexer);
+                mark_end(lexer);
+                return emit(lexer, ESCAPED_RBRACE);
+            }
+            return false;
+        }
+        if is(lookahead(lexer), '@') && valid[ESCAPED_AT] {
+            advance(lexer);
+            mark_end(lexer);
+            return emit(lexer, ESCAPED_AT);
+        }
+        if allow_any_chunk {
+            mark_end(lexer);
+            return emit(lexer, chunk_kind);
+        }
+        return false;
+    }
+
+    if is(lookahead(lexer), '&') && valid[ENTITY] && reference_scan_entity(lexer) {
+        return emit(lexer, ENTITY);
+    }
+
+    if !allow_any_chunk {
+        return false;
+    }
+
+    let mut has_content = false;
+    while lookahead(lexer) != 0 {
+        if is(lookahead(lexer), '<') {
+            break;
+        }
+
+        if embed_mode && is(lookahead(lexer), '@') {
+            let saved = *lexer;
+            advance(lexer);
+            if is(lookahead(lexer), '{') {
+                *lexer = saved;
+                return has_content && emit(lexer, chunk_kind);
+            }
+            *lexer = saved;
+        }
+
+        if is(lookahead(lexer), '{') || is(lookahead(lexer), '}') {
+            break;
+        }
+
+        if is(lookahead(lexer), '\\') {
+            mark_end(lexer);
+            advance(lexer);
+            if is(lookahead(lexer), '{')
+                || is(lookahead(lexer), '}')
+                || (embed_mode && is(lookahead(lexer), '@'))
+            {
+                return has_content && emit(lexer, chunk_kind);
+            }
+            has_content = true;
+            continue;
+        }
+
+        if is(lookahead(lexer), '&') && valid[ENTITY] {
+            let saved = *lexer;
+            if reference_is_entity_start(lexer) {
+                *lexer = saved;
+                return has_content && emit(lexer, chunk_kind);
+            }
+            *lexer = saved;
+        }
+
+        advance(lexer);
+        has_content = true;
+        mark_end(lexer);
+    }
+
+    has_content && emit(lexer, chunk_kind)
+}
+
+/// Deterministic inputs mixing ordinary text with every character the scanner treats specially.
+fn generated_inputs() -> Vec<Vec<char>> {
+    const ALPHABET: &[char] = &[
+        'a', 'Z', ' ', '\n', '>', '<', '{', '}', '\\', '&', '@', '#', 'x', 'f', '1', ';', 'é', '😀',
+    ];
+
+    let mut state = 0x2545_f491_u32;
+    let mut next = move || {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        state
+    };
+
+    let mut inputs = vec![
+        Vec::new(),
+        "plain prose with no delimiters".chars().collect(),
+        "a &amp; b &#10; c &#x1F; d &bogus e".chars().collect(),
+        "text \\{ \\} \\@ \\n @{ value }".chars().collect(),
+    ];
+    for _ in 0..2000 {
+        let len = (next() % 24) as usize;
+        inputs.push(
+            (0..len)
+                .map(|_| ALPHABET[next() as usize % ALPHABET.len()])
+                .collect(),
+        );
+    }
+    inputs
+}
+
+#[test]
+fn test_text_scanner_matches_per_character_reference() {
+    for input in generated_inputs() {
+        for mask in 0u32..64 {
+            let valid: [bool; 6] = std::array::from_fn(|index| mask & (1 << index) != 0);
+
+            let mut scanned = MockLexer::new(&input);
+            let matched = unsafe {
+                tree_sitter_nx_external_scanner_scan(
+                    std::ptr::null_mut(),
+                    scanned.lexer_ptr(),
+                    valid.as_ptr(),
+                )
+            };
+
+            let mut reference = MockLexer::new(&input);
+            let reference_matched = unsafe { reference_scan(reference.lexer_ptr(), &valid) };
+
+            assert_eq!(
+                scanned.outcome(matched),
+                reference.outcome(reference_matched),
+                "scanner diverged from the reference on {:?} with valid symbols {valid:?}",
+                input.iter().collect::<String>(),
+            );
+            assert_eq!(scanned.position, reference.position);
+        }
+    }
+}
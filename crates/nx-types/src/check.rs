@@ -1,10 +1,11 @@
 //! High-level type checking and source-analysis API.
 
-use crate::{InferenceContext, Type, TypeEnvironment};
+use crate::{ImportedTypeEnvironment, InferenceContext, Type, TypeEnvironment};
 use nx_diagnostics::{Diagnostic, Label, Severity};
 use nx_hir::{lower, ExprId, Import, LoweredModule, LoweringDiagnostic, PreparedModule, SourceId};
 use nx_syntax::{parse_file as syntax_parse_file, parse_str as syntax_parse_str};
 use rustc_hash::FxHashMap;
+use serde::{Deserialize, Serialize};
 use std::io;
 use std::path::Path;
 use std::sync::Arc;
@@ -14,7 +15,7 @@ use std::sync::Arc;
 /// This artifact preserves the parse outcome, lowered HIR, inferred type environment, static
 /// diagnostics, and import metadata produced while parsing, lowering, preparing an analysis
 /// module, building scopes, and type checking one source file.
-#[derive(Debug, Clone)]
+#[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct ModuleArtifact {
     /// Source file name used for diagnostics.
     pub file_name: String,
@@ -121,9 +122,20 @@ pub fn check_file(path: impl AsRef<Path>) -> io::Result<TypeCheckResult> {
 
 /// Analyzes a caller-prepared module where visible bindings have already been constructed.
 pub fn analyze_prepared_module(
+    file_name: &str,
+    prepared_module: PreparedModule,
+    diagnostics: Vec<Diagnostic>,
+) -> ModuleArtifact {
+    analyze_prepared_module_with_imports(file_name, prepared_module, diagnostics, Vec::new())
+}
+
+/// Analyzes a caller-prepared module, taking the types of imported bindings covered by
+/// `imported` from those frozen environments instead of resolving them again.
+pub fn analyze_prepared_module_with_imports(
     file_name: &str,
     mut prepared_module: PreparedModule,
     mut diagnostics: Vec<Diagnostic>,
+    imported: Vec<Arc<ImportedTypeEnvironment>>,
 ) -> ModuleArtifact {
     for error in nx_hir::validate_record_definitions(&prepared_module) {
         prepared_module.add_diagnostic(LoweringDiagnostic {
@@ -172,7 +184,7 @@ pub fn analyze_prepared_module(
         file_name,
     ));
 
-    let mut ctx = InferenceContext::with_file_name(&prepared_module, file_name);
+    let mut ctx = InferenceContext::with_imported_types(&prepared_module, file_name, imported);
 
     for item in prepared_module.raw_module().items() {
         match item {
@@ -1,8 +1,12 @@
 //! Type environment for tracking type bindings.
 
-use crate::Type;
-use nx_hir::{ExprId, Name};
+use crate::{InferenceContext, Type};
+use nx_hir::{
+    ExprId, LocalDefinitionId, Name, PreparedBinding, PreparedBindingTarget, PreparedModule,
+    PreparedNamespace,
+};
 use rustc_hash::FxHashMap;
+use serde::{Deserialize, Serialize};
 use std::sync::Arc;
 
 /// A binding of a name to a type.
@@ -25,11 +29,22 @@ impl TypeBinding {
 }
 
 /// A single scope containing name → type bindings.
-#[derive(Debug, Clone, Default)]
+#[derive(Debug, Clone, Default, Serialize, Deserialize)]
 struct Scope {
+    #[serde(serialize_with = "serialize_sorted_bindings")]
     bindings: FxHashMap<Name, Arc<Type>>,
 }
 
+/// Writes scope bindings in name order; map order follows name addresses and varies by process.
+fn serialize_sorted_bindings<S: serde::Serializer>(
+    bindings: &FxHashMap<Name, Arc<Type>>,
+    serializer: S,
+) -> Result<S::Ok, S::Error> {
+    let mut sorted = bindings.iter().collect::<Vec<_>>();
+    sorted.sort_unstable_by(|(lhs, _), (rhs, _)| lhs.as_str().cmp(rhs.as_str()));
+    serializer.collect_map(sorted)
+}
+
 impl Scope {
     fn new() -> Self {
         Self::default()
@@ -57,11 +72,12 @@ impl Scope {
 /// The environment uses a scope stack to support lexical scoping.
 /// Use `push_scope`/`pop_scope` to create nested scopes for let bindings,
 /// function bodies, etc.
-#[derive(Debug, Clone)]
+#[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct TypeEnvironment {
     /// Stack of scopes (innermost at the end)
     scopes: Vec<Scope>,
     /// ExprId → Type mappings
+    #[serde(with = "nx_hir::arena_serde::idx_map")]
     expr_types: FxHashMap<ExprId, Arc<Type>>,
 }
 
@@ -156,6 +172,61 @@ impl TypeEnvironment {
     }
 }
 
+/// Frozen types of one library's exports, resolved once and shared by every dependent module.
+///
+/// The environment holds the value bindings a module would compute for an unaliased wildcard
+/// import of the library, so dependents can reuse them instead of resolving every imported
+/// signature again. Each binding remembers the definition it was resolved from, and
+/// [`lookup_binding`](Self::lookup_binding) only answers for a dependent binding that still
+/// targets that definition.
+#[derive(Debug, Default)]
+pub struct ImportedTypeEnvironment {
+    env: TypeEnvironment,
+    origins: FxHashMap<Name, (String, LocalDefinitionId)>,
+}
+
+impl ImportedTypeEnvironment {
+    /// Resolves the imported value bindings of `module`, which should hold nothing but the
+    /// library's exports bound under their exported names.
+    pub fn from_prepared_module(module: &PreparedModule) -> Self {
+        let (env, _) = InferenceContext::new(module).finish();
+        let origins = module
+            .bindings(PreparedNamespace::Value)
+            .filter_map(|binding| match &binding.target {
+                PreparedBindingTarget::Imported { item, .. } => Some((
+                    binding.visible_name.clone(),
+                    (item.module_identity.clone(), item.definition_id),
+                )),
+                _ => None,
+            })
+            .collect();
+        Self { env, origins }
+    }
+
+    /// Returns the frozen type for `binding` when it imports the definition this environment
+    /// resolved under the same name.
+    pub fn lookup_binding(&self, binding: &PreparedBinding) -> Option<&Type> {
+        let PreparedBindingTarget::Imported { item, .. } = &binding.target else {
+            return None;
+        };
+        let (module_identity, definition_id) = self.origins.get(&binding.visible_name)?;
+        if *definition_id != item.definition_id || *module_identity != item.module_identity {
+            return None;
+        }
+        self.env.lookup(&binding.visible_name)
+    }
+
+    /// Returns the number of frozen bindings.
+    pub fn len(&self) -> usize {
+        self.origins.len()
+    }
+
+    /// Returns true if the library exports no values or functions.
+    pub fn is_empty(&self) -> bool {
+        self.origins.is_empty()
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -4,17 +4,19 @@ use crate::{
     common_supertype as generic_common_supertype, is_object_type, resolve_type_ref_with,
     resolve_type_ref_with_seen,
     ty::{EnumType, UnionCaseType, UnionType},
-    type_satisfies_expected as generic_type_satisfies_expected, Type, TypeEnvironment,
+    type_satisfies_expected as generic_type_satisfies_expected, ImportedTypeEnvironment, Type,
+    TypeEnvironment,
 };
 use nx_diagnostics::{Diagnostic, Label, TextSpan};
 use nx_hir::{
     ast, effective_component_contract_for_name, effective_record_shape_for_name,
     interface_component, interface_enum, interface_function_signature, interface_type_alias,
-    interface_union, is_record_subtype, ExprId, InterfaceItemKind, Item, Name,
+    interface_union, is_record_subtype, ExprId, InterfaceItemKind, Item, Name, PreparedBinding,
     PreparedBindingOrigin, PreparedModule, PreparedNamespace, PropertyEntry, ResolvedPreparedItem,
     UnionCaseDef, UnionDef,
 };
 use rustc_hash::{FxHashMap, FxHashSet};
+use std::sync::Arc;
 
 struct TypeAliasInfo {
     target: ast::TypeRef,
@@ -59,6 +61,8 @@ pub struct InferenceContext<'a> {
     file_name: String,
     /// Type environment (name → type, expr → type)
     env: TypeEnvironment,
+    /// Frozen export types of libraries imported without an alias, consulted after `env`
+    imported: Vec<Arc<ImportedTypeEnvironment>>,
     /// Type errors collected during inference
     diagnostics: Vec<Diagnostic>,
     /// Next type variable ID for inference
@@ -81,10 +85,21 @@ impl<'a> InferenceContext<'a> {
 
     /// Creates a new inference context for a module with a diagnostic file name.
     pub fn with_file_name(module: &'a PreparedModule, file_name: impl Into<String>) -> Self {
+        Self::with_imported_types(module, file_name, Vec::new())
+    }
+
+    /// Creates an inference context that reuses frozen export types for the imported bindings
+    /// they cover instead of resolving those signatures again.
+    pub fn with_imported_types(
+        module: &'a PreparedModule,
+        file_name: impl Into<String>,
+        imported: Vec<Arc<ImportedTypeEnvironment>>,
+    ) -> Self {
         let mut ctx = Self {
             module,
             file_name: file_name.into(),
             env: TypeEnvironment::new(),
+            imported,
             diagnostics: Vec::new(),
             next_var_id: 0,
             function_return_placeholders: FxHashMap::default(),
@@ -130,7 +145,7 @@ impl<'a> InferenceContext<'a> {
 
             // Identifiers look up in environment
             ast::Expr::Ident(name) => {
-                if let Some(ty) = self.env.lookup(name) {
+                if let Some(ty) = self.lookup_name(name) {
                     ty.clone()
                 } else {
                     Type::Error
@@ -242,7 +257,7 @@ impl<'a> InferenceContext<'a> {
             // Member access
             ast::Expr::Member { base, member, span } => {
                 if let Some(name) = self.flattened_expr_name(expr_id) {
-                    if let Some(ty) = self.env.lookup(&name) {
+                    if let Some(ty) = self.lookup_name(&name) {
                         ty.clone()
                     } else if let Some((union_def, case)) =
                         self.union_case_from_qualified_name(&name)
@@ -973,7 +988,7 @@ impl<'a> InferenceContext<'a> {
                     ..
                 } => {
                     self.check_element_bindings_against_function(element, &function, span);
-                    if let Some(func_ty) = self.env.lookup(&element.tag) {
+                    if let Some(func_ty) = self.lookup_name(&element.tag) {
                         if let Type::Function { ret, .. } = func_ty {
                             return (**ret).clone();
                         }
@@ -1624,11 +1639,14 @@ impl<'a> InferenceContext<'a> {
             }
         }
 
-        for (name, expected) in &spec.properties {
-            if !expected.is_required {
-                continue;
-            }
-
+        let mut required = spec
+            .properties
+            .iter()
+            .filter(|(_, expected)| expected.is_required)
+            .map(|(name, _)| name)
+            .collect::<Vec<_>>();
+        required.sort_unstable_by(|lhs, rhs| lhs.as_str().cmp(rhs.as_str()));
+        for name in required {
             let supplied_by_body = content_from_body
                 && spec
                     .content_property
@@ -1730,6 +1748,27 @@ impl<'a> InferenceContext<'a> {
         (self.env, self.diagnostics)
     }
 
+    /// Looks up the type of a name in the environment, then in the frozen imported types.
+    fn lookup_name(&self, name: &Name) -> Option<&Type> {
+        if let Some(ty) = self.env.lookup(name) {
+            return Some(ty);
+        }
+        if self.imported.is_empty() {
+            return None;
+        }
+        let binding = self
+            .module
+            .resolve_binding(PreparedNamespace::Value, name)?;
+        self.imported_binding_type(binding)
+    }
+
+    /// Returns the frozen type for an imported binding, if a frozen environment covers it.
+    fn imported_binding_type(&self, binding: &PreparedBinding) -> Option<&Type> {
+        self.imported
+            .iter()
+            .find_map(|imported| imported.lookup_binding(binding))
+    }
+
     fn register_type_definitions(&mut self) {
         let bindings = self
             .module
@@ -1855,9 +1894,11 @@ impl<'a> InferenceContext<'a> {
     }
 
     fn register_function_signatures(&mut self) {
+        // Bindings covered by a frozen imported environment are already resolved.
         let bindings = self
             .module
             .bindings(PreparedNamespace::Value)
+            .filter(|binding| self.imported_binding_type(binding).is_none())
             .cloned()
             .collect::<Vec<_>>();
 
@@ -1913,6 +1954,7 @@ impl<'a> InferenceContext<'a> {
         let bindings = self
             .module
             .bindings(PreparedNamespace::Value)
+            .filter(|binding| self.imported_binding_type(binding).is_none())
             .cloned()
             .collect::<Vec<_>>();
 
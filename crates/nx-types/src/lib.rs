@@ -135,10 +135,10 @@ pub mod ty;
 
 // Re-export main types
 pub use check::{
-    analyze_prepared_module, analyze_str, check_file, check_str, ModuleArtifact,
-    SourceAnalysisResult, TypeCheckResult, TypeCheckSession,
+    analyze_prepared_module, analyze_prepared_module_with_imports, analyze_str, check_file,
+    check_str, ModuleArtifact, SourceAnalysisResult, TypeCheckResult, TypeCheckSession,
 };
-pub use env::{TypeBinding, TypeEnvironment};
+pub use env::{ImportedTypeEnvironment, TypeBinding, TypeEnvironment};
 pub use infer::{InferenceContext, TypeInference};
 pub use semantics::{
     common_supertype, is_object_type, resolve_type_ref_with, resolve_type_ref_with_seen,
@@ -3,6 +3,7 @@
 //! Defines the core `Type` enum and related types.
 
 use nx_hir::Name;
+use serde::{Deserialize, Serialize};
 use std::fmt;
 use std::hash::{Hash, Hasher};
 
@@ -27,7 +28,7 @@ enum CanonicalPrimitive {
 ///
 /// `Int` is a display-preserving synonym for `I64`, and `Float` for `F64`.
 /// They compare equal and hash identically via custom impls.
-#[derive(Debug, Clone, Copy)]
+#[derive(Debug, Clone, Copy, Serialize, Deserialize)]
 pub enum Primitive {
     /// 32-bit signed integer
     I32,
@@ -148,7 +149,7 @@ impl fmt::Display for Primitive {
 /// A type in the NX type system.
 ///
 /// Types are immutable and can be shared via `Arc` for efficiency.
-#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub enum Type {
     /// Primitive type (i32, i64, int, f32, f64, float, string, bool, void)
     Primitive(Primitive),
@@ -442,7 +443,7 @@ fn write_postfix_type(f: &mut fmt::Formatter<'_>, inner: &Type, suffix: &str) ->
 }
 
 /// Describes an enum type with its members.
-#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub struct EnumType {
     /// Enum name
     pub name: Name,
@@ -451,7 +452,7 @@ pub struct EnumType {
 }
 
 /// Describes a discriminated union type with its cases.
-#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub struct UnionType {
     /// Union name
     pub name: Name,
@@ -469,7 +470,7 @@ impl UnionType {
 }
 
 /// Describes a discriminated union case type.
-#[derive(Debug, Clone, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub struct UnionCaseType {
     /// Owning union name.
     pub union: Name,